@@ -0,0 +1,73 @@
+/**
+ * @file    BlackBox.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   Fault 직전 제어 주기 데이터를 보관하는 RAM 링 버퍼(블랙박스) 헤더 파일
+ * @details 매 제어 주기마다 설정된 채널을 16비트로 압축하여 링 버퍼에 기록하고,
+ * TIM1 Break 발생 시 Post-trigger 구간까지 기록한 뒤 버퍼를 동결합니다.
+ */
+
+#ifndef INC_BLACKBOX_H_
+#define INC_BLACKBOX_H_
+
+#include <stdint.h>
+#include "DataChannel.h"
+
+/** @name 블랙박스 버퍼 크기
+ * @{ */
+#define BB_DEPTH            512u                /**< 기록 주기 수 (2의 거듭제곱, 20kHz 기준 25.6ms) */
+#define BB_DEPTH_MASK       (BB_DEPTH - 1u)     /**< 링 인덱스 마스크 */
+#define BB_CH_MAX           13u                 /**< 최대 채널 수 (샘플당 2byte, 총 13kB) */
+#define BB_POST_TRIG_NUM    32u                 /**< Break 이후 추가로 기록할 주기 수 (차단 응답 관측용) */
+/** @} */
+
+/** @name 블랙박스 상태
+ * @{ */
+#define BB_STATE_RECORD     0u                  /**< 연속 기록 중 */
+#define BB_STATE_POST_TRIG  1u                  /**< Break 발생, Post-trigger 기록 중 */
+#define BB_STATE_FROZEN     2u                  /**< 동결 (판독 가능, vBlackBoxRearm 전까지 유지) */
+/** @} */
+
+/**
+ * @struct sBlackBox
+ * @brief  블랙박스 기록 상태 및 트리거 정보
+ */
+typedef struct {
+	uint16_t uState;            /**< 기록 상태 (BB_STATE_*) */
+	uint16_t uChNum;            /**< 사용 채널 수 (≤ BB_CH_MAX) */
+	uint16_t uHead;             /**< 다음에 기록할 행 인덱스 */
+	uint16_t uTrigIdx;          /**< Break 발생 시점에 기록된 행 인덱스 */
+	uint16_t uPostCnt;          /**< 남은 Post-trigger 기록 주기 수 */
+	uint16_t uTrigState;        /**< Break 발생 시점의 주 상태 */
+	uint16_t uTrigFault;        /**< Break 발생 시점의 래치된 고장 원인 (FAULT_BIT_*) */
+	uint32_t ulRecordCnt;       /**< 재무장 이후 누적 기록 주기 수 (버퍼 유효 길이 판단) */
+} sBlackBox;
+
+/** @brief 블랙박스 상태 객체 외부 참조 */
+extern sBlackBox BlackBox;
+/** @brief 블랙박스 채널 디스크립터 (런타임 변경 가능, 변경 후 vBlackBoxRearm 호출) */
+extern sDataChannel BlackBoxCh[BB_CH_MAX];
+/** @brief 블랙박스 샘플 버퍼 [행][채널] */
+extern int16_t iBlackBoxBuf[BB_DEPTH][BB_CH_MAX];
+
+/** @brief  기본 채널 구성을 설정하고 기록을 시작합니다. */
+extern void vInitBlackBox(void);
+/** @brief  버퍼를 비우고 연속 기록 상태로 되돌립니다. */
+extern void vBlackBoxRearm(void);
+/** @brief  제어 주기마다 호출되어 현재 채널 값을 한 행 기록합니다. */
+extern void vBlackBoxRecord(void);
+/**
+ * @brief  Break 발생 시 트리거 시점을 기록하고 Post-trigger 기록 후 동결하도록 요청합니다.
+ * @param  uState 현재 주 상태
+ * @param  uFault 래치된 고장 원인 비트
+ */
+extern void vBlackBoxTrigger(uint16_t uState, uint16_t uFault);
+/**
+ * @brief  동결된 버퍼에서 트리거 기준 상대 위치의 한 행을 복사합니다.
+ * @param  iAge 트리거 행 기준 상대 위치 (음수: 이전, 0: 트리거, 양수: 이후)
+ * @param  piDst 채널 수만큼의 복사 대상 버퍼
+ * @retval 1: 유효한 행, 0: 동결 전이거나 기록 범위 밖
+ */
+extern uint16_t uBlackBoxRead(int16_t iAge, int16_t* piDst);
+
+#endif /* INC_BLACKBOX_H_ */
@@ -0,0 +1,86 @@
+/**
+ * @file    Can.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   FDCAN1 레지스터 직접 제어 드라이버 및 상태 송신/명령 수신 헤더 파일
+ * @details HAL FDCAN 모듈 없이 FDCAN1(PB8: RX, PB9: TX)을 CAN FD(중재 1Mbps, 데이터 5Mbps, BRS)로 설정합니다.
+ * 상태 프레임은 저속 제어(2kHz)에서 uCANTxMode 분주로 송신하고, 명령 프레임은 메인 루프에서 수신 FIFO를 읽어 처리합니다.
+ *
+ * | 식별자 (11비트) | 방향 | 내용 |
+ * | :--- | :--- | :--- |
+ * | CAN_ID_STATUS + 노드 | 송신 | 상태 프레임 (CanMsg.h) |
+ * | CAN_ID_CMD + 노드 | 수신 | 명령 프레임 (CanMsg.h) |
+ * | CAN_ID_STOP_ALL | 수신 | 전체 정지 (데이터 무관) |
+ *
+ * 하드웨어 필터는 위 두 수신 식별자만 RX FIFO 0에 저장하고 나머지(확장 ID, 원격 프레임 포함)는 모두 거부합니다.
+ * CAN 인터럽트를 사용하지 않으므로 버스의 다른 트래픽은 CPU를 전혀 깨우지 않습니다.
+ * 호스트에서는 Test/test_can이 소프트웨어 버스(Test/CanBus.c)의 FDCAN1 대역 위에서 이 드라이버를 그대로 실행하여 시험합니다.
+ */
+
+#ifndef INC_CAN_H_
+#define INC_CAN_H_
+
+#include <stdint.h>
+#include "CanMsg.h"
+
+/** @name 식별자 할당
+ * @{ */
+#define CAN_NODE_ID         1u                  /**< 이 구동기의 노드 번호 (0 ~ 0x7F) */
+#define CAN_ID_STOP_ALL     0x080u              /**< 전체 정지 식별자 */
+#define CAN_ID_STATUS       0x100u              /**< 상태 프레임 식별자 기준값 */
+#define CAN_ID_CMD          0x200u              /**< 명령 프레임 식별자 기준값 */
+/** @} */
+
+/** @name 비트 타이밍 (FDCAN 커널 클럭 = PCLK1 170MHz)
+ * @{ */
+#define CAN_NBRP            1u                  /**< 중재 구간 분주 */
+#define CAN_NTSEG1          135u                /**< 중재 구간 TSEG1 [tq] (1 + 135 + 34 = 170 tq → 1Mbps, 샘플 시점 80%) */
+#define CAN_NTSEG2          34u                 /**< 중재 구간 TSEG2 [tq] */
+#define CAN_NSJW            34u                 /**< 중재 구간 SJW [tq] */
+#define CAN_DBRP            1u                  /**< 데이터 구간 분주 */
+#define CAN_DTSEG1          26u                 /**< 데이터 구간 TSEG1 [tq] (1 + 26 + 7 = 34 tq → 5Mbps, 샘플 시점 79%) */
+#define CAN_DTSEG2          7u                  /**< 데이터 구간 TSEG2 [tq] */
+#define CAN_DSJW            7u                  /**< 데이터 구간 SJW [tq] */
+/** @} */
+
+/** @name 명령 감시
+ * @{ */
+#define CAN_CMD_TIMEOUT_MS  100u                /**< 구동 허용 상태에서 명령이 끊겼다고 판단하는 시간 [ms] */
+#define CAN_RX_TASK_MAX     3u                  /**< vCanTask 1회 호출당 최대 처리 프레임 수 (RX FIFO 깊이) */
+/** @} */
+
+/** @brief 상태 프레임 기본 송신 분주 (저속 제어 2kHz / 20 = 100Hz) */
+#define CAN_STATUS_DIV      20u
+
+/**
+ * @struct sCan
+ * @brief  CAN 통신 상태 및 통계
+ */
+typedef struct {
+	uint16_t uReady;            /**< 초기화 완료 여부 (저속 제어가 먼저 시작되므로 송신 전에 확인) */
+	uint16_t uSeq;              /**< 상태 프레임 순번 */
+	uint16_t uCmdStat;          /**< 명령 상태 (CAN_CMD_STAT_*) */
+	uint16_t uCmdFlags;         /**< 마지막으로 적용한 명령 플래그 (에지 검출용) */
+	uint32_t ulCmdTick;         /**< 마지막 유효 명령 수신 시각 [ms] */
+	uint32_t ulTxCnt;           /**< 송신 요청한 상태 프레임 수 */
+	uint32_t ulTxFullCnt;       /**< 송신 FIFO가 가득 차 버린 상태 프레임 수 */
+	uint32_t ulRxCnt;           /**< 처리한 명령 프레임 수 */
+	uint32_t ulRxBadCnt;        /**< 거부한 명령 프레임 수 */
+	uint32_t ulTimeoutCnt;      /**< 명령 끊김으로 정지한 횟수 */
+	uint32_t ulBusOffCnt;       /**< Bus-off 복구 횟수 */
+} sCan;
+
+/** @brief CAN 객체 외부 참조 */
+extern sCan Can;
+
+/**
+ * @brief  FDCAN1, 메시지 RAM 필터와 비트 타이밍을 설정하고 버스에 참여합니다.
+ * @note   vInitCommand, vInitParam 이후 호출해야 합니다.
+ */
+extern void vInitCan(void);
+/** @brief  상태 프레임을 송신 FIFO에 넣습니다. (저속 제어 문맥 전용, 비차단) */
+extern void vCanSendStatus(void);
+/** @brief  메인 루프에서 호출되어 명령 프레임을 처리하고, 명령 끊김과 Bus-off를 감시합니다. */
+extern void vCanTask(void);
+
+#endif /* INC_CAN_H_ */
@@ -0,0 +1,117 @@
+/**
+ * @file    CanMsg.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   CAN 상태/명령 프레임의 데이터 필드 형식 및 변환 함수 헤더 파일
+ * @details 하드웨어(HAL/레지스터)에 의존하지 않는 순수 변환 함수만 두어, 호스트에서 같은 소스를 소프트웨어 버스와 함께 컴파일하여
+ * 패킹/언패킹을 검증할 수 있습니다. 모든 다바이트 필드는 리틀 엔디언입니다.
+ *
+ * [상태 프레임] (CAN FD, 16byte)
+ * | 오프셋 | 크기 | 필드 |
+ * | :--- | :--- | :--- |
+ * | 0 | 4 | f32 속도 [RPM] |
+ * | 4 | 4 | f32 q축 전류 [A] |
+ * | 8 | 4 | f32 직류단 전압 [V] |
+ * | 12 | 1 | u8 상태 (IDLE/ALIGN/RUN/FAULT/FLYSTART) |
+ * | 13 | 1 | u8 제어 모드 |
+ * | 14 | 1 | u8 래치된 고장 원인 (FAULT_BIT_*) |
+ * | 15 | 1 | u8 bit0~3: 순번, bit4~7: 명령 상태 (CAN_CMD_STAT_*) |
+ *
+ * [명령 프레임] (CAN FD 또는 Classic, 8byte 이상)
+ * | 오프셋 | 크기 | 필드 |
+ * | :--- | :--- | :--- |
+ * | 0 | 1 | u8 명령 종류 (CAN_CMD_*) |
+ * | 1 | 1 | u8 bit0: 구동 허용, bit1: 고장 리셋 |
+ * | 2 | 2 | 예약 |
+ * | 4 | 4 | f32 설정값 (토크 [Nm], 속도 [RPM], 위치 [rad]) |
+ */
+
+#ifndef INC_CANMSG_H_
+#define INC_CANMSG_H_
+
+#include <stdint.h>
+
+/** @name 데이터 필드 길이 [byte]
+ * @{ */
+#define CAN_STATUS_LEN      16u
+#define CAN_CMD_LEN         8u
+/** @} */
+
+/** @name 명령 종류
+ * @{ */
+#define CAN_CMD_NONE        0u                  /**< 설정값 없음 (구동 허용/리셋 비트만 사용, 감시 갱신용) */
+#define CAN_CMD_TORQUE      1u                  /**< 토크 지령 [Nm] (전류 제어 모드) */
+#define CAN_CMD_SPEED       2u                  /**< 속도 지령 [RPM] (속도 제어 모드) */
+#define CAN_CMD_POSITION    3u                  /**< 위치 지령 [rad] (위치 제어기 미구현, 거부) */
+/** @} */
+
+/** @name 명령 플래그
+ * @{ */
+#define CAN_CMD_FLAG_ENABLE 0x01u               /**< 구동 허용 (0 → 1: 시작, 1 → 0: 정지) */
+#define CAN_CMD_FLAG_RESET  0x02u               /**< 고장 리셋 (0 → 1 에지) */
+/** @} */
+
+/** @name 명령 상태 (상태 프레임 15번 바이트 상위 4비트)
+ * @{ */
+#define CAN_CMD_STAT_IDLE       0u              /**< CAN 명령 미수신 */
+#define CAN_CMD_STAT_ACTIVE     1u              /**< 제한 시간 내 명령 수신 중 */
+#define CAN_CMD_STAT_TIMEOUT    2u              /**< 명령 끊김으로 정지 */
+#define CAN_CMD_STAT_REJECTED   3u              /**< 마지막 명령 거부 (잘못된 종류/값/길이) */
+/** @} */
+
+/**
+ * @struct sCanStatus
+ * @brief  상태 프레임 내용
+ */
+typedef struct {
+	float fWrpm;                /**< 속도 [RPM] */
+	float fIqsr;                /**< q축 전류 [A] */
+	float fVdc;                 /**< 직류단 전압 [V] */
+	uint8_t uState;             /**< 상태 */
+	uint8_t uCtrlMode;          /**< 제어 모드 */
+	uint8_t uFault;             /**< 래치된 고장 원인 */
+	uint8_t uSeq;               /**< 순번 (0~15) */
+	uint8_t uCmdStat;           /**< 명령 상태 (CAN_CMD_STAT_*) */
+} sCanStatus;
+
+/**
+ * @struct sCanCmd
+ * @brief  명령 프레임 내용
+ */
+typedef struct {
+	uint8_t uType;              /**< 명령 종류 (CAN_CMD_*) */
+	uint8_t uFlags;             /**< 명령 플래그 (CAN_CMD_FLAG_*) */
+	float fValue;               /**< 설정값 */
+} sCanCmd;
+
+/**
+ * @brief  상태 프레임 데이터 필드를 만듭니다.
+ * @param  pStatus 상태
+ * @param  pData 출력 (CAN_STATUS_LEN byte)
+ * @retval 없음
+ */
+extern void vCanPackStatus(const sCanStatus* pStatus, uint8_t* pData);
+/**
+ * @brief  상태 프레임 데이터 필드를 해석합니다. (수신측/호스트 검증용)
+ * @param  pData 입력 (CAN_STATUS_LEN byte)
+ * @param  pStatus 상태
+ * @retval 없음
+ */
+extern void vCanUnpackStatus(const uint8_t* pData, sCanStatus* pStatus);
+/**
+ * @brief  명령 프레임 데이터 필드를 만듭니다. (송신측/호스트 검증용)
+ * @param  pCmd 명령
+ * @param  pData 출력 (CAN_CMD_LEN byte)
+ * @retval 없음
+ */
+extern void vCanPackCmd(const sCanCmd* pCmd, uint8_t* pData);
+/**
+ * @brief  명령 프레임 데이터 필드를 해석하고 검증합니다.
+ * @param  pData 입력
+ * @param  uLen 데이터 길이 [byte]
+ * @param  pCmd 명령
+ * @retval 1: 유효, 0: 길이 부족, 알 수 없는 종류 또는 유한하지 않은 설정값
+ */
+extern uint16_t uCanUnpackCmd(const uint8_t* pData, uint16_t uLen, sCanCmd* pCmd);
+
+#endif /* INC_CANMSG_H_ */
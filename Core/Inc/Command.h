@@ -0,0 +1,133 @@
+/**
+ * @file    Command.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   백그라운드(메인 루프/디버거/통신) → 제어 ISR 명령 및 설정값 전달 헤더 파일
+ * @details 시작/정지/리셋은 SPSC 링 버퍼의 명령 이벤트로, 제어 모드와 설정값은 최신값 우편함의 스냅숏으로 전달합니다.
+ * 제어 ISR은 매 주기 시작 시 vCmdFetch에서 한 번만 읽고, 새 스냅숏이 게시된 경우에만 적용하므로 한 주기 안에서는 항상 같은 값을 사용합니다.
+ *
+ * | 입력 (디버거/메인 루프) | 전달 수단 | ISR 적용 대상 |
+ * | :--- | :--- | :--- |
+ * | CmdReq.uStart = 1 | CMD_START 이벤트 | Flag.START = 1 |
+ * | CmdReq.uStop = 1 | CMD_STOP 이벤트 | Flag.START = 0 |
+ * | CmdReq.uReset = 1 | CMD_RESET 이벤트 (요청측 설정값과 ISR 스냅숏도 0으로 초기화) | Flag.RESET = 1 |
+ * | CmdReq.Set.* | 설정값 우편함 | uControlMode, INV.SC.fWrpmRefSet, INV.CC.fIdsrRefSet/fIqsrRefSet/fIqsrSlopeSet, fVdqsrRefSet |
+ * | vCmdThrottlePost(설정값) (제어 ISR, vThrottleUpdate) | 스로틀 설정값 우편함 (CMD_SRC_THROTTLE, 게시 중에는 CmdReq.Set보다 우선) | 위와 같음 |
+ * | uCmdVarWrite(ID, 값) | 값 대기 슬롯 + CMD_VAR_WRITE 이벤트 (VAR_ACC_RW) / CmdReq.Set (VAR_ACC_SET) | 변수 레지스트리 항목 1개 (VAR_ACC_RO는 거절) |
+ * | uCmdPost(CMD_SCOPE_ARM) | CMD_SCOPE_ARM 이벤트 | vScopeArm |
+ *
+ * @note 트리거 필드(uStart/uStop/uReset)는 이벤트를 넣은 뒤 vCmdTask가 0으로 되돌립니다.
+ * Flag와 위 설정값은 ISR 소유이므로 디버거에서 직접 쓰지 않고 CmdReq를 사용합니다.
+ * 설정값 출처는 vCmdFetch 한 곳에서만 고릅니다. 스로틀이 게시 중이면 스로틀 스냅숏을, 해제(vCmdThrottleRelease)되면 CmdReq 스냅숏을 다시 적용합니다.
+ */
+
+#ifndef INC_COMMAND_H_
+#define INC_COMMAND_H_
+
+#include <stdint.h>
+#include "Mailbox.h"
+
+/** @name 명령 이벤트 코드 (항목 하위 16비트, 상위 16비트는 인자)
+ * @{ */
+#define CMD_NONE            0u
+#define CMD_START           1u                  /**< 구동 시작 */
+#define CMD_STOP            2u                  /**< 구동 정지 */
+#define CMD_RESET           3u                  /**< 고장 해제 및 제어기 초기화 */
+#define CMD_VAR_WRITE       4u                  /**< 변수 레지스트리 항목 쓰기 (인자: 변수 ID) */
+#define CMD_SCOPE_ARM       5u                  /**< 스코프 재무장 (샘플 기록과 같은 문맥에서 상태 초기화) */
+/** @} */
+
+/** @name 설정값 출처 (번호가 클수록 우선)
+ * @{ */
+#define CMD_SRC_REQ         0u                  /**< CmdReq.Set (디버거/통신/변수 쓰기) */
+#define CMD_SRC_THROTTLE    1u                  /**< RC 스로틀 (vThrottleUpdate) */
+/** @} */
+
+/** @name 변수 쓰기 결과 (uCmdVarWrite)
+ * @{ */
+#define CMD_VAR_OK          0u
+#define CMD_VAR_ERR_ID      1u                  /**< 없는 변수 ID */
+#define CMD_VAR_ERR_RO      2u                  /**< 읽기 전용 변수 (VAR_ACC_RO) */
+#define CMD_VAR_ERR_VAL     3u                  /**< 값 범위 밖 (제어 모드 등) */
+#define CMD_VAR_ERR_BUSY    4u                  /**< 명령 큐 가득 참 */
+/** @} */
+
+/** @name 명령 큐 구성
+ * @{ */
+#define CMD_QUEUE_SIZE      8u                  /**< 명령 이벤트 큐 크기 (2의 거듭제곱) */
+#define CMD_FETCH_MAX       4u                  /**< 제어 주기당 처리하는 최대 이벤트 수 (실행 시간 상한) */
+/** @} */
+
+/**
+ * @struct sCmdSetpoint
+ * @brief  제어 ISR로 전달되는 설정값 스냅숏
+ */
+typedef struct {
+	float fWrpmRefSet;          /**< 목표 속도 [RPM] */
+	float fIdsrRefSet;          /**< d축 전류 목표값 [A] */
+	float fIqsrRefSet;          /**< q축 전류 목표값 [A] */
+	float fVdqsrRefSet;         /**< 고정 전압 모드 전압 지령 [V] */
+	float fIqsrSlopeSet;        /**< VECTCONTL_MODE q축 전류 지령 기울기 [A/s] (CmdReq 기본값 CC_IQ_SLOPE) */
+	uint16_t uControlMode;      /**< 제어 모드 (*_MODE) */
+	uint16_t uReserved;
+} sCmdSetpoint;
+
+/**
+ * @struct sCmdReq
+ * @brief  디버거 및 메인 루프가 쓰는 명령 요청
+ */
+typedef struct {
+	uint16_t uStart;            /**< 1: 시작 요청 */
+	uint16_t uStop;             /**< 1: 정지 요청 */
+	uint16_t uReset;            /**< 1: 리셋 요청 */
+	uint16_t uReserved;
+	sCmdSetpoint Set;           /**< 설정값 (변경 시 vCmdTask가 게시) */
+} sCmdReq;
+
+/** @brief 명령 요청 외부 참조 (디버거/메인 루프 쓰기용) */
+extern sCmdReq CmdReq;
+/** @brief CmdReq 출처의 최신 설정값 스냅숏 (제어 ISR 소유) */
+extern sCmdSetpoint CmdSet;
+/** @brief 명령 이벤트 큐 (생산자: 메인 루프, 소비자: 제어 ISR) */
+extern sSpscRing CmdQueue;
+
+/**
+ * @brief  현재 제어 모드/설정값으로 명령 요청과 우편함을 초기화합니다.
+ * @note   vInitController 이후 호출해야 합니다. 호출 전 vCmdFetch는 아무 것도 적용하지 않습니다.
+ */
+extern void vInitCommand(void);
+/**
+ * @brief  명령 이벤트를 제어 ISR로 보냅니다. (메인 루프 문맥 전용)
+ * @param  uCode 명령 코드 (CMD_*)
+ * @param  uArg 인자
+ * @retval 1: 성공, 0: 큐 가득 참
+ */
+extern uint16_t uCmdPost(uint16_t uCode, uint16_t uArg);
+/**
+ * @brief  변수 레지스트리 항목 쓰기를 제어 ISR로 보냅니다. (메인 루프 문맥 전용)
+ * @details 값은 ID별 대기 슬롯에 두고 ID만 이벤트로 보냅니다. 적용 전에 같은 ID를 다시 쓰면 마지막 값이 적용됩니다.
+ * 설정값 우편함이 소유하는 항목(VAR_ACC_SET: 목표 속도, 제어 모드)은 CmdReq.Set에 기록하고, 읽기 전용 항목은 거절합니다.
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @param  ulRaw 변수 타입의 원시 비트 (float 비트 패턴 또는 정수)
+ * @retval CMD_VAR_OK 또는 실패 원인 (CMD_VAR_ERR_*)
+ */
+extern uint16_t uCmdVarWrite(uint16_t uId, uint32_t ulRaw);
+/** @brief  메인 루프에서 호출되어 CmdReq의 요청을 이벤트로 바꾸고, 변경된 설정값을 게시합니다. */
+extern void vCmdTask(void);
+/**
+ * @brief  스로틀 설정값 스냅숏을 게시합니다. (제어 ISR, vCmdFetch 이전)
+ * @details 게시한 뒤에는 vCmdThrottleRelease까지 스로틀 출처가 CmdReq.Set보다 우선합니다.
+ * @param  pSet 설정값 스냅숏
+ */
+extern void vCmdThrottlePost(const sCmdSetpoint* pSet);
+/** @brief  스로틀 출처를 해제합니다. 다음 vCmdFetch에서 CmdReq 스냅숏을 다시 적용합니다. (제어 ISR) */
+extern void vCmdThrottleRelease(void);
+/** @brief  제어 주기마다 호출되어 이벤트를 처리하고, 우선순위가 가장 높은 출처의 새 스냅숏을 적용합니다. */
+extern void vCmdFetch(void);
+/**
+ * @brief  현재 출처(CMD_SRC_*)의 설정값 스냅숏을 제어 모드와 목표값에 반영합니다. (제어 ISR)
+ * @note   vInitController가 목표값을 지운 뒤(리셋, IDLE 진입) 호출하여 요청측 설정값과 맞춥니다.
+ */
+extern void vCmdApply(void);
+
+#endif /* INC_COMMAND_H_ */
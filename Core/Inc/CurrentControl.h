@@ -15,6 +15,9 @@
 /** @brief 전류 제어기 차단 주파수 (Bandwidth): 300Hz를 Radian 단위로 변환 */
 #define WC_CC (300.0f * 6.283185307179586476925286766559)
 
+/** @brief VECTCONTL_MODE q축 전류 지령 기본 기울기 [A/s] */
+#define CC_IQ_SLOPE             10.0f
+
 /** @brief 약자속 제어 시작 전압 제한치 (1 / sqrt(3)) */
 #define VLIM_FW                 0.5773502691896257645091487805019 // 1. / sqrt(3)
 
@@ -68,6 +71,7 @@ typedef struct {
 
 	float fIdsrRefSet;          /**< 사용자가 설정한 d축 전류 목표값 */
 	float fIqsrRefSet;          /**< 사용자가 설정한 q축 전류 목표값 */
+	float fIqsrSlopeSet;        /**< VECTCONTL_MODE q축 전류 지령 기울기 [A/s] (명령 모듈이 활성 출처의 스냅숏으로 설정: CmdReq는 CC_IQ_SLOPE, 스로틀은 THR_IQ_SLOPE) */
 
     float fIdqrRefSet;          /**< DQ축 복합 지령 설정값 (필요 시 사용) */
 
@@ -77,15 +81,7 @@ typedef struct {
     // ---------------------------------------------------------
     // 4. PI Controller Gains (전류 제어기 이득)
     // ---------------------------------------------------------
-    // d-axis Controller
-    float fKpdCc;               /**< d축 전류 제어기 비례 이득 */
-    float fKidCc;               /**< d축 전류 제어기 적분 이득 */
-    float fKadCc;               /**< d축 Anti-windup 이득 */
-
-    // q-axis Controller
-    float fKpqCc;               /**< q축 전류 제어기 비례 이득 */
-    float fKiqCc;               /**< q축 전류 제어기 적분 이득 */
-    float fKaqCc;               /**< q축 Anti-windup 이득 */
+    // d/q축 Kp, Ki, Ka는 파라미터 세트(Param.h의 sCtrlParam)로 이동
 
     // ---------------------------------------------------------
     // 5. PI Controller State & Outputs (제어기 상태 및 출력)
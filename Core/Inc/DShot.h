@@ -0,0 +1,184 @@
+/**
+ * @file    DShot.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   DShot 디지털 스로틀 프레임 복호 및 KISS 텔레메트리 프레임 헤더 파일
+ * @details 하드웨어(HAL/레지스터)에 의존하지 않는 순수 복호 함수만 두어, 호스트에서 합성 에지열로 같은 소스를 검증할 수 있습니다 (Test/test_dshot).
+ * 입력은 비트마다 (비트 시작 에지 간 주기, 펄스 시간) 쌍이며 단위는 타이머 틱입니다. (양방향 DShot은 신호가 반전되어 펄스가 Low)
+ *
+ * [프레임] (16bit, MSB 먼저)
+ * | 비트 | 필드 |
+ * | :--- | :--- |
+ * | 15 ~ 5 | 스로틀 값 (0: 정지, 1 ~ 47: 특수 명령, 48 ~ 2047: 스로틀) |
+ * | 4 | 텔레메트리 요청 |
+ * | 3 ~ 0 | CRC = (v ^ (v >> 4) ^ (v >> 8)) & 0xF, v = 상위 12bit (양방향 DShot은 CRC 반전) |
+ *
+ * [비트 판정]
+ * | 조건 | 판정 |
+ * | :--- | :--- |
+ * | 주기 > 1.5 비트 | 프레임 시작 (이전 미완성 프레임은 오류) |
+ * | 주기 < 0.5 비트 | 글리치 (프레임 폐기) |
+ * | High > 9/16 비트 | 1 (공칭 75%) |
+ * | 그 외 | 0 (공칭 37.5%) |
+ *
+ * [양방향 DShot eRPM 응답] (같은 선, Idle High, 비트율 = DShot 비트율 × 5/4)
+ * | 단계 | 내용 |
+ * | :--- | :--- |
+ * | **1. 값** | 전기 1회전 주기 [µs] = m << e (e: 3bit, m: 9bit), 정지/범위 초과는 0xFFF |
+ * | **2. CRC** | 16bit 워드 = (v12 << 4) + (~(v ^ (v >> 4) ^ (v >> 8)) & 0xF) |
+ * | **3. GCR** | 니블 4개(상위부터)를 각각 5bit GCR 코드로 바꿔 20bit |
+ * | **4. 선 부호** | 시작 비트 Low 뒤에 GCR 1 = 레벨 반전, 0 = 유지 (총 21bit, 수신측은 g = L ^ (L >> 1)) |
+ *
+ * [KISS ESC 텔레메트리] (별도 UART 115200bps 8N1, 10byte, 다바이트 필드는 빅 엔디언)
+ * | 오프셋 | 크기 | 필드 |
+ * | :--- | :--- | :--- |
+ * | 0 | 1 | 온도 [°C] |
+ * | 1 | 2 | 전압 [0.01V] |
+ * | 3 | 2 | 전류 [0.01A] |
+ * | 5 | 2 | 소모 용량 [mAh] |
+ * | 7 | 2 | eRPM / 100 |
+ * | 9 | 1 | CRC-8 (다항식 0x07, 초기값 0, 반사 없음, 오프셋 0 ~ 8) |
+ */
+
+#ifndef INC_DSHOT_H_
+#define INC_DSHOT_H_
+
+#include <stdint.h>
+
+/** @name 스로틀 값 구간
+ * @{ */
+#define DSHOT_CMD_MAX       47u                 /**< 특수 명령 최대값 */
+#define DSHOT_THR_MIN       48u                 /**< 스로틀 최소값 */
+#define DSHOT_THR_MAX       2047u               /**< 스로틀 최대값 */
+/** @} */
+
+/** @brief 프레임 비트 수 */
+#define DSHOT_FRAME_BITS    16u
+/** @brief eRPM 응답 선 레벨 비트 수 (시작 비트 + GCR 20bit) */
+#define DSHOT_GCR_BITS      21u
+/** @brief eRPM 응답 정지 값 (전기 주기 최대) */
+#define DSHOT_ERPM_STOP     0x0FFFu
+
+/** @brief KISS 텔레메트리 프레임 길이 [byte] */
+#define KISS_FRAME_LEN      10u
+
+/**
+ * @struct sKissTelem
+ * @brief  KISS 텔레메트리 값 (프레임 단위 그대로)
+ */
+typedef struct {
+	uint8_t uTemp;              /**< 온도 [°C] */
+	uint16_t uVolt;             /**< 전압 [0.01V] */
+	uint16_t uCurr;             /**< 전류 [0.01A] */
+	uint16_t uMah;              /**< 소모 용량 [mAh] */
+	uint16_t uErpm;             /**< eRPM / 100 */
+} sKissTelem;
+
+/**
+ * @struct sDshotDec
+ * @brief  DShot 복호기 상태
+ */
+typedef struct {
+	uint32_t ulBitTicks;        /**< 공칭 비트 주기 [tick] */
+	uint32_t ulGapTicks;        /**< 프레임 시작 판정 주기 [tick] */
+	uint32_t ulGlitchTicks;     /**< 글리치 판정 주기 [tick] */
+	uint32_t ulOneTicks;        /**< 1 판정 High 시간 [tick] */
+	uint16_t uShift;            /**< 수신 중인 비트열 */
+	uint16_t uBitCnt;           /**< 수신한 비트 수 (DSHOT_FRAME_BITS 초과: 다음 프레임 시작 대기) */
+	uint16_t uInvCrc;           /**< 1: 반전 CRC (양방향 DShot) */
+	uint32_t ulFrameCnt;        /**< CRC가 맞은 프레임 수 */
+	uint32_t ulCrcErrCnt;       /**< CRC 오류 프레임 수 */
+	uint32_t ulFrameErrCnt;     /**< 비트 수/글리치 오류 프레임 수 */
+} sDshotDec;
+
+/**
+ * @brief  복호기를 초기화합니다.
+ * @param  pDec 복호기
+ * @param  ulBitTicks 공칭 비트 주기 [tick] (타이머 클럭 / 비트율)
+ * @param  uInvCrc 1: 반전 CRC (양방향 DShot)
+ * @retval 없음
+ */
+extern void vDshotDecInit(sDshotDec* pDec, uint32_t ulBitTicks, uint16_t uInvCrc);
+/**
+ * @brief  비트 하나(상승 → 하강 에지)를 입력합니다.
+ * @param  pDec 복호기
+ * @param  ulPeriod 직전 상승 에지 이후 이번 상승 에지까지 [tick]
+ * @param  ulHigh High 시간 [tick]
+ * @param  pFrame 완성된 프레임 (반환값 1일 때만 유효)
+ * @retval 1: CRC가 맞는 프레임 완성, 0: 진행 중 또는 오류
+ */
+extern uint16_t uDshotDecBit(sDshotDec* pDec, uint32_t ulPeriod, uint32_t ulHigh, uint16_t* pFrame);
+/**
+ * @brief  (주기, High) 쌍 링 버퍼에서 기록 위치 바로 앞의 프레임 하나만 따로 복호합니다.
+ * @details 기준 복호기와 같은 비트 주기/CRC 극성의 임시 복호기에 마지막 DSHOT_FRAME_BITS쌍을 넣어,
+ * uDshotDecBit이 1을 반환한 경우만 유효로 봅니다. 첫 쌍이 프레임 앞 공백이어야 하므로 잘린 프레임도 거절합니다.
+ * 기준 복호기의 상태와 통계는 바꾸지 않으므로 다른 문맥에서 같은 링을 복호하는 중에도 호출할 수 있습니다.
+ * @param  pDec 기준 복호기 (비트 주기, CRC 극성만 사용)
+ * @param  pRing 링 버퍼 (짝수 위치: 주기, 홀수 위치: High 시간)
+ * @param  uMask 링 버퍼 크기 - 1 (크기는 2의 거듭제곱, 2 × DSHOT_FRAME_BITS 이상)
+ * @param  uEnd 기록 위치 (짝수)
+ * @param  pFrame 프레임 (반환값 1일 때만 유효)
+ * @retval 1: 마지막 프레임 CRC 일치, 0: 오류
+ */
+extern uint16_t uDshotDecLast(const sDshotDec* pDec, const volatile uint32_t* pRing, uint16_t uMask, uint16_t uEnd, uint16_t* pFrame);
+/**
+ * @brief  스로틀 값과 텔레메트리 비트로 프레임을 만듭니다. (송신측/호스트 검증용)
+ * @param  uValue 스로틀 값 (0 ~ 2047)
+ * @param  uTelem 텔레메트리 요청 (0/1)
+ * @param  uInvCrc 1: 반전 CRC (양방향 DShot)
+ * @retval 16bit 프레임
+ */
+extern uint16_t uDshotPack(uint16_t uValue, uint16_t uTelem, uint16_t uInvCrc);
+/**
+ * @brief  전기 1회전 주기를 eRPM 응답 워드로 만듭니다.
+ * @param  ulPeriodUs 전기 1회전 주기 [µs] (0x1FF << 7 초과는 정지로 표시)
+ * @retval 16bit 워드 (반전 CRC 포함)
+ */
+extern uint16_t uDshotErpmEncode(uint32_t ulPeriodUs);
+/**
+ * @brief  eRPM 응답 워드에서 전기 1회전 주기를 꺼냅니다. (수신측/호스트 검증용)
+ * @param  uWord 16bit 워드
+ * @retval 전기 1회전 주기 [µs]
+ */
+extern uint32_t ulDshotErpmDecode(uint16_t uWord);
+/**
+ * @brief  16bit 워드를 GCR 부호화하여 선 레벨 비트열로 만듭니다.
+ * @param  uWord 16bit 워드
+ * @retval 선 레벨 (bit20 = 시작 비트 ~ bit0, 1 = High)
+ */
+extern uint32_t ulDshotGcrEncode(uint16_t uWord);
+/**
+ * @brief  선 레벨 비트열을 GCR 복호하고 반전 CRC를 검사합니다. (수신측/호스트 검증용)
+ * @param  ulLevels 선 레벨 (bit20 = 시작 비트 ~ bit0)
+ * @param  pWord 16bit 워드 (반환값 1일 때만 유효)
+ * @retval 1: 유효, 0: GCR 코드 또는 CRC 오류
+ */
+extern uint16_t uDshotGcrDecode(uint32_t ulLevels, uint16_t* pWord);
+/**
+ * @brief  KISS 텔레메트리 CRC-8 (다항식 0x07)
+ * @param  pData 데이터
+ * @param  uLen 길이 [byte]
+ * @retval CRC
+ */
+extern uint8_t uKissCrc8(const uint8_t* pData, uint16_t uLen);
+/**
+ * @brief  KISS 텔레메트리 프레임을 만듭니다.
+ * @param  pT 텔레메트리 값
+ * @param  pOut 출력 (KISS_FRAME_LEN byte)
+ * @retval 프레임 길이 [byte]
+ */
+extern uint16_t uKissBuild(const sKissTelem* pT, uint8_t* pOut);
+/**
+ * @brief  KISS 텔레메트리 프레임을 해석합니다. (수신측/호스트 검증용)
+ * @param  pIn 프레임 (KISS_FRAME_LEN byte)
+ * @param  pT 텔레메트리 값 (반환값 1일 때만 유효)
+ * @retval 1: 유효, 0: CRC 오류
+ */
+extern uint16_t uKissParse(const uint8_t* pIn, sKissTelem* pT);
+
+/** @brief 프레임의 스로틀 값 (0 ~ 2047) */
+#define DSHOT_VALUE(f)      ((uint16_t)((f) >> 5))
+/** @brief 프레임의 텔레메트리 요청 비트 */
+#define DSHOT_TELEM(f)      ((uint16_t)(((f) >> 4) & 1u))
+
+#endif /* INC_DSHOT_H_ */
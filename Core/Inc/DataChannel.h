@@ -0,0 +1,85 @@
+/**
+ * @file    DataChannel.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   기록/모니터링 대상 변수를 주소·타입·스케일로 기술하는 공통 채널 디스크립터 헤더 파일
+ * @details 블랙박스, 스코프, 텔레메트리 등 여러 모듈이 같은 방식으로 임의의 전역 변수를 읽어
+ * 16비트 정수 샘플로 압축할 수 있도록 채널 디스크립터와 인라인 읽기 함수를 정의합니다.
+ *
+ * | 타입 | 원본 변수형 | 비고 |
+ * | :--- | :--- | :--- |
+ * | **DCH_TYPE_FLOAT** | float | 제어 변수 대부분 (전류, 전압, 속도, 각도) |
+ * | **DCH_TYPE_INT16** | int16_t | |
+ * | **DCH_TYPE_UINT16** | uint16_t | 상태, 플래그, 카운터 |
+ * | **DCH_TYPE_INT32** | int32_t | |
+ * | **DCH_TYPE_UINT32** | uint32_t | 사이클 카운트 등 |
+ */
+
+#ifndef INC_DATACHANNEL_H_
+#define INC_DATACHANNEL_H_
+
+#include <stdint.h>
+
+/** @name 채널 원본 변수 타입
+ * @{ */
+#define DCH_TYPE_FLOAT      0u
+#define DCH_TYPE_INT16      1u
+#define DCH_TYPE_UINT16     2u
+#define DCH_TYPE_INT32      3u
+#define DCH_TYPE_UINT32     4u
+/** @} */
+
+/**
+ * @struct sDataChannel
+ * @brief  기록 대상 변수 1개를 기술하는 채널 디스크립터
+ * @details 변환값 = 원본 값 × fScale + fOffset (곱셈-덧셈 1회). 16비트 샘플은 이를 포화한 값이며, 복원 시 (샘플 - fOffset) / fScale.
+ * DAC 출력처럼 코드 중심이 필요한 경우 fOffset에 중심 코드를 지정합니다.
+ */
+typedef struct {
+	const volatile void* pAddr; /**< 원본 변수 주소 (0: 미사용 채널, 항상 0 기록) */
+	uint16_t uType;             /**< 원본 변수 타입 (DCH_TYPE_*) */
+	float fScale;               /**< 물리량 → 정수 코드 변환 계수 (예: 전류 1000 → mA 단위) */
+	float fOffset;              /**< 변환 후 더할 오프셋 코드 (예: DAC 중심 2048) */
+} sDataChannel;
+
+/**
+ * @brief  채널이 가리키는 변수를 타입에 맞게 읽어 float로 반환합니다.
+ * @param  pCh 채널 디스크립터 포인터
+ * @retval 원본 변수 값
+ */
+static inline float fReadDataChannel(const sDataChannel* pCh){
+	if(pCh->pAddr == 0) return 0.0f;
+
+	switch(pCh->uType){
+	case DCH_TYPE_INT16:	return (float)(*(const volatile int16_t*)pCh->pAddr);
+	case DCH_TYPE_UINT16:	return (float)(*(const volatile uint16_t*)pCh->pAddr);
+	case DCH_TYPE_INT32:	return (float)(*(const volatile int32_t*)pCh->pAddr);
+	case DCH_TYPE_UINT32:	return (float)(*(const volatile uint32_t*)pCh->pAddr);
+	default:				return *(const volatile float*)pCh->pAddr;
+	}
+}
+
+/**
+ * @brief  채널 값에 스케일과 오프셋을 적용합니다.
+ * @param  pCh 채널 디스크립터 포인터
+ * @retval 원본 값 × fScale + fOffset
+ */
+static inline float fScaleDataChannel(const sDataChannel* pCh){
+	return fReadDataChannel(pCh) * pCh->fScale + pCh->fOffset;
+}
+
+/**
+ * @brief  채널 값을 스케일링하여 포화된 16비트 정수 샘플로 변환합니다.
+ * @param  pCh 채널 디스크립터 포인터
+ * @retval 16비트 샘플
+ */
+static inline int16_t iPackDataChannel(const sDataChannel* pCh){
+	float fVal = fScaleDataChannel(pCh);
+
+	if(fVal > 32767.0f)			fVal = 32767.0f;
+	else if(fVal < -32768.0f)	fVal = -32768.0f;
+
+	return (int16_t)fVal;
+}
+
+#endif /* INC_DATACHANNEL_H_ */
@@ -0,0 +1,80 @@
+/**
+ * @file    EscTelem.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   ESC 텔레메트리(KISS 형식) 생성 및 USART2 DMA 송신 헤더 파일
+ * @details 저속 제어(2kHz)에서 제어 ISR이 이미 계산한 값만 읽어 직류 전류, 소모 용량, 온도, eRPM을 만들고
+ * KISS 프레임(DShot.h)을 DMA로 송신합니다. 20kHz 제어 경로에는 코드를 추가하지 않습니다.
+ *
+ * | 항목 | 계산 |
+ * | :--- | :--- |
+ * | **직류 전류** | 제어 주기 배터리 전류 추정값 (PowerLimit.h, 1.5·(Vd·Id + Vq·Iq) / Vdc) |
+ * | **소모 용량** | Idc > 0 구간만 적분 [mAh] |
+ * | **온도** | ADC5 내부 온도 센서 (공장 보정값 TS_CAL1/TS_CAL2, IIR 필터) |
+ * | **eRPM** | \|fWrpmSC\| × 극쌍수 |
+ *
+ * | 송신 모드 | 동작 |
+ * | :--- | :--- |
+ * | **ESC_TELEM_OFF** | 송신 안 함 (값 계산은 계속) |
+ * | **ESC_TELEM_PERIODIC** | uDiv 저속 주기마다 1 프레임 (기본 2 = 1kHz, 115200bps에서 10byte = 0.87ms) |
+ * | **ESC_TELEM_REQUEST** | DShot 프레임의 텔레메트리 요청 비트마다 1 프레임 |
+ *
+ * 송신 DMA가 아직 이전 프레임을 보내는 중이면 이번 프레임은 건너뜁니다 (ulBusyCnt).
+ */
+
+#ifndef INC_ESCTELEM_H_
+#define INC_ESCTELEM_H_
+
+#include <stdint.h>
+#include "DShot.h"
+
+/** @name 송신 모드
+ * @{ */
+#define ESC_TELEM_OFF       0u
+#define ESC_TELEM_PERIODIC  1u
+#define ESC_TELEM_REQUEST   2u
+/** @} */
+
+/** @name 구성
+ * @{ */
+#define ESC_TELEM_BAUD      115200UL            /**< KISS 텔레메트리 통신 속도 [bps] */
+#define ESC_KER_CLK         170000000UL         /**< USART2 커널 클럭 (PCLK1) [Hz] */
+#define ESC_TELEM_TS        0.0005f             /**< 호출 주기 (저속 제어 2kHz) [s] */
+#define ESC_TELEM_DIV_MIN   2u                  /**< 최소 송신 분주 (1kHz, 프레임 송신 시간 0.87ms) */
+#define ESC_TEMP_ALPHA      0.01f               /**< 온도 IIR 계수 (시정수 약 50ms) */
+/** @} */
+
+/**
+ * @struct sEscTelem
+ * @brief  ESC 텔레메트리 설정 및 상태
+ */
+typedef struct {
+	uint16_t uMode;             /**< 송신 모드 (ESC_TELEM_*) */
+	uint16_t uDiv;              /**< 주기 송신 분주 (ESC_TELEM_DIV_MIN 이상) */
+	uint16_t uDivCnt;           /**< 분주 카운터 */
+	uint16_t uReady;            /**< 초기화 완료 여부 */
+	float fIdc;                 /**< 직류 전류 추정 [A] */
+	float fMah;                 /**< 소모 용량 [mAh] */
+	float fTempC;               /**< 온도 [°C] */
+	float fErpm;                /**< 전기 회전수 [eRPM] */
+	float fTsSlope;             /**< 온도 센서 기울기 [°C/LSB] (보정값에서 계산) */
+	float fTsOffset;            /**< 온도 센서 오프셋 [°C] */
+	sKissTelem Kiss;            /**< 마지막 송신 값 */
+	uint32_t ulFrameCnt;        /**< 송신한 프레임 수 */
+	uint32_t ulBusyCnt;         /**< 송신 중이라 건너뛴 프레임 수 */
+} sEscTelem;
+
+/** @brief ESC 텔레메트리 객체 외부 참조 */
+extern sEscTelem EscTelem;
+
+/**
+ * @brief  USART2 송신(PB3), DMA2_CH3, ADC5 온도 센서를 초기화합니다.
+ * @note   MX_DMA_Init 이후 호출해야 합니다.
+ */
+extern void vInitEscTelem(void);
+/**
+ * @brief  저속 제어(2kHz)에서 호출되어 텔레메트리 값을 갱신하고 프레임을 송신합니다.
+ */
+extern void vEscTelemUpdate(void);
+
+#endif /* INC_ESCTELEM_H_ */
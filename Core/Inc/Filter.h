@@ -85,4 +85,13 @@ extern float IIR1Update(IIR1 *p_gIIR, float input);
  */
 extern float IIR2Update(IIR2 *p_gIIR, const float input);
 
+/**
+ * @brief  2차 IIR 필터의 상태 변수를 주어진 값의 정상 상태(DC)로 미리 설정합니다.
+ * @details 필터를 0이 아닌 값에서 시작해야 할 때(예: 회전 중 재기동) 출력 과도 응답을 없애기 위해 사용합니다.
+ * @param  p_gIIR 설정할 IIR2 구조체 포인터
+ * @param  value 정상 상태 입력/출력값
+ * @retval 없음
+ */
+extern void presetIIR2(IIR2 *p_gIIR, float value);
+
 #endif /* INC_FILTER_H_ */
@@ -0,0 +1,122 @@
+/**
+ * @file    FlashLog.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   Bank 2 플래시에 고장/이벤트 기록을 남기는 비차단(Non-stalling) 로그 헤더 파일
+ * @details 코드는 Bank 1에서 실행되고 로그는 Bank 2 마지막 32kB(16 페이지)에 기록하여
+ * 소거/프로그램 중에도 Bank 1 명령어 인출이 멈추지 않도록 합니다 (Read-While-Write).
+ * 레코드는 32byte 고정 길이이며, 시퀀스 번호와 CRC-32로 유효성을 판정합니다.
+ */
+
+#ifndef INC_FLASHLOG_H_
+#define INC_FLASHLOG_H_
+
+#include <stdint.h>
+
+/** @name 로그 영역 (링커 스크립트 FLASHLOG 영역과 일치해야 함)
+ * @{ */
+#define FLOG_BASE_ADDR      0x08078000UL        /**< 로그 영역 시작 주소 (Bank 2, 페이지 112) */
+#define FLOG_PAGE_SIZE      2048u               /**< 페이지 크기 (Dual Bank 모드) [byte] */
+#define FLOG_PAGE_NUM       16u                 /**< 로그 영역 페이지 수 (32kB) */
+#define FLOG_PAGE_FIRST     112u                /**< Bank 2 내 첫 페이지 번호 */
+#define FLOG_REC_SIZE       32u                 /**< 레코드 크기 [byte] (8byte 프로그램 단위 × 4) */
+#define FLOG_REC_PER_PAGE   (FLOG_PAGE_SIZE / FLOG_REC_SIZE)
+#define FLOG_REC_NUM        (FLOG_PAGE_NUM * FLOG_REC_PER_PAGE)
+#define FLOG_PAYLOAD_SIZE   20u                 /**< 레코드당 데이터 크기 [byte] */
+#define FLOG_QUEUE_NUM      8u                  /**< 기록 대기 큐 크기 (2의 거듭제곱) */
+/** @} */
+
+/** @name 레코드 종류
+ * @{ */
+#define FLOG_TYPE_FAULT     1u                  /**< 고장 기록 (sFlashLogFault) */
+#define FLOG_TYPE_EVENT     2u                  /**< 일반 이벤트 */
+#define FLOG_TYPE_CALIB     3u                  /**< 보정값 (sFlashLogCalib, 전류 ADC 오프셋) */
+/** @} */
+
+/** @name 로그 기록 상태
+ * @{ */
+#define FLOG_STATE_DISABLE  0u                  /**< 사용 불가 (Single Bank 옵션 등) */
+#define FLOG_STATE_IDLE     1u                  /**< 대기 */
+#define FLOG_STATE_ERASE    2u                  /**< 페이지 소거 진행 중 */
+#define FLOG_STATE_PROGRAM  3u                  /**< 더블워드 프로그램 진행 중 */
+/** @} */
+
+/**
+ * @struct sFlashLogRec
+ * @brief  플래시에 기록되는 32byte 레코드
+ */
+typedef struct {
+	uint32_t ulSeq;                             /**< 시퀀스 번호 (1부터 증가, 0xFFFFFFFF: 빈 슬롯) */
+	uint16_t uType;                             /**< 레코드 종류 (FLOG_TYPE_*) */
+	uint16_t uLen;                              /**< 유효 데이터 길이 [byte] */
+	uint8_t  uPayload[FLOG_PAYLOAD_SIZE];       /**< 데이터 */
+	uint32_t ulCrc;                             /**< 앞 28byte의 CRC-32 */
+} sFlashLogRec;
+
+/**
+ * @struct sFlashLogFault
+ * @brief  FLOG_TYPE_FAULT 레코드 데이터 (20byte)
+ */
+typedef struct {
+	uint16_t uFaultFirst;                       /**< 최초 고장 원인 (FAULT_BIT_*) */
+	uint16_t uFaultLatch;                       /**< 래치된 고장 원인 */
+	uint16_t uTripSrc;                          /**< 하드웨어 비교기 출력 (HW_TRIP_*) */
+	uint16_t uState;                            /**< 고장 발생 시 주 상태 */
+	int16_t  iIa, iIb, iIc;                     /**< 상전류 [mA] */
+	int16_t  iVdc;                              /**< 직류단 전압 [10mV] */
+	int16_t  iWrpm;                             /**< 속도 [RPM] */
+	uint16_t uReserved;
+} sFlashLogFault;
+
+/**
+ * @struct sFlashLogCalib
+ * @brief  FLOG_TYPE_CALIB 레코드 데이터 (16byte)
+ */
+typedef struct {
+	float fIaOffset;                            /**< A상 전류 ADC 오프셋 [count] */
+	float fIbOffset;                            /**< B상 전류 ADC 오프셋 [count] */
+	float fIcOffset;                            /**< C상 전류 ADC 오프셋 [count] */
+	uint32_t ulReserved;
+} sFlashLogCalib;
+
+/**
+ * @struct sFlashLog
+ * @brief  로그 기록 상태 및 통계
+ */
+typedef struct {
+	uint16_t uState;                            /**< 기록 상태 (FLOG_STATE_*) */
+	uint16_t uRecIdx;                           /**< 다음에 기록할 슬롯 번호 (0 ~ FLOG_REC_NUM-1) */
+	uint16_t uDwIdx;                            /**< 현재 레코드에서 프로그램 중인 더블워드 번호 (0~3) */
+	uint16_t uQHead, uQTail;                    /**< 대기 큐 인덱스 (Push: Head, Pop: Tail) */
+	uint32_t ulSeq;                             /**< 다음 레코드 시퀀스 번호 */
+	uint32_t ulWriteCnt;                        /**< 기록 완료 레코드 수 */
+	uint32_t ulDropCnt;                         /**< 큐가 가득 차 버려진 레코드 수 */
+	uint32_t ulErrCnt;                          /**< 플래시 오류 발생 횟수 */
+	uint32_t ulBurstOverrunStart;               /**< 기록 시작 시점 ulOverrunCnt */
+	uint32_t ulBurstOverrun;                    /**< 직전 기록 버스트 동안 발생한 제어 주기 초과 횟수 (0이어야 정상) */
+} sFlashLog;
+
+/** @brief 플래시 로그 상태 객체 외부 참조 */
+extern sFlashLog FlashLog;
+
+/** @brief  Dual Bank 여부를 확인하고 로그 영역을 스캔하여 다음 기록 위치를 찾습니다. */
+extern void vInitFlashLog(void);
+/**
+ * @brief  레코드를 기록 대기 큐에 넣습니다. (ISR 포함 모든 문맥에서 호출 가능)
+ * @param  uType 레코드 종류 (FLOG_TYPE_*)
+ * @param  pData 데이터 포인터
+ * @param  uLen 데이터 길이 [byte] (FLOG_PAYLOAD_SIZE 초과분은 잘림)
+ * @retval 1: 성공, 0: 큐 가득 참 또는 사용 불가
+ */
+extern uint16_t uFlashLogPush(uint16_t uType, const void* pData, uint16_t uLen);
+/** @brief  메인 루프에서 호출되어 소거/프로그램을 한 단계씩 진행합니다. (대기 없음) */
+extern void vFlashLogTask(void);
+/**
+ * @brief  지정한 종류의 가장 최근 유효 레코드를 읽습니다.
+ * @param  uType 레코드 종류
+ * @param  pRec 결과 레코드
+ * @retval 1: 찾음, 0: 없음
+ */
+extern uint16_t uFlashLogReadLatest(uint16_t uType, sFlashLogRec* pRec);
+
+#endif /* INC_FLASHLOG_H_ */
@@ -20,12 +20,29 @@
 #define SPD_FAULT_LEV		10000.0f    /**< 과속도 차단 레벨 [RPM] */
 /** @} */
 
+/** @name 하드웨어 차단 임계치 (COMP + DAC3 → TIM1 Break)
+ * @details 소프트웨어 보호(CURR_FAULT_LEV 등)보다 높게 설정하여 1차 보호는 하드웨어가, 2차 보호는 소프트웨어가 담당합니다.
+ * @{ */
+#define HW_CURR_TRIP_LEV    15.0f       /**< 하드웨어 과전류 차단 레벨 (A, B상 정방향만, 부방향/C상은 소프트웨어 보호) [A] */
+#define HW_VDC_TRIP_LEV     18.0f       /**< 하드웨어 직류단 과전압 차단 레벨 [V] */
+#define HW_ADC_OFFSET_NOM   2048.0f     /**< 오프셋 보정 전 사용할 공칭 전류 센서 오프셋 [ADC count] */
+/** @} */
+
+/** @name 하드웨어 차단 원인 비트 (sFault_Info.uTripSrc)
+ * @{ */
+#define HW_TRIP_NONE        0x0000u     /**< 하드웨어 차단 없음 (소프트웨어 Break) */
+#define HW_TRIP_OC_A        0x0001u     /**< COMP3 (PA0, A상 정방향 과전류) */
+#define HW_TRIP_OC_B        0x0002u     /**< COMP1 (PA1, B상 정방향 과전류) */
+#define HW_TRIP_OV          0x0004u     /**< COMP2 (PA3, 직류단 과전압) */
+/** @} */
+
 /** @name 시스템 주 상태 제어 (System States)
  * @{ */
 #define IDLE_STATE			0u          /**< 대기 상태 */
 #define ALIGN_STATE			1u          /**< 위치 정렬(Align) 상태 */
 #define RUN_STATE			2u          /**< 운전 상태 */
 #define FAULT_STATE			3u          /**< 결함 발생 상태 */
+#define FLYSTART_STATE		4u          /**< 회전 중 재기동(Flying Start) 판별 상태 */
 /** @} */
 
 /** @name 애플리케이션 타입 정의 */
@@ -52,7 +69,9 @@ extern float fInvVdc;                           /**< 직류단 전압의 역수
 
 extern float fDutyTest1, fDutyTest2, fDutyTest3; /**< 듀티 테스트용 변수 */
 
-extern uint16_t uControlMode;                   /**< 현재 제어 모드 (속도, 전류 등) */
+extern uint16_t uControlMode;                   /**< 현재 제어 모드 (속도, 전류 등, 제어 ISR 소유: CmdReq로 변경) */
+extern float fVdqsrRefSet;                      /**< 고정 전압 모드 전압 지령 [V] (제어 ISR 소유: CmdReq로 변경) */
+extern uint16_t uCurrState;                     /**< 현재 주 상태 (IDLE_STATE 등) */
 extern uint16_t uMaxCountSampHalf;              /**< PWM 샘플링 관련 카운트 값 */
 extern uint16_t uBootStrapEnd;                  /**< 부트스트랩 충전 완료 여부 */
 
@@ -118,10 +137,15 @@ extern void vSwitchOffSettingTIM(TIM_HandleTypeDef *htim);
 /** @name Fault 관련 플래그 */
 extern uint16_t SW_Fault, TZ_Fault;             /**< 소프트웨어적 결함 및 하드웨어 트리거(Trip Zone) 결함 플래그 */
 
-/* 엔코더 및 속도 측정 관련 변수 */
-extern volatile uint32_t uFrequency, uLast_Capture_Time;
-extern volatile float fDuty_Cycle;
+/** @name 하드웨어 1차 보호 레벨 (초기값은 *_TRIP_LEV 매크로, 소프트웨어 2차 레벨은 Param.h의 sCtrlParam) */
+extern float fHwCurrTripLev, fHwVdcTripLev;     /**< 하드웨어 1차 보호 레벨 [A], [V] */
+
+/** @name 제어 ISR 실행 시간 감시 (DWT 사이클 카운터) */
+extern uint32_t ulControlCycles;                /**< 직전 vControl 실행 사이클 수 */
+extern float fElapsedTimeUs;                    /**< 직전 vControl 실행 시간 [µs] */
+extern uint32_t ulOverrunCnt;                   /**< 제어 주기 초과(Deadline Miss) 누적 횟수 */
 
+/* 엔코더 및 속도 측정 관련 함수 */
 /**
  * @brief  엔코더 인터페이스를 초기화합니다.
  * @param  htim 엔코더 입력용 타이머 핸들러
@@ -5,11 +5,15 @@
  * @brief   MCU 내부 DAC(Digital-to-Analog Converter) 제어를 위한 헤더 파일
  * @details 실시간 제어 변수(전류, 속도 등)를 오실로스코프로 관측하기 위해
  * 내부 DAC를 통해 아날로그 전압으로 출력하는 기능을 정의합니다.
+ * 출력 시점은 TIM1 업데이트에 동기된 TIM3 TRGO로 고정되며, DAC 데이터는 DMA로 전달됩니다.
  */
 
 #ifndef INC_INTDAC_H_
 #define INC_INTDAC_H_
 
+#include <stdint.h>
+#include "DataChannel.h"
+
 /** @brief DAC의 기준 전압 (Reference Voltage) [V] */
 #define VREF                3.3f
 
@@ -19,12 +23,33 @@
 /** @brief 전압당 DAC 코드 변환 상수 (Codes/Volt) */
 #define DAC_CODES_PER_VOLT  (DAC_CODES_FULL / VREF)
 
+/** @brief DAC 출력 중심 코드 (1.65V) */
+#define DAC_CODE_CENTER     2048.0f
+
+/** @brief DAC 모니터링 채널 수 (DAC1_CH1, DAC1_CH2, DAC2_CH1) */
+#define INT_DAC_CH_NUM      3u
+
+/**
+ * @brief DAC 채널 디스크립터 {주소, 타입, 스케일[code/단위], 오프셋[code]}
+ * @details 출력 코드 = 원본 값 × fScale + fOffset (0 ~ 4095 포화)
+ */
+extern sDataChannel IntDacCh[INT_DAC_CH_NUM];
+
 /**
  * @brief  내부 DAC 주변장치를 초기화하고 출력 채널을 설정합니다.
  * @retval 없음
  */
 void vInitIntDac();
 
+/**
+ * @brief  변수 레지스트리 ID로 DAC 채널을 지정합니다. (중심 코드 1.65V 기준)
+ * @param  uCh DAC 채널 (0 ~ INT_DAC_CH_NUM-1)
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @param  fUnitPerVolt 출력 1V당 변수 값 [단위/V]
+ * @retval 1: 성공, 0: 잘못된 채널, ID 또는 스케일
+ */
+extern uint16_t uIntDacSelect(uint16_t uCh, uint16_t uId, float fUnitPerVolt);
+
 /**
  * @brief  지정된 변수를 DAC 레지스터에 써서 아날로그 전압으로 출력합니다.
  * @details 모니터링이 필요한 변수를 스케일링하여 실시간 루프 내에서 호출됩니다.
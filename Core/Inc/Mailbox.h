@@ -0,0 +1,96 @@
+/**
+ * @file    Mailbox.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 ISR과 백그라운드 코드 사이의 잠금 없는(Lock-free) 단일 생산자/단일 소비자 통신 헤더 파일
+ * @details 인터럽트 금지 없이 명시적 메모리 배리어(__DMB)로 기록 순서를 보장하는 두 가지 통신 수단을 제공합니다.
+ *
+ * | 종류 | 용도 | 특성 |
+ * | :--- | :--- | :--- |
+ * | **sSpscRing** | 명령 이벤트 (시작, 정지, 리셋 등) | 32비트 항목 FIFO, 누락 없음, 가득 차면 생산자 쪽에서 실패 |
+ * | **sMbxLatest** | 설정값/상태 스냅숏 | 2슬롯 최신값 우편함, 중간 값은 덮어씀, 소비자는 항상 일관된 한 벌을 읽음 |
+ *
+ * @note 각 객체는 생산자 1개, 소비자 1개 문맥(예: 메인 루프 → 제어 ISR)에서만 사용해야 합니다.
+ */
+
+#ifndef INC_MAILBOX_H_
+#define INC_MAILBOX_H_
+
+#include <stdint.h>
+
+/**
+ * @struct sSpscRing
+ * @brief  단일 생산자/단일 소비자 32비트 링 버퍼
+ * @details uHead는 생산자만, uTail은 소비자만 갱신합니다. 두 카운터는 자유 증가(Free-running)하며
+ * 항목 수는 (uHead - uTail)입니다. 크기는 2의 거듭제곱이어야 합니다.
+ */
+typedef struct {
+	volatile uint16_t uHead;    /**< 다음 기록 위치 (생산자 소유) */
+	volatile uint16_t uTail;    /**< 다음 판독 위치 (소비자 소유) */
+	uint16_t uMask;             /**< 크기 - 1 */
+	uint32_t* pBuf;             /**< 항목 버퍼 */
+	uint32_t ulFullCnt;         /**< 가득 차서 버려진 항목 수 (생산자 소유) */
+} sSpscRing;
+
+/**
+ * @struct sMbxLatest
+ * @brief  2슬롯 최신값 우편함
+ * @details 생산자는 게시되지 않은 슬롯에 기록한 뒤 배리어 후 ulSeq를 증가시켜 게시합니다.
+ * 소비자는 ulSeq의 짝/홀로 게시된 슬롯을 읽고, 읽는 동안 ulSeq가 바뀌었으면 다시 읽습니다.
+ * 제어 ISR이 소비자이면 생산자가 ISR 실행 중에 진행될 수 없으므로 재시도가 발생하지 않습니다 (고정 비용).
+ */
+typedef struct {
+	volatile uint32_t ulSeq;    /**< 게시 횟수 (슬롯 = ulSeq & 1) */
+	uint16_t uSize;             /**< 슬롯 크기 [byte] */
+	void* pSlot[2];             /**< 슬롯 버퍼 */
+} sMbxLatest;
+
+/**
+ * @brief  링 버퍼를 초기화합니다.
+ * @param  pRing 링 버퍼
+ * @param  pBuf 항목 버퍼
+ * @param  uSize 항목 수 (2의 거듭제곱)
+ * @retval 없음
+ */
+extern void vSpscInit(sSpscRing* pRing, uint32_t* pBuf, uint16_t uSize);
+/**
+ * @brief  항목을 추가합니다. (생산자)
+ * @param  pRing 링 버퍼
+ * @param  ulItem 항목
+ * @retval 1: 성공, 0: 가득 참
+ */
+extern uint16_t uSpscPush(sSpscRing* pRing, uint32_t ulItem);
+/**
+ * @brief  가장 오래된 항목을 꺼냅니다. (소비자)
+ * @param  pRing 링 버퍼
+ * @param  pulItem 꺼낸 항목
+ * @retval 1: 성공, 0: 비어 있음
+ */
+extern uint16_t uSpscPop(sSpscRing* pRing, uint32_t* pulItem);
+
+/**
+ * @brief  우편함을 초기화하고 초기값을 게시합니다.
+ * @param  pMbx 우편함
+ * @param  pSlot0 슬롯 0 버퍼
+ * @param  pSlot1 슬롯 1 버퍼
+ * @param  uSize 슬롯 크기 [byte]
+ * @param  pInit 초기값
+ * @retval 없음
+ */
+extern void vMbxInit(sMbxLatest* pMbx, void* pSlot0, void* pSlot1, uint16_t uSize, const void* pInit);
+/**
+ * @brief  새 값을 게시합니다. (생산자)
+ * @param  pMbx 우편함
+ * @param  pSrc 게시할 값 (uSize byte)
+ * @retval 없음
+ */
+extern void vMbxWrite(sMbxLatest* pMbx, const void* pSrc);
+/**
+ * @brief  가장 최근에 게시된 값을 읽습니다. (소비자)
+ * @param  pMbx 우편함
+ * @param  pDst 읽은 값 (uSize byte)
+ * @retval 읽은 값의 게시 번호
+ */
+extern uint32_t ulMbxRead(sMbxLatest* pMbx, void* pDst);
+
+#endif /* INC_MAILBOX_H_ */
@@ -121,6 +121,10 @@ void vAlign(sCurrentCtrl* CCtrl, sSpeedObs *SObs, TIM_TypeDef *TIMx);
  * @brief  홀 센서 기반의 위치 정렬을 수행합니다.
  */
 void vAlignHallSensor(sCurrentCtrl* CCtrl, sSpeedObs *SObs);
+/**
+ * @brief  회전 중인 모터를 홀 에지 시간으로 포착하여 관측기 및 제어기 상태를 초기화합니다.
+ */
+void vFlyingStart(sMotorCtrl* MotorControl, sCurrentCtrl* CCtrl, sSpeedObs* SObs, sSpeedCtrl* SCtrl);
 /**
  * @brief  모터의 속도 및 위치를 추정/계산합니다.
  */
@@ -153,5 +157,21 @@ extern void vClearFault();
  * @param  Fault_Infomation 정보를 저장할 Fault 구조체
  */
 extern void vFaultEvent(sMotorCtrl* MotorControl, sFault_Info* Fault_Infomation);
+/**
+ * @brief  모든 보호 조건을 한 번에 비교하여 원인별 디바운스 및 래치를 수행합니다.
+ * @param  MotorControl 모터 제어 통합 구조체 포인터
+ * @param  Fault_Infomation 고장 정보 구조체 포인터
+ * @param  uEnMask 현재 상태에서 허용할 고장 원인 마스크 (FAULT_MASK_*)
+ * @retval 래치된 고장 원인 비트 (0: 정상)
+ */
+extern uint16_t uFaultEvaluate(sMotorCtrl* MotorControl, sFault_Info* Fault_Infomation, uint16_t uEnMask);
+/** @brief  COMP1~3과 DAC3을 설정하고 비교기 출력을 TIM1 Break 입력에 연결합니다. */
+extern void vInitHwTrip(void);
+/**
+ * @brief  하드웨어 차단 레벨을 DAC3 기준 전압으로 변환하여 반영합니다.
+ * @param  fCurrLev 과전류 차단 레벨 [A]
+ * @param  fVdcLev 과전압 차단 레벨 [V]
+ */
+extern void vSetHwTripLevel(float fCurrLev, float fVdcLev);
 
 #endif /* INC_MOTORCONTROL_H_ */
@@ -0,0 +1,187 @@
+/**
+ * @file    Param.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 이득/제한값/필터 계수의 더블 버퍼 파라미터 세트 헤더 파일
+ * @details 실시간 제어가 사용하는 파생 파라미터(sCtrlParam)를 두 벌 두고, 백그라운드에서 설계 입력(sCtrlParamCfg)으로
+ * 비활성 세트를 계산·검증한 뒤 포인터 하나를 바꿔 게시합니다. 제어 ISR은 주기 시작 시 포인터만 갱신하므로
+ * 한 주기 안에서 이득이 섞이지 않고, 실시간 경로에는 나눗셈이나 초기화 호출이 없습니다.
+ *
+ * | 단계 | 실행 위치 | 동작 |
+ * | :--- | :--- | :--- |
+ * | **1. 편집** | 디버거/통신 | ParamCfg 필드 변경 후 ParamReq.uCommit = 1 |
+ * | **2. 계산/검증** | 메인 루프 (vParamTask) | 비활성 세트에 파생값 계산, 실패 시 ParamReq.uErr에 원인 비트 기록 후 게시 안 함 |
+ * | **3. 게시** | 메인 루프 (vParamTask) | DMB 후 pCtrlParamNext = 비활성 세트 |
+ * | **4. 교체** | 제어 ISR (vParamFetch) | pCtrlParam = pCtrlParamNext (바뀐 경우 속도 LPF 계수 적재) |
+ *
+ * @note 직전 게시가 ISR에 반영되기 전에는 다음 세트를 계산하지 않습니다 (ISR이 사용 중인 세트는 절대 수정하지 않음).
+ */
+
+#ifndef INC_PARAM_H_
+#define INC_PARAM_H_
+
+#include <stdint.h>
+
+/** @name 파라미터 검증 실패 원인 (ParamReq.uErr)
+ * @{ */
+#define PARAM_ERR_NONE      0x0000u
+#define PARAM_ERR_MOTOR     0x0001u     /**< 전동기 상수(R, L, λf, P, J) ≤ 0 */
+#define PARAM_ERR_BW        0x0002u     /**< 대역폭 ≤ 0 또는 이산화 한계 초과 (ωc·Ts > PARAM_WC_TS_MAX, 속도 제어기는 SC_DIV 제어 주기) */
+#define PARAM_ERR_LIMIT     0x0004u     /**< 전류/속도/가감속 제한값 ≤ 0, 배터리 제한값 < 0, 전압 하한/상한 범위 밖 또는 피크 전류 < 연속 정격 */
+#define PARAM_ERR_FAULT     0x0008u     /**< 보호 레벨 ≤ 0 또는 저전압 ≥ 과전압 */
+/** @} */
+
+/** @brief 허용하는 최대 ωc·Ts (전류 제어기/PLL/LPF 이산화 안정 여유) */
+#define PARAM_WC_TS_MAX     0.5f
+
+/** @name 기본 배터리 제한 (0: 사용 안 함)
+ * @{ */
+#define PARAM_IBAT_MAX      0.0f                /**< 배터리 방전 전류 제한 [A] */
+#define PARAM_PBAT_MAX      0.0f                /**< 배터리 방전 전력 제한 [W] */
+#define PARAM_VDC_SAG_MIN   0.0f                /**< 직류단 전압 하한 [V] (0: 사용 안 함, 사용 시 RUN 이탈 10V보다 높게) */
+#define PARAM_VDC_REGEN_MAX 16.0f               /**< 회생 직류단 전압 상한 [V] (과전압 Fault 17V보다 낮게) */
+#define PARAM_ID_BRAKE_MAX  0.0f                /**< d축 손실 제동 최대 전류 [A] */
+/** @} */
+
+/** @name 기본 과부하 설정 (Thermal.h)
+ * @{ */
+#define PARAM_IS_PEAK       0.0f                /**< 피크 전류 [A] (0: 사용 안 함, 연속 정격으로 제한) */
+#define PARAM_TAU_WIND      30.0f               /**< 권선 열 시정수 [s] */
+/** @} */
+
+/** @name 기본 가감속 기울기 [RPM/s]
+ * @{ */
+#define PARAM_WRPM_ACC      1000.0f
+#define PARAM_WRPM_DEC      500.0f
+/** @} */
+
+/**
+ * @struct sCtrlParamCfg
+ * @brief  파라미터 설계 입력 (물리량, 백그라운드 편집용)
+ */
+typedef struct {
+	/* 전동기 상수 */
+	float fRs;                  /**< 상저항 [Ohm] */
+	float fLd;                  /**< d축 인덕턴스 [H] */
+	float fLq;                  /**< q축 인덕턴스 [H] */
+	float fLamf;                /**< 자속 쇄교수 [Wb] */
+	float fPP;                  /**< 극쌍수 */
+	float fJm;                  /**< 관성 [kg·m^2] */
+
+	/* 대역폭 */
+	float fWcCc;                /**< 전류 제어 대역폭 [rad/s] */
+	float fWcSc;                /**< 속도 제어 대역폭 [rad/s] */
+	float fWcPll;               /**< PLL 대역폭 [rad/s] */
+	float fZetaPll;             /**< PLL 감쇠비 */
+	float fWcWrpmLpf;           /**< 속도 피드백 LPF 차단 주파수 [rad/s] */
+
+	/* 제한값 */
+	float fIsMax;               /**< 연속 정격 전류 [A] (피크 전류 미사용 시 토크 제한, 과부하 모델 기준) */
+	float fWrpmMax;             /**< 속도 지령 제한 [RPM] */
+	float fWrpmAcc;             /**< 가속 기울기 [RPM/s] */
+	float fWrpmDec;             /**< 감속 기울기 [RPM/s] */
+
+	/* 소프트웨어 2차 보호 레벨 */
+	float fCurrFaultLev;        /**< 과전류 [A] */
+	float fVdcFaultLev;         /**< 과전압 [V] */
+	float fSpdFaultLev;         /**< 과속도 [RPM] */
+	float fVdcUvFaultLev;       /**< 저전압 [V] */
+
+	/* 배터리 제한 (PowerLimit.h, 통신 인덱스 유지를 위해 뒤에 추가) */
+	float fIbatMax;             /**< 방전 전류 제한 [A] (≤ 0: 사용 안 함) */
+	float fPbatMax;             /**< 방전 전력 제한 [W] (≤ 0: 사용 안 함) */
+	float fVdcSagMin;           /**< 직류단 전압 하한 [V] (0: 사용 안 함, 저전압 Fault < 값 < 과전압 Fault) */
+	float fVdcRegenMax;         /**< 회생 직류단 전압 상한 [V] (0: 사용 안 함, 전압 하한/저전압 Fault < 값 < 과전압 Fault) */
+	float fIdBrakeMax;          /**< d축 손실 제동 최대 전류 [A] (0: 사용 안 함, √(Is,peak² + 값²) < 과전류 Fault) */
+
+	/* 과부하 (Thermal.h) */
+	float fIsPeak;              /**< 피크 전류 [A] (0: 사용 안 함, 사용 시 ≥ fIsMax, √(값² + Id,brake²) < 과전류 Fault) */
+	float fTauWind;             /**< 권선 열 시정수 [s] */
+} sCtrlParamCfg;
+
+/**
+ * @struct sCtrlParam
+ * @brief  제어 ISR이 사용하는 파생 파라미터 세트 (나눗셈 없이 곱셈으로만 사용)
+ */
+typedef struct {
+	uint32_t ulVersion;         /**< 게시 번호 */
+
+	/* 전류 제어기 */
+	float fKpdCc, fKidCc, fKadCc;   /**< d축 비례/적분/Anti-windup 이득 */
+	float fKpqCc, fKiqCc, fKaqCc;   /**< q축 비례/적분/Anti-windup 이득 */
+
+	/* 속도 제어기 */
+	float fKpSc, fKiSc, fKaSc;      /**< 비례/적분/Anti-windup 이득 */
+	float fTeRefMax, fTeRefMin;     /**< 토크 지령 제한 [Nm] (피크 전류 기준, 열 모델 허용 전류는 전원 제한에서 적용) */
+	float fInvKT;                   /**< 토크 상수 역수 [A/Nm] */
+	float fKT;                      /**< 토크 상수 [Nm/A] */
+	float fPP;                      /**< 극쌍 수 (기계 RPM → eRPM 환산) */
+	float fInvPP;                   /**< 극쌍 수 역수 (전기각 속도 → 기계 RPM 환산) */
+	float fLamf;                    /**< 자속 쇄교수 [Wb] (회전 중 재기동 역기전력 선인가) */
+	float fWrpmRefMax;              /**< 속도 지령 제한 [RPM] */
+	float fDelWrpmAcc;              /**< 속도 제어 1회당 가속 증분 [RPM] (× SC_DIV 제어 주기) */
+	float fDelWrpmDec;              /**< 속도 제어 1회당 감속 증분 [RPM] (× SC_DIV 제어 주기) */
+
+	/* 관측기 */
+	float fKpPLL, fKiPLL;           /**< PLL 비례/적분 이득 */
+	float fWrpmLpfCoeff[5];         /**< 속도 피드백 LPF 계수 (IIR2.coeff 형식) */
+	float fWrmLpfCoeff[5];          /**< 기계각 속도 LPF 계수 (IIR2.coeff 형식) */
+	float fK1So, fK2TsSo, fK3TsSo;  /**< 외란 관측기 이득 (fK2, fK3은 × 공칭 주기) */
+	float fDelIdsrAlign;            /**< 정렬 전류 주기당 증분 [A] */
+	float fDelWrRefAlign;           /**< 정렬 속도 주기당 증분 [rad/s] */
+
+	/* 보호 */
+	float fCurrFaultLev, fVdcFaultLev, fSpdFaultLev, fVdcUvFaultLev;
+
+	/* 배터리 제한 */
+	float fIbatMax;                 /**< 방전 전류 제한 [A] (사용 안 함: PWR_LIM_NONE) */
+	float fPbatMax;                 /**< 방전 전력 제한 [W] (사용 안 함: PWR_LIM_NONE) */
+	float fVdcSagMin;               /**< 직류단 전압 하한 [V] (0: 사용 안 함) */
+	float fVdcRegenMax;             /**< 회생 직류단 전압 상한 [V] (0: 사용 안 함) */
+	float fIdBrakeMax;              /**< d축 손실 제동 최대 전류 [A] */
+	float fKiPwrLim;                /**< 제한기 적분 이득 × fTsamp */
+
+	/* 과부하 */
+	float fIsPeak;                  /**< 피크 전류 [A] (사용 안 함: fIsCont) */
+	float fIsCont;                  /**< 연속 정격 전류 [A] */
+	float fInvIsCont2;              /**< 1 / fIsCont² */
+	float fKThWind;                 /**< 권선 열 모델 이득 THERM_TS / τw */
+} sCtrlParam;
+
+/**
+ * @struct sParamReq
+ * @brief  파라미터 변경 요청 및 결과
+ */
+typedef struct {
+	uint16_t uCommit;           /**< 1: ParamCfg로 새 세트 계산 및 게시 요청 (처리 후 0) */
+	uint16_t uErr;              /**< 마지막 요청의 검증 결과 (PARAM_ERR_*) */
+	uint32_t ulCommitCnt;       /**< 게시 성공 횟수 */
+} sParamReq;
+
+/** @brief 파라미터 설계 입력 (편집용) */
+extern sCtrlParamCfg ParamCfg;
+/** @brief 파라미터 변경 요청 */
+extern sParamReq ParamReq;
+/** @brief 제어 ISR이 이번 주기에 사용하는 파라미터 세트 (ISR 소유) */
+extern const sCtrlParam* pCtrlParam;
+
+/**
+ * @brief  기본 설계값으로 첫 세트를 계산하여 즉시 활성화합니다.
+ * @note   fTimIntFreq가 정해진 뒤, 제어 인터럽트가 시작되기 전(vInitController 이전)에 호출해야 합니다.
+ */
+extern void vInitParam(void);
+/**
+ * @brief  설계 입력으로 파생 파라미터를 계산하고 검증합니다. (백그라운드 전용, 나눗셈 포함)
+ * @param  pCfg 설계 입력
+ * @param  pOut 계산 결과
+ * @retval 검증 실패 원인 (PARAM_ERR_NONE: 성공)
+ */
+extern uint16_t uParamBuild(const sCtrlParamCfg* pCfg, sCtrlParam* pOut);
+/** @brief  메인 루프에서 호출되어 변경 요청을 처리합니다. */
+extern void vParamTask(void);
+/** @brief  제어 주기 시작 시 호출되어 게시된 세트로 교체합니다. (포인터 비교 1회) */
+extern void vParamFetch(void);
+/** @brief  현재 세트의 필터 계수를 필터 인스턴스에 적재합니다. (필터 상태는 유지) */
+extern void vParamLoadFilter(void);
+
+#endif /* INC_PARAM_H_ */
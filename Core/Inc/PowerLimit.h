@@ -0,0 +1,76 @@
+/**
+ * @file    PowerLimit.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   직류단(배터리) 전류/전력 추정 및 동적 q축 전류 제한 헤더 파일
+ * @details 제어 주기마다 dq 전력 평형으로 배터리측 전력과 전류를 추정하고, 두 개의 PI 제한기로 q축 전류 허용 범위를 줄입니다.
+ * - 방전 제한기: 배터리 전류/전력 제한과 직류단 전압 하한(Sag 제한) → 전동(동력 소비) 방향 한계
+ * - 회생 제한기: 직류단 전압 상한(과전압 Fault 전) → 제동(회생) 방향 한계와 선택적 d축 손실 제동
+ *
+ * | 단계 | 계산 |
+ * | :--- | :--- |
+ * | **1. 추정** | Pbat = 1.5·(Vd·Id + Vq·Iq) (1차 LPF), Ibat = Pbat / Vdc |
+ * | **2. 허용 전류** | Ibat,lim = min(Ibat,max, Pbat,max / Vdc), q축 기준값 Iq,max = min(Is,peak, 열 모델 허용 전류 - Thermal.h) |
+ * | **3. 초과량** | e = max(Ibat − Ibat,lim, (Vdc,min − Vdc)·PWR_SAG_GAIN) [A] (하한 항은 RUN 상태, Ibat > 0일 때만) |
+ * | **4. q축 환산** | e_q = e · Vdc / (1.5·\|Vq\|) (∂Ibat/∂Iq의 역수, \|Vq\| ≥ PWR_VQ_MIN) |
+ * | **5. 제한기** | 감소량 = PWR_LIM_KP·e_q + ∫Ki·e_q, 0 ~ Iq,max로 제한 (적분항도 같은 범위) |
+ * | **6. 회생** | e_ov = (Vdc − Vdc,max)·PWR_OV_GAIN를 같은 방식으로 q축 환산하여 PI로 회생 감소량 계산 |
+ * | **7. d축 손실 제동** | Id = −min(회생 감소량, Id,brake) (Ld = Lq이면 토크 없이 1.5·Rs·Id² 소비, 회생 감소량이 그만큼 덜 필요) |
+ * | **8. 적용** | Vq ≥ 0: [−(Iq,max − 회생 감소량), Iq,max − 감소량], Vq < 0: 부호 반대 |
+ *
+ * 비례항이 초과 즉시 전류를 줄이고, 적분항(Ki = PWR_LIM_WC_RATIO·ωcc)이 정상 상태 오차를 없앱니다.
+ * Vdc,min(기본 0: 사용 안 함)은 RUN 상태의 저전압 이탈(10V)과 저전압 Fault보다 높게 두어, 차단되기 전에 전력을 낮춰 운전을 유지합니다.
+ * 하한 항은 방전 중에만 적분하므로, 정지 중 개방 전압이 하한보다 낮아도 감소량이 미리 쌓여 RUN 진입 후 토크가 0이 되지 않습니다.
+ * Vdc,max는 과전압 Fault(VDC_FAULT_LEV)보다 낮게 두어, 강한 제동에서도 차단 없이 버스가 받아들일 수 있는 만큼만 회생합니다.
+ * 배터리 내부 저항 모델로 회생 제한을 재현하는 호스트 시뮬레이션은 Test/sim_regen.c입니다.
+ */
+
+#ifndef INC_POWERLIMIT_H_
+#define INC_POWERLIMIT_H_
+
+#include <stdint.h>
+
+/** @name 제한기 상수
+ * @{ */
+#define PWR_LIM_NONE        1.0e6f              /**< 제한 없음 (설정값 ≤ 0일 때 사용하는 값) */
+#define PWR_LIM_KP          0.5f                /**< 비례 이득 (q축 환산 초과량 대비 감소량) */
+#define PWR_LIM_WC_RATIO    0.2f                /**< 적분 이득 / 전류 제어 대역폭 */
+#define PWR_PBAT_ALPHA      0.2f                /**< 전력 추정 LPF 계수 (20kHz 기준 시정수 약 0.25ms) */
+#define PWR_VQ_MIN          0.5f                /**< q축 환산 분모 하한 [V] */
+#define PWR_SAG_GAIN        5.0f                /**< 전압 하한 부족분 → 배터리 전류 초과 환산 [A/V] */
+#define PWR_OV_KP           1.0f                /**< 회생 제한기 비례 이득 */
+#define PWR_OV_GAIN         10.0f               /**< 전압 상한 초과분 → 배터리 충전 전류 초과 환산 [A/V] */
+/** @} */
+
+/**
+ * @struct sPowerLimit
+ * @brief  전원 제한 상태
+ */
+typedef struct {
+	float fPbat;                /**< 배터리측 전력 추정 [W] (양수: 방전) */
+	float fIbat;                /**< 배터리측 전류 추정 [A] (양수: 방전) */
+	float fInteg;               /**< 제한기 적분항 [A] */
+	float fIqRed;               /**< q축 전류 한계 감소량 [A] */
+	float fIqMax;               /**< 동적 q축 전류 상한 [A] */
+	float fIqMin;               /**< 동적 q축 전류 하한 [A] */
+	float fOvInteg;             /**< 회생 제한기 적분항 [A] */
+	float fIqRegenRed;          /**< 제동 방향 q축 전류 한계 감소량 [A] */
+	float fIdBrake;             /**< d축 손실 제동 전류 지령 [A] (0 또는 음수) */
+	uint16_t uActive;           /**< 1: 제한 동작 중 */
+	uint16_t uRegenActive;      /**< 1: 회생 과전압 제한 동작 중 */
+	uint32_t ulActiveCnt;       /**< 제한 동작 제어 주기 수 */
+	uint32_t ulRegenActiveCnt;  /**< 회생 제한 동작 제어 주기 수 */
+} sPowerLimit;
+
+/** @brief 전원 제한 객체 외부 참조 */
+extern sPowerLimit PwrLim;
+
+/** @brief  추정값과 제한기 상태를 초기화합니다. (vInitController에서 호출) */
+extern void vInitPowerLimit(void);
+/**
+ * @brief  제어 주기마다 호출되어 배터리 전류/전력을 추정하고 동적 q축 전류 한계를 갱신합니다.
+ * @note   fInvVdc 갱신 후, vSpeedControl/vCurrentRef 전에 호출해야 합니다.
+ */
+extern void vPowerLimit(void);
+
+#endif /* INC_POWERLIMIT_H_ */
@@ -0,0 +1,125 @@
+/**
+ * @file    Proto.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   USART1 프레임 기반 요청/응답 명령·파라미터 프로토콜 헤더 파일
+ * @details 디버거 없이 변수 읽기/쓰기, 시작/정지/리셋, 설정값 및 파라미터 변경, 스코프 무장/판독을 수행합니다.
+ * 요청 처리는 메인 루프(vProtoTask)에서만 수행하고, 제어 ISR로 가는 값은 명령 모듈의 잠금 없는 큐와 우편함을 통해 전달합니다.
+ *
+ * [프레임 형식] (모든 다바이트 필드는 리틀 엔디언)
+ * | 오프셋 | 크기 | 필드 | 설명 |
+ * | :--- | :--- | :--- | :--- |
+ * | 0 | 2 | uSync | 요청 PROTO_SYNC_REQ, 응답 PROTO_SYNC_RSP |
+ * | 2 | 1 | uSeq | 요청 순번 (응답은 그대로 반환) |
+ * | 3 | 1 | uOp | 명령 코드 (PROTO_OP_*, 응답은 그대로 반환) |
+ * | 4 | 2 | uLen | 페이로드 길이 (≤ PROTO_PAYLOAD_MAX) |
+ * | 6 | uLen | 페이로드 | 응답은 첫 바이트가 상태 코드 (PROTO_OK / PROTO_ERR_*) |
+ * | 6 + uLen | 2 | uCrc | uSeq ~ 페이로드 CRC-16/CCITT-FALSE |
+ *
+ * 응답은 텔레메트리와 같은 송신 DMA를 사용하므로 수신측은 동기 워드로 두 스트림을 구분합니다.
+ * CRC가 틀린 요청에는 응답하지 않으며(ulCrcErrCnt 증가), 호스트는 응답 제한 시간 후 같은 uSeq로 재전송합니다.
+ *
+ * @details [호스트 도구]
+ * Test/proto_cli(직렬 장치, 변수 이름/ID 읽기·쓰기, 시작/정지/리셋, 파라미터, 스코프 CSV 내려받기)가 Test/ProtoHost.c로
+ * 요청을 보냅니다. 보드 없이 시험할 때는 Test/proto_sim이 실제 Proto.c와 명령/파라미터/스코프 모듈을 단순 플랜트와 함께
+ * 실시간으로 실행하여 pty로 응답하고, 출력한 슬레이브 경로를 proto_cli에 넘깁니다. Test/test_proto는 같은 조합을 메모리로 연결해 시험합니다.
+ */
+
+#ifndef INC_PROTO_H_
+#define INC_PROTO_H_
+
+#include <stdint.h>
+
+/** @name 프레임 구성
+ * @{ */
+#define PROTO_VERSION       1u                  /**< 프로토콜 버전 (PING 응답) */
+#define PROTO_SYNC_REQ      0xA55Cu             /**< 요청 동기 워드 */
+#define PROTO_SYNC_RSP      0xA55Du             /**< 응답 동기 워드 */
+#define PROTO_HDR_LEN       6u                  /**< 동기 워드 ~ 페이로드 길이 [byte] */
+#define PROTO_PAYLOAD_MAX   250u                /**< 최대 페이로드 길이 [byte] */
+#define PROTO_FRAME_MAX     (PROTO_HDR_LEN + PROTO_PAYLOAD_MAX + 2u)
+#define PROTO_READ_MAX      32u                 /**< VAR_READ 1회 최대 변수 수 */
+#define PROTO_RX_TIMEOUT_MS 20u                 /**< 프레임 수신 중 바이트 간 최대 간격 [ms] (초과 시 폐기) */
+#define PROTO_TASK_BYTES_MAX 256u               /**< vProtoTask 1회 호출당 최대 처리 수신 바이트 수 */
+/** @} */
+
+/** @name 명령 코드
+ * | 코드 | 요청 페이로드 | 응답 데이터 (상태 코드 이후) |
+ * | :--- | :--- | :--- |
+ * | PING | - | u16 버전, u16 변수 수, u16 파라미터 수, u16 최대 페이로드 |
+ * | VAR_INFO | u16 ID | u32 해시, u8 타입, u8 단위, f32 스케일, 이름 문자열 |
+ * | VAR_READ | u16 ID × n (n ≤ PROTO_READ_MAX) | u32 원시값 × n (int16은 부호 확장) |
+ * | VAR_WRITE | u16 ID, u32 원시값 (읽기 전용 ID는 PROTO_ERR_RO) | - |
+ * | CMD | u8 CMD_START/STOP/RESET | - |
+ * | SET_GET | - | f32 속도, f32 Id, f32 Iq, f32 전압, u16 제어 모드 |
+ * | SET_WRITE | u8 PROTO_SET_*, u32 값 (모드는 정수, 나머지는 f32) | - |
+ * | PARAM_GET | u8 인덱스 (sCtrlParamCfg 필드 순서) | f32 값 |
+ * | PARAM_SET | u8 인덱스, f32 값 | - |
+ * | PARAM_COMMIT | - | - |
+ * | PARAM_STATUS | - | u16 계산 대기, u16 오류 비트, u32 게시 횟수, u32 적용 버전 |
+ * | SCOPE_ARM | u8 모드, u8 채널 수, u16 분주, u16 Pre-trigger, u8 트리거 채널, u8 트리거 종류, f32 레벨, u16 ID × 채널 수 | - |
+ * | SCOPE_STATUS | - | u8 상태, u8 완료, u8 채널 수, u8 예약, u16 Pre-trigger, u16 깊이, u32 캡처 수 (채널 수/Pre-trigger는 완료 버퍼 기준, 없으면 현재 설정) |
+ * | SCOPE_READ | u16 시작 샘플, u8 샘플 수, u8 잠금 유지 | i16 × 채널 수 × 샘플 수 |
+ * | TELEM | u8 송신 사용, u8 모드 (0xFF: 유지) | - |
+ * @{ */
+#define PROTO_OP_PING           0x01u
+#define PROTO_OP_VAR_INFO       0x02u
+#define PROTO_OP_VAR_READ       0x03u
+#define PROTO_OP_VAR_WRITE      0x04u
+#define PROTO_OP_CMD            0x05u
+#define PROTO_OP_SET_GET        0x06u
+#define PROTO_OP_SET_WRITE      0x07u
+#define PROTO_OP_PARAM_GET      0x08u
+#define PROTO_OP_PARAM_SET      0x09u
+#define PROTO_OP_PARAM_COMMIT   0x0Au
+#define PROTO_OP_PARAM_STATUS   0x0Bu
+#define PROTO_OP_SCOPE_ARM      0x0Cu
+#define PROTO_OP_SCOPE_STATUS   0x0Du
+#define PROTO_OP_SCOPE_READ     0x0Eu
+#define PROTO_OP_TELEM          0x0Fu
+/** @} */
+
+/** @name SET_WRITE 대상 필드
+ * @{ */
+#define PROTO_SET_WRPM      0u                  /**< 목표 속도 [RPM] */
+#define PROTO_SET_IDSR      1u                  /**< d축 전류 목표값 [A] */
+#define PROTO_SET_IQSR      2u                  /**< q축 전류 목표값 [A] */
+#define PROTO_SET_VDQSR     3u                  /**< 고정 전압 모드 전압 지령 [V] */
+#define PROTO_SET_MODE      4u                  /**< 제어 모드 (*_MODE) */
+/** @} */
+
+/** @name 응답 상태 코드
+ * @{ */
+#define PROTO_OK            0u
+#define PROTO_ERR_OP        1u                  /**< 알 수 없는 명령 코드 */
+#define PROTO_ERR_LEN       2u                  /**< 페이로드 길이 불일치 */
+#define PROTO_ERR_ARG       3u                  /**< 잘못된 ID/인덱스/값 */
+#define PROTO_ERR_BUSY      4u                  /**< 명령 큐 가득 참 또는 스코프 완료 버퍼 없음 */
+#define PROTO_ERR_RO        5u                  /**< 읽기 전용 변수 쓰기 (VAR_ACC_RO) */
+/** @} */
+
+/**
+ * @struct sProto
+ * @brief  프로토콜 수신/송신 상태 및 통계
+ */
+typedef struct {
+	uint16_t uRxLen;            /**< 조립 중인 요청 프레임 바이트 수 */
+	uint16_t uTxLen;            /**< 응답 프레임 길이 */
+	uint16_t uTxPending;        /**< 1: 응답이 송신 DMA 유휴를 기다리는 중 */
+	uint16_t uReserved;
+	uint32_t ulRxTick;          /**< 마지막 수신 바이트 시각 [ms] */
+	uint32_t ulReqCnt;          /**< 처리한 요청 수 */
+	uint32_t ulCrcErrCnt;       /**< CRC 오류로 버린 요청 수 */
+	uint32_t ulLenErrCnt;       /**< 길이 초과로 버린 요청 수 */
+	uint32_t ulTimeoutCnt;      /**< 바이트 간 시간 초과로 버린 요청 수 */
+} sProto;
+
+/** @brief 프로토콜 객체 외부 참조 */
+extern sProto Proto;
+
+/** @brief  수신 상태를 초기화합니다. (vInitUart, vInitCommand, vInitParam 이후 호출) */
+extern void vInitProto(void);
+/** @brief  메인 루프에서 호출되어 수신 바이트를 조립하고 완성된 요청 1개를 처리하여 응답합니다. */
+extern void vProtoTask(void);
+
+#endif /* INC_PROTO_H_ */
@@ -0,0 +1,164 @@
+/**
+ * @file    RcFrame.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   SBUS/CRSF 직렬 수신기 프레임 파서 및 CRSF 텔레메트리 프레임 생성 헤더 파일
+ * @details 하드웨어(HAL/레지스터)에 의존하지 않는 순수 함수만 두어, 호스트에서 같은 소스로 파서를 검증하고 처리량을 측정할 수 있습니다 (Test/test_rcframe, Test/bench_rcframe).
+ * 파서는 바이트 단위로 입력받고, 유휴 구간(Idle Line)을 프레임 경계로 알려 주면 미완성 프레임을 버리고 다시 동기를 잡습니다.
+ *
+ * [SBUS] (100000bps, 8E2, 반전 신호, 25byte)
+ * | 오프셋 | 크기 | 필드 |
+ * | :--- | :--- | :--- |
+ * | 0 | 1 | 시작 바이트 0x0F |
+ * | 1 | 22 | 16채널 × 11bit (LSB 먼저 연속 패킹) |
+ * | 23 | 1 | bit0: CH17, bit1: CH18, bit2: 프레임 손실, bit3: Failsafe |
+ * | 24 | 1 | 끝 바이트 0x00 |
+ *
+ * [CRSF] (420000bps, 8N1)
+ * | 오프셋 | 크기 | 필드 |
+ * | :--- | :--- | :--- |
+ * | 0 | 1 | 주소 (0xC8: 비행 제어기, 0xEA/0xEE: 수신기/송신기) |
+ * | 1 | 1 | 길이 N (종류 + 데이터 + CRC, 2 ~ 62) |
+ * | 2 | 1 | 종류 (0x16: RC 채널, 0x14: 링크 통계, 0x08: 배터리, 0x0C: RPM) |
+ * | 3 | N - 2 | 데이터 (다바이트 필드는 빅 엔디언, RC 채널은 SBUS와 같은 11bit 패킹) |
+ * | N + 1 | 1 | CRC-8 (다항식 0xD5, 종류 ~ 데이터) |
+ *
+ * 채널 값 172 ~ 992 ~ 1811은 펄스폭 988 ~ 1500 ~ 2012µs에 해당하며 RC_CH_TO_US로 환산합니다.
+ */
+
+#ifndef INC_RCFRAME_H_
+#define INC_RCFRAME_H_
+
+#include <stdint.h>
+
+/** @brief 채널 수 */
+#define RC_CH_NUM           16u
+
+/** @name SBUS
+ * @{ */
+#define SBUS_FRAME_LEN      25u
+#define SBUS_START          0x0Fu
+#define SBUS_END            0x00u
+#define SBUS_FLAG_LOST      0x04u               /**< 프레임 손실 */
+#define SBUS_FLAG_FAILSAFE  0x08u               /**< 수신기 Failsafe */
+/** @} */
+
+/** @name CRSF
+ * @{ */
+#define CRSF_ADDR_FC        0xC8u               /**< 비행 제어기 주소 (텔레메트리 동기 바이트) */
+#define CRSF_ADDR_RX        0xEAu               /**< 수신기 주소 */
+#define CRSF_ADDR_TX        0xEEu               /**< 송신 모듈 주소 */
+#define CRSF_FRAME_MAX      64u                 /**< 최대 프레임 길이 [byte] */
+#define CRSF_TYPE_BATTERY   0x08u               /**< 배터리 센서 (전압, 전류, 용량, 잔량) */
+#define CRSF_TYPE_RPM       0x0Cu               /**< RPM 센서 (출처 ID, int24 RPM 목록) */
+#define CRSF_TYPE_LINK      0x14u               /**< 링크 통계 */
+#define CRSF_TYPE_RC        0x16u               /**< RC 채널 (16 × 11bit) */
+#define CRSF_LINK_LQ_OFS    2u                  /**< 링크 통계 데이터 내 상향 링크 품질 [%] 위치 */
+/** @} */
+
+/** @brief 채널 값 → 펄스폭 [µs] (992 → 1500, 1 count = 0.625µs, 반올림) */
+#define RC_CH_TO_US(v)      ((uint16_t)(1500 + ((((int32_t)(v) - 992) * 5 + 4) >> 3)))
+
+/**
+ * @struct sSbusParser
+ * @brief  SBUS 파서 상태
+ */
+typedef struct {
+	uint8_t uBuf[SBUS_FRAME_LEN];   /**< 수신 중인 프레임 */
+	uint16_t uIdx;                  /**< 수신한 바이트 수 */
+	uint16_t uCh[RC_CH_NUM];        /**< 마지막 유효 프레임의 채널 값 (0 ~ 2047) */
+	uint8_t uFlags;                 /**< 마지막 유효 프레임의 플래그 바이트 */
+	uint32_t ulFrameCnt;            /**< 유효 프레임 수 */
+	uint32_t ulErrCnt;              /**< 시작/끝 바이트 오류 또는 미완성 프레임 수 */
+} sSbusParser;
+
+/**
+ * @struct sCrsfParser
+ * @brief  CRSF 파서 상태
+ */
+typedef struct {
+	uint8_t uBuf[CRSF_FRAME_MAX];   /**< 수신 중인 프레임 */
+	uint16_t uIdx;                  /**< 수신한 바이트 수 */
+	uint16_t uCh[RC_CH_NUM];        /**< 마지막 RC 채널 프레임의 채널 값 */
+	uint8_t uLinkLq;                /**< 마지막 링크 통계의 상향 링크 품질 [%] */
+	uint32_t ulFrameCnt;            /**< CRC가 맞은 프레임 수 */
+	uint32_t ulCrcErrCnt;           /**< CRC 오류 프레임 수 */
+	uint32_t ulErrCnt;              /**< 주소/길이 오류 또는 미완성 프레임 수 */
+} sCrsfParser;
+
+/**
+ * @brief  SBUS 바이트 하나를 입력합니다.
+ * @param  pP 파서
+ * @param  uByte 수신 바이트
+ * @retval 1: 유효 프레임 완성 (uCh, uFlags 갱신), 0: 진행 중 또는 오류
+ */
+extern uint16_t uSbusPush(sSbusParser* pP, uint8_t uByte);
+/**
+ * @brief  SBUS 유휴 구간(프레임 경계)을 알립니다. 미완성 프레임은 버립니다.
+ * @param  pP 파서
+ * @retval 없음
+ */
+extern void vSbusIdle(sSbusParser* pP);
+/**
+ * @brief  CRSF 바이트 하나를 입력합니다.
+ * @param  pP 파서
+ * @param  uByte 수신 바이트
+ * @retval CRC가 맞는 프레임 완성 시 프레임 종류 (RC 채널/링크 통계는 uCh/uLinkLq 갱신), 그 외 0
+ */
+extern uint8_t uCrsfPush(sCrsfParser* pP, uint8_t uByte);
+/**
+ * @brief  CRSF 유휴 구간(프레임 경계)을 알립니다. 미완성 프레임은 버립니다.
+ * @param  pP 파서
+ * @retval 없음
+ */
+extern void vCrsfIdle(sCrsfParser* pP);
+/**
+ * @brief  11bit 패킹 채널 22byte를 16채널로 풉니다.
+ * @param  pData 패킹 데이터 (22byte)
+ * @param  pCh 채널 값 (RC_CH_NUM개)
+ * @retval 없음
+ */
+extern void vRcUnpackCh(const uint8_t* pData, uint16_t* pCh);
+/**
+ * @brief  16채널을 11bit 패킹 22byte로 만듭니다. (송신측/호스트 검증용)
+ * @param  pCh 채널 값 (RC_CH_NUM개)
+ * @param  pData 패킹 데이터 (22byte)
+ * @retval 없음
+ */
+extern void vRcPackCh(const uint16_t* pCh, uint8_t* pData);
+/**
+ * @brief  CRSF CRC-8 (다항식 0xD5)
+ * @param  pData 데이터
+ * @param  uLen 길이 [byte]
+ * @retval CRC
+ */
+extern uint8_t uCrsfCrc8(const uint8_t* pData, uint16_t uLen);
+/**
+ * @brief  CRSF 프레임을 만듭니다. (동기 바이트 0xC8)
+ * @param  uType 프레임 종류
+ * @param  pPayload 데이터
+ * @param  uLen 데이터 길이 [byte] (최대 CRSF_FRAME_MAX - 4)
+ * @param  pOut 출력 (uLen + 4 byte)
+ * @retval 프레임 길이 [byte], 0: 길이 초과
+ */
+extern uint16_t uCrsfBuild(uint8_t uType, const uint8_t* pPayload, uint16_t uLen, uint8_t* pOut);
+/**
+ * @brief  CRSF 배터리 센서 프레임을 만듭니다.
+ * @param  fVolt 전압 [V] (0.1V 단위)
+ * @param  fAmp 전류 [A] (0.1A 단위)
+ * @param  ulMah 소모 용량 [mAh] (24bit)
+ * @param  uPct 잔량 [%]
+ * @param  pOut 출력 (12byte)
+ * @retval 프레임 길이 [byte]
+ */
+extern uint16_t uCrsfBuildBattery(float fVolt, float fAmp, uint32_t ulMah, uint8_t uPct, uint8_t* pOut);
+/**
+ * @brief  CRSF RPM 센서 프레임(값 1개)을 만듭니다.
+ * @param  uSource 출처 ID
+ * @param  lRpm 회전수 [RPM] (int24)
+ * @param  pOut 출력 (8byte)
+ * @retval 프레임 길이 [byte]
+ */
+extern uint16_t uCrsfBuildRpm(uint8_t uSource, int32_t lRpm, uint8_t* pOut);
+
+#endif /* INC_RCFRAME_H_ */
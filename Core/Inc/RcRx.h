@@ -0,0 +1,89 @@
+/**
+ * @file    RcRx.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   USART3 직렬 수신기(SBUS/CRSF) 입력 및 CRSF 텔레메트리 송신 헤더 파일
+ * @details 수신은 순환 DMA와 유휴 구간(IDLE) 검출로 처리하여 바이트 단위 인터럽트가 없습니다.
+ * IDLE 인터럽트와 DMA 절반/완료 인터럽트(긴 연속 수신 대비)에서만 새 바이트를 파서(RcFrame.h)에 넣고,
+ * 선택한 채널을 펄스폭 [µs]으로 환산하여 스로틀 입력(THR_INPUT_SERIAL)에 게시합니다.
+ *
+ * | 항목 | SBUS | CRSF |
+ * | :--- | :--- | :--- |
+ * | **USART3** | 100000bps, 8E2, RX/TX 반전 | 420000bps, 8N1 |
+ * | **프레임 경계** | 유휴 구간 (시작 0x0F ~ 끝 0x00) | 길이 필드 + CRC-8 (유휴 구간에서 재동기) |
+ * | **링크 Failsafe** | 플래그 바이트 Failsafe 비트 | 링크 통계 상향 링크 품질 < RC_LQ_MIN |
+ * | **텔레메트리** | 없음 (단방향) | 배터리(전압, 직류 전류 추정, 소모 용량 - EscTelem.h), RPM 프레임을 메인 루프에서 DMA 송신 |
+ *
+ * 링크 Failsafe 또는 프레임 끊김(THR_LOSS_S)이면 스로틀 출력은 0이 되고, 스로틀을 0으로 내려야 재무장합니다.
+ */
+
+#ifndef INC_RCRX_H_
+#define INC_RCRX_H_
+
+#include <stdint.h>
+#include "RcFrame.h"
+
+/** @name 프로토콜
+ * @{ */
+#define RC_PROTO_NONE       0u                  /**< 사용 안 함 (USART3 정지) */
+#define RC_PROTO_SBUS       1u
+#define RC_PROTO_CRSF       2u
+#define RC_PROTO_DEFAULT    RC_PROTO_NONE       /**< 초기 프로토콜 */
+/** @} */
+
+/** @name 통신 속도 (USART3 커널 클럭 = PCLK1 170MHz, OVER16)
+ * @{ */
+#define RC_KER_CLK          170000000UL
+#define RC_SBUS_BAUD        100000UL
+#define RC_CRSF_BAUD        420000UL
+/** @} */
+
+#define RC_RX_BUF_SIZE      256u                /**< 수신 순환 버퍼 크기 [byte] (2의 거듭제곱) */
+#define RC_THR_CH           2u                  /**< 스로틀 채널 기본값 (0부터, AETR 배치의 CH3) */
+#define RC_LQ_MIN           20u                 /**< CRSF 링크 품질 Failsafe 기준 [%] */
+#define RC_TELEM_PERIOD_MS  100u                /**< CRSF 텔레메트리 프레임 간격 [ms] (배터리/RPM 교대) */
+#define RC_RPM_SOURCE_ID    0u                  /**< CRSF RPM 프레임 출처 ID */
+
+/**
+ * @struct sRcRx
+ * @brief  직렬 수신기 상태
+ */
+typedef struct {
+	uint16_t uProto;            /**< 프로토콜 (RC_PROTO_*, vRcRxSetProto로 변경) */
+	uint16_t uThrCh;            /**< 스로틀로 쓰는 채널 (0 ~ RC_CH_NUM - 1) */
+	uint16_t uTelemEn;          /**< 1: CRSF 텔레메트리 송신 */
+	uint16_t uReady;            /**< 초기화 완료 여부 */
+	volatile uint32_t ulSample; /**< 스로틀 샘플 게시 (상위 16bit: 순번, 하위 16bit: 펄스폭 [µs]), 한 번의 쓰기로 원자적 게시 */
+	volatile uint16_t uLinkOk;  /**< 0: 수신기 Failsafe 또는 링크 품질 부족 */
+	uint16_t uRd;               /**< 수신 버퍼 판독 위치 (인터럽트 소유) */
+	uint16_t uTelemSel;         /**< 다음 텔레메트리 프레임 (0: 배터리, 1: RPM) */
+	uint32_t ulTelemTick;       /**< 마지막 텔레메트리 송신 시각 [ms] */
+	uint32_t ulLinkFailCnt;     /**< 링크 Failsafe 진입 횟수 */
+	uint32_t ulTelemCnt;        /**< 송신한 텔레메트리 프레임 수 */
+	sSbusParser Sbus;           /**< SBUS 파서 */
+	sCrsfParser Crsf;           /**< CRSF 파서 */
+} sRcRx;
+
+/** @brief 직렬 수신기 객체 외부 참조 */
+extern sRcRx RcRx;
+
+/**
+ * @brief  USART3 핀/DMA 클럭과 인터럽트를 준비하고 기본 프로토콜로 시작합니다.
+ * @note   MX_DMA_Init 이후 호출해야 합니다.
+ */
+extern void vInitRcRx(void);
+/**
+ * @brief  프로토콜을 바꾸고 USART3와 수신/송신 DMA를 다시 설정합니다. (메인 루프 전용)
+ * @param  uProto 프로토콜 (RC_PROTO_*)
+ */
+extern void vRcRxSetProto(uint16_t uProto);
+/**
+ * @brief  USART3 IDLE 및 DMA2_CH1 절반/완료 인터럽트에서 호출되어 새 바이트를 파싱합니다.
+ */
+extern void vRcRxIrq(void);
+/**
+ * @brief  메인 루프에서 호출되어 CRSF 텔레메트리를 송신합니다. (비차단)
+ */
+extern void vRcRxTask(void);
+
+#endif /* INC_RCRX_H_ */
@@ -0,0 +1,113 @@
+/**
+ * @file    Scope.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 루프 내부 변수를 트리거 조건에 맞춰 RAM에 캡처하는 소프트웨어 오실로스코프 헤더 파일
+ * @details 최대 8채널을 N 제어 주기마다 16비트로 기록하고, 레벨/에지/상태 전이 트리거와
+ * Pre-trigger 구간을 지원합니다. 더블 버퍼를 사용하여 한 버퍼를 판독하는 동안 다른 버퍼에 다음 캡처를 진행합니다.
+ */
+
+#ifndef INC_SCOPE_H_
+#define INC_SCOPE_H_
+
+#include <stdint.h>
+#include "DataChannel.h"
+
+/** @name 스코프 버퍼 크기
+ * @{ */
+#define SCOPE_CH_MAX        8u                  /**< 최대 채널 수 */
+#define SCOPE_DEPTH         256u                /**< 캡처당 샘플 수 (2의 거듭제곱) */
+#define SCOPE_DEPTH_MASK    (SCOPE_DEPTH - 1u)
+/** @} */
+
+/** @name 트리거 종류
+ * @{ */
+#define SCOPE_TRIG_RISING   0u                  /**< 상승 에지 (이전 < 레벨 ≤ 현재) */
+#define SCOPE_TRIG_FALLING  1u                  /**< 하강 에지 (이전 ≥ 레벨 > 현재) */
+#define SCOPE_TRIG_ABOVE    2u                  /**< 레벨 이상 */
+#define SCOPE_TRIG_BELOW    3u                  /**< 레벨 미만 */
+#define SCOPE_TRIG_CHANGE   4u                  /**< 값 변화 (상태 전이 등 정수 채널용) */
+/** @} */
+
+/** @name 캡처 모드
+ * @{ */
+#define SCOPE_MODE_SINGLE   0u                  /**< 1회 캡처 후 정지 */
+#define SCOPE_MODE_NORMAL   1u                  /**< 캡처 완료 시 다른 버퍼로 자동 재무장 */
+/** @} */
+
+/** @name 스코프 상태
+ * @{ */
+#define SCOPE_STATE_STOP    0u                  /**< 정지 */
+#define SCOPE_STATE_PRETRIG 1u                  /**< Pre-trigger 구간 채우는 중 (트리거 무시) */
+#define SCOPE_STATE_ARMED   2u                  /**< 트리거 대기 */
+#define SCOPE_STATE_POSTTRIG 3u                 /**< 트리거 이후 구간 기록 중 */
+#define SCOPE_STATE_HOLD    4u                  /**< 캡처 완료, 판독 잠금 해제 대기 */
+/** @} */
+
+/**
+ * @struct sScope
+ * @brief  소프트웨어 오실로스코프 설정 및 상태
+ */
+typedef struct {
+	/* 설정 (vScopeArm 호출 전 변경) */
+	uint16_t uMode;             /**< 캡처 모드 (SCOPE_MODE_*) */
+	uint16_t uChNum;            /**< 사용 채널 수 (≤ SCOPE_CH_MAX) */
+	uint16_t uDecim;            /**< 샘플링 분주 (N 제어 주기마다 1 샘플, 1 이상) */
+	uint16_t uPreTrig;          /**< Pre-trigger 샘플 수 (< SCOPE_DEPTH) */
+	uint16_t uTrigCh;           /**< 트리거 채널 번호 */
+	uint16_t uTrigType;         /**< 트리거 종류 (SCOPE_TRIG_*) */
+	float fTrigLevel;           /**< 트리거 레벨 (원본 물리량) */
+	uint16_t uForce;            /**< 1: 조건과 무관하게 즉시 트리거 */
+
+	/* 상태 */
+	uint16_t uState;            /**< 스코프 상태 (SCOPE_STATE_*) */
+	uint16_t uWrBuf;            /**< 기록 중인 버퍼 번호 (0/1) */
+	uint16_t uRdBuf;            /**< 판독 가능한 완료 버퍼 번호 (0/1) */
+	uint16_t uReady;            /**< 완료 버퍼 존재 여부 */
+	uint16_t uRdLock;           /**< 판독 중 잠금 (1이면 완료 버퍼를 덮어쓰지 않음) */
+	uint16_t uDecimCnt;         /**< 분주 카운터 */
+	uint16_t uWrIdx;            /**< 다음 기록 샘플 인덱스 */
+	uint16_t uFillCnt;          /**< 재무장 이후 기록 샘플 수 (Pre-trigger 채움 확인) */
+	uint16_t uPostCnt;          /**< 남은 Post-trigger 샘플 수 */
+	uint16_t uTrigIdx[2];       /**< 버퍼별 트리거 샘플 인덱스 */
+	uint16_t uRdChNum;          /**< 완료 버퍼의 채널 수 (완료 처리 시 고정, 재무장과 무관) */
+	uint16_t uRdPreTrig;        /**< 완료 버퍼의 Pre-trigger 샘플 수 (완료 처리 시 고정) */
+	int16_t iTrigLevel;         /**< 트리거 채널과 같은 변환(× fScale + fOffset)을 적용한 16비트 레벨 */
+	int16_t iTrigPrev;          /**< 직전 트리거 채널 샘플 */
+	uint32_t ulCaptureCnt;      /**< 완료된 캡처 수 */
+} sScope;
+
+/** @brief 스코프 객체 외부 참조 */
+extern sScope Scope;
+/** @brief 스코프 채널 디스크립터 */
+extern sDataChannel ScopeCh[SCOPE_CH_MAX];
+/** @brief 스코프 더블 버퍼 [버퍼][샘플][채널] */
+extern int16_t iScopeBuf[2][SCOPE_DEPTH][SCOPE_CH_MAX];
+
+/** @brief  기본 설정(정지 상태)으로 초기화합니다. */
+extern void vInitScope(void);
+/**
+ * @brief  변수 레지스트리 ID로 스코프 채널을 지정합니다. (기본 스케일 사용)
+ * @param  uCh 스코프 채널 (0 ~ SCOPE_CH_MAX-1)
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @retval 1: 성공, 0: 잘못된 채널 또는 ID
+ */
+extern uint16_t uScopeSelect(uint16_t uCh, uint16_t uId);
+/** @brief  현재 설정으로 캡처를 시작(재무장)합니다. */
+extern void vScopeArm(void);
+/** @brief  제어 주기마다 호출되어 샘플을 기록하고 트리거를 판정합니다. */
+extern void vScopeRecord(void);
+/**
+ * @brief  완료 버퍼의 판독 잠금을 설정/해제합니다.
+ * @param  uLock 1: 잠금, 0: 해제
+ */
+extern void vScopeLock(uint16_t uLock);
+/**
+ * @brief  완료 버퍼에서 시간 순서상 uSample번째 샘플(0 = 가장 오래된 샘플)을 복사합니다.
+ * @param  uSample 샘플 번호 (0 ~ SCOPE_DEPTH-1, uRdPreTrig 번째가 트리거 샘플)
+ * @param  piDst uRdChNum개 채널의 복사 대상 버퍼
+ * @retval 1: 성공, 0: 완료 버퍼 없음 또는 범위 밖
+ */
+extern uint16_t uScopeRead(uint16_t uSample, int16_t* piDst);
+
+#endif /* INC_SCOPE_H_ */
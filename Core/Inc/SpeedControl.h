@@ -13,6 +13,9 @@
 /** @brief 속도 제어기 차단 주파수 (Bandwidth): 5Hz를 Radian 단위로 변환 */
 #define WC_SC	(5.0f * PI2)
 
+/** @brief 속도 제어 분주비: 제어 ISR SC_DIV회마다 vSpeedControl 1회 (속도 제어 주기 = SC_DIV × fTsamp) */
+#define SC_DIV	40u
+
 /**
  * @struct sSpeedCtrl
  * @brief  속도 제어 루프의 상태 변수 및 이득을 관리하는 구조체
@@ -25,10 +28,7 @@ typedef struct {
 	float fWrmSC;           /**< 속도 제어기 입력으로 사용되는 피드백 속도 [rad/s] */
 	float fErrWrm;          /**< 속도 오차 (Reference - Feedback) [rad/s] */
 
-	// 2. 제어기 이득 (Controller Gains)
-	float fKpSc;            /**< 속도 제어기 비례 이득 (Proportional Gain) */
-	float fKiSc;            /**< 속도 제어기 적분 이득 (Integral Gain) */
-	float fKaSc;            /**< Anti-windup 이득 (적분기 포화 방지용) */
+	// 2. 제어기 이득 및 토크 제한은 파라미터 세트(Param.h의 sCtrlParam)로 이동
 
 	// 3. 토크 및 적분기 상태 (Torque & Integrator State)
 	float fTeInteg;         /**< 속도 제어기 적분항 누적 상태 값 */
@@ -39,8 +39,6 @@ typedef struct {
 	// 4. 출력 및 제한 (Output & Limits)
 	volatile float fIqsrRefSC;       /**< 속도 제어기 출력인 q축 전류 지령값 (토크 성분) */
 	float fIqsrRamp_LIMIT;  /**< q축 전류의 급격한 변화를 막기 위한 램프 제한치 */
-	float fTeRefMax;        /**< 출력 토크의 최대 제한치 */
-	float fTeRefMin;        /**< 출력 토크의 최소 제한치 */
 
 } sSpeedCtrl;
 
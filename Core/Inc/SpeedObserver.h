@@ -44,6 +44,17 @@
 #define ALIGN_CNT_MAX           40000      /**< 정렬 수행 시간 (FSAMP=20kHz 기준 2초) */
 /** @} */
 
+/** @name Flying Start(회전 중 재기동) 파라미터
+ * @{ */
+#define FLY_WRPM_MIN            300.0f     /**< 플라잉 스타트를 시도할 최소 회전 속도 [RPM] */
+#define FLY_EDGE_NUM_MIN        2u         /**< 속도 추정에 필요한 같은 방향 연속 홀 에지 수 */
+#define FLY_CNT_MAX             800u       /**< 홀 에지 대기 최대 시간 (FSAMP=20kHz 기준 40ms) */
+
+#define FLY_RESULT_NONE         0u         /**< 회전 상태 판별 중 */
+#define FLY_RESULT_CAUGHT       1u         /**< 회전자 포착 완료 → RUN 진입 */
+#define FLY_RESULT_ALIGN        2u         /**< 정지(저속) 상태 → 기존 Align 시퀀스 수행 */
+/** @} */
+
 /**
  * @struct sSpeedObs
  * @brief  속도/위치 추정 및 기동 시퀀스를 관리하는 구조체
@@ -53,8 +64,7 @@ typedef struct {
 	uint16_t uAlignStep, uAlignEnd;     /**< 정렬 단계 및 종료 플래그 */
 	uint32_t lAlignCnt;                 /**< 정렬 진행 카운터 */
 	float fThetarmOffset, fIdsrRefAlign, fWrRefAlign, fThetarAlign, fThetarmOffsetTemp; /**< 정렬 관련 각도/지령 */
-	float fDelIdsrAlign;                /**< 정렬 전류 변화량 */
-	float fDelWrRefAlign;               /**< 정렬 속도 변화량 */
+	/* 정렬 전류/속도 주기당 증분은 파라미터 세트(Param.h의 sCtrlParam)에서 사용 */
 	float fINV_AlignCntPlus1, fThetarAlignComp; /**< 연산 최적화 변수 */
 
 	uint16_t uHall_A, uHall_B, uHall_C; /**< 홀 센서 디지털 입력 상태 */
@@ -62,6 +72,20 @@ typedef struct {
 
 	float fThetar_Hall;                 /**< 홀 센서 기반 전기각 */
 
+	// ---------------------------------------------------------
+	// 0. Hall Edge Timing & Flying Start (홀 에지 시간 측정 및 회전 중 재기동)
+	// ---------------------------------------------------------
+	uint16_t uHall_PrevState;           /**< 직전 제어 주기의 홀 센서 상태 */
+	int16_t  iHallDir;                  /**< 홀 에지 기반 회전 방향 (+1: 정방향, -1: 역방향, 0: 미확정) */
+	uint16_t uHallEdgeNum;              /**< 같은 방향으로 연속 검출된 홀 에지 수 */
+	uint32_t lHallEdgeCnt;              /**< 마지막 홀 에지 이후 경과한 제어 주기 수 */
+	uint32_t lHallPeriodCnt;            /**< 직전 두 홀 에지 사이의 제어 주기 수 (60도 구간) */
+	float fThetarHallEdge;              /**< 마지막 홀 에지 시점의 전기각 (구간 경계) [rad] */
+	float fWrHallEdge;                  /**< 홀 에지 간격으로 추정한 전기각 속도 [rad/s] */
+
+	uint16_t uFlyResult;                /**< 플라잉 스타트 판별 결과 (FLY_RESULT_xxx) */
+	uint32_t lFlyCnt;                   /**< 플라잉 스타트 대기 카운터 */
+
     // ---------------------------------------------------------
     // 1. Estimated Angle & Trigonometry (추정 각도 및 삼각함수)
     // ---------------------------------------------------------
@@ -98,13 +122,7 @@ typedef struct {
     // ---------------------------------------------------------
     // 3. Observer Gains & Parameters (관측기 이득 및 파라미터)
     // ---------------------------------------------------------
-    float fK1;                          /**< 관측기 이득 1 (위치 오차 보정) */
-    float fK2Ts;                        /**< 관측기 이득 2 * 샘플링 시간 (속도 오차 보정) */
-    float fK3Ts;                        /**< 관측기 이득 3 * 샘플링 시간 (부하 토크/가속도 추정) */
-
-    float fBperJ;                       /**< 마찰계수/관성비 (B/J) */
-    float fInvJ;                        /**< 관성 역수 (1/J) */
-    float fInvPP;                       /**< 극쌍수 역수 (1/PP) */
+    /* 관측기 이득(K1, K2·Ts, K3·Ts)과 극쌍수 역수는 파라미터 세트(Param.h의 sCtrlParam)에서 사용 */
 
     float fAccEstInteg;                 /**< 가속도 추정기 적분 상태 */
     float fAccFF;                       /**< 가속도 전향 보상항 */
@@ -112,8 +130,7 @@ typedef struct {
     // ---------------------------------------------------------
     // 3-2. PLL Gains & Parameter (PLL 이득 및 파라미터)
     // ---------------------------------------------------------
-    float fKpPLL;                       /**< PLL 비례 이득 */
-    float fKiPLL;                       /**< PLL 적분 이득 */
+    /* PLL 이득(Kp, Ki)은 파라미터 세트(Param.h의 sCtrlParam)에서 사용 */
     float fThetarmInteg;                /**< PLL 내부 기계각 적분기 상태 */
     float fThetarInteg;                 /**< PLL 내부 전기각 적분기 상태 */
 
@@ -0,0 +1,77 @@
+/**
+ * @file    SyncPwm.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   고속 운전 영역의 동기 PWM(Synchronous PWM) 설정 및 상태 구조체 정의 헤더 파일
+ * @details 전기 주파수 대비 캐리어 펄스 수가 적어지는 영역에서 TIM1 캐리어 주기를 전기 주파수의
+ * 정수배로 맞추어 비동기 샘플링에 의한 저조파(Subharmonic) 및 맥놀이 전류를 억제합니다.
+ */
+
+#ifndef INC_SYNCPWM_H_
+#define INC_SYNCPWM_H_
+
+#include <stdint.h>
+#include "stm32g4xx_hal.h"
+#include "SpeedObserver.h"
+
+/** @name 동기 PWM 진입/해제 조건 (캐리어 주파수 / 전기 주파수 비)
+ * @{ */
+#define SYNC_PULSE_RATIO_ON     24.0f      /**< 공칭 캐리어 기준 펄스 비가 이 값 이하이면 동기 PWM 진입 */
+#define SYNC_PULSE_RATIO_OFF    30.0f      /**< 펄스 비가 이 값 이상이면 비동기 PWM 복귀 (히스테리시스) */
+/** @} */
+
+/** @brief 동기 PWM 펄스 수 후보 개수 */
+#define SYNC_PULSE_TABLE_NUM    4u
+
+/** @brief 위상 잠금 보정 이득 (다음 캐리어 주기에서 보정할 각도 오차 비율) */
+#define SYNC_KP_PHASE           0.25f
+
+/** @brief 위상 보정 시 허용하는 최소 캐리어 주기 (공칭 주기 대비 비율) */
+#define SYNC_TSAMP_MIN_RATIO    0.9f
+
+/**
+ * @struct sSyncPwm
+ * @brief  동기 PWM 동작 상태 및 캐리어 주기 파이프라인을 관리하는 구조체
+ */
+typedef struct {
+	uint16_t uEnable;           /**< 동기 PWM 사용 옵션 (0: 비동기 고정, 1: 고속 영역 동기 PWM) */
+	uint16_t uActive;           /**< 현재 동기 PWM 동작 여부 */
+	uint16_t uPulseNum;         /**< 현재 전기 1주기당 캐리어 펄스 수 */
+	uint16_t uPulseNumReq;      /**< 다음 구간 경계에서 적용할 펄스 수 (0: 비동기 복귀) */
+
+	uint32_t ulArrNominal;      /**< 비동기 운전 시 공칭 ARR 값 */
+	float fTsampNominal;        /**< 공칭 제어(캐리어) 주기 [s] */
+	float fTsampNext;           /**< 이미 기록되어 다음 주기에 적용되는 캐리어 주기 [s] */
+	float fArrPerSec;           /**< 주기[s] → ARR 변환 계수 */
+
+	float fPulseRatio;          /**< 공칭 캐리어 주파수 / 전기 주파수 */
+	float fThetarPrev;          /**< 직전 주기 전기각 (구간 경계 검출용) [rad] */
+	float fPhaseErr;            /**< 캐리어 격자 대비 예측 전기각 오차 [rad] */
+} sSyncPwm;
+
+/** @brief 동기 PWM 전역 객체 외부 참조 */
+extern sSyncPwm SyncPwm;
+
+/**
+ * @brief  공칭 캐리어 주기를 저장하고 ARR 프리로드를 활성화합니다.
+ * @param  htim PWM 타이머 핸들러
+ * @retval 없음
+ */
+extern void vInitSyncPwm(TIM_HandleTypeDef *htim);
+
+/**
+ * @brief  동기 PWM을 해제하고 공칭 캐리어 주기로 복귀합니다.
+ * @param  htim PWM 타이머 핸들러
+ * @retval 없음
+ */
+extern void vSyncPwmReset(TIM_HandleTypeDef *htim);
+
+/**
+ * @brief  전기 주파수에 맞추어 다음 캐리어 주기(ARR)와 fTsamp를 갱신합니다.
+ * @param  htim PWM 타이머 핸들러
+ * @param  SObs 속도 및 위치 관측기 구조체 포인터
+ * @retval 없음
+ */
+extern void vSyncPwmUpdate(TIM_HandleTypeDef *htim, sSpeedObs* SObs);
+
+#endif /* INC_SYNCPWM_H_ */
@@ -0,0 +1,135 @@
+/**
+ * @file    Telemetry.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 주기 단위 바이너리 텔레메트리 스트림(USART1 + DMA) 헤더 파일
+ * @details 제어 ISR이 선택된 채널의 16비트 샘플을 고정 형식 프레임으로 더블 버퍼에 직접 기록하고,
+ * 한쪽 버퍼가 가득 차면 DMA가 백그라운드로 송신합니다.
+ *
+ * @details [프레임 형식] (리틀 엔디안, 14byte)
+ * | 오프셋 | 크기 | 필드 | 내용 |
+ * | :--- | :--- | :--- | :--- |
+ * | 0 | 2 | uSync | TELEM_SYNC (0xA55A, 바이트 순서 5A A5) |
+ * | 2 | 2 | uSeq | 프레임 순번 (분주 후 샘플마다 +1, 누락 검출용) |
+ * | 4 | 2 × TELEM_CH_NUM | iCh[] | 채널 샘플 (복원: 샘플 / 변수 레지스트리 기본 스케일) |
+ * | 12 | 2 | uCrc | uSeq ~ iCh[] 구간의 CRC-16/CCITT-FALSE |
+ *
+ * @details [대역폭]
+ * 4Mbps 8N1 = 400kB/s 이고 20kHz × 14byte = 280kB/s (사용률 70%)이므로 분주 없이 연속 송신이 가능합니다.
+ * 채널 수를 늘리면 uDecim으로 프레임 속도를 낮추거나 차분 압축 모드(TELEM_MODE_DELTA)를 사용합니다.
+ *
+ * @details [호스트 복원]
+ * Test/telem_decode(직렬 장치 → CSV)가 Test/TelemDecode.c로 스트림을 복원합니다. 보드 없이 시험할 때는 Test/telem_sim이
+ * 실제 Telemetry.c를 합성 파형으로 실행하여 pty로 송신하고, 출력한 슬레이브 경로를 telem_decode에 넘깁니다.
+ * 차분 압축 블록도 같은 복원기가 자동으로 구분하며, 채널별 예측 차수(uOrderMask)에 따른 압축률은 Test/bench_telem이
+ * 합성 파형 또는 telem_decode로 기록한 CSV에 대해 출력합니다 (합성 전류/속도 파형, 기본 채널: 약 4.4배, 링크 사용률 70% → 16%).
+ *
+ * @details [차분 압축 블록 형식] (TELEM_MODE_DELTA, 리틀 엔디안)
+ * | 오프셋 | 크기 | 필드 | 내용 |
+ * | :--- | :--- | :--- | :--- |
+ * | 0 | 2 | 동기 워드 | TELEM_SYNC_DELTA (0xA55B, 바이트 순서 5B A5) |
+ * | 2 | 2 | 순번 | 블록 첫 샘플의 순번 (블록 내 샘플은 연속) |
+ * | 4 | 1 | 블록 길이 | TELEM_BLOCK_LEN |
+ * | 5 | 1 | 차수 마스크 | 비트 i = 1: 채널 i 2차 예측, 0: 1차 예측 |
+ * | 6 | 2 | 페이로드 길이 | 비트 패킹 페이로드 바이트 수 |
+ * | 8 | n | 페이로드 | 채널 순서대로 [폭 w: 5bit][첫 샘플: 16bit][잔차 × (N-1): 각 w bit], LSB부터 채움, 끝에서 바이트 정렬 |
+ * | 8+n | 2 | CRC | 순번 ~ 페이로드 구간의 CRC-16/CCITT-FALSE |
+ *
+ * 잔차는 1차: x[k] - x[k-1], 2차: x[k] - (2·x[k-1] - x[k-2]) (k = 1은 항상 1차)이며, ZigZag 부호화
+ * ((r << 1) ^ (r >> 31)) 후 블록 내 최대값의 비트 수 w로 고정 폭 패킹합니다. 각 블록은 독립적으로 복원됩니다.
+ */
+
+#ifndef INC_TELEMETRY_H_
+#define INC_TELEMETRY_H_
+
+#include <stdint.h>
+#include "DataChannel.h"
+
+/** @name 텔레메트리 프레임 구성
+ * @{ */
+#define TELEM_CH_NUM        4u                  /**< 프레임당 채널 수 */
+#define TELEM_FRAME_NUM     32u                 /**< 버퍼(반쪽)당 프레임 수 (20kHz 기준 1.6ms) */
+#define TELEM_SYNC          0xA55Au             /**< 프레임 동기 워드 */
+/** @} */
+
+/** @name 송신 모드
+ * @{ */
+#define TELEM_MODE_RAW      0u                  /**< 샘플마다 고정 형식 프레임 (ISR에서 송신) */
+#define TELEM_MODE_DELTA    1u                  /**< 원시 샘플 링 버퍼 → 메인 루프에서 차분 압축 블록 송신 */
+/** @} */
+
+/** @name 차분 압축 구성
+ * @{ */
+#define TELEM_SYNC_DELTA    0xA55Bu             /**< 압축 블록 동기 워드 */
+#define TELEM_BLOCK_LEN     16u                 /**< 블록당 샘플 수 (TELEM_RAW_DEPTH의 약수) */
+#define TELEM_RAW_DEPTH     256u                /**< 원시 샘플 링 버퍼 깊이 (2의 거듭제곱, 20kHz 기준 12.8ms) */
+#define TELEM_RAW_MASK      (TELEM_RAW_DEPTH - 1u)
+#define TELEM_RAW_BLOCK_NUM (TELEM_RAW_DEPTH / TELEM_BLOCK_LEN)
+#define TELEM_TASK_BLOCK_MAX 2u                 /**< vTelemTask 1회 호출당 최대 압축 블록 수 (실행 시간 상한) */
+#define TELEM_RES_BITS_MAX  19u                 /**< 16비트 샘플 2차 잔차의 ZigZag 최대 비트 수 */
+/** @brief 압축 블록 최대 크기 (헤더 8 + 채널별 최대 페이로드 + CRC 2) [byte] */
+#define TELEM_DELTA_FRAME_MAX (8u + ((TELEM_CH_NUM * (5u + 16u + (TELEM_BLOCK_LEN - 1u) * TELEM_RES_BITS_MAX) + 7u) / 8u) + 2u)
+/** @} */
+
+/**
+ * @struct sTelemFrame
+ * @brief  텔레메트리 프레임 (모든 필드 16비트, 패딩 없음)
+ */
+typedef struct {
+	uint16_t uSync;             /**< 동기 워드 (TELEM_SYNC) */
+	uint16_t uSeq;              /**< 프레임 순번 */
+	int16_t iCh[TELEM_CH_NUM];  /**< 채널 샘플 */
+	uint16_t uCrc;              /**< uSeq ~ iCh[] CRC-16 */
+} sTelemFrame;
+
+/**
+ * @struct sTelem
+ * @brief  텔레메트리 설정 및 상태
+ */
+typedef struct {
+	volatile uint16_t uEnable;  /**< 송신 사용 여부 */
+	uint16_t uMode;             /**< 송신 모드 (TELEM_MODE_*, uTelemSetMode로 변경) */
+	uint16_t uDecim;            /**< 프레임 분주 (N 제어 주기마다 1 프레임, 1 이상) */
+	uint16_t uOrderMask;        /**< 압축 모드 채널별 예측 차수 (비트 i = 1: 2차) */
+
+	uint16_t uDecimCnt;         /**< 분주 카운터 */
+	uint16_t uSeq;              /**< 다음 프레임 순번 */
+	uint16_t uWrBuf;            /**< 기록 중인 버퍼 번호 (0/1) */
+	uint16_t uWrIdx;            /**< 기록 중인 버퍼의 다음 프레임 인덱스 */
+	uint16_t uTxLen;            /**< 압축 모드: 기록 중인 버퍼에 쌓인 바이트 수 */
+	uint16_t uBlkCnt;           /**< 압축 모드: 현재 블록에 기록한 샘플 수 */
+	uint16_t uRawSkip;          /**< 압축 모드: 링 버퍼가 가득 차 현재 블록을 버리는 중 */
+	volatile uint16_t uRawWr;   /**< 원시 링 버퍼 기록 카운터 (ISR 소유) */
+	volatile uint16_t uRawRd;   /**< 원시 링 버퍼 판독 카운터 (메인 루프 소유) */
+	uint32_t ulTxCnt;           /**< DMA 송신 시작한 버퍼 수 */
+	uint32_t ulDropCnt;         /**< 링크 또는 압축 지연으로 버린 프레임(샘플) 수 */
+	uint32_t ulRawBytes;        /**< 압축한 샘플을 고정 형식 프레임으로 보냈을 때의 바이트 수 */
+	uint32_t ulCompBytes;       /**< 실제 송신한 압축 블록 바이트 수 (압축률 = ulRawBytes / ulCompBytes) */
+} sTelem;
+
+/** @brief 텔레메트리 객체 외부 참조 */
+extern sTelem Telem;
+/** @brief 텔레메트리 채널 디스크립터 */
+extern sDataChannel TelemCh[TELEM_CH_NUM];
+
+/** @brief  기본 채널로 초기화하고 송신을 시작합니다. (vInitUart 이후 호출) */
+extern void vInitTelemetry(void);
+/**
+ * @brief  변수 레지스트리 ID로 텔레메트리 채널을 지정합니다. (기본 스케일 사용)
+ * @param  uCh 채널 (0 ~ TELEM_CH_NUM-1)
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @retval 1: 성공, 0: 잘못된 채널 또는 ID
+ */
+extern uint16_t uTelemSelect(uint16_t uCh, uint16_t uId);
+/**
+ * @brief  송신 모드를 변경하고 버퍼를 초기화합니다. (메인 루프 또는 통신 처리에서 호출)
+ * @param  uMode 송신 모드 (TELEM_MODE_*)
+ * @retval 1: 성공, 0: 잘못된 모드
+ */
+extern uint16_t uTelemSetMode(uint16_t uMode);
+/** @brief  제어 주기마다 호출되어 프레임(또는 원시 샘플)을 기록하고, 가득 찬 버퍼를 DMA로 송신합니다. */
+extern void vTelemRecord(void);
+/** @brief  메인 루프에서 호출되어 원시 샘플을 블록 단위로 압축하고 송신합니다. (압축 모드 전용, 호출당 실행량 제한) */
+extern void vTelemTask(void);
+
+#endif /* INC_TELEMETRY_H_ */
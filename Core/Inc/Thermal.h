@@ -0,0 +1,78 @@
+/**
+ * @file    Thermal.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   권선/MOSFET 열 모델(I²t 과부하) 기반 피크 전류 허용 및 디레이팅 헤더 파일
+ * @details 저속 제어(2kHz)에서 측정 전류로 권선과 MOSFET의 온도 상승을 추정하고, 허용 전류(fIsAllow)를
+ * 피크 전류(ParamCfg.fIsPeak)와 연속 정격(ParamCfg.fIsMax) 사이에서 연속적으로 줄입니다. 전원 제한(PowerLimit.h)의
+ * q축 전류 기준값이 이 허용 전류를 넘지 않으므로, 속도/토크/스로틀 지령 모두 같은 한계를 따릅니다.
+ *
+ * | 모델 | 입력 | 회로 |
+ * | :--- | :--- | :--- |
+ * | **권선** | Is² / Is,cont² | 1차: dθ/dt = (Is²/Is,cont² − θ) / τw (θ = 1: 연속 정격의 정상 상태 온도 상승) |
+ * | **MOSFET** | 도통 1.5·Is²·Rds + 스위칭 (3/π)·Vdc·Is·tsw·fsw | 2차: 소자당 손실(1/6)이 접합-케이스 (Rjc, τjc), 전체 손실이 방열판-주위 (Rca, τca) |
+ *
+ * | 디레이팅 | 허용 전류 |
+ * | :--- | :--- |
+ * | **권선** | θ ≤ THERM_WIND_DERATE: 피크, θ = 1: 연속 정격 (사이 선형) |
+ * | **MOSFET** | Tj ≤ THERM_TJ_DERATE: 피크, Tj ≥ THERM_TJ_MAX: 연속 정격 (사이 선형) |
+ * | **최종** | 두 값 중 작은 값 |
+ *
+ * 피크 2배 정격, 냉간 시작이면 권선 기준 약 0.22·τw(τw = 30s이면 약 7초) 동안 피크를 허용한 뒤 연속 정격으로 매끄럽게 내려옵니다.
+ * 주위 온도는 ESC 텔레메트리 온도(MCU 내부 온도 센서)를 사용합니다. 열 상태는 정지/리셋(vInitController)으로 초기화하지 않습니다.
+ */
+
+#ifndef INC_THERMAL_H_
+#define INC_THERMAL_H_
+
+#include <stdint.h>
+
+/** @name 모델 상수
+ * @{ */
+#define THERM_TS            0.0005f             /**< 호출 주기 (저속 제어 2kHz) [s] */
+#define THERM_WIND_DERATE   0.8f                /**< 권선 디레이팅 시작 열 상태 (연속 정격 상승 대비) */
+#define THERM_FET_RDS       0.002f              /**< MOSFET 도통 저항 [Ohm] (고온 값) */
+#define THERM_FET_TSW       50.0e-9f            /**< 상승 + 하강 스위칭 시간 [s] */
+#define THERM_SW_FACTOR     0.9549f             /**< 3상 스위칭 손실 계수 3/π (레그당 ½·Vdc·I·tsw·fsw, 상전류 평균 2/π·Is, 3레그) */
+#define THERM_RTH_JC        1.5f                /**< 접합-케이스 열저항 [K/W] (소자당) */
+#define THERM_TAU_JC        0.02f               /**< 접합-케이스 열 시정수 [s] */
+#define THERM_RTH_CA        4.0f                /**< 방열판-주위 열저항 [K/W] (전체) */
+#define THERM_TAU_CA        60.0f               /**< 방열판-주위 열 시정수 [s] */
+#define THERM_TJ_DERATE     100.0f              /**< MOSFET 디레이팅 시작 접합 온도 [°C] */
+#define THERM_TJ_MAX        125.0f              /**< MOSFET 연속 정격 제한 접합 온도 [°C] */
+#define THERM_TAMB_DEFAULT  40.0f               /**< 온도 센서 준비 전 주위 온도 [°C] */
+/** @} */
+
+/**
+ * @struct sThermal
+ * @brief  열 모델 상태
+ */
+typedef struct {
+	float fIs2;                 /**< 전류 크기 제곱 Id² + Iq² [A²] */
+	float fThWind;              /**< 권선 열 상태 (1: 연속 정격 정상 상태) */
+	float fPfet;                /**< MOSFET 전체 손실 추정 [W] */
+	float fTamb;                /**< 주위 온도 [°C] */
+	float fDtCa;                /**< 방열판 온도 상승 [K] */
+	float fDtJc;                /**< 접합-케이스 온도 상승 [K] */
+	float fTj;                  /**< 접합 온도 추정 [°C] */
+	float fIsWind;              /**< 권선 기준 허용 전류 [A] */
+	float fIsFet;               /**< MOSFET 기준 허용 전류 [A] */
+	float fIsAllow;             /**< 최종 허용 전류 크기 [A] (전원 제한 q축 기준값 상한) */
+	uint16_t uDerate;           /**< 1: 피크 전류보다 낮게 제한 중 */
+	uint32_t ulDerateCnt;       /**< 디레이팅 저속 주기 수 */
+} sThermal;
+
+/** @brief 열 모델 객체 외부 참조 */
+extern sThermal Thermal;
+
+/**
+ * @brief  열 상태를 냉간(주위 온도)으로 초기화합니다.
+ * @note   vInitParam 이후, 제어 타이머 시작 전에 한 번만 호출합니다.
+ */
+extern void vInitThermal(void);
+/**
+ * @brief  저속 제어(2kHz)에서 호출되어 열 모델을 적분하고 허용 전류를 갱신합니다.
+ */
+extern void vThermalUpdate(void);
+
+#endif /* INC_THERMAL_H_ */
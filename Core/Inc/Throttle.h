@@ -0,0 +1,190 @@
+/**
+ * @file    Throttle.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   RC PWM/DShot 스로틀 입력(TIM5 DMA 캡처) → 필터 → 곡선 → 토크/속도 지령 변환 헤더 파일
+ * @details TIM5(PWM 입력 모드)가 펄스폭을 CCR2에 캡처할 때마다 DMA가 작은 링 버퍼에 기록하고,
+ * 제어 ISR(vThrottleUpdate)이 새 샘플이 있을 때만 필터와 곡선을 적용하여 지령을 갱신합니다. 캡처 인터럽트는 사용하지 않습니다.
+ * 같은 핀(PB2)으로 아날로그 PWM(1MHz 틱) 또는 DShot150/300/600(170MHz 틱, DShot.h)을 받으며 uInput으로 선택합니다.
+ * 직렬 수신기(THR_INPUT_SERIAL)는 RcRx가 게시한 채널 환산 펄스폭을 PWM과 같은 경로로 처리하고, 수신기 링크 Failsafe는 즉시 반영합니다.
+ *
+ * | 단계 | 내용 |
+ * | :--- | :--- |
+ * | **1. 검증** | PWM/직렬: 펄스폭 THR_PULSE_MIN_US ~ THR_PULSE_MAX_US 밖의 샘플은 버림, DShot: CRC 오류/비트 수 오류 프레임은 버림 |
+ * | **2. 필터** | PWM/직렬: 최근 3샘플 중앙값(글리치 제거) → 1차 IIR (fAlpha, 1이면 우회), DShot: 필터 없음 |
+ * | **3. 정규화** | PWM: 보정된 끝점(fMinUs, fCenterUs, fMaxUs), DShot: 48 ~ 2047 (양방향은 48 ~ 1047 역방향, 1048 ~ 2047 정방향) |
+ * | **4. 곡선** | 불감대(PWM만) 제거 후 재정규화 → Expo 곡선 룩업 테이블(THR_LUT_NUM점 선형 보간) |
+ * | **5. 출력** | 토크 모드: 운전 모드(ThrottleMode.h, 제동/드래그/후진)로 Iq 목표 계산 (Iq,max = Te,max × 1/KT), 속도 모드: 목표 속도 = 출력 × 최대 속도 |
+ * | **6. 안전** | THR_LOSS_S 동안 유효 샘플이 없으면 출력 0(Failsafe). 출력이 0인 샘플이 THR_ARM_SAMPLES번 연속될 때까지 재무장 금지 |
+ *
+ * [입력 → 지령 지연]
+ * 펄스(또는 DShot 프레임 마지막 비트) 하강 에지 → 다음 제어 ISR에서 반영(최대 1 제어 주기) → 같은 주기 전류 제어 → 다음 PWM 주기 적용.
+ * ISR은 캡처 이후 경과 시간(TIM5->CNT - CCR2)을 fLatencyUs/fLatencyMaxUs로 측정하며, 여기에 PWM 반영 지연 1.5 제어 주기가 더해집니다.
+ * PWM 입력에서 IIR 필터를 사용하면 (1/fAlpha - 1) 프레임의 군지연이 추가됩니다.
+ * DShot600 프레임은 약 27µs이므로 입력 → 지령 반영은 수십 µs (20kHz 제어 기준 최대 50µs) 입니다.
+ *
+ * [DShot 캡처]
+ * CC2(하강 에지) DMA 요청마다 DMA Burst(DCR: CCR1부터 2워드)로 CCR1(주기), CCR2(High 시간)를 쌍으로 링 버퍼에 기록합니다.
+ * TIM5는 32bit이므로 170MHz 틱에서도 프레임 간 공백이 넘치지 않습니다.
+ *
+ * [양방향 DShot eRPM 응답] (uDshotTelem = 1)
+ * 신호가 반전(Idle High, 반전 CRC)되므로 캡처 극성과 PB2 풀업을 바꿉니다. 프레임 안에서는 카운터가 비트마다 리셋되므로
+ * TIM5 CC4(비트 주기 + THR_BDSHOT_PREP_US)와 CC3(비트 주기 + THR_BDSHOT_TURN_US) 비교는 프레임 뒤 공백에서 한 번씩만 일치합니다.
+ *
+ * | 시점 | 실행 | 동작 |
+ * | :--- | :--- | :--- |
+ * | **CC4** | TIM5 인터럽트 (vThrottleTurnIrq, 우선순위 1) | 방금 끝난 프레임을 uDshotDecLast로 확인 (CRC 오류면 응답 안 함), GCR 선 레벨 준비, 캡처 중지, PB2 출력(Idle High), DMA 무장 |
+ * | **CC3** | 하드웨어 (DMA1_CH8) | CC3 DMA 요청으로 TIM6->CR1 = CEN, 1틱 뒤 첫 업데이트에서 DMA1_CH7이 시작 비트 출력 |
+ * | **완료** | DMA1_CH7 전송 완료 인터럽트 (vThrottleTxDoneIrq) | PB2를 캡처 입력으로 되돌림 |
+ *
+ * TIM6은 기본 타이머라 슬레이브 트리거 입력이 없으므로, TIM5 CC3 일치에서 DMA가 CEN을 써서 시작합니다.
+ * 준비 인터럽트가 제어 ISR(우선순위 0)에 밀려도 응답 시작 시각은 CC3 일치로 정해지므로 흔들리지 않고,
+ * 준비가 CC3보다 늦은 경우에만 그 프레임의 응답을 건너뜁니다 (ulTelemLateCnt).
+ * eRPM 워드는 제어 ISR이 fWrpmSC × 극쌍수로 매 주기 갱신해 두므로, 두 인터럽트 모두 수 µs 안에 끝나 제어 ISR을 막지 않습니다.
+ */
+
+#ifndef INC_THROTTLE_H_
+#define INC_THROTTLE_H_
+
+#include <stdint.h>
+#include "DShot.h"
+#include "ThrottleMode.h"
+
+/** @name 캡처 및 검증
+ * @{ */
+#define THR_RING_SIZE       8u                  /**< DMA 캡처 링 버퍼 크기 (2의 거듭제곱) */
+#define THR_PULSE_MIN_US    700u                /**< 유효 펄스폭 하한 [µs] */
+#define THR_PULSE_MAX_US    2300u               /**< 유효 펄스폭 상한 [µs] */
+#define THR_LOSS_S          0.1f                /**< 신호 끊김 판정 시간 [s] */
+#define THR_ARM_SAMPLES     10u                 /**< 재무장에 필요한 연속 0 출력 샘플 수 */
+/** @} */
+
+/** @name 기본 보정값
+ * @{ */
+#define THR_MIN_US          1000.0f             /**< 최소 펄스폭 [µs] */
+#define THR_CENTER_US       1500.0f             /**< 중립 펄스폭 [µs] (양방향) */
+#define THR_MAX_US          2000.0f             /**< 최대 펄스폭 [µs] */
+#define THR_DEADBAND        0.03f               /**< 불감대 (정규화 값) */
+#define THR_EXPO            0.3f                /**< Expo 계수 (0: 선형, 1: 3차) */
+#define THR_ALPHA           0.5f                /**< IIR 계수 (1: 필터 없음) */
+/** @} */
+
+/** @name 입력 방식
+ * @{ */
+#define THR_INPUT_PWM       0u                  /**< 아날로그 PWM (1MHz 틱, 50 ~ 490Hz) */
+#define THR_INPUT_DSHOT150  1u                  /**< DShot150 (170MHz 틱) */
+#define THR_INPUT_DSHOT300  2u                  /**< DShot300 */
+#define THR_INPUT_DSHOT600  3u                  /**< DShot600 */
+#define THR_INPUT_SERIAL    4u                  /**< 직렬 수신기 채널 (SBUS/CRSF, RcRx.h), 환산 펄스폭으로 PWM 경로 처리 */
+#define THR_INPUT_DEFAULT   THR_INPUT_PWM       /**< 초기 입력 방식 */
+/** @} */
+
+/** @brief DShot 입력 여부 */
+#define THR_IS_DSHOT(u)     ((u) >= THR_INPUT_DSHOT150 && (u) <= THR_INPUT_DSHOT600)
+
+/** @brief DShot 캡처 링 버퍼 크기 [word] ((주기, High) 쌍 64개 = 4 프레임, 2의 거듭제곱) */
+#define THR_DSHOT_RING_SIZE 128u
+/** @brief TIM5 커널 클럭 [Hz] (PCLK1) */
+#define THR_TIM_CLK         170000000u
+/** @brief 프레임 끝 → eRPM 응답 시작 [µs] (TIM5 CC3, 하드웨어 시작) */
+#define THR_BDSHOT_TURN_US  30u
+/** @brief 프레임 끝 → eRPM 응답 준비 인터럽트 [µs] (TIM5 CC4, 제어 ISR 실행 시간보다 충분히 앞) */
+#define THR_BDSHOT_PREP_US  2u
+/** @brief eRPM 응답 최소 속도 [eRPM] (이하는 정지로 응답) */
+#define THR_ERPM_MIN        1000.0f
+/** @brief eRPM 응답 DMA 워드 수 (선 레벨 21bit + Idle High 복귀) */
+#define THR_BDSHOT_TX_LEN   (DSHOT_GCR_BITS + 1u)
+/** @brief DShot 비트율 기준값 [bit/s] (DShot150) */
+#define THR_DSHOT_BASE_BPS  150000u
+
+/** @brief 토크 출력 q축 전류 지령 기울기 [A/s] (제동/토크 차단 응답, 10A까지 5ms) */
+#define THR_IQ_SLOPE        2000.0f
+
+/** @brief Expo 곡선 룩업 테이블 점 수 (입력 0~1, 2^n + 1) */
+#define THR_LUT_NUM         33u
+
+/** @name 출력 대상
+ * @{ */
+#define THR_OUT_OFF         0u                  /**< 스로틀 미사용 (명령 모듈의 설정값 사용) */
+#define THR_OUT_TORQUE      1u                  /**< 토크 지령 (전류 제어 모드) */
+#define THR_OUT_SPEED       2u                  /**< 속도 지령 (속도 제어 모드) */
+/** @} */
+
+/**
+ * @struct sThrottle
+ * @brief  스로틀 입력 설정 및 상태
+ */
+typedef struct {
+	/* 설정 (uOutMode = THR_OUT_OFF 상태에서 변경 후 vThrottleBuildLut) */
+	uint16_t uOutMode;          /**< 출력 대상 (THR_OUT_*) */
+	uint16_t uInput;            /**< 입력 방식 (THR_INPUT_*, vThrottleSetInput으로 변경) */
+	uint16_t uDshotTelem;       /**< 1: 양방향 DShot (반전 신호, eRPM 응답), vThrottleSetInput으로 적용 */
+	uint16_t uBidir;            /**< 1: 양방향 (중립 기준 ±), 0: 단방향 */
+	float fMinUs;               /**< 최소 펄스폭 [µs] */
+	float fCenterUs;            /**< 중립 펄스폭 [µs] */
+	float fMaxUs;               /**< 최대 펄스폭 [µs] */
+	float fDeadband;            /**< 불감대 (정규화 값) */
+	float fExpo;                /**< Expo 계수 */
+	float fAlpha;               /**< IIR 계수 */
+
+	/* 상태 */
+	uint16_t uReady;            /**< 초기화 완료 여부 */
+	uint16_t uRd;               /**< 링 버퍼 판독 위치 */
+	uint16_t uMed[3];           /**< 중앙값 필터 이력 [µs] */
+	uint16_t uFailsafe;         /**< 1: 신호 끊김 또는 재무장 대기 (출력 0) */
+	uint16_t uArmCnt;           /**< 재무장 연속 0 출력 샘플 수 */
+	uint16_t uPeriodUs;         /**< 입력 프레임 주기 [µs] (PWM) */
+	uint16_t uDshotValue;       /**< 마지막 DShot 스로틀 값 (0 ~ 2047) */
+	uint16_t uDshotCmd;         /**< 마지막 DShot 특수 명령 (1 ~ 47, 스로틀 0으로 처리) */
+	uint16_t uTelemArm;         /**< 1: 다음 프레임 뒤 eRPM 응답 (유효 프레임 수신 중) */
+	uint16_t uTelemWord;        /**< 응답할 eRPM 워드 (제어 ISR 갱신) */
+	volatile uint16_t uTelemReq;/**< 1: DShot 텔레메트리 요청 비트 수신 (ESC 텔레메트리가 소비) */
+	float fPulseUs;             /**< 필터된 펄스폭 [µs] */
+	float fOut;                 /**< 곡선 적용 출력 (-1 ~ 1) */
+	float fLossTime;            /**< 마지막 유효 샘플 이후 경과 시간 [s] */
+	float fLatencyUs;           /**< 캡처 → 지령 반영 지연 [µs] */
+	float fLatencyMaxUs;        /**< 최대 지연 [µs] */
+	uint32_t ulSampleCnt;       /**< 처리한 유효 샘플 수 */
+	uint32_t ulRejectCnt;       /**< 범위 밖으로 버린 샘플 수 */
+	uint32_t ulFailsafeCnt;     /**< Failsafe 진입 횟수 */
+	uint32_t ulTelemCnt;        /**< 송신한 eRPM 응답 수 */
+	uint32_t ulTelemSkipCnt;    /**< 마지막 프레임 CRC/비트 오류로 건너뛴 응답 수 */
+	uint32_t ulTelemLateCnt;    /**< 준비가 응답 시각(CC3)보다 늦어 건너뛴 응답 수 */
+	sDshotDec Dshot;            /**< DShot 복호기 */
+	sThrMode Mode;              /**< 토크 출력 운전 모드 (제동/드래그/후진) */
+} sThrottle;
+
+/** @brief 스로틀 객체 외부 참조 */
+extern sThrottle Throttle;
+
+/**
+ * @brief  기본 보정값으로 초기화하고 TIM5 CCR2 → DMA1_CH6 캡처를 시작합니다.
+ * @note   MX_TIM5_Init, MX_DMA_Init 이후 호출해야 합니다. 출력은 THR_OUT_OFF로 시작합니다.
+ */
+extern void vInitThrottle(void);
+/**
+ * @brief  입력 방식을 바꾸고 TIM5 분주/DMA를 다시 설정합니다. (메인 루프 전용)
+ * @param  uInput 입력 방식 (THR_INPUT_*)
+ * @note   재설정 중에는 uReady = 0으로 두어 ISR이 스로틀 출처를 해제하며(CmdReq 설정값 사용), 입력이 바뀌면 Failsafe로 들어가 재무장이 필요합니다.
+ */
+extern void vThrottleSetInput(uint16_t uInput);
+/**
+ * @brief  Expo 곡선 룩업 테이블을 다시 만듭니다. (메인 루프, uOutMode = THR_OUT_OFF 상태에서 호출)
+ */
+extern void vThrottleBuildLut(void);
+/**
+ * @brief  제어 주기마다 호출되어 새 캡처 샘플을 처리하고 설정값을 명령 모듈의 스로틀 출처로 게시합니다. (vCmdFetch 이전)
+ */
+extern void vThrottleUpdate(void);
+/**
+ * @brief  TIM5 CC4(프레임 끝 + THR_BDSHOT_PREP_US)에서 방금 받은 프레임이 유효하면 eRPM 응답을 준비합니다.
+ * @note   TIM5_IRQHandler에서 호출합니다. 송신 시작은 TIM5 CC3 DMA 요청이 하드웨어로 수행합니다.
+ */
+extern void vThrottleTurnIrq(void);
+/**
+ * @brief  eRPM 응답 송신이 끝나면 PB2를 캡처 입력으로 되돌립니다.
+ * @note   DMA1_Channel7_IRQHandler에서 호출합니다.
+ */
+extern void vThrottleTxDoneIrq(void);
+
+#endif /* INC_THROTTLE_H_ */
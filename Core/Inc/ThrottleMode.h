@@ -0,0 +1,99 @@
+/**
+ * @file    ThrottleMode.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   RC 스로틀 운전 모드(전진/제동, 전진/제동/후진, 3D 양방향) 및 드래그 브레이크 헤더 파일
+ * @details 스로틀 출력(-1 ~ 1)과 회전 속도로 q축 전류 목표를 만드는 상태 머신입니다. 하드웨어에 의존하지 않으므로
+ * 호스트에서 같은 소스로 모드 전이를 검증할 수 있습니다. 토크 출력(THR_OUT_TORQUE)에서 제어 주기마다 호출됩니다.
+ *
+ * | 모드 | 스틱 전진 | 스틱 중립 | 스틱 후진 |
+ * | :--- | :--- | :--- | :--- |
+ * | **THRM_DIRECT** | 출력 × Iq,max | 0 | 출력 × Iq,max (기존 동작) |
+ * | **THRM_FWD_BRAKE** | 전진 | 드래그 브레이크 | 제동 (정지 후 0, 후진 없음) |
+ * | **THRM_FWD_BRAKE_REV** | 전진 (후진 중이면 제동 → 정지 즉시 전진) | 드래그 브레이크 | 제동 → 정지 후 스틱 후진을 fRevDelayS 동안 계속 유지하면 후진 (그 사이 중립/전진이면 취소) |
+ * | **THRM_BIDIR_3D** | 회전과 같은 방향이면 구동, 반대 방향이면 제동 → 정지 후 반대 방향 구동 (스틱 부호 = 방향) | 드래그 브레이크 | 〃 |
+ *
+ * [제동 전류]
+ * 제동 전류는 회전 반대 방향으로 |스틱| × fBrakeCurr (드래그는 fDragCurr)이며, |속도| < fFadeRpm 구간에서 속도에 비례해 줄여
+ * 0 속도에서 정확히 0이 되므로 제동이 역방향 구동으로 넘어가지 않습니다. 회생 전류는 전원 제한(PowerLimit.h)의
+ * 직류단 전압 상한 안에서 최대로 흐릅니다.
+ *
+ * @note 제동/후진은 중립 기준 양방향 스로틀(Throttle.uBidir = 1)에서만 스틱 후진 구간이 생깁니다.
+ */
+
+#ifndef INC_THROTTLEMODE_H_
+#define INC_THROTTLEMODE_H_
+
+#include <stdint.h>
+
+/** @name 운전 모드
+ * @{ */
+#define THRM_DIRECT         0u
+#define THRM_FWD_BRAKE      1u
+#define THRM_FWD_BRAKE_REV  2u
+#define THRM_BIDIR_3D       3u
+/** @} */
+
+/** @name 상태
+ * @{ */
+#define THRM_ST_DRIVE       0u                  /**< 구동 (iDir 방향) 또는 중립 드래그 */
+#define THRM_ST_BRAKE       1u                  /**< 제동 */
+#define THRM_ST_REV_WAIT    2u                  /**< 정지 후 후진 지연 (스틱 후진 유지 중, 출력 0) */
+/** @} */
+
+/** @name 기본값
+ * @{ */
+#define THRM_BRAKE_CURR     8.0f                /**< 최대 제동 전류 [A] */
+#define THRM_DRAG_CURR      0.0f                /**< 드래그 브레이크 전류 [A] */
+#define THRM_REV_SCALE      0.5f                /**< 후진 출력 비율 */
+#define THRM_REV_DELAY_S    0.2f                /**< 정지 후 스틱 후진 유지 시간 [s] */
+#define THRM_STOP_RPM       100.0f              /**< 정지 판정 속도 [RPM] */
+#define THRM_FADE_RPM       500.0f              /**< 제동 전류 감쇄 시작 속도 [RPM] */
+/** @} */
+
+/**
+ * @struct sThrMode
+ * @brief  운전 모드 설정 및 상태
+ */
+typedef struct {
+	/* 설정 */
+	uint16_t uMode;             /**< 운전 모드 (THRM_*) */
+	float fBrakeCurr;           /**< 최대 제동 전류 [A] */
+	float fDragCurr;            /**< 드래그 브레이크 전류 [A] (0: 사용 안 함) */
+	float fRevScale;            /**< 후진 출력 비율 (0 ~ 1) */
+	float fRevDelayS;           /**< 정지 후 후진 진입까지 스틱 후진 유지 시간 [s] */
+	float fStopRpm;             /**< 정지 판정 속도 [RPM] */
+	float fFadeRpm;             /**< 제동 전류 감쇄 시작 속도 [RPM] (fStopRpm보다 크게) */
+
+	/* 상태 */
+	uint16_t uState;            /**< 상태 (THRM_ST_*) */
+	int16_t iDir;               /**< 구동 방향 (+1: 전진, -1: 후진) */
+	float fTimer;               /**< 후진 지연 경과 시간 [s] */
+	float fIqRef;               /**< q축 전류 목표 [A] */
+	uint32_t ulRevCnt;          /**< 후진 진입 횟수 */
+} sThrMode;
+
+/**
+ * @brief  기본 설정으로 초기화합니다.
+ * @param  pM 운전 모드
+ * @retval 없음
+ */
+extern void vThrModeInit(sThrMode* pM);
+/**
+ * @brief  상태를 전진 구동으로 되돌립니다. (Failsafe, 입력 변경 시)
+ * @param  pM 운전 모드
+ * @retval 없음
+ */
+extern void vThrModeReset(sThrMode* pM);
+/**
+ * @brief  스틱 값과 속도로 상태를 갱신하고 q축 전류 목표를 계산합니다.
+ * @param  pM 운전 모드
+ * @param  fStick 스로틀 출력 (-1 ~ 1, 곡선 적용 후)
+ * @param  fWrpm 회전 속도 [RPM]
+ * @param  fIqMax q축 전류 최대값 [A]
+ * @param  fTs 호출 주기 [s]
+ * @retval q축 전류 목표 [A]
+ */
+extern float fThrModeUpdate(sThrMode* pM, float fStick, float fWrpm, float fIqMax, float fTs);
+
+#endif /* INC_THROTTLEMODE_H_ */
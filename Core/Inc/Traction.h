@@ -0,0 +1,119 @@
+/**
+ * @file    Traction.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   속도 미분 기반 구동력 제어(Traction Control) 및 출발 제어(Launch Control) 헤더 파일
+ * @details 바퀴가 미끄러지면 차량 질량이 허용하는 것보다 회전 가속도가 갑자기 커집니다. 속도 제어 주기(40 제어 주기)마다
+ * 관측기 속도(fWrpmSC)를 미분하여 가속도를 추정하고, 토크 방향 가속도가 한계를 넘으면 q축 전류 한계(fIqLim)를 즉시 줄인 뒤
+ * 유지 시간 후 기울기로 복귀시킵니다. 하드웨어에 의존하지 않으며 반복문 없이 호출당 일정한 연산(나눗셈 3회 이내)만 수행합니다.
+ *
+ * | 단계 | 계산 |
+ * | :--- | :--- |
+ * | **1. 가속도 추정** | a = LPF((ω[k] − ω[k−1]) / Ts) [RPM/s] |
+ * | **2. 미끄럼 한계** | a,max = fAccMax, fJeq > 0이면 min(fAccMax, fSlipRatio·KT·\|Iq\|/Jeq + TC_ACC_MARGIN) (차량 모델) |
+ * | **3. 미끄럼 판정** | 토크 방향 가속도 a·sign(Iq) > a,max (\|Iq\| ≥ TC_IQ_ON일 때만, 제동 잠김도 포함) |
+ * | **4. 토크 차단** | 미끄럼 중 매 주기 Iq,lim = max(min(Iq,lim, \|Iq\|)·fCutRatio, fIqFloor), 유지 타이머 fHoldS 재시작 |
+ * | **5. 복귀** | 유지 시간 후 Iq,lim += fRecoverRate·Ts (Iq,max까지) |
+ * | **6. 출발 프로파일** | 정지 상태에서 토크 지령이 생기면 fLaunchTimeS 동안 Iq,lim ≤ 프로파일(t)·Iq,max (TC_LAUNCH_PTS점 선형 보간) |
+ *
+ * 출력 한계는 전류 지령(vCurrentRef)과 속도 제어기 토크 한계(vSpeedControl)에 함께 적용되므로 토크/속도 출력 모두에 동작하며,
+ * 속도 제어기는 한계를 Anti-windup에 반영합니다. 사용 안 함(uEn = 0, uLaunchEn = 0)이면 한계는 TC_LIM_NONE입니다.
+ */
+
+#ifndef INC_TRACTION_H_
+#define INC_TRACTION_H_
+
+#include <stdint.h>
+
+/** @name 상수
+ * @{ */
+#define TC_LIM_NONE         1.0e6f              /**< 제한 없음 [A] */
+#define TC_ACC_ALPHA        0.5f                /**< 가속도 추정 LPF 계수 (속도 제어 주기 기준) */
+#define TC_ACC_MARGIN       500.0f              /**< 차량 모델 한계 여유 [RPM/s] (추정 잡음, 저토크 구간) */
+#define TC_IQ_ON            0.5f                /**< 미끄럼 판정/출발 시작 토크 지령 [A] */
+#define TC_RADS_TO_RPM      9.5492966f          /**< rad/s → RPM */
+#define TC_LAUNCH_PTS       5u                  /**< 출발 프로파일 점 수 (0 ~ fLaunchTimeS 등간격) */
+/** @} */
+
+/** @name 기본값
+ * @{ */
+#define TC_ACC_MAX          20000.0f            /**< 최대 가속도 [RPM/s] */
+#define TC_JEQ              0.0f                /**< 전동기축 환산 차량 관성 [kg·m^2] (0: 모델 사용 안 함) */
+#define TC_SLIP_RATIO       1.5f                /**< 모델 가속도 대비 미끄럼 판정 배율 */
+#define TC_CUT_RATIO        0.5f                /**< 미끄럼 중 속도 제어 주기당 전류 한계 감소 비율 */
+#define TC_IQ_FLOOR         1.0f                /**< 전류 한계 하한 [A] */
+#define TC_HOLD_S           0.05f               /**< 차단 후 복귀 전 유지 시간 [s] */
+#define TC_RECOVER_RATE     50.0f               /**< 복귀 기울기 [A/s] */
+#define TC_LAUNCH_TIME_S    0.3f                /**< 출발 프로파일 길이 [s] */
+#define TC_STOP_RPM         100.0f              /**< 출발 재무장 정지 판정 속도 [RPM] */
+/** @} */
+
+/** @name 출발 상태
+ * @{ */
+#define TC_LAUNCH_OFF       0u                  /**< 사용 안 함 또는 프로파일 종료 (정지 + 지령 0이면 READY) */
+#define TC_LAUNCH_READY     1u                  /**< 정지 대기 (프로파일 첫 점으로 제한) */
+#define TC_LAUNCH_ACTIVE    2u                  /**< 프로파일 진행 중 */
+/** @} */
+
+/**
+ * @struct sTraction
+ * @brief  구동력/출발 제어 설정 및 상태
+ */
+typedef struct {
+	/* 설정 */
+	uint16_t uEn;               /**< 1: 구동력 제어 사용 */
+	uint16_t uLaunchEn;         /**< 1: 출발 제어 사용 */
+	float fAccMax;              /**< 최대 가속도 [RPM/s] */
+	float fJeq;                 /**< 전동기축 환산 차량 관성 [kg·m^2] (0: 고정 한계만 사용) */
+	float fSlipRatio;           /**< 모델 가속도 대비 미끄럼 판정 배율 */
+	float fCutRatio;            /**< 미끄럼 중 주기당 전류 한계 감소 비율 (0 ~ 1) */
+	float fIqFloor;             /**< 전류 한계 하한 [A] */
+	float fHoldS;               /**< 차단 후 유지 시간 [s] */
+	float fRecoverRate;         /**< 복귀 기울기 [A/s] */
+	float fLaunchTimeS;         /**< 출발 프로파일 길이 [s] */
+	float fLaunchProf[TC_LAUNCH_PTS]; /**< 출발 프로파일 (Iq,max 대비 비율) */
+	float fStopRpm;             /**< 출발 재무장 정지 판정 속도 [RPM] */
+
+	/* 상태 */
+	float fWrpmPrev;            /**< 직전 속도 [RPM] */
+	float fAcc;                 /**< 가속도 추정 [RPM/s] */
+	float fAccLim;              /**< 미끄럼 판정 가속도 [RPM/s] */
+	float fIqTc;                /**< 구동력 제어 전류 한계 [A] */
+	float fHoldTimer;           /**< 유지 남은 시간 [s] */
+	float fLaunchTimer;         /**< 출발 경과 시간 [s] */
+	float fIqLim;               /**< 최종 q축 전류 한계 크기 [A] */
+	uint16_t uSlip;             /**< 1: 미끄럼 판정 중 */
+	uint16_t uLaunchState;      /**< 출발 상태 (TC_LAUNCH_*) */
+	uint16_t uInit;             /**< 0: 첫 호출 (속도 미분 기준값 없음) */
+	uint32_t ulSlipCnt;         /**< 미끄럼 진입 횟수 */
+	uint32_t ulLaunchCnt;       /**< 출발 프로파일 실행 횟수 */
+} sTraction;
+
+/** @brief 구동력/출발 제어 객체 외부 참조 */
+extern sTraction Traction;
+
+/**
+ * @brief  기본 설정으로 초기화합니다.
+ * @param  pT 구동력 제어
+ * @retval 없음
+ */
+extern void vTractionInit(sTraction* pT);
+/**
+ * @brief  추정/제한 상태를 초기화합니다. (vInitController에서 호출, 설정값 유지)
+ * @param  pT 구동력 제어
+ * @retval 없음
+ */
+extern void vTractionReset(sTraction* pT);
+/**
+ * @brief  속도 제어 주기마다 가속도를 추정하고 q축 전류 한계를 갱신합니다.
+ * @param  pT 구동력 제어
+ * @param  fWrpm 관측기 속도 [RPM]
+ * @param  fIqRef 현재 q축 전류 지령 [A] (부호 = 토크 방향)
+ * @param  fIqMax q축 전류 최대값 [A]
+ * @param  fKT 토크 상수 [Nm/A] (차량 모델용)
+ * @param  fTs 호출 주기 [s]
+ * @retval q축 전류 한계 크기 [A]
+ */
+extern float fTractionUpdate(sTraction* pT, float fWrpm, float fIqRef, float fIqMax, float fKT, float fTs);
+
+#endif /* INC_TRACTION_H_ */
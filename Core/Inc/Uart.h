@@ -0,0 +1,75 @@
+/**
+ * @file    Uart.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   USART1 레지스터 직접 제어 드라이버 헤더 파일
+ * @details HAL UART 모듈 없이 USART1(PB6: TX, PB7: RX)을 설정하고, 송신은 DMA1 채널 4, 수신은 DMA1 채널 5(순환 모드)로 처리합니다.
+ * 송신 요청은 비차단이며, 이전 전송이 끝나지 않았으면 즉시 실패를 반환합니다.
+ */
+
+#ifndef INC_UART_H_
+#define INC_UART_H_
+
+#include <stdint.h>
+
+/** @brief USART1 통신 속도 [bps] (OVER8 사용, 170MHz / 4Mbps = 정수 분주) */
+#define UART_BAUD           4000000UL
+
+/** @brief USART1 커널 클럭 (PCLK2) [Hz] */
+#define UART_KER_CLK        170000000UL
+
+/** @brief 수신 순환 버퍼 크기 [byte] (2의 거듭제곱, 4Mbps 기준 약 2.5ms) */
+#define UART_RX_BUF_SIZE    1024u
+
+/** @brief CRC-16/CCITT-FALSE 초기값 */
+#define CRC16_INIT          0xFFFFu
+
+/**
+ * @brief  USART1과 송신 DMA(DMA1_CH4), 수신 DMA(DMA1_CH5)를 초기화합니다. (8N1)
+ * @note   MX_DMA_Init(DMA1/DMAMUX1 클럭) 이후 호출해야 합니다.
+ * @param  ulBaud 통신 속도 [bps]
+ * @retval 없음
+ */
+extern void vInitUart(uint32_t ulBaud);
+
+/**
+ * @brief  송신 DMA가 전송 중인지 확인합니다.
+ * @retval 1: 전송 중, 0: 유휴
+ */
+extern uint16_t uUartTxBusy(void);
+
+/**
+ * @brief  버퍼를 DMA로 송신합니다. (비차단)
+ * @note   버퍼는 전송이 끝날 때까지 유지되어야 합니다. 제어 ISR(텔레메트리)과 메인 루프(통신 응답)가 함께 호출하므로
+ * 유휴 확인과 전송 시작 사이에는 인터럽트를 잠시 금지합니다.
+ * @param  pData 송신 버퍼
+ * @param  uLen 송신 바이트 수 (1 이상)
+ * @retval 1: 전송 시작, 0: 이전 전송 진행 중
+ */
+extern uint16_t uUartTxStart(const void* pData, uint16_t uLen);
+
+/**
+ * @brief  지정한 버퍼가 아직 송신 중인지 확인합니다.
+ * @param  pData 송신을 요청했던 버퍼
+ * @retval 1: 해당 버퍼 송신 중, 0: 송신 완료 (버퍼 재사용 가능)
+ */
+extern uint16_t uUartTxBusyWith(const void* pData);
+
+/**
+ * @brief  수신 순환 버퍼에서 아직 읽지 않은 바이트를 꺼냅니다. (메인 루프 전용)
+ * @param  pDst 복사 대상
+ * @param  uMax 최대 바이트 수
+ * @retval 꺼낸 바이트 수
+ */
+extern uint16_t uUartRxRead(uint8_t* pDst, uint16_t uMax);
+
+/**
+ * @brief  CRC-16/CCITT-FALSE를 누적 계산합니다. (테이블 방식, ISR에서 호출 가능)
+ * @param  uCrc 초기값 (CRC16_INIT) 또는 이전 누적값
+ * @param  pData 데이터
+ * @param  uLen 바이트 수
+ * @retval 누적 CRC
+ */
+extern uint16_t uCrc16(uint16_t uCrc, const void* pData, uint16_t uLen);
+
+#endif /* INC_UART_H_ */
@@ -0,0 +1,196 @@
+/**
+ * @file    VarTable.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   모니터링 가능한 변수의 컴파일 타임 레지스트리(심볼 테이블) 헤더 파일
+ * @details VAR_TABLE_LIST X-매크로 한 곳에 변수를 등록하면 ID 열거형과 플래시 상수 테이블(VarTable)이
+ * 함께 생성됩니다. DAC 출력, 스코프, 블랙박스, 통신 프로토콜은 ID로 O(1) 조회하여 채널을 구성합니다.
+ *
+ * @details [호스트 디코딩]
+ * ELF에서는 `VarTableInfo`(sVarTableInfo) 심볼을 찾아 ulMagic, uEntryNum, uEntrySize로 `VarTable` 배열을 해석합니다.
+ * 이름 해시는 이름을 32byte로 0 패딩(초과분 절단)한 뒤 계산한 FNV-1a 32비트 값입니다.
+ */
+
+#ifndef INC_VARTABLE_H_
+#define INC_VARTABLE_H_
+
+#include <stdint.h>
+#include "DataChannel.h"
+
+/** @name 물리 단위 코드
+ * @{ */
+#define VAR_UNIT_NONE       0u
+#define VAR_UNIT_A          1u      /**< 전류 [A] */
+#define VAR_UNIT_V          2u      /**< 전압 [V] */
+#define VAR_UNIT_RPM        3u      /**< 속도 [RPM] */
+#define VAR_UNIT_RAD        4u      /**< 각도 [rad] */
+#define VAR_UNIT_RAD_S      5u      /**< 각속도 [rad/s] */
+#define VAR_UNIT_NM         6u      /**< 토크 [Nm] */
+#define VAR_UNIT_S          7u      /**< 시간 [s] */
+#define VAR_UNIT_US         8u      /**< 시간 [µs] */
+#define VAR_UNIT_CNT        9u      /**< 카운트/상태/플래그 */
+#define VAR_UNIT_RPM_S      10u     /**< 각가속도 [RPM/s] */
+#define VAR_UNIT_MAH        11u     /**< 전하량 [mAh] */
+#define VAR_UNIT_DEGC       12u     /**< 온도 [°C] */
+#define VAR_UNIT_W          13u     /**< 전력 [W] */
+/** @} */
+
+/** @name 쓰기 권한
+ * @{ */
+#define VAR_ACC_RO          0u      /**< 읽기 전용 (측정값, 상태, 카운터, 파생값) */
+#define VAR_ACC_RW          1u      /**< 쓰기 가능 (제어 ISR이 CMD_VAR_WRITE 이벤트로 적용) */
+#define VAR_ACC_SET         2u      /**< 설정값 우편함이 소유 (쓰기는 CmdReq.Set으로 전달) */
+/** @} */
+
+/** @brief 테이블 식별자 ('VTBL') */
+#define VAR_TABLE_MAGIC     0x4C425456UL
+
+/** @name 컴파일 타임 이름 해시 (32byte 0 패딩 FNV-1a)
+ * @details 각 단계에서 해시 값이 한 번만 참조되므로 매크로 전개 크기가 길이에 비례합니다.
+ * @{ */
+#define VAR_HASH_CHAR(s, i)     ((uint32_t)(uint8_t)(((i) < sizeof(s)) ? (s)[((i) < sizeof(s)) ? (i) : 0] : 0))
+#define VAR_HASH_STEP(s, i, h)  ((((uint32_t)(h)) ^ VAR_HASH_CHAR(s, i)) * 16777619u)
+#define VAR_HASH_4(s, i, h)     VAR_HASH_STEP(s, (i) + 3u, VAR_HASH_STEP(s, (i) + 2u, VAR_HASH_STEP(s, (i) + 1u, VAR_HASH_STEP(s, (i), h))))
+#define VAR_HASH_16(s, i, h)    VAR_HASH_4(s, (i) + 12u, VAR_HASH_4(s, (i) + 8u, VAR_HASH_4(s, (i) + 4u, VAR_HASH_4(s, (i), h))))
+#define VAR_HASH(s)             VAR_HASH_16(s, 16u, VAR_HASH_16(s, 0u, 2166136261u))
+/** @} */
+
+/**
+ * @brief 모니터링 변수 목록 X(ID, 이름, 주소, 타입, 단위, 기본 스케일, 쓰기 권한)
+ * @details 기본 스케일은 16비트 샘플 기록용 (전류/전압 1000 → mA/mV, 각도 10000 → 0.1 mrad).
+ * 쓰기 권한이 VAR_ACC_RO인 항목은 통신/레지스트리 쓰기를 거절합니다.
+ * 항목 순서가 ID이므로 호스트 호환을 위해 새 항목은 끝에 추가합니다.
+ */
+#define VAR_TABLE_LIST(X) \
+	X(CC_IAS,        "CC.fIasHall",      &INV.CC.fIasHall,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_IBS,        "CC.fIbsHall",      &INV.CC.fIbsHall,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_ICS,        "CC.fIcsHall",      &INV.CC.fIcsHall,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_IDSR,       "CC.fIdsr",         &INV.CC.fIdsr,             DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_IQSR,       "CC.fIqsr",         &INV.CC.fIqsr,             DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_IDSR_REF,   "CC.fIdsrRef",      &INV.CC.fIdsrRef,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_IQSR_REF,   "CC.fIqsrRef",      &INV.CC.fIqsrRef,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(CC_VDSR_REF,   "CC.fVdsrRef",      &INV.CC.fVdsrRef,          DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_VQSR_REF,   "CC.fVqsrRef",      &INV.CC.fVqsrRef,          DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_VDSR_OUT,   "CC.fVdsrOut",      &INV.CC.fVdsrOut,          DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_VQSR_OUT,   "CC.fVqsrOut",      &INV.CC.fVqsrOut,          DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_VDQ_MAG,    "CC.fVdqsrOutMag",  &INV.CC.fVdqsrOutMag,      DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_IDSR_INTEG, "CC.fIdsrInteg",    &INV.CC.fIdsrInteg,        DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_IQSR_INTEG, "CC.fIqsrInteg",    &INV.CC.fIqsrInteg,        DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(CC_DEL_IDS_FW, "CC.fDelIdsrRefFW", &INV.CC.fDelIdsrRefFW,     DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(SO_THETAR,     "SO.fThetar",       &INV.SO.fThetar,           DCH_TYPE_FLOAT,  VAR_UNIT_RAD,   10000.0f, VAR_ACC_RO) \
+	X(SO_THETAR_CC,  "SO.fThetarCC",     &INV.SO.fThetarCC,         DCH_TYPE_FLOAT,  VAR_UNIT_RAD,   10000.0f, VAR_ACC_RO) \
+	X(SO_THETAR_HALL,"SO.fThetar_Hall",  &INV.SO.fThetar_Hall,      DCH_TYPE_FLOAT,  VAR_UNIT_RAD,   10000.0f, VAR_ACC_RO) \
+	X(SO_WRPM_EST,   "SO.fWrpmEst",      &INV.SO.fWrpmEst,          DCH_TYPE_FLOAT,  VAR_UNIT_RPM,   1.0f, VAR_ACC_RO) \
+	X(SO_WRPM_SC,    "SO.fWrpmSC",       &INV.SO.fWrpmSC,           DCH_TYPE_FLOAT,  VAR_UNIT_RPM,   1.0f, VAR_ACC_RO) \
+	X(SO_HALL_STATE, "SO.uHall_State",   &INV.SO.uHall_State,       DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(SO_WR_HALL,    "SO.fWrHallEdge",   &INV.SO.fWrHallEdge,       DCH_TYPE_FLOAT,  VAR_UNIT_RAD_S, 1.0f, VAR_ACC_RO) \
+	X(SC_WRPM_REF,   "SC.fWrpmRef",      &INV.SC.fWrpmRef,          DCH_TYPE_FLOAT,  VAR_UNIT_RPM,   1.0f, VAR_ACC_RO) \
+	X(SC_WRPM_REFSET,"SC.fWrpmRefSet",   &INV.SC.fWrpmRefSet,       DCH_TYPE_FLOAT,  VAR_UNIT_RPM,   1.0f, VAR_ACC_SET) \
+	X(SC_TE_REF,     "SC.fTeRef",        &INV.SC.fTeRef,            DCH_TYPE_FLOAT,  VAR_UNIT_NM,    10000.0f, VAR_ACC_RO) \
+	X(SC_TE_INTEG,   "SC.fTeInteg",      &INV.SC.fTeInteg,          DCH_TYPE_FLOAT,  VAR_UNIT_NM,    10000.0f, VAR_ACC_RO) \
+	X(SC_IQSR_REF,   "SC.fIqsrRefSC",    &INV.SC.fIqsrRefSC,        DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(VDC,           "fVdc",             &fVdc,                     DCH_TYPE_FLOAT,  VAR_UNIT_V,     1000.0f, VAR_ACC_RO) \
+	X(TSAMP,         "fTsamp",           &fTsamp,                   DCH_TYPE_FLOAT,  VAR_UNIT_S,     1.0e7f, VAR_ACC_RO) \
+	X(ELAPSED_US,    "fElapsedTimeUs",   &fElapsedTimeUs,           DCH_TYPE_FLOAT,  VAR_UNIT_US,    100.0f, VAR_ACC_RO) \
+	X(CTRL_CYCLES,   "ulControlCycles",  &ulControlCycles,          DCH_TYPE_UINT32, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(OVERRUN_CNT,   "ulOverrunCnt",     &ulOverrunCnt,             DCH_TYPE_UINT32, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(STATE,         "uCurrState",       &uCurrState,               DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(CTRL_MODE,     "uControlMode",     &uControlMode,             DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_SET) \
+	X(SW_FAULT,      "SW_Fault",         &SW_Fault,                 DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(TZ_FAULT,      "TZ_Fault",         &TZ_Fault,                 DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(FAULT_LATCH,   "Fault.uFaultLatch",&INV.Fault_Info.uFaultLatch, DCH_TYPE_UINT16, VAR_UNIT_CNT, 1.0f, VAR_ACC_RO) \
+	X(FAULT_RAW,     "Fault.uFaultRaw",  &INV.Fault_Info.uFaultRaw, DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(SYNC_PULSE,    "SyncPwm.uPulseNum",&SyncPwm.uPulseNum,        DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(THR_OUT_MODE,  "Throttle.uOutMode",&Throttle.uOutMode,        DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RW) \
+	X(THR_PULSE,     "Throttle.fPulseUs",&Throttle.fPulseUs,        DCH_TYPE_FLOAT,  VAR_UNIT_US,    10.0f, VAR_ACC_RO) \
+	X(THR_OUT,       "Throttle.fOut",    &Throttle.fOut,            DCH_TYPE_FLOAT,  VAR_UNIT_NONE,  1000.0f, VAR_ACC_RO) \
+	X(THR_FAILSAFE,  "Throttle.uFailsafe",&Throttle.uFailsafe,      DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(THR_LATENCY,   "Throttle.fLatencyUs",&Throttle.fLatencyUs,    DCH_TYPE_FLOAT,  VAR_UNIT_US,    1.0f, VAR_ACC_RO) \
+	X(THR_DSHOT_VAL, "Throttle.uDshotValue",&Throttle.uDshotValue,  DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(THR_DSHOT_CRC, "Dshot.ulCrcErrCnt",&Throttle.Dshot.ulCrcErrCnt, DCH_TYPE_UINT32, VAR_UNIT_CNT, 1.0f, VAR_ACC_RO) \
+	X(THR_TELEM_CNT, "Throttle.ulTelemCnt",&Throttle.ulTelemCnt,    DCH_TYPE_UINT32, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(RC_LINK_OK,    "RcRx.uLinkOk",     &RcRx.uLinkOk,             DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(ESC_IDC,       "EscTelem.fIdc",    &EscTelem.fIdc,            DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(ESC_MAH,       "EscTelem.fMah",    &EscTelem.fMah,            DCH_TYPE_FLOAT,  VAR_UNIT_MAH,   1.0f, VAR_ACC_RO) \
+	X(ESC_TEMP,      "EscTelem.fTempC",  &EscTelem.fTempC,          DCH_TYPE_FLOAT,  VAR_UNIT_DEGC,  100.0f, VAR_ACC_RO) \
+	X(ESC_FRAME_CNT, "EscTelem.ulFrameCnt",&EscTelem.ulFrameCnt,    DCH_TYPE_UINT32, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(PWR_PBAT,      "PwrLim.fPbat",     &PwrLim.fPbat,             DCH_TYPE_FLOAT,  VAR_UNIT_W,     10.0f, VAR_ACC_RO) \
+	X(PWR_IBAT,      "PwrLim.fIbat",     &PwrLim.fIbat,             DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(PWR_IQ_RED,    "PwrLim.fIqRed",    &PwrLim.fIqRed,            DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(PWR_ACTIVE,    "PwrLim.uActive",   &PwrLim.uActive,           DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(PWR_REGEN_RED, "PwrLim.fIqRegenRed",&PwrLim.fIqRegenRed,      DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(PWR_ID_BRAKE,  "PwrLim.fIdBrake",  &PwrLim.fIdBrake,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(THRM_STATE,    "Mode.uState",      &Throttle.Mode.uState,     DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(THRM_IQ_REF,   "Mode.fIqRef",      &Throttle.Mode.fIqRef,     DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(TC_ACC,        "Traction.fAcc",    &Traction.fAcc,            DCH_TYPE_FLOAT,  VAR_UNIT_RPM_S, 0.1f, VAR_ACC_RO) \
+	X(TC_IQ_LIM,     "Traction.fIqLim",  &Traction.fIqLim,          DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(TC_SLIP,       "Traction.uSlip",   &Traction.uSlip,           DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(TC_SLIP_CNT,   "Traction.ulSlipCnt",&Traction.ulSlipCnt,      DCH_TYPE_UINT32, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(TC_LAUNCH,     "Traction.uLaunchState",&Traction.uLaunchState,DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(THERM_WIND,    "Thermal.fThWind",  &Thermal.fThWind,          DCH_TYPE_FLOAT,  VAR_UNIT_NONE,  1000.0f, VAR_ACC_RO) \
+	X(THERM_TJ,      "Thermal.fTj",      &Thermal.fTj,              DCH_TYPE_FLOAT,  VAR_UNIT_DEGC,  100.0f, VAR_ACC_RO) \
+	X(THERM_PFET,    "Thermal.fPfet",    &Thermal.fPfet,            DCH_TYPE_FLOAT,  VAR_UNIT_W,     100.0f, VAR_ACC_RO) \
+	X(THERM_IS_ALLOW,"Thermal.fIsAllow", &Thermal.fIsAllow,         DCH_TYPE_FLOAT,  VAR_UNIT_A,     1000.0f, VAR_ACC_RO) \
+	X(THERM_DERATE,  "Thermal.uDerate",  &Thermal.uDerate,          DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO) \
+	X(ADC_CALIB_SRC, "uAdcCalibSrc",     &uAdcCalibSrc,             DCH_TYPE_UINT16, VAR_UNIT_CNT,   1.0f, VAR_ACC_RO)
+
+/** @brief 변수 ID 열거형 (VAR_ID_<ID>) */
+typedef enum {
+#define VAR_TABLE_ENUM(id, name, addr, type, unit, scale, acc)	VAR_ID_##id,
+	VAR_TABLE_LIST(VAR_TABLE_ENUM)
+#undef VAR_TABLE_ENUM
+	VAR_ID_NUM
+} eVarId;
+
+/**
+ * @struct sVarEntry
+ * @brief  변수 레지스트리 항목 (플래시 상수, 24byte)
+ */
+typedef struct {
+	uint32_t ulHash;                /**< 이름 해시 (VAR_HASH) */
+	const char* pName;              /**< 이름 문자열 */
+	const volatile void* pAddr;     /**< 변수 주소 */
+	uint16_t uType;                 /**< 변수 타입 (DCH_TYPE_*) */
+	uint16_t uUnit;                 /**< 물리 단위 (VAR_UNIT_*) */
+	float fScale;                   /**< 기본 스케일 (16비트 샘플 기록용) */
+	uint16_t uAccess;               /**< 쓰기 권한 (VAR_ACC_*) */
+	uint16_t uReserved;
+} sVarEntry;
+
+/**
+ * @struct sVarTableInfo
+ * @brief  호스트 도구가 테이블을 찾고 해석하기 위한 헤더
+ */
+typedef struct {
+	uint32_t ulMagic;               /**< VAR_TABLE_MAGIC */
+	uint16_t uEntryNum;             /**< 항목 수 (VAR_ID_NUM) */
+	uint16_t uEntrySize;            /**< 항목 크기 (sizeof(sVarEntry)) */
+	const sVarEntry* pTable;        /**< 테이블 시작 주소 */
+} sVarTableInfo;
+
+/** @brief 변수 레지스트리 (플래시) */
+extern const sVarEntry VarTable[VAR_ID_NUM];
+/** @brief 변수 레지스트리 헤더 (플래시) */
+extern const sVarTableInfo VarTableInfo;
+
+/**
+ * @brief  ID로 레지스트리 항목을 조회합니다. (O(1))
+ * @param  uId 변수 ID
+ * @retval 항목 포인터 (범위 밖이면 0)
+ */
+extern const sVarEntry* pVarGet(uint16_t uId);
+/**
+ * @brief  이름 해시로 변수 ID를 검색합니다. (항목 수에 비례, 통신 초기화 등 비실시간 용도)
+ * @param  ulHash 이름 해시
+ * @retval 변수 ID (없으면 VAR_ID_NUM)
+ */
+extern uint16_t uVarFindHash(uint32_t ulHash);
+/**
+ * @brief  ID의 주소/타입/기본 스케일로 채널 디스크립터를 구성합니다. (오프셋 0)
+ * @param  uId 변수 ID
+ * @param  pCh 구성할 채널 디스크립터
+ * @retval 1: 성공, 0: 잘못된 ID
+ */
+extern uint16_t uVarChannel(uint16_t uId, sDataChannel* pCh);
+
+#endif /* INC_VARTABLE_H_ */
@@ -20,6 +20,19 @@
 /** @brief ADC 원시 값을 실제 물리량(A, V)으로 변환하는 단계 정의 */
 #define ADC_GET_SCALED_VALUE				1u
 
+/** @name 저장 오프셋 (FLOG_TYPE_CALIB) 비교 기준
+ * @{ */
+#define ADC_CALIB_TOL_CNT       40.0f       /**< 측정값 채택 허용 편차 [count] (약 0.5A, 초과 시 기동 중 전류로 보고 저장값 사용) */
+#define ADC_CALIB_SAVE_CNT      4.0f        /**< 저장 히스테리시스 [count] (저장 기준값과의 편차가 이 값을 넘을 때만 새로 기록하고 기준값 갱신) */
+/** @} */
+
+/** @name 오프셋 출처 (uAdcCalibSrc)
+ * @{ */
+#define ADC_CALIB_SRC_NONE      0u          /**< 보정 진행 중 */
+#define ADC_CALIB_SRC_MEAS      1u          /**< 측정값 사용 (저장값과 일치 또는 새로 저장) */
+#define ADC_CALIB_SRC_FLASH     2u          /**< 측정값이 저장값과 허용 편차 이상 달라 저장값 사용 */
+/** @} */
+
 /** * @brief 전류 ADC 스케일링 상수
  * @details 계산식: 1.0 / 센서감도(0.066V/A) * (기준전압(3.3V) / 분해능(4096))
  */
@@ -52,6 +65,16 @@ typedef struct{
  */
 extern void vInitAdc(void);
 
+/**
+ * @brief  플래시 로그의 최근 오프셋 기록(FLOG_TYPE_CALIB)을 읽어 보정 기준값으로 둡니다.
+ * @note   vInitFlashLog 이후, 오프셋 보정 완료(약 0.3s) 전에 호출합니다.
+ * @retval 없음
+ */
+extern void vAdcLoadCalib(void);
+
+/** @brief 오프셋 출처 (ADC_CALIB_SRC_*) */
+extern uint16_t uAdcCalibSrc;
+
 /**
  * @brief  ADC 변환 완료 후 호출되어 데이터를 스케일링하고 오프셋을 제거하는 실시간 처리 함수입니다.
  * @details 주로 ADC DMA 인터럽트 서비스 루틴 혹은 콜백 함수에서 호출됩니다.
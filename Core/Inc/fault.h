@@ -10,6 +10,41 @@
 #ifndef INC_FAULT_H_
 #define INC_FAULT_H_
 
+#include <stdint.h>
+
+/** @name 고장 원인 비트 (uFaultRaw / uFaultLatch / uFaultFirst)
+ * @{ */
+#define FAULT_BIT_OV        0x0001u     /**< 직류단 과전압 */
+#define FAULT_BIT_UV        0x0002u     /**< 직류단 저전압 (운전 중에만 유효) */
+#define FAULT_BIT_OC_A      0x0004u     /**< A상 과전류 */
+#define FAULT_BIT_OC_B      0x0008u     /**< B상 과전류 */
+#define FAULT_BIT_OC_C      0x0010u     /**< C상 과전류 */
+#define FAULT_BIT_OSPD      0x0020u     /**< 과속도 */
+#define FAULT_BIT_HALL      0x0040u     /**< 홀 센서 무효 상태 (000 / 111) */
+#define FAULT_BIT_OVERRUN   0x0080u     /**< 제어 ISR 연산 시간 초과 (Deadline Miss) */
+#define FAULT_CAUSE_NUM     8u          /**< 고장 원인 개수 */
+/** @} */
+
+/** @name 상태/제어 모드별 고장 검사 허용 마스크
+ * @{ */
+#define FAULT_MASK_IDLE     (FAULT_BIT_OV | FAULT_BIT_OC_A | FAULT_BIT_OC_B | FAULT_BIT_OC_C | FAULT_BIT_OSPD | FAULT_BIT_OVERRUN)
+#define FAULT_MASK_OPENLOOP (FAULT_MASK_IDLE | FAULT_BIT_UV)     /**< 홀 센서를 쓰지 않는 모드 (DUTY_TEST, CONST_VOLT, CONST_CUR) */
+#define FAULT_MASK_ACTIVE   (FAULT_MASK_OPENLOOP | FAULT_BIT_HALL)
+/** @} */
+
+/** @name 고장 원인별 디바운스 횟수 (연속 검출 제어 주기 수, 비트 순서와 동일)
+ * @{ */
+#define FAULT_DEB_OV        2u
+#define FAULT_DEB_UV        20u
+#define FAULT_DEB_OC        1u
+#define FAULT_DEB_OSPD      20u
+#define FAULT_DEB_HALL      10u
+#define FAULT_DEB_OVERRUN   3u
+/** @} */
+
+/** @brief 저전압 고장 레벨 [V] */
+#define VDC_UV_FAULT_LEV    7.0f
+
 /**
  * @struct sFault_Info
  * @brief  Fault 발생 순간의 모터 및 인버터 상태 데이터를 저장하는 구조체
@@ -25,6 +60,13 @@ typedef	struct{
 	float Vdc_Fault;    /**< Fault 발생 시점의 직류단 전압 (DC-Link) [V] */
 	float Wrpm_Fault;   /**< Fault 발생 시점의 모터 회전 속도 [RPM] */
 
+	uint16_t uTripSrc;  /**< Break 발생 시점의 하드웨어 비교기 출력 (HW_TRIP_* 비트 조합) */
+
+	uint16_t uFaultRaw;   /**< 이번 제어 주기의 비교 결과 (디바운스 전, FAULT_BIT_* 조합) */
+	uint16_t uFaultLatch; /**< 디바운스를 통과하여 래치된 고장 원인 (vClearFault 전까지 유지) */
+	uint16_t uFaultFirst; /**< 최초로 래치된 고장 원인 */
+	uint16_t uDebCnt[FAULT_CAUSE_NUM]; /**< 원인별 연속 검출 카운터 */
+
 }sFault_Info;
 
 #endif /* INC_FAULT_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @file    BlackBox.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   Fault 직전 제어 주기 데이터를 보관하는 RAM 링 버퍼(블랙박스) 구현 소스 파일
+ *
+ * @details [동작 개요]
+ * `vBlackBoxRecord()`는 매 제어 주기 끝에서 채널 디스크립터(BlackBoxCh)가 가리키는 변수를
+ * 16비트 정수로 압축하여 iBlackBoxBuf의 한 행에 기록합니다. TIM1 Break ISR의 `vFaultEvent()`가
+ * `vBlackBoxTrigger()`를 호출하면 트리거 행을 기억하고, BB_POST_TRIG_NUM 주기를 더 기록한 뒤 동결합니다.
+ * 동결된 버퍼는 Reset(vClearFault) 이후에도 유지되며 `vBlackBoxRearm()` 호출 시에만 재기록을 시작합니다.
+ *
+ * | 상태 | 동작 |
+ * | :--- | :--- |
+ * | **BB_STATE_RECORD** | 링 버퍼 연속 기록 (가장 오래된 행을 덮어씀) |
+ * | **BB_STATE_POST_TRIG** | Break 이후 uPostCnt 주기만큼 추가 기록 |
+ * | **BB_STATE_FROZEN** | 기록 중지. uBlackBoxRead 또는 디버거로 iBlackBoxBuf 판독 |
+ *
+ * @details [기본 채널 구성 (vInitBlackBox)]
+ * | 채널 | 변수 | 스케일 (단위) |
+ * | :--- | :--- | :--- |
+ * | 0 ~ 2 | fIasHall, fIbsHall, fIcsHall | 1000 (mA) |
+ * | 3 ~ 4 | fIdsr, fIqsr | 1000 (mA) |
+ * | 5 ~ 6 | fIdsrRef, fIqsrRef | 1000 (mA) |
+ * | 7 ~ 8 | fVdsrRef, fVqsrRef | 1000 (mV) |
+ * | 9 | fThetarCC | 10000 (0.1 mrad) |
+ * | 10 | fWrpmSC | 1 (RPM) |
+ * | 11 | fVdc | 1000 (mV) |
+ * | 12 | uCurrState | 1 (주 상태) |
+ */
+
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "BlackBox.h"
+
+/** @brief 블랙박스 상태 객체 */
+sBlackBox BlackBox;
+
+/** @brief 블랙박스 채널 디스크립터 */
+sDataChannel BlackBoxCh[BB_CH_MAX];
+
+/** @brief 블랙박스 샘플 버퍼 [행][채널] */
+int16_t iBlackBoxBuf[BB_DEPTH][BB_CH_MAX];
+
+/**
+ * @brief  기본 채널 구성을 설정하고 기록을 시작합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitBlackBox(void){
+	BlackBoxCh[0]  = (sDataChannel){&INV.CC.fIasHall, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[1]  = (sDataChannel){&INV.CC.fIbsHall, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[2]  = (sDataChannel){&INV.CC.fIcsHall, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[3]  = (sDataChannel){&INV.CC.fIdsr,    DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[4]  = (sDataChannel){&INV.CC.fIqsr,    DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[5]  = (sDataChannel){&INV.CC.fIdsrRef, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[6]  = (sDataChannel){&INV.CC.fIqsrRef, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[7]  = (sDataChannel){&INV.CC.fVdsrRef, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[8]  = (sDataChannel){&INV.CC.fVqsrRef, DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[9]  = (sDataChannel){&INV.SO.fThetarCC, DCH_TYPE_FLOAT, 10000.0f};
+	BlackBoxCh[10] = (sDataChannel){&INV.SO.fWrpmSC,  DCH_TYPE_FLOAT, 1.0f};
+	BlackBoxCh[11] = (sDataChannel){&fVdc,            DCH_TYPE_FLOAT, 1000.0f};
+	BlackBoxCh[12] = (sDataChannel){&uCurrState,      DCH_TYPE_UINT16, 1.0f};
+	BlackBox.uChNum = BB_CH_MAX;
+
+	vBlackBoxRearm();
+}
+
+/**
+ * @brief  버퍼를 비우고 연속 기록 상태로 되돌립니다.
+ * @note   제어 ISR보다 낮은 우선순위에서 호출 시 상태를 마지막에 변경하여 기록 재개 시점을 명확히 합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vBlackBoxRearm(void){
+	BlackBox.uHead = 0u;
+	BlackBox.uTrigIdx = 0u;
+	BlackBox.uPostCnt = 0u;
+	BlackBox.uTrigState = 0u;
+	BlackBox.uTrigFault = 0u;
+	BlackBox.ulRecordCnt = 0ul;
+	if(BlackBox.uChNum > BB_CH_MAX) BlackBox.uChNum = BB_CH_MAX;
+
+	BlackBox.uState = BB_STATE_RECORD;
+}
+
+/**
+ * @brief  제어 주기마다 호출되어 현재 채널 값을 한 행 기록합니다.
+ * @details 동결 상태에서는 즉시 반환합니다. Post-trigger 기록이 끝나면 동결 상태로 전이합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vBlackBoxRecord(void){
+	int16_t* piRow;
+	uint16_t i;
+
+	if(BlackBox.uState == BB_STATE_FROZEN) return;
+
+	piRow = iBlackBoxBuf[BlackBox.uHead];
+	for(i = 0u; i < BlackBox.uChNum; i++) {
+		piRow[i] = iPackDataChannel(&BlackBoxCh[i]);
+	}
+	BlackBox.uHead = (BlackBox.uHead + 1u) & BB_DEPTH_MASK;
+	BlackBox.ulRecordCnt++;
+
+	if(BlackBox.uState == BB_STATE_POST_TRIG) {
+		if(BlackBox.uPostCnt == 0u) BlackBox.uState = BB_STATE_FROZEN;
+		else						BlackBox.uPostCnt--;
+	}
+}
+
+/**
+ * @brief  Break 발생 시 트리거 시점을 기록하고 Post-trigger 기록 후 동결하도록 요청합니다.
+ * @details 이미 트리거된 경우(연속 Break, 동결 상태)에는 최초 트리거 정보를 유지합니다.
+ * 트리거 행은 Break 직전 제어 주기에 마지막으로 기록된 행입니다.
+ * @param  uState 현재 주 상태
+ * @param  uFault 래치된 고장 원인 비트
+ * @retval 없음
+ */
+void vBlackBoxTrigger(uint16_t uState, uint16_t uFault){
+	if(BlackBox.uState != BB_STATE_RECORD) return;
+
+	BlackBox.uTrigIdx = (BlackBox.uHead - 1u) & BB_DEPTH_MASK;
+	BlackBox.uTrigState = uState;
+	BlackBox.uTrigFault = uFault;
+	BlackBox.uPostCnt = BB_POST_TRIG_NUM - 1u;
+	BlackBox.uState = BB_STATE_POST_TRIG;
+}
+
+/**
+ * @brief  동결된 버퍼에서 트리거 기준 상대 위치의 한 행을 복사합니다.
+ * @param  iAge 트리거 행 기준 상대 위치 (음수: 이전, 0: 트리거, 양수: 이후)
+ * @param  piDst 채널 수만큼의 복사 대상 버퍼
+ * @retval 1: 유효한 행, 0: 동결 전이거나 기록 범위 밖
+ */
+uint16_t uBlackBoxRead(int16_t iAge, int16_t* piDst){
+	int32_t lOldest, lNewest;
+	uint16_t uIdx, i;
+
+	if(BlackBox.uState != BB_STATE_FROZEN) return 0u;
+
+	/* 트리거 행 기준 유효 범위: 이후 BB_POST_TRIG_NUM 행, 이전은 기록된 행 수와 버퍼 크기 중 작은 값 */
+	lNewest = (int32_t)BB_POST_TRIG_NUM;
+	lOldest = (int32_t)BB_POST_TRIG_NUM + 1 - (int32_t)((BlackBox.ulRecordCnt < BB_DEPTH) ? BlackBox.ulRecordCnt : BB_DEPTH);
+	if((iAge < lOldest) || (iAge > lNewest)) return 0u;
+
+	uIdx = (uint16_t)(BlackBox.uTrigIdx + iAge) & BB_DEPTH_MASK;
+	for(i = 0u; i < BlackBox.uChNum; i++) {
+		piDst[i] = iBlackBoxBuf[uIdx][i];
+	}
+	return 1u;
+}
@@ -0,0 +1,273 @@
+/**
+ * @file    Can.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   FDCAN1 레지스터 직접 제어 드라이버 및 상태 송신/명령 수신 구현 소스 파일
+ *
+ * @details [메시지 RAM] (STM32G4 고정 배치, FDCAN1 = SRAMCAN_BASE, 워드 오프셋)
+ * | 영역 | 오프셋 | 크기 | 사용 |
+ * | :--- | :--- | :--- | :--- |
+ * | **표준 ID 필터** | 0 | 28 × 1 | 0: 명령 ID, 1: 전체 정지 ID (Classic 마스크, RX FIFO 0) |
+ * | **확장 ID 필터** | 28 | 8 × 2 | 사용 안 함 (LSE = 0, 확장 ID는 모두 거부) |
+ * | **RX FIFO 0** | 44 | 3 × 18 | 명령 수신 |
+ * | **RX FIFO 1** | 98 | 3 × 18 | 사용 안 함 |
+ * | **TX 이벤트 FIFO** | 152 | 3 × 2 | 사용 안 함 |
+ * | **TX FIFO** | 158 | 3 × 18 | 상태 송신 |
+ *
+ * @details [명령 처리] (메인 루프, vCanTask)
+ * | 명령 | 처리 |
+ * | :--- | :--- |
+ * | **CAN_CMD_TORQUE** | 전류 제어 모드, Iq 목표값 = 토크 × 1/KT (현재 파라미터 세트) |
+ * | **CAN_CMD_SPEED** | 속도 제어 모드, 목표 속도 |
+ * | **CAN_CMD_POSITION** | 위치 제어기가 없으므로 거부 (CAN_CMD_STAT_REJECTED) |
+ * | **구동 허용 비트** | 0 → 1 에지: 시작, 1 → 0 에지: 정지 |
+ * | **리셋 비트** | 0 → 1 에지: 고장 리셋 |
+ * | **끊김** | 구동 허용 중 CAN_CMD_TIMEOUT_MS 동안 유효 명령이 없으면 정지 후 목표값 0 |
+ *
+ * 설정값과 시작/정지는 모두 CmdReq를 통해 vCmdTask → 명령 큐/설정값 우편함 경로로 제어 ISR에 전달됩니다.
+ * CmdReq는 메인 루프 소유이므로 명령 수신은 인터럽트가 아닌 메인 루프에서 FIFO를 읽어 처리합니다.
+ */
+
+#include "main.h"
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "Command.h"
+#include "Param.h"
+#include "Can.h"
+
+/** @name 메시지 RAM 워드 오프셋
+ * @{ */
+#define CAN_RAM_STDF        0u
+#define CAN_RAM_RXF0        44u
+#define CAN_RAM_TXFQ        158u
+#define CAN_RAM_ELEM_WORDS  18u                 /**< RX/TX 요소 크기 (헤더 2 + 데이터 64byte) */
+#define CAN_RAM_WORDS       212u                /**< FDCAN 인스턴스당 메시지 RAM 크기 */
+/** @} */
+
+/** @brief 상태 프레임 DLC (16byte) */
+#define CAN_DLC_16          10u
+
+/** @brief CAN 객체 */
+sCan Can;
+
+/** @brief CAN FD DLC → 데이터 길이 [byte] */
+static const uint8_t uCanDlcLen[16] = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 12u, 16u, 20u, 24u, 32u, 48u, 64u};
+
+/**
+ * @brief  메시지 RAM 주소를 반환합니다.
+ * @param  ulWord 워드 오프셋
+ * @retval 메시지 RAM 포인터
+ */
+static inline volatile uint32_t* pCanRam(uint32_t ulWord){
+	return (volatile uint32_t*)(SRAMCAN_BASE + 4u * ulWord);
+}
+
+/**
+ * @brief  FDCAN1, 메시지 RAM 필터와 비트 타이밍을 설정하고 버스에 참여합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitCan(void){
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+	volatile uint32_t* pRam;
+	uint32_t i;
+
+	Can.uReady = 0u;
+
+	__HAL_RCC_FDCAN_CONFIG(RCC_FDCANCLKSOURCE_PCLK1);
+	__HAL_RCC_FDCAN_CLK_ENABLE();
+	__HAL_RCC_GPIOB_CLK_ENABLE();
+
+	GPIO_InitStruct.Pin = GPIO_PIN_8 | GPIO_PIN_9;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	GPIO_InitStruct.Alternate = GPIO_AF9_FDCAN1;
+	HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+	/* 초기화 모드 진입 및 설정 변경 허용 */
+	FDCAN1->CCCR |= FDCAN_CCCR_INIT;
+	while(!(FDCAN1->CCCR & FDCAN_CCCR_INIT));
+	FDCAN1->CCCR |= FDCAN_CCCR_CCE;
+	FDCAN_CONFIG->CKDIV = 0u;
+
+	FDCAN1->CCCR |= FDCAN_CCCR_FDOE | FDCAN_CCCR_BRSE | FDCAN_CCCR_TXP;
+	FDCAN1->NBTP = ((CAN_NSJW - 1u) << FDCAN_NBTP_NSJW_Pos) | ((CAN_NBRP - 1u) << FDCAN_NBTP_NBRP_Pos)
+			| ((CAN_NTSEG1 - 1u) << FDCAN_NBTP_NTSEG1_Pos) | ((CAN_NTSEG2 - 1u) << FDCAN_NBTP_NTSEG2_Pos);
+	FDCAN1->DBTP = FDCAN_DBTP_TDC | ((CAN_DBRP - 1u) << FDCAN_DBTP_DBRP_Pos)
+			| ((CAN_DTSEG1 - 1u) << FDCAN_DBTP_DTSEG1_Pos) | ((CAN_DTSEG2 - 1u) << FDCAN_DBTP_DTSEG2_Pos)
+			| ((CAN_DSJW - 1u) << FDCAN_DBTP_DSJW_Pos);
+	/* 송수신기 지연 보상: 보조 샘플 시점 = 측정 지연 + 데이터 구간 샘플 시점 */
+	FDCAN1->TDCR = ((CAN_DBRP * (CAN_DTSEG1 + 1u)) << FDCAN_TDCR_TDCO_Pos);
+
+	/* 메시지 RAM 전체 초기화 후 필터 기록 (SFT = 2: Classic, SFEC = 1: RX FIFO 0) */
+	pRam = pCanRam(0u);
+	for(i = 0u; i < CAN_RAM_WORDS; i++) pRam[i] = 0u;
+
+	pRam = pCanRam(CAN_RAM_STDF);
+	pRam[0] = (2ul << 30) | (1ul << 27) | ((uint32_t)(CAN_ID_CMD + CAN_NODE_ID) << 16) | 0x7FFu;
+	pRam[1] = (2ul << 30) | (1ul << 27) | ((uint32_t)CAN_ID_STOP_ALL << 16) | 0x7FFu;
+
+	/* 필터 2개, 불일치 표준/확장 ID 및 원격 프레임 거부 */
+	FDCAN1->RXGFC = (2ul << FDCAN_RXGFC_LSS_Pos) | (0ul << FDCAN_RXGFC_LSE_Pos)
+			| (2ul << FDCAN_RXGFC_ANFS_Pos) | (2ul << FDCAN_RXGFC_ANFE_Pos)
+			| FDCAN_RXGFC_RRFS | FDCAN_RXGFC_RRFE;
+
+	/* 인터럽트 미사용 */
+	FDCAN1->IE = 0u;
+	FDCAN1->ILE = 0u;
+
+	FDCAN1->CCCR &= ~FDCAN_CCCR_INIT;
+
+	Can.uSeq = 0u;
+	Can.uCmdStat = CAN_CMD_STAT_IDLE;
+	Can.uCmdFlags = 0u;
+	Can.ulCmdTick = HAL_GetTick();
+	Can.ulTxCnt = 0ul;
+	Can.ulTxFullCnt = 0ul;
+	Can.ulRxCnt = 0ul;
+	Can.ulRxBadCnt = 0ul;
+	Can.ulTimeoutCnt = 0ul;
+	Can.ulBusOffCnt = 0ul;
+	Can.uReady = 1u;
+}
+
+/**
+ * @brief  상태 프레임을 송신 FIFO에 넣습니다. (저속 제어 문맥 전용, 비차단)
+ * @details 송신 FIFO가 가득 차면(버스 부재, 중재 패배 지속 등) 이번 프레임을 버리고 ulTxFullCnt를 증가시킵니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vCanSendStatus(void){
+	sCanStatus Status;
+	uint8_t uData[CAN_STATUS_LEN];
+	volatile uint32_t* pElem;
+	uint32_t ulIdx, i;
+
+	if(!Can.uReady) return;
+
+	if(FDCAN1->TXFQS & FDCAN_TXFQS_TFQF) {
+		Can.ulTxFullCnt++;
+		return;
+	}
+
+	Status.fWrpm = INV.SO.fWrpmSC;
+	Status.fIqsr = INV.CC.fIqsr;
+	Status.fVdc = fVdc;
+	Status.uState = (uint8_t)uCurrState;
+	Status.uCtrlMode = (uint8_t)uControlMode;
+	Status.uFault = (uint8_t)INV.Fault_Info.uFaultLatch;
+	Status.uSeq = (uint8_t)Can.uSeq;
+	Status.uCmdStat = (uint8_t)Can.uCmdStat;
+	vCanPackStatus(&Status, uData);
+
+	ulIdx = (FDCAN1->TXFQS & FDCAN_TXFQS_TFQPI_Msk) >> FDCAN_TXFQS_TFQPI_Pos;
+	pElem = pCanRam(CAN_RAM_TXFQ + ulIdx * CAN_RAM_ELEM_WORDS);
+
+	pElem[0] = (uint32_t)(CAN_ID_STATUS + CAN_NODE_ID) << 18;
+	pElem[1] = (1ul << 21) | (1ul << 20) | ((uint32_t)CAN_DLC_16 << 16);   /* FDF, BRS, DLC */
+	for(i = 0u; i < (CAN_STATUS_LEN / 4u); i++) {
+		pElem[2u + i] = uData[4u * i] | ((uint32_t)uData[4u * i + 1u] << 8)
+				| ((uint32_t)uData[4u * i + 2u] << 16) | ((uint32_t)uData[4u * i + 3u] << 24);
+	}
+	FDCAN1->TXBAR = 1ul << ulIdx;
+
+	Can.uSeq = (uint16_t)((Can.uSeq + 1u) & 0x0Fu);
+	Can.ulTxCnt++;
+}
+
+/**
+ * @brief  구동을 정지하고 목표값을 0으로 되돌립니다.
+ * @param  uStat 설정할 명령 상태
+ * @retval 없음
+ */
+static void vCanStop(uint16_t uStat){
+	CmdReq.uStop = 1u;
+	CmdReq.Set.fWrpmRefSet = 0.0f;
+	CmdReq.Set.fIqsrRefSet = 0.0f;
+	Can.uCmdFlags = 0u;
+	Can.uCmdStat = uStat;
+}
+
+/**
+ * @brief  유효한 명령 프레임을 CmdReq에 반영합니다.
+ * @param  pCmd 명령
+ * @retval 1: 적용, 0: 거부
+ */
+static uint16_t uCanApplyCmd(const sCanCmd* pCmd){
+	switch(pCmd->uType){
+	case CAN_CMD_TORQUE:
+		CmdReq.Set.uControlMode = VECTCONTL_MODE;
+		CmdReq.Set.fIqsrRefSet = pCmd->fValue * pCtrlParam->fInvKT;
+		break;
+	case CAN_CMD_SPEED:
+		CmdReq.Set.uControlMode = SPDCONTL_MODE;
+		CmdReq.Set.fWrpmRefSet = pCmd->fValue;
+		break;
+	case CAN_CMD_NONE:
+		break;
+	default:
+		return 0u;
+	}
+
+	if((pCmd->uFlags & CAN_CMD_FLAG_RESET) && !(Can.uCmdFlags & CAN_CMD_FLAG_RESET))		CmdReq.uReset = 1u;
+	if((pCmd->uFlags & CAN_CMD_FLAG_ENABLE) && !(Can.uCmdFlags & CAN_CMD_FLAG_ENABLE))		CmdReq.uStart = 1u;
+	if(!(pCmd->uFlags & CAN_CMD_FLAG_ENABLE) && (Can.uCmdFlags & CAN_CMD_FLAG_ENABLE))		CmdReq.uStop = 1u;
+
+	Can.uCmdFlags = pCmd->uFlags;
+	Can.uCmdStat = (pCmd->uFlags & CAN_CMD_FLAG_ENABLE) ? CAN_CMD_STAT_ACTIVE : CAN_CMD_STAT_IDLE;
+	return 1u;
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 명령 프레임을 처리하고, 명령 끊김과 Bus-off를 감시합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vCanTask(void){
+	volatile uint32_t* pElem;
+	uint8_t uData[CAN_CMD_LEN];
+	sCanCmd Cmd;
+	uint32_t ulIdx, ulId, ulWord;
+	uint16_t uLen, i, n;
+
+	if(!Can.uReady) return;
+
+	/* Bus-off 시 하드웨어가 INIT을 세우므로 해제하여 복구 시퀀스(128 × 11 열성 비트) 시작 */
+	if(FDCAN1->CCCR & FDCAN_CCCR_INIT) {
+		FDCAN1->CCCR &= ~FDCAN_CCCR_INIT;
+		Can.ulBusOffCnt++;
+	}
+
+	for(n = 0u; (n < CAN_RX_TASK_MAX) && (FDCAN1->RXF0S & FDCAN_RXF0S_F0FL_Msk); n++) {
+		ulIdx = (FDCAN1->RXF0S & FDCAN_RXF0S_F0GI_Msk) >> FDCAN_RXF0S_F0GI_Pos;
+		pElem = pCanRam(CAN_RAM_RXF0 + ulIdx * CAN_RAM_ELEM_WORDS);
+
+		ulId = (pElem[0] >> 18) & 0x7FFu;
+		uLen = uCanDlcLen[(pElem[1] >> 16) & 0x0Fu];
+		for(i = 0u; (i < CAN_CMD_LEN) && (i < uLen); i++) {
+			ulWord = pElem[2u + (i >> 2)];
+			uData[i] = (uint8_t)(ulWord >> (8u * (i & 3u)));
+		}
+		FDCAN1->RXF0A = ulIdx;
+
+		if(ulId == CAN_ID_STOP_ALL) {
+			vCanStop(CAN_CMD_STAT_IDLE);
+			continue;
+		}
+
+		if(uCanUnpackCmd(uData, uLen, &Cmd) && uCanApplyCmd(&Cmd)) {
+			Can.ulCmdTick = HAL_GetTick();
+			Can.ulRxCnt++;
+		}
+		else {
+			Can.uCmdStat = CAN_CMD_STAT_REJECTED;
+			Can.ulRxBadCnt++;
+		}
+	}
+
+	if((Can.uCmdFlags & CAN_CMD_FLAG_ENABLE) && ((HAL_GetTick() - Can.ulCmdTick) > CAN_CMD_TIMEOUT_MS)) {
+		vCanStop(CAN_CMD_STAT_TIMEOUT);
+		Can.ulTimeoutCnt++;
+	}
+}
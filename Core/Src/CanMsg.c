@@ -0,0 +1,94 @@
+/**
+ * @file    CanMsg.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   CAN 상태/명령 프레임의 데이터 필드 변환 구현 소스 파일
+ * @details 표준 C 라이브러리만 사용합니다 (HAL, CMSIS 헤더 없음). 바이트 단위로 조립하므로 호스트 엔디언과 무관합니다.
+ */
+
+#include <string.h>
+#include <math.h>
+#include "CanMsg.h"
+
+/** @brief 리틀 엔디언 float 쓰기 */
+static void vCanPutF32(uint8_t* p, float f){
+	uint32_t ul;
+
+	memcpy(&ul, &f, 4u);
+	p[0] = (uint8_t)ul; p[1] = (uint8_t)(ul >> 8); p[2] = (uint8_t)(ul >> 16); p[3] = (uint8_t)(ul >> 24);
+}
+
+/** @brief 리틀 엔디언 float 읽기 */
+static float fCanGetF32(const uint8_t* p){
+	uint32_t ul = p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+	float f;
+
+	memcpy(&f, &ul, 4u);
+	return f;
+}
+
+/**
+ * @brief  상태 프레임 데이터 필드를 만듭니다.
+ * @param  pStatus 상태
+ * @param  pData 출력 (CAN_STATUS_LEN byte)
+ * @retval 없음
+ */
+void vCanPackStatus(const sCanStatus* pStatus, uint8_t* pData){
+	vCanPutF32(&pData[0], pStatus->fWrpm);
+	vCanPutF32(&pData[4], pStatus->fIqsr);
+	vCanPutF32(&pData[8], pStatus->fVdc);
+	pData[12] = pStatus->uState;
+	pData[13] = pStatus->uCtrlMode;
+	pData[14] = pStatus->uFault;
+	pData[15] = (uint8_t)((pStatus->uSeq & 0x0Fu) | (uint8_t)(pStatus->uCmdStat << 4));
+}
+
+/**
+ * @brief  상태 프레임 데이터 필드를 해석합니다.
+ * @param  pData 입력 (CAN_STATUS_LEN byte)
+ * @param  pStatus 상태
+ * @retval 없음
+ */
+void vCanUnpackStatus(const uint8_t* pData, sCanStatus* pStatus){
+	pStatus->fWrpm = fCanGetF32(&pData[0]);
+	pStatus->fIqsr = fCanGetF32(&pData[4]);
+	pStatus->fVdc = fCanGetF32(&pData[8]);
+	pStatus->uState = pData[12];
+	pStatus->uCtrlMode = pData[13];
+	pStatus->uFault = pData[14];
+	pStatus->uSeq = (uint8_t)(pData[15] & 0x0Fu);
+	pStatus->uCmdStat = (uint8_t)(pData[15] >> 4);
+}
+
+/**
+ * @brief  명령 프레임 데이터 필드를 만듭니다.
+ * @param  pCmd 명령
+ * @param  pData 출력 (CAN_CMD_LEN byte)
+ * @retval 없음
+ */
+void vCanPackCmd(const sCanCmd* pCmd, uint8_t* pData){
+	pData[0] = pCmd->uType;
+	pData[1] = pCmd->uFlags;
+	pData[2] = 0u;
+	pData[3] = 0u;
+	vCanPutF32(&pData[4], pCmd->fValue);
+}
+
+/**
+ * @brief  명령 프레임 데이터 필드를 해석하고 검증합니다.
+ * @param  pData 입력
+ * @param  uLen 데이터 길이 [byte]
+ * @param  pCmd 명령
+ * @retval 1: 유효, 0: 길이 부족, 알 수 없는 종류 또는 유한하지 않은 설정값
+ */
+uint16_t uCanUnpackCmd(const uint8_t* pData, uint16_t uLen, sCanCmd* pCmd){
+	if(uLen < CAN_CMD_LEN) return 0u;
+
+	pCmd->uType = pData[0];
+	pCmd->uFlags = pData[1];
+	pCmd->fValue = fCanGetF32(&pData[4]);
+
+	if(pCmd->uType > CAN_CMD_POSITION) return 0u;
+	if(!isfinite(pCmd->fValue)) return 0u;
+	return 1u;
+}
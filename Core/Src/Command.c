@@ -0,0 +1,286 @@
+/**
+ * @file    Command.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   백그라운드(메인 루프/디버거/통신) → 제어 ISR 명령 및 설정값 전달 구현 소스 파일
+ *
+ * @details [전달 경로]
+ * | 단계 | 실행 위치 | 동작 |
+ * | :--- | :--- | :--- |
+ * | **1. 요청** | 디버거/통신 | CmdReq 필드 기록 또는 uCmdPost 호출 |
+ * | **2. 변환** | 메인 루프 (vCmdTask) | 트리거 필드 → 이벤트 큐, 설정값이 바뀌었으면 우편함 게시 |
+ * | **3. 적용** | 제어 ISR (vCmdFetch) | 이벤트 최대 CMD_FETCH_MAX개 처리, 새 설정값 스냅숏이 게시된 경우에만 복사 후 제어 변수에 반영 |
+ *
+ * [설정값 출처]
+ * | 출처 | 생산자 | 우편함 | 우선순위 |
+ * | :--- | :--- | :--- | :--- |
+ * | **CMD_SRC_REQ** | 메인 루프 (vCmdTask ← CmdReq.Set) | CmdSetMbx | 낮음 |
+ * | **CMD_SRC_THROTTLE** | 제어 ISR (vThrottleUpdate, vCmdFetch 이전) | CmdThrMbx | 높음 (vCmdThrottleRelease까지) |
+ *
+ * 두 우편함은 항상 읽어 출처별 최신 스냅숏을 유지하고, 활성 출처가 새로 게시했거나 활성 출처가 바뀐 경우에만 제어 변수에 반영합니다.
+ * 따라서 스로틀 사용 중 들어온 CmdReq 설정값은 버려지지 않고, 스로틀을 해제하면 그 값이 바로 적용됩니다.
+ *
+ * 변수 쓰기는 32비트 항목에 담을 수 없으므로 값을 ID별 슬롯에 먼저 기록하고 ID만 이벤트로 보냅니다.
+ * ISR은 이벤트를 꺼낸 시점에 슬롯을 읽어 변수 타입 크기로 한 번에 기록합니다.
+ * 읽기 전용(VAR_ACC_RO) 항목은 거절하고, 설정값 우편함이 소유하는 항목(VAR_ACC_SET)은 CmdReq.Set에 기록하여 우편함 경로로 보냅니다.
+ *
+ * 설정값은 새로 게시된 경우에만 반영하므로, 그 사이 변수 쓰기나 디버거 기록은 다음 게시까지 유지됩니다.
+ * 리셋 요청 시에는 vInitController가 목표값을 0으로 되돌리는 기존 동작과 맞추기 위해 요청측 설정값과 ISR의 스냅숏을 모두 0으로 초기화합니다.
+ * vInitController 직후에는 vCmdApply로 스냅숏(리셋 후에는 0, 정지 후에는 마지막 설정값)과 제어 모드를 다시 반영합니다.
+ */
+
+#include <string.h>
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "VarTable.h"
+#include "Scope.h"
+#include "Command.h"
+
+/** @brief 명령 요청 (디버거/메인 루프 쓰기용) */
+sCmdReq CmdReq;
+/** @brief CmdReq 출처의 최신 설정값 스냅숏 (제어 ISR 소유) */
+sCmdSetpoint CmdSet;
+/** @brief 명령 이벤트 큐 */
+sSpscRing CmdQueue;
+
+/** @brief 명령 이벤트 큐 버퍼 */
+static uint32_t ulCmdQueueBuf[CMD_QUEUE_SIZE];
+/** @brief 설정값 우편함 */
+static sMbxLatest CmdSetMbx;
+/** @brief 설정값 우편함 슬롯 */
+static sCmdSetpoint CmdSetSlot[2];
+/** @brief 마지막으로 게시한 설정값 (변경 검출용, 메인 루프 소유) */
+static sCmdSetpoint CmdSetLast;
+/** @brief 마지막으로 반영한 설정값 게시 번호 (제어 ISR 소유) */
+static uint32_t ulCmdSetSeq = 0ul;
+/** @brief 스로틀 설정값 우편함 (생산자/소비자 모두 제어 ISR) */
+static sMbxLatest CmdThrMbx;
+/** @brief 스로틀 설정값 우편함 슬롯 */
+static sCmdSetpoint CmdThrSlot[2];
+/** @brief 스로틀 출처의 최신 설정값 스냅숏 (제어 ISR 소유) */
+static sCmdSetpoint CmdThrSet;
+/** @brief 마지막으로 반영한 스로틀 게시 번호 (제어 ISR 소유) */
+static uint32_t ulCmdThrSeq = 0ul;
+/** @brief 스로틀 출처 게시 중 여부 (vCmdThrottlePost/Release) */
+static uint16_t uCmdThrActive = 0u;
+/** @brief 현재 적용 중인 설정값 출처 (CMD_SRC_*) */
+static uint16_t uCmdSrc = CMD_SRC_REQ;
+/** @brief 변수 쓰기 값 대기 슬롯 (메인 루프 기록, 제어 ISR 판독) */
+static volatile uint32_t ulCmdVarWrVal[VAR_ID_NUM];
+/** @brief 초기화 완료 여부 (vInitCommand 이전 ISR 진입 대비) */
+static volatile uint16_t uCmdReady = 0u;
+
+/**
+ * @brief  현재 제어 모드/설정값으로 명령 요청과 우편함을 초기화합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitCommand(void){
+	uCmdReady = 0u;
+
+	memset(&CmdReq, 0, sizeof(CmdReq));
+	CmdReq.Set.fWrpmRefSet = INV.SC.fWrpmRefSet;
+	CmdReq.Set.fIdsrRefSet = INV.CC.fIdsrRefSet;
+	CmdReq.Set.fIqsrRefSet = INV.CC.fIqsrRefSet;
+	CmdReq.Set.fVdqsrRefSet = fVdqsrRefSet;
+	CmdReq.Set.fIqsrSlopeSet = CC_IQ_SLOPE;
+	CmdReq.Set.uControlMode = uControlMode;
+
+	CmdSetLast = CmdReq.Set;
+	CmdSet = CmdReq.Set;
+
+	vSpscInit(&CmdQueue, ulCmdQueueBuf, CMD_QUEUE_SIZE);
+	vMbxInit(&CmdSetMbx, &CmdSetSlot[0], &CmdSetSlot[1], (uint16_t)sizeof(sCmdSetpoint), &CmdReq.Set);
+	ulCmdSetSeq = CmdSetMbx.ulSeq;
+
+	CmdThrSet = CmdReq.Set;
+	vMbxInit(&CmdThrMbx, &CmdThrSlot[0], &CmdThrSlot[1], (uint16_t)sizeof(sCmdSetpoint), &CmdThrSet);
+	ulCmdThrSeq = CmdThrMbx.ulSeq;
+	uCmdThrActive = 0u;
+	uCmdSrc = CMD_SRC_REQ;
+
+	uCmdReady = 1u;
+}
+
+/**
+ * @brief  명령 이벤트를 제어 ISR로 보냅니다. (메인 루프 문맥 전용)
+ * @param  uCode 명령 코드 (CMD_*)
+ * @param  uArg 인자
+ * @retval 1: 성공, 0: 큐 가득 참
+ */
+uint16_t uCmdPost(uint16_t uCode, uint16_t uArg){
+	return uSpscPush(&CmdQueue, ((uint32_t)uArg << 16) | uCode);
+}
+
+/**
+ * @brief  설정값 우편함 소유 항목의 쓰기를 요청측 설정값(CmdReq.Set)에 기록합니다. (메인 루프 문맥 전용)
+ * @param  uId 변수 ID (VAR_ACC_SET 항목)
+ * @param  ulRaw 변수 타입의 원시 비트
+ * @retval CMD_VAR_OK, CMD_VAR_ERR_VAL (제어 모드 범위 밖), CMD_VAR_ERR_ID (대응 필드 없음)
+ */
+static uint16_t uCmdVarSet(uint16_t uId, uint32_t ulRaw){
+	float f;
+
+	switch(uId){
+	case VAR_ID_SC_WRPM_REFSET:
+		memcpy(&f, &ulRaw, 4u);
+		CmdReq.Set.fWrpmRefSet = f;
+		break;
+	case VAR_ID_CTRL_MODE:
+		if(ulRaw > ALIGN_MODE) return CMD_VAR_ERR_VAL;
+		CmdReq.Set.uControlMode = (uint16_t)ulRaw;
+		break;
+	default:
+		return CMD_VAR_ERR_ID;
+	}
+	return CMD_VAR_OK;
+}
+
+/**
+ * @brief  변수 레지스트리 항목 쓰기를 제어 ISR로 보냅니다. (메인 루프 문맥 전용)
+ * @details 이벤트 큐 기록(uSpscPush) 안의 배리어가 슬롯 기록 이후 이벤트가 보이도록 순서를 보장합니다.
+ * 설정값 우편함 소유 항목은 CmdReq.Set에 기록하므로 다음 vCmdTask에서 게시됩니다.
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @param  ulRaw 변수 타입의 원시 비트
+ * @retval CMD_VAR_OK 또는 실패 원인 (CMD_VAR_ERR_*)
+ */
+uint16_t uCmdVarWrite(uint16_t uId, uint32_t ulRaw){
+	const sVarEntry* pVar = pVarGet(uId);
+
+	if(pVar == 0) return CMD_VAR_ERR_ID;
+	if(pVar->uAccess == VAR_ACC_RO) return CMD_VAR_ERR_RO;
+	if(pVar->uAccess == VAR_ACC_SET) return uCmdVarSet(uId, ulRaw);
+
+	ulCmdVarWrVal[uId] = ulRaw;
+	return uCmdPost(CMD_VAR_WRITE, uId) ? CMD_VAR_OK : CMD_VAR_ERR_BUSY;
+}
+
+/**
+ * @brief  대기 슬롯의 값을 변수 타입 크기로 기록합니다. (제어 ISR)
+ * @param  uId 변수 ID
+ * @retval 없음
+ */
+static void vCmdVarApply(uint16_t uId){
+	const sVarEntry* pVar = pVarGet(uId);
+	uint32_t ulRaw;
+
+	if((pVar == 0) || (pVar->uAccess != VAR_ACC_RW)) return;
+	ulRaw = ulCmdVarWrVal[uId];
+
+	switch(pVar->uType){
+	case DCH_TYPE_INT16:
+	case DCH_TYPE_UINT16:	*(volatile uint16_t*)pVar->pAddr = (uint16_t)ulRaw;	break;
+	default:				*(volatile uint32_t*)pVar->pAddr = ulRaw;				break;
+	}
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 CmdReq의 요청을 이벤트로 바꾸고, 변경된 설정값을 게시합니다.
+ * @details 큐가 가득 차면 트리거 필드를 유지하여 다음 호출에서 다시 시도합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vCmdTask(void){
+	if(!uCmdReady) return;
+
+	if(CmdReq.uReset && uCmdPost(CMD_RESET, 0u)) {
+		CmdReq.uReset = 0u;
+		CmdReq.Set.fWrpmRefSet = 0.0f;
+		CmdReq.Set.fIdsrRefSet = 0.0f;
+		CmdReq.Set.fIqsrRefSet = 0.0f;
+		CmdReq.Set.fVdqsrRefSet = 0.0f;
+	}
+	if(CmdReq.uStop && uCmdPost(CMD_STOP, 0u))		CmdReq.uStop = 0u;
+	if(CmdReq.uStart && uCmdPost(CMD_START, 0u))	CmdReq.uStart = 0u;
+
+	if(memcmp(&CmdReq.Set, &CmdSetLast, sizeof(sCmdSetpoint)) != 0) {
+		CmdSetLast = CmdReq.Set;
+		vMbxWrite(&CmdSetMbx, &CmdSetLast);
+	}
+}
+
+/**
+ * @brief  스로틀 설정값 스냅숏을 게시합니다. (제어 ISR, vCmdFetch 이전)
+ * @param  pSet 설정값 스냅숏
+ * @retval 없음
+ */
+void vCmdThrottlePost(const sCmdSetpoint* pSet){
+	if(!uCmdReady) return;
+
+	vMbxWrite(&CmdThrMbx, pSet);
+	uCmdThrActive = 1u;
+}
+
+/**
+ * @brief  스로틀 출처를 해제합니다. (제어 ISR)
+ * @param  없음
+ * @retval 없음
+ */
+void vCmdThrottleRelease(void){
+	uCmdThrActive = 0u;
+}
+
+/**
+ * @brief  제어 주기마다 호출되어 이벤트를 처리하고, 우선순위가 가장 높은 출처의 새 스냅숏을 적용합니다.
+ * @details 이벤트는 도착 순서대로 최대 CMD_FETCH_MAX개만 처리하고 나머지는 다음 주기로 넘깁니다.
+ * 설정값은 출처별로 게시 번호가 바뀐 경우에만 복사하고, 활성 출처에 새 스냅숏이 있거나 활성 출처가 바뀐 경우에만 제어 변수에 반영합니다.
+ * 리셋 이벤트는 CmdReq 스냅숏의 목표값을 0으로 만듭니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vCmdFetch(void){
+	uint32_t ulItem;
+	uint16_t i, uSrc, uNew;
+
+	if(!uCmdReady) return;
+
+	for(i = 0u; (i < CMD_FETCH_MAX) && uSpscPop(&CmdQueue, &ulItem); i++) {
+		switch((uint16_t)ulItem){
+		case CMD_START:	Flag.START = 1u;	break;
+		case CMD_STOP:	Flag.START = 0u;	break;
+		case CMD_RESET:
+			Flag.RESET = 1u;
+			CmdSet.fWrpmRefSet = 0.0f;
+			CmdSet.fIdsrRefSet = 0.0f;
+			CmdSet.fIqsrRefSet = 0.0f;
+			CmdSet.fVdqsrRefSet = 0.0f;
+			break;
+		case CMD_VAR_WRITE:	vCmdVarApply((uint16_t)(ulItem >> 16));	break;
+		case CMD_SCOPE_ARM:	vScopeArm();	break;
+		default:							break;
+		}
+	}
+
+	uSrc = (uCmdThrActive != 0u) ? CMD_SRC_THROTTLE : CMD_SRC_REQ;
+	uNew = (uSrc != uCmdSrc);
+	uCmdSrc = uSrc;
+
+	if(CmdSetMbx.ulSeq != ulCmdSetSeq) {
+		ulCmdSetSeq = ulMbxRead(&CmdSetMbx, &CmdSet);
+		if(uSrc == CMD_SRC_REQ) uNew = 1u;
+	}
+	if(CmdThrMbx.ulSeq != ulCmdThrSeq) {
+		ulCmdThrSeq = ulMbxRead(&CmdThrMbx, &CmdThrSet);
+		if(uSrc == CMD_SRC_THROTTLE) uNew = 1u;
+	}
+	if(uNew) vCmdApply();
+}
+
+/**
+ * @brief  현재 출처(CMD_SRC_*)의 설정값 스냅숏을 제어 모드와 목표값에 반영합니다. (제어 ISR)
+ * @details vCmdFetch가 활성 출처의 새 스냅숏을 받았거나 출처가 바뀌었을 때와, 리셋/IDLE 진입에서 vInitController가 목표값을 지운 직후에 호출됩니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vCmdApply(void){
+	const sCmdSetpoint* pSet = (uCmdSrc == CMD_SRC_THROTTLE) ? &CmdThrSet : &CmdSet;
+
+	if(!uCmdReady) return;
+
+	uControlMode = pSet->uControlMode;
+	INV.SC.fWrpmRefSet = pSet->fWrpmRefSet;
+	INV.CC.fIdsrRefSet = pSet->fIdsrRefSet;
+	INV.CC.fIqsrRefSet = pSet->fIqsrRefSet;
+	INV.CC.fIqsrSlopeSet = pSet->fIqsrSlopeSet;
+	fVdqsrRefSet = pSet->fVdqsrRefSet;
+}
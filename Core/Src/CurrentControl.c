@@ -10,6 +10,9 @@
 #include "GlobalVar.h"
 #include "Adc.h"
 #include "math.h"
+#include "Param.h"
+#include "PowerLimit.h"
+#include "Traction.h"
 
 /** @brief DQ축 전압 지령 설정을 위한 전역 변수 (V/f 제어 등에서 사용) */
 float fVdqsrRefSet = 0.0f;
@@ -27,7 +30,7 @@ static inline float LIMIT_OPT(float val, float min, float max) {
 
 /**
  * @brief  전류 제어기 구조체 및 관련 변수들을 초기화합니다.
- * @note   제어기 이득(Gain) 계산 시 모터의 파라미터(L, R)와 차단 주파수(WC_CC)를 사용합니다.
+ * @note   제어기 이득은 Param.c에서 백그라운드로 계산되어 pCtrlParam으로 교체되므로 여기서는 상태 변수만 초기화합니다.
  * @param  MotorControl 모터 파라미터 정보를 담고 있는 구조체 포인터
  * @param  CCtrl 초기화할 전류 제어기 구조체 포인터
  * @retval 없음
@@ -50,29 +53,10 @@ void vInitCurrentControl(sMotorCtrl* MotorControl, sCurrentCtrl* CCtrl){
 	CCtrl->fIdsrFF = 0.0f;  CCtrl->fIqsrFF = 0.0f;
 	CCtrl->fIdsrRef = 0.0f; CCtrl->fIqsrRef = 0.0f;
 	CCtrl->fIdsrRefSet = 0.0f; CCtrl->fIqsrRefSet = 0.0f; CCtrl->fIdqrRefSet = 0.0f;
+	CCtrl->fIqsrSlopeSet = CC_IQ_SLOPE;
 	CCtrl->fIdsrRefMax = 0.0f; CCtrl->fIqsrRefMax = 0.0f;
 
-	/* D축 전류 제어기 이득 설정 (Kpd = Ld * Wc, Kid = Rs * Wc) */
-	CCtrl->fKpdCc = MotorControl->LD * WC_CC;
-	CCtrl->fKidCc = MotorControl->RS * WC_CC;
-
-	/* D축 Anti-windup 계수 계산 */
-	if (CCtrl->fKpdCc > 0.0f) {
-		CCtrl->fKadCc = 1.0f / CCtrl->fKpdCc;
-	} else {
-		CCtrl->fKadCc = 0.0f;
-	}
-
-	/* Q축 전류 제어기 이득 설정 (Kpq = Lq * Wc, Kiq = Rs * Wc) */
-	CCtrl->fKpqCc = MotorControl->LQ * WC_CC;
-	CCtrl->fKiqCc = MotorControl->RS * WC_CC;
-
-	/* Q축 Anti-windup 계수 계산 */
-	if (CCtrl->fKpqCc > 0.0f) {
-		CCtrl->fKaqCc = 1.0f / CCtrl->fKpqCc;
-	} else {
-		CCtrl->fKaqCc = 0.0f;
-	}
+	/* 전류 제어기 이득(Kp = L·Wc, Ki = Rs·Wc, Ka = 1/Kp)은 파라미터 세트(pCtrlParam)에서 사용 */
 
 	/* 적분항 및 전압 출력 변수 초기화 */
 	CCtrl->fIdsrInteg = 0.0f; CCtrl->fIqsrInteg = 0.0f;
@@ -114,8 +98,11 @@ void vInitCurrentControl(sMotorCtrl* MotorControl, sCurrentCtrl* CCtrl){
  * @brief  현재 운전 모드에 따라 전류 지령값(Id, Iq)을 생성합니다.
  * @details
  * - CONST_CUR_MODE: 슬로프 생성기를 통한 전류 지령 추종
- * - VECTCONTL_MODE: 외부 설정된 지령값에 대해 슬로프 적용
+ * - VECTCONTL_MODE: 외부 설정된 지령값에 대해 슬로프 적용 (q축 기울기는 fIqsrSlopeSet)
  * - SPDCONTL_MODE: 속도 제어기 출력값을 Q축 전류 지령으로 사용
+ * - 모든 모드: Q축 전류 지령을 배터리 전류/전력/전압 하한·상한에 따른 동적 한계(PwrLim)로 제한
+ * - 모든 모드: 구동력/출발 제어 한계(Traction.fIqLim)로 Q축 전류 지령 크기 제한 (차단 후 복귀 기울기가 그대로 반영됨)
+ * - VECTCONTL_MODE, SPDCONTL_MODE: 회생 과전압 제한 중이면 d축 손실 제동 전류 추가
  * @param  CCtrl 전류 제어 구조체 포인터
  * @param  SCtrl 속도 제어 구조체 포인터
  * @retval 없음
@@ -130,7 +117,7 @@ void vCurrentRef(sCurrentCtrl* CCtrl, sSpeedCtrl* SCtrl){
 
 	case VECTCONTL_MODE:
 		vSlopeGenerator(&CCtrl->fIdsrRef, CCtrl->fIdsrRefSet, 10.0f *fTsamp);
-		vSlopeGenerator(&CCtrl->fIqsrRef, CCtrl->fIqsrRefSet, 10.0f * fTsamp);
+		vSlopeGenerator(&CCtrl->fIqsrRef, CCtrl->fIqsrRefSet, CCtrl->fIqsrSlopeSet * fTsamp);
 		break;
 
 	case SPDCONTL_MODE:
@@ -145,6 +132,12 @@ void vCurrentRef(sCurrentCtrl* CCtrl, sSpeedCtrl* SCtrl){
 		CCtrl->fIqsrRef = CCtrl->fIqsrRefSet;
 		break;
 	}
+
+	CCtrl->fIqsrRef = LIMIT(CCtrl->fIqsrRef, PwrLim.fIqMin, PwrLim.fIqMax);
+	CCtrl->fIqsrRef = LIMIT(CCtrl->fIqsrRef, -Traction.fIqLim, Traction.fIqLim);
+	if((uControlMode == VECTCONTL_MODE) || (uControlMode == SPDCONTL_MODE)) {
+		CCtrl->fIdsrRef = MIN(CCtrl->fIdsrRef, PwrLim.fIdBrake);
+	}
 }
 
 /**
@@ -161,8 +154,8 @@ void vCurrentRef(sCurrentCtrl* CCtrl, sSpeedCtrl* SCtrl){
 void vCurrentControl(sCurrentCtrl* CCtrl, sSpeedObs* SObs){
 
 	/* Anti-windup 항 계산: 지령 전압과 실제 출력 전압의 차이에 비례 이득의 역수를 곱함 */
-	CCtrl->fVdsrAwRef = CCtrl->fKadCc * (CCtrl->fVdsrRef - CCtrl->fVdsrOut);
-	CCtrl->fVqsrAwRef = CCtrl->fKaqCc * (CCtrl->fVqsrRef - CCtrl->fVqsrOut);
+	CCtrl->fVdsrAwRef = pCtrlParam->fKadCc * (CCtrl->fVdsrRef - CCtrl->fVdsrOut);
+	CCtrl->fVqsrAwRef = pCtrlParam->fKaqCc * (CCtrl->fVqsrRef - CCtrl->fVqsrOut);
 
 	/* Clarke Transformation (3-phase to 2-phase stationary) */
 	CCtrl->fIdss = CCtrl->fIasHall;
@@ -180,12 +173,12 @@ void vCurrentControl(sCurrentCtrl* CCtrl, sSpeedObs* SObs){
 	CCtrl->fIqsrFF = 0.0f;
 
 	/* PI 제어기 적분항 업데이트 (Anti-windup 고려) */
-	CCtrl->fIdsrInteg += fTsamp * CCtrl->fKidCc * (CCtrl->fIdsrErr - CCtrl->fVdsrAwRef);
-	CCtrl->fIqsrInteg += fTsamp * CCtrl->fKiqCc * (CCtrl->fIqsrErr - CCtrl->fVqsrAwRef);
+	CCtrl->fIdsrInteg += fTsamp * pCtrlParam->fKidCc * (CCtrl->fIdsrErr - CCtrl->fVdsrAwRef);
+	CCtrl->fIqsrInteg += fTsamp * pCtrlParam->fKiqCc * (CCtrl->fIqsrErr - CCtrl->fVqsrAwRef);
 
 	/* 최종 동기 좌표계 전압 지령 계산 */
-	CCtrl->fVdsrRef = CCtrl->fKpdCc * CCtrl->fIdsrErr + CCtrl->fIdsrInteg + CCtrl->fIdsrFF;
-	CCtrl->fVqsrRef = CCtrl->fKpqCc * CCtrl->fIqsrErr + CCtrl->fIqsrInteg + CCtrl->fIqsrFF;
+	CCtrl->fVdsrRef = pCtrlParam->fKpdCc * CCtrl->fIdsrErr + CCtrl->fIdsrInteg + CCtrl->fIdsrFF;
+	CCtrl->fVqsrRef = pCtrlParam->fKpqCc * CCtrl->fIqsrErr + CCtrl->fIqsrInteg + CCtrl->fIqsrFF;
 }
 
 /**
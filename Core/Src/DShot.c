@@ -0,0 +1,246 @@
+/**
+ * @file    DShot.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   DShot 디지털 스로틀 프레임 복호 및 KISS 텔레메트리 프레임 구현 소스 파일
+ * @details 표준 C 라이브러리만 사용합니다 (HAL, CMSIS 헤더 없음). 판정 임계값은 초기화 시 틱 단위로 미리 계산하여
+ * 비트당 비교 몇 번으로 끝나게 합니다.
+ */
+
+#include "DShot.h"
+
+/** @brief 니블 → 5bit GCR 코드 */
+static const uint8_t uDshotGcrTable[16] = {
+		0x19u, 0x1Bu, 0x12u, 0x13u, 0x1Du, 0x15u, 0x16u, 0x17u,
+		0x1Au, 0x09u, 0x0Au, 0x0Bu, 0x1Eu, 0x0Du, 0x0Eu, 0x0Fu,
+};
+
+/** @brief 12bit 값의 4bit CRC */
+static uint16_t uDshotCrc(uint16_t uV12){
+	return (uint16_t)((uV12 ^ (uV12 >> 4) ^ (uV12 >> 8)) & 0x0Fu);
+}
+
+/**
+ * @brief  복호기를 초기화합니다.
+ * @param  pDec 복호기
+ * @param  ulBitTicks 공칭 비트 주기 [tick]
+ * @param  uInvCrc 1: 반전 CRC
+ * @retval 없음
+ */
+void vDshotDecInit(sDshotDec* pDec, uint32_t ulBitTicks, uint16_t uInvCrc){
+	pDec->ulBitTicks = ulBitTicks;
+	pDec->ulGapTicks = ulBitTicks + (ulBitTicks >> 1);
+	pDec->ulGlitchTicks = ulBitTicks >> 1;
+	pDec->ulOneTicks = (ulBitTicks * 9u) >> 4;
+	pDec->uShift = 0u;
+	pDec->uBitCnt = DSHOT_FRAME_BITS + 1u;
+	pDec->uInvCrc = (uInvCrc != 0u) ? 0x0Fu : 0u;
+	pDec->ulFrameCnt = 0u;
+	pDec->ulCrcErrCnt = 0u;
+	pDec->ulFrameErrCnt = 0u;
+}
+
+/**
+ * @brief  비트 하나를 입력합니다.
+ * @param  pDec 복호기
+ * @param  ulPeriod 직전 상승 에지 이후 이번 상승 에지까지 [tick]
+ * @param  ulHigh High 시간 [tick]
+ * @param  pFrame 완성된 프레임
+ * @retval 1: CRC가 맞는 프레임 완성, 0: 진행 중 또는 오류
+ */
+uint16_t uDshotDecBit(sDshotDec* pDec, uint32_t ulPeriod, uint32_t ulHigh, uint16_t* pFrame){
+	uint16_t uFrame;
+
+	if(ulPeriod > pDec->ulGapTicks){
+		/* 프레임 간 공백 뒤 첫 비트 */
+		if(pDec->uBitCnt > 0u && pDec->uBitCnt < DSHOT_FRAME_BITS) pDec->ulFrameErrCnt++;
+		pDec->uShift = 0u;
+		pDec->uBitCnt = 0u;
+	}
+	else if(ulPeriod < pDec->ulGlitchTicks){
+		if(pDec->uBitCnt < DSHOT_FRAME_BITS) pDec->ulFrameErrCnt++;
+		pDec->uBitCnt = DSHOT_FRAME_BITS + 1u;
+		return 0u;
+	}
+	else if(pDec->uBitCnt >= DSHOT_FRAME_BITS){
+		/* 완성(또는 폐기)된 프레임 뒤에 공백 없이 이어지는 비트 */
+		if(pDec->uBitCnt == DSHOT_FRAME_BITS) pDec->ulFrameErrCnt++;
+		pDec->uBitCnt = DSHOT_FRAME_BITS + 1u;
+		return 0u;
+	}
+
+	pDec->uShift = (uint16_t)((pDec->uShift << 1) | ((ulHigh > pDec->ulOneTicks) ? 1u : 0u));
+	if(++pDec->uBitCnt < DSHOT_FRAME_BITS) return 0u;
+
+	uFrame = pDec->uShift;
+	if((uDshotCrc((uint16_t)(uFrame >> 4)) ^ pDec->uInvCrc) != (uFrame & 0x0Fu)){
+		pDec->ulCrcErrCnt++;
+		return 0u;
+	}
+	pDec->ulFrameCnt++;
+	*pFrame = uFrame;
+	return 1u;
+}
+
+/**
+ * @brief  링 버퍼에서 기록 위치 바로 앞의 프레임 하나만 따로 복호합니다.
+ * @param  pDec 기준 복호기 (비트 주기, CRC 극성만 사용)
+ * @param  pRing 링 버퍼 (주기, High 시간 쌍)
+ * @param  uMask 링 버퍼 크기 - 1
+ * @param  uEnd 기록 위치 (짝수)
+ * @param  pFrame 프레임
+ * @retval 1: 마지막 프레임 CRC 일치, 0: 오류
+ */
+uint16_t uDshotDecLast(const sDshotDec* pDec, const volatile uint32_t* pRing, uint16_t uMask, uint16_t uEnd, uint16_t* pFrame){
+	sDshotDec Dec;
+	uint16_t i, uPos, uRet = 0u;
+
+	vDshotDecInit(&Dec, pDec->ulBitTicks, pDec->uInvCrc);
+	uPos = (uint16_t)((uEnd - 2u * DSHOT_FRAME_BITS) & uMask);
+	for(i = 0u; i < DSHOT_FRAME_BITS; i++){
+		uRet = uDshotDecBit(&Dec, pRing[uPos], pRing[uPos + 1u], pFrame);
+		uPos = (uint16_t)((uPos + 2u) & uMask);
+	}
+	return uRet;
+}
+
+/**
+ * @brief  스로틀 값과 텔레메트리 비트로 프레임을 만듭니다.
+ * @param  uValue 스로틀 값 (0 ~ 2047)
+ * @param  uTelem 텔레메트리 요청 (0/1)
+ * @param  uInvCrc 1: 반전 CRC
+ * @retval 16bit 프레임
+ */
+uint16_t uDshotPack(uint16_t uValue, uint16_t uTelem, uint16_t uInvCrc){
+	uint16_t uV12 = (uint16_t)(((uValue & 0x7FFu) << 1) | (uTelem & 1u));
+	uint16_t uCrc = uDshotCrc(uV12);
+
+	if(uInvCrc != 0u) uCrc ^= 0x0Fu;
+	return (uint16_t)((uV12 << 4) | uCrc);
+}
+
+/**
+ * @brief  전기 1회전 주기를 eRPM 응답 워드로 만듭니다.
+ * @param  ulPeriodUs 전기 1회전 주기 [µs]
+ * @retval 16bit 워드
+ */
+uint16_t uDshotErpmEncode(uint32_t ulPeriodUs){
+	uint16_t uExp = 0u, uV12;
+
+	while(ulPeriodUs > 0x1FFu){
+		if(uExp == 7u){
+			ulPeriodUs = 0x1FFu;
+			break;
+		}
+		ulPeriodUs >>= 1;
+		uExp++;
+	}
+
+	uV12 = (uint16_t)((uExp << 9) | ulPeriodUs);
+	return (uint16_t)((uV12 << 4) | (uDshotCrc(uV12) ^ 0x0Fu));
+}
+
+/**
+ * @brief  eRPM 응답 워드에서 전기 1회전 주기를 꺼냅니다.
+ * @param  uWord 16bit 워드
+ * @retval 전기 1회전 주기 [µs]
+ */
+uint32_t ulDshotErpmDecode(uint16_t uWord){
+	return (uint32_t)((uWord >> 4) & 0x1FFu) << ((uWord >> 13) & 0x07u);
+}
+
+/**
+ * @brief  16bit 워드를 GCR 부호화하여 선 레벨 비트열로 만듭니다.
+ * @param  uWord 16bit 워드
+ * @retval 선 레벨 (bit20 = 시작 비트 ~ bit0)
+ */
+uint32_t ulDshotGcrEncode(uint16_t uWord){
+	uint32_t ulGcr = 0u, ulLevels = 0u, ulLevel = 0u;
+	int16_t i;
+
+	for(i = 12; i >= 0; i -= 4) ulGcr = (ulGcr << 5) | uDshotGcrTable[(uWord >> i) & 0x0Fu];
+
+	/* 시작 비트 Low, 이후 GCR 1마다 레벨 반전 */
+	for(i = 19; i >= 0; i--){
+		ulLevel ^= (ulGcr >> i) & 1u;
+		ulLevels |= ulLevel << i;
+	}
+	return ulLevels;
+}
+
+/**
+ * @brief  선 레벨 비트열을 GCR 복호하고 반전 CRC를 검사합니다.
+ * @param  ulLevels 선 레벨 (bit20 = 시작 비트 ~ bit0)
+ * @param  pWord 16bit 워드
+ * @retval 1: 유효, 0: GCR 코드 또는 CRC 오류
+ */
+uint16_t uDshotGcrDecode(uint32_t ulLevels, uint16_t* pWord){
+	uint32_t ulGcr = (ulLevels ^ (ulLevels >> 1)) & 0xFFFFFu;
+	uint16_t uWord = 0u, uNib, uCode;
+	int16_t i;
+
+	for(i = 15; i >= 0; i -= 5){
+		uCode = (uint16_t)((ulGcr >> i) & 0x1Fu);
+		for(uNib = 0u; uNib < 16u && uDshotGcrTable[uNib] != uCode; uNib++){}
+		if(uNib == 16u) return 0u;
+		uWord = (uint16_t)((uWord << 4) | uNib);
+	}
+
+	if((uDshotCrc((uint16_t)(uWord >> 4)) ^ 0x0Fu) != (uWord & 0x0Fu)) return 0u;
+	*pWord = uWord;
+	return 1u;
+}
+
+/**
+ * @brief  KISS 텔레메트리 CRC-8 (다항식 0x07)
+ * @param  pData 데이터
+ * @param  uLen 길이 [byte]
+ * @retval CRC
+ */
+uint8_t uKissCrc8(const uint8_t* pData, uint16_t uLen){
+	uint8_t uCrc = 0u;
+	uint16_t i, j;
+
+	for(i = 0u; i < uLen; i++){
+		uCrc ^= pData[i];
+		for(j = 0u; j < 8u; j++) uCrc = (uint8_t)((uCrc & 0x80u) ? ((uCrc << 1) ^ 0x07u) : (uCrc << 1));
+	}
+	return uCrc;
+}
+
+/**
+ * @brief  KISS 텔레메트리 프레임을 만듭니다.
+ * @param  pT 텔레메트리 값
+ * @param  pOut 출력 (KISS_FRAME_LEN byte)
+ * @retval 프레임 길이 [byte]
+ */
+uint16_t uKissBuild(const sKissTelem* pT, uint8_t* pOut){
+	pOut[0] = pT->uTemp;
+	pOut[1] = (uint8_t)(pT->uVolt >> 8);
+	pOut[2] = (uint8_t)pT->uVolt;
+	pOut[3] = (uint8_t)(pT->uCurr >> 8);
+	pOut[4] = (uint8_t)pT->uCurr;
+	pOut[5] = (uint8_t)(pT->uMah >> 8);
+	pOut[6] = (uint8_t)pT->uMah;
+	pOut[7] = (uint8_t)(pT->uErpm >> 8);
+	pOut[8] = (uint8_t)pT->uErpm;
+	pOut[9] = uKissCrc8(pOut, KISS_FRAME_LEN - 1u);
+	return KISS_FRAME_LEN;
+}
+
+/**
+ * @brief  KISS 텔레메트리 프레임을 해석합니다.
+ * @param  pIn 프레임 (KISS_FRAME_LEN byte)
+ * @param  pT 텔레메트리 값
+ * @retval 1: 유효, 0: CRC 오류
+ */
+uint16_t uKissParse(const uint8_t* pIn, sKissTelem* pT){
+	if(uKissCrc8(pIn, KISS_FRAME_LEN - 1u) != pIn[9]) return 0u;
+
+	pT->uTemp = pIn[0];
+	pT->uVolt = (uint16_t)((pIn[1] << 8) | pIn[2]);
+	pT->uCurr = (uint16_t)((pIn[3] << 8) | pIn[4]);
+	pT->uMah  = (uint16_t)((pIn[5] << 8) | pIn[6]);
+	pT->uErpm = (uint16_t)((pIn[7] << 8) | pIn[8]);
+	return 1u;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file    EscTelem.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   ESC 텔레메트리(KISS 형식) 생성 및 USART2 DMA 송신 구현 소스 파일
+ *
+ * @details [자원 할당]
+ * | 자원 | 설정 |
+ * | :--- | :--- |
+ * | **USART2** | 115200bps 8N1, 송신 전용, 레지스터 직접 제어 |
+ * | **PB3** | AF7 (USART2_TX) |
+ * | **DMA2_CH3** | DMAMUX1_Channel10 = USART2_TX, EscTxBuf → TDR, Normal 모드, 인터럽트 없음 |
+ * | **ADC5** | 내부 온도 센서 채널 4, 소프트웨어 시작, 샘플링 640.5 클럭 (HCLK/4) |
+ *
+ * 온도 변환은 호출마다 결과를 읽고 다음 변환을 시작하므로 대기하지 않습니다. (변환 시간 약 15µs ≪ 0.5ms)
+ * 전송 완료는 CNDTR이 0이 되는 것으로 판단합니다.
+ */
+
+#include "main.h"
+#include "GlobalVar.h"
+#include "UserMath.h"
+#include "MotorControl.h"
+#include "Param.h"
+#include "Throttle.h"
+#include "PowerLimit.h"
+#include "EscTelem.h"
+
+/** @brief 온도 센서 ADC 채널 (ADC5_IN4) */
+#define ESC_TEMP_CH         4u
+/** @brief ADC 기준 전압 [mV] */
+#define ESC_VREF_MV         3300.0f
+
+/** @brief ESC 텔레메트리 객체 */
+sEscTelem EscTelem;
+
+/** @brief 송신 버퍼 (DMA2_CH3 판독) */
+static uint8_t EscTxBuf[KISS_FRAME_LEN];
+
+/**
+ * @brief  ADC5를 깨우고 보정한 뒤 온도 센서 변환을 시작합니다.
+ * @retval 없음
+ */
+static void vEscTempInit(void){
+	float fCal1 = (float)(*TEMPSENSOR_CAL1_ADDR), fCal2 = (float)(*TEMPSENSOR_CAL2_ADDR);
+
+	/* 보정값은 3.0V 기준이므로 3.3V 기준 변환값으로 환산하여 기울기/오프셋을 미리 계산 */
+	fCal1 *= (float)TEMPSENSOR_CAL_VREFANALOG / ESC_VREF_MV;
+	fCal2 *= (float)TEMPSENSOR_CAL_VREFANALOG / ESC_VREF_MV;
+	EscTelem.fTsSlope = (fCal2 > fCal1) ? (float)(TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP) / (fCal2 - fCal1) : 0.0f;
+	EscTelem.fTsOffset = (float)TEMPSENSOR_CAL1_TEMP - EscTelem.fTsSlope * fCal1;
+
+	__HAL_RCC_ADC345_CLK_ENABLE();
+	ADC345_COMMON->CCR |= ADC_CCR_CKMODE | ADC_CCR_VSENSESEL;   /* HCLK/4 = 42.5MHz */
+
+	ADC5->CR = 0u;                      /* Deep Power Down 해제 */
+	ADC5->CR = ADC_CR_ADVREGEN;
+	HAL_Delay(1);                       /* 레귤레이터 안정화 (20µs 이상) */
+	ADC5->CR |= ADC_CR_ADCAL;
+	while(ADC5->CR & ADC_CR_ADCAL);
+
+	ADC5->ISR = ADC_ISR_ADRDY;
+	ADC5->CR |= ADC_CR_ADEN;
+	while(!(ADC5->ISR & ADC_ISR_ADRDY));
+
+	ADC5->SMPR1 = ADC_SMPR1_SMP0 << (3u * ESC_TEMP_CH);
+	ADC5->SQR1 = ESC_TEMP_CH << ADC_SQR1_SQ1_Pos;
+	ADC5->CR |= ADC_CR_ADSTART;
+
+	EscTelem.fTempC = (float)TEMPSENSOR_CAL1_TEMP;
+}
+
+/**
+ * @brief  USART2 송신(PB3), DMA2_CH3, ADC5 온도 센서를 초기화합니다.
+ * @retval 없음
+ */
+void vInitEscTelem(void){
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+	__HAL_RCC_USART2_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+	__HAL_RCC_GPIOB_CLK_ENABLE();
+
+	GPIO_InitStruct.Pin = GPIO_PIN_3;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_PULLUP;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	GPIO_InitStruct.Alternate = GPIO_AF7_USART2;
+	HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+	USART2->CR1 = 0u;
+	USART2->BRR = (ESC_KER_CLK + (ESC_TELEM_BAUD >> 1)) / ESC_TELEM_BAUD;
+	USART2->CR2 = 0u;
+	USART2->CR3 = USART_CR3_DMAT;
+	USART2->CR1 = USART_CR1_TE | USART_CR1_UE;
+
+	DMA2_Channel3->CCR = 0u;
+	DMAMUX1_Channel10->CCR = DMA_REQUEST_USART2_TX;
+	DMA2_Channel3->CPAR = (uint32_t)&USART2->TDR;
+	DMA2_Channel3->CNDTR = 0u;
+
+	vEscTempInit();
+
+	EscTelem.uMode = ESC_TELEM_PERIODIC;
+	EscTelem.uDiv = ESC_TELEM_DIV_MIN;
+	EscTelem.uReady = 1u;
+}
+
+/**
+ * @brief  저속 제어(2kHz)에서 호출되어 텔레메트리 값을 갱신하고 프레임을 송신합니다.
+ * @retval 없음
+ */
+void vEscTelemUpdate(void){
+	uint16_t uSend = 0u;
+	float fTemp;
+
+	if(EscTelem.uReady == 0u) return;
+
+	EscTelem.fIdc = PwrLim.fIbat;
+	if(EscTelem.fIdc > 0.0f) EscTelem.fMah += EscTelem.fIdc * (ESC_TELEM_TS * 1000.0f / 3600.0f);
+	EscTelem.fErpm = ABS(INV.SO.fWrpmSC) * pCtrlParam->fPP;
+
+	if(ADC5->ISR & ADC_ISR_EOC){
+		fTemp = EscTelem.fTsOffset + EscTelem.fTsSlope * (float)ADC5->DR;
+		EscTelem.fTempC += ESC_TEMP_ALPHA * (fTemp - EscTelem.fTempC);
+		ADC5->CR |= ADC_CR_ADSTART;
+	}
+
+	if(EscTelem.uMode == ESC_TELEM_PERIODIC){
+		if(EscTelem.uDiv < ESC_TELEM_DIV_MIN) EscTelem.uDiv = ESC_TELEM_DIV_MIN;
+		if(++EscTelem.uDivCnt >= EscTelem.uDiv){
+			EscTelem.uDivCnt = 0u;
+			uSend = 1u;
+		}
+	}
+	else if(EscTelem.uMode == ESC_TELEM_REQUEST && Throttle.uTelemReq != 0u){
+		Throttle.uTelemReq = 0u;
+		uSend = 1u;
+	}
+	if(uSend == 0u) return;
+
+	if(DMA2_Channel3->CNDTR != 0u){
+		EscTelem.ulBusyCnt++;
+		return;
+	}
+
+	EscTelem.Kiss.uTemp = (uint8_t)LIMIT(EscTelem.fTempC, 0.0f, 255.0f);
+	EscTelem.Kiss.uVolt = (uint16_t)LIMIT(fVdc * 100.0f, 0.0f, 65535.0f);
+	EscTelem.Kiss.uCurr = (uint16_t)LIMIT(EscTelem.fIdc * 100.0f, 0.0f, 65535.0f);
+	EscTelem.Kiss.uMah = (uint16_t)LIMIT(EscTelem.fMah, 0.0f, 65535.0f);
+	EscTelem.Kiss.uErpm = (uint16_t)LIMIT(EscTelem.fErpm * 0.01f, 0.0f, 65535.0f);
+	uKissBuild(&EscTelem.Kiss, EscTxBuf);
+
+	DMA2_Channel3->CCR = 0u;
+	DMA2->IFCR = DMA_IFCR_CGIF3;
+	DMA2_Channel3->CMAR = (uint32_t)EscTxBuf;
+	DMA2_Channel3->CNDTR = KISS_FRAME_LEN;
+	DMA2_Channel3->CCR = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_EN;
+	EscTelem.ulFrameCnt++;
+}
@@ -185,3 +185,18 @@ float IIR2Update(IIR2 *p_gIIR, const float x)
 
     return(y);
 }
+
+/**
+ * @brief  2차 IIR 필터의 상태 레지스터를 정상 상태 값으로 설정합니다.
+ * @details 입력과 출력이 모두 value로 수렴한 상태(y = G(0) * x)를 가정하여
+ * Direct Form II Transposed 구조의 두 레지스터 값을 역산합니다.
+ * 이후 같은 값이 입력되면 출력은 과도 응답 없이 value를 유지합니다. (DC 이득 1인 LPF 기준)
+ * @param  p_gIIR 설정할 IIR2 구조체 포인터
+ * @param  value 정상 상태 값
+ * @retval 없음
+ */
+void presetIIR2(IIR2 *p_gIIR, float value)
+{
+    p_gIIR->reg[1] = (p_gIIR->coeff[3] + p_gIIR->coeff[4]) * value;
+    p_gIIR->reg[0] = value - p_gIIR->coeff[0] * value;
+}
@@ -0,0 +1,330 @@
+/**
+ * @file    FlashLog.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   Bank 2 플래시에 고장/이벤트 기록을 남기는 비차단(Non-stalling) 로그 구현 소스 파일
+ *
+ * @details [Read-While-Write 구조]
+ * 단일 Bank에서 소거/프로그램을 수행하면 완료될 때까지 같은 Bank의 명령어 인출이 멈춰
+ * 20kHz 제어 ISR이 지연됩니다. 본 모듈은 Dual Bank 모드(OPTR.DBANK = 1)에서 로그를 Bank 2
+ * 마지막 16 페이지에만 기록하고, 코드와 상수는 링커 스크립트로 Bank 1(0x08000000 ~ 0x0803FFFF)에
+ * 제한합니다. 따라서 소거(약 22ms)나 프로그램(약 85µs) 도중에도 ISR은 지연 없이 실행됩니다.
+ *
+ * | 항목 | 내용 |
+ * | :--- | :--- |
+ * | **기록 단위** | 32byte 레코드 = 더블워드 4개. 메인 루프 1회당 최대 1개 동작만 시작하고 BSY는 폴링하지 않음 |
+ * | **Wear Leveling** | 1024 슬롯 링 구조. 페이지 첫 슬롯에 도달하면 가장 오래된 페이지를 소거 후 재사용 |
+ * | **유효성** | 시퀀스 번호 + CRC-32 (하드웨어 CRC). 부팅 시 최대 시퀀스 다음 슬롯부터 기록 재개 |
+ * | **검증** | 기록 버스트 동안 증가한 ulOverrunCnt를 ulBurstOverrun에 기록 (0이면 Deadline Miss 없음) |
+ *
+ * @note Single Bank 옵션(DBANK = 0)에서는 Read-While-Write가 불가능하므로 로그를 비활성화합니다.
+ * @note 프로그램 도중 전원이 차단되어 ECC 이중 오류가 남은 슬롯은 부팅 스캔 시 NMI를 유발할 수 있습니다.
+ */
+
+#include <string.h>
+#include "GlobalVar.h"
+#include "FlashLog.h"
+
+/** @brief 플래시 로그 상태 객체 */
+sFlashLog FlashLog;
+
+/** @brief 기록 대기 큐 */
+static sFlashLogRec FlashLogQueue[FLOG_QUEUE_NUM];
+
+/** @brief 현재 기록 중인 레코드 (시퀀스/CRC 포함) */
+static sFlashLogRec FlashLogCur;
+
+/**
+ * @brief  슬롯 번호에 해당하는 플래시 주소를 반환합니다.
+ * @param  uIdx 슬롯 번호
+ * @retval 레코드 포인터
+ */
+static const sFlashLogRec* pFlashLogSlot(uint16_t uIdx){
+	return (const sFlashLogRec*)(FLOG_BASE_ADDR + (uint32_t)uIdx * FLOG_REC_SIZE);
+}
+
+/**
+ * @brief  하드웨어 CRC 유닛으로 워드 배열의 CRC-32를 계산합니다.
+ * @param  pulData 데이터 포인터
+ * @param  uWordNum 워드 수
+ * @retval CRC-32
+ */
+static uint32_t ulFlashLogCrc(const uint32_t* pulData, uint16_t uWordNum){
+	uint16_t i;
+
+	CRC->CR = CRC_CR_RESET;
+	for(i = 0u; i < uWordNum; i++) CRC->DR = pulData[i];
+	return CRC->DR;
+}
+
+/**
+ * @brief  레코드의 시퀀스 번호와 CRC가 유효한지 확인합니다.
+ * @param  pRec 레코드 포인터
+ * @retval 1: 유효, 0: 빈 슬롯 또는 손상
+ */
+static uint16_t uFlashLogValid(const sFlashLogRec* pRec){
+	if(pRec->ulSeq == 0xFFFFFFFFUL) return 0u;
+	return (ulFlashLogCrc((const uint32_t*)pRec, 7u) == pRec->ulCrc) ? 1u : 0u;
+}
+
+/**
+ * @brief  슬롯이 속한 페이지가 완전히 소거된 상태인지 확인합니다.
+ * @param  uIdx 페이지 첫 슬롯 번호
+ * @retval 1: 소거됨, 0: 기록된 데이터 있음
+ */
+static uint16_t uFlashLogPageBlank(uint16_t uIdx){
+	const uint32_t* pulWord = (const uint32_t*)pFlashLogSlot(uIdx);
+	uint16_t i;
+
+	for(i = 0u; i < (FLOG_PAGE_SIZE / 4u); i++) {
+		if(pulWord[i] != 0xFFFFFFFFUL) return 0u;
+	}
+	return 1u;
+}
+
+/**
+ * @brief  현재 슬롯이 속한 Bank 2 페이지 소거를 시작합니다. (완료를 기다리지 않음)
+ * @param  없음
+ * @retval 없음
+ */
+static void vFlashLogStartErase(void){
+	uint32_t ulPage = FLOG_PAGE_FIRST + FlashLog.uRecIdx / FLOG_REC_PER_PAGE;
+
+	FLASH->CR = (FLASH->CR & ~(FLASH_CR_PNB | FLASH_CR_PG)) | FLASH_CR_PER | FLASH_CR_BKER | (ulPage << FLASH_CR_PNB_Pos);
+	FLASH->CR |= FLASH_CR_STRT;
+}
+
+/**
+ * @brief  현재 레코드의 uDwIdx번째 더블워드 프로그램을 시작합니다. (완료를 기다리지 않음)
+ * @param  없음
+ * @retval 없음
+ */
+static void vFlashLogStartProgram(void){
+	const uint32_t* pulSrc = (const uint32_t*)&FlashLogCur + 2u * FlashLog.uDwIdx;
+	volatile uint32_t* pulDst = (volatile uint32_t*)pFlashLogSlot(FlashLog.uRecIdx) + 2u * FlashLog.uDwIdx;
+
+	FLASH->CR = (FLASH->CR & ~(FLASH_CR_PER | FLASH_CR_BKER | FLASH_CR_PNB)) | FLASH_CR_PG;
+	pulDst[0] = pulSrc[0];
+	__ISB();
+	pulDst[1] = pulSrc[1];
+}
+
+/**
+ * @brief  플래시 데이터 캐시를 비워 소거/프로그램된 내용을 다시 읽을 수 있게 합니다.
+ * @param  없음
+ * @retval 없음
+ */
+static void vFlashLogFlushDCache(void){
+	FLASH->ACR &= ~FLASH_ACR_DCEN;
+	FLASH->ACR |= FLASH_ACR_DCRST;
+	FLASH->ACR &= ~FLASH_ACR_DCRST;
+	FLASH->ACR |= FLASH_ACR_DCEN;
+}
+
+/**
+ * @brief  큐의 가장 오래된 레코드를 제거하고 다음 슬롯으로 이동합니다.
+ * @param  uWritten 1: 기록 완료, 0: 오류로 폐기
+ * @retval 없음
+ */
+static void vFlashLogNext(uint16_t uWritten){
+	FLASH->CR &= ~(FLASH_CR_PG | FLASH_CR_PER | FLASH_CR_BKER | FLASH_CR_PNB);
+
+	FlashLog.uQTail = (FlashLog.uQTail + 1u) & (FLOG_QUEUE_NUM - 1u);
+	FlashLog.uRecIdx = (FlashLog.uRecIdx + 1u) % FLOG_REC_NUM;
+	FlashLog.uDwIdx = 0u;
+
+	if(uWritten) {
+		FlashLog.ulSeq++;
+		FlashLog.ulWriteCnt++;
+	}
+	FlashLog.uState = FLOG_STATE_IDLE;
+}
+
+/**
+ * @brief  플래시 상태 레지스터의 오류 플래그를 확인하고 클리어합니다.
+ * @param  없음
+ * @retval 1: 오류 발생, 0: 정상
+ */
+static uint16_t uFlashLogError(void){
+	uint32_t ulErr = FLASH->SR & FLASH_FLAG_SR_ERRORS;
+
+	if(ulErr == 0ul) return 0u;
+
+	FLASH->SR = ulErr;
+	FlashLog.ulErrCnt++;
+	return 1u;
+}
+
+/**
+ * @brief  Dual Bank 여부를 확인하고 로그 영역을 스캔하여 다음 기록 위치를 찾습니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitFlashLog(void){
+	const sFlashLogRec* pRec;
+	uint32_t ulSeqMax = 0ul;
+	uint16_t uIdxMax = FLOG_REC_NUM - 1u, i;
+
+	memset(&FlashLog, 0, sizeof(FlashLog));
+	FlashLog.uState = FLOG_STATE_DISABLE;
+
+	if((FLASH->OPTR & FLASH_OPTR_DBANK) == 0ul) return;
+
+	RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+	(void)RCC->AHB1ENR;
+
+	/* 최대 시퀀스 번호를 가진 유효 레코드 검색 */
+	for(i = 0u; i < FLOG_REC_NUM; i++) {
+		pRec = pFlashLogSlot(i);
+		if(uFlashLogValid(pRec) && (pRec->ulSeq >= ulSeqMax)) {
+			ulSeqMax = pRec->ulSeq;
+			uIdxMax = i;
+		}
+	}
+
+	/* 다음 슬롯부터 기록. 손상된(빈 슬롯이 아닌) 슬롯은 페이지 경계까지 건너뜀 */
+	FlashLog.ulSeq = ulSeqMax + 1ul;
+	FlashLog.uRecIdx = (uIdxMax + 1u) % FLOG_REC_NUM;
+	while(((FlashLog.uRecIdx % FLOG_REC_PER_PAGE) != 0u) && (pFlashLogSlot(FlashLog.uRecIdx)->ulSeq != 0xFFFFFFFFUL)) {
+		FlashLog.uRecIdx = (FlashLog.uRecIdx + 1u) % FLOG_REC_NUM;
+	}
+
+	FlashLog.uState = FLOG_STATE_IDLE;
+}
+
+/**
+ * @brief  레코드를 기록 대기 큐에 넣습니다. (ISR 포함 모든 문맥에서 호출 가능)
+ * @param  uType 레코드 종류 (FLOG_TYPE_*)
+ * @param  pData 데이터 포인터
+ * @param  uLen 데이터 길이 [byte] (FLOG_PAYLOAD_SIZE 초과분은 잘림)
+ * @retval 1: 성공, 0: 큐 가득 참 또는 사용 불가
+ */
+uint16_t uFlashLogPush(uint16_t uType, const void* pData, uint16_t uLen){
+	sFlashLogRec* pRec;
+	uint32_t ulPrimask;
+	uint16_t uNext;
+
+	if(FlashLog.uState == FLOG_STATE_DISABLE) return 0u;
+	if(uLen > FLOG_PAYLOAD_SIZE) uLen = FLOG_PAYLOAD_SIZE;
+
+	ulPrimask = __get_PRIMASK();
+	__disable_irq();
+
+	uNext = (FlashLog.uQHead + 1u) & (FLOG_QUEUE_NUM - 1u);
+	if(uNext == FlashLog.uQTail) {
+		FlashLog.ulDropCnt++;
+		__set_PRIMASK(ulPrimask);
+		return 0u;
+	}
+
+	pRec = &FlashLogQueue[FlashLog.uQHead];
+	memset(pRec, 0xFF, sizeof(sFlashLogRec));
+	pRec->uType = uType;
+	pRec->uLen = uLen;
+	memcpy(pRec->uPayload, pData, uLen);
+	FlashLog.uQHead = uNext;
+
+	__set_PRIMASK(ulPrimask);
+	return 1u;
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 소거/프로그램을 한 단계씩 진행합니다. (대기 없음)
+ * @details
+ * 1. IDLE: 큐에 레코드가 있으면 시퀀스 번호와 CRC를 붙이고, 페이지 첫 슬롯이면서 소거되지 않은 페이지는 소거를 시작합니다.
+ * 2. ERASE: BSY 해제 시 데이터 캐시를 비우고 첫 더블워드 프로그램을 시작합니다.
+ * 3. PROGRAM: BSY 해제 시 다음 더블워드를 시작하고, 4개 완료 시 다음 슬롯으로 이동합니다.
+ * 4. 큐가 비면 플래시를 잠그고 버스트 동안의 제어 주기 초과 횟수를 기록합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vFlashLogTask(void){
+	switch(FlashLog.uState){
+	case FLOG_STATE_IDLE:
+		if(FlashLog.uQHead == FlashLog.uQTail) break;
+
+		if(READ_BIT(FLASH->CR, FLASH_CR_LOCK)) {
+			HAL_FLASH_Unlock();
+			FlashLog.ulBurstOverrunStart = ulOverrunCnt;
+		}
+
+		FlashLogCur = FlashLogQueue[FlashLog.uQTail];
+		FlashLogCur.ulSeq = FlashLog.ulSeq;
+		FlashLogCur.ulCrc = ulFlashLogCrc((const uint32_t*)&FlashLogCur, 7u);
+		FlashLog.uDwIdx = 0u;
+
+		if(((FlashLog.uRecIdx % FLOG_REC_PER_PAGE) == 0u) && !uFlashLogPageBlank(FlashLog.uRecIdx)) {
+			vFlashLogStartErase();
+			FlashLog.uState = FLOG_STATE_ERASE;
+		}
+		else {
+			vFlashLogStartProgram();
+			FlashLog.uState = FLOG_STATE_PROGRAM;
+		}
+		break;
+
+	case FLOG_STATE_ERASE:
+		if(FLASH->SR & FLASH_SR_BSY) break;
+
+		if(uFlashLogError()) {
+			vFlashLogNext(0u);
+			break;
+		}
+		vFlashLogFlushDCache();
+		vFlashLogStartProgram();
+		FlashLog.uState = FLOG_STATE_PROGRAM;
+		break;
+
+	case FLOG_STATE_PROGRAM:
+		if(FLASH->SR & FLASH_SR_BSY) break;
+
+		if(uFlashLogError()) {
+			vFlashLogNext(0u);
+			break;
+		}
+		FLASH->SR = FLASH_SR_EOP;
+
+		FlashLog.uDwIdx++;
+		if(FlashLog.uDwIdx < (FLOG_REC_SIZE / 8u)) {
+			vFlashLogStartProgram();
+			break;
+		}
+		vFlashLogNext(1u);
+		break;
+
+	default: //case FLOG_STATE_DISABLE:
+		return;
+	}
+
+	/* 버스트 종료: 잠금 및 검증 지표 기록 */
+	if((FlashLog.uState == FLOG_STATE_IDLE) && (FlashLog.uQHead == FlashLog.uQTail) && !READ_BIT(FLASH->CR, FLASH_CR_LOCK)) {
+		vFlashLogFlushDCache();
+		HAL_FLASH_Lock();
+		FlashLog.ulBurstOverrun = ulOverrunCnt - FlashLog.ulBurstOverrunStart;
+	}
+}
+
+/**
+ * @brief  지정한 종류의 가장 최근 유효 레코드를 읽습니다.
+ * @note   기록 진행 중(ERASE/PROGRAM)에는 Bank 2 읽기가 지연되므로 메인 루프 IDLE 상태에서만 호출합니다.
+ * @param  uType 레코드 종류
+ * @param  pRec 결과 레코드
+ * @retval 1: 찾음, 0: 없음
+ */
+uint16_t uFlashLogReadLatest(uint16_t uType, sFlashLogRec* pRec){
+	const sFlashLogRec* pSlot;
+	uint32_t ulSeqMax = 0ul;
+	uint16_t uFound = 0u, i;
+
+	if(FlashLog.uState != FLOG_STATE_IDLE) return 0u;
+
+	for(i = 0u; i < FLOG_REC_NUM; i++) {
+		pSlot = pFlashLogSlot(i);
+		if((pSlot->uType == uType) && uFlashLogValid(pSlot) && (pSlot->ulSeq >= ulSeqMax)) {
+			ulSeqMax = pSlot->ulSeq;
+			*pRec = *pSlot;
+			uFound = 1u;
+		}
+	}
+	return uFound;
+}
@@ -18,8 +18,8 @@
  * @details [주요 제어 및 초기화 함수 (Functions)]
  * | 함수명 | 파라미터 / 대상 | 주요 동작 및 특징 |
  * | :--- | :--- | :--- |
- * | **vInintMotorParameter** | `sMotorCtrl*` | 구조체에 모터 파라미터(Ld, Lq, Rs, 극쌍수 등) 및 연산 최적화용 역수값 할당 |
- * | **vInitController** | - | 제어 모드 설정 및 속도/전류 제어기, 관측기 초기화 수행 |
+ * | **vInintMotorParameter** | `sMotorCtrl*` | 구조체에 모터 파라미터(Ld, Lq, Rs, 극쌍수 등) 및 역수값 할당 (부팅 시 1회) |
+ * | **vInitController** | - | 제어 모드 설정 및 속도/전류 제어기, 관측기 상태 초기화 (이득/계수는 파라미터 세트) |
  * | **vSwitchOnSettingTIM** | `TIM_HandleTypeDef*` | 게이트 드라이버 Enable 및 타이머 채널/MOE 활성화 (PWM 출력 시작) |
  * | **vSwitchOffSettingTIM** | `TIM_HandleTypeDef*` | 게이트 드라이버 Disable 및 MOE 차단 (Emergency Stop, 고장 시 즉시 차단) |
  * | **vBootstrapCharge** | `TIM_HandleTypeDef*` | 상측 스위치 구동을 위해 하측(N-ch) 스위치만 일정 듀티로 켜서 커패시터 충전 |
@@ -30,6 +30,8 @@
 #include <stdint.h>
 #include "GlobalVar.h"
 #include "MotorControl.h"
+#include "PowerLimit.h"
+#include "Traction.h"
 
 /** @brief PWM 생성을 위한 메인 타이머 핸들러 참조 */
 extern TIM_HandleTypeDef htim1;
@@ -78,6 +80,8 @@ void vSlopeGenerator(float *fVar, float fCmd, float fDelPerTs) {
 
 /**
  * @brief  전동기 모델 기반 제어에 필요한 물리 파라미터를 구조체에 할당합니다.
+ * @details 부팅 시 한 번만 호출합니다 (나눗셈 포함). 제어 ISR은 이 구조체의 상수 대신
+ * 파라미터 세트(pCtrlParam)의 극쌍수, 자속, 토크 상수와 그 역수를 사용하므로, ParamCfg 변경이 그대로 반영됩니다.
  * @param  MotorControl 초기화할 모터 제어 구조체 포인터
  * @retval 없음
  */
@@ -103,17 +107,20 @@ void vInintMotorParameter(sMotorCtrl* MotorControl){
 }
 
 /**
- * @brief  전체 제어 시스템 초기화 (모터 파라미터, 각 제어기 초기화)
+ * @brief  전체 제어 시스템 초기화 (각 제어기 상태 초기화)
+ * @details 리셋/IDLE 진입 시 제어 ISR에서도 호출되므로 상태 변수만 지웁니다.
+ * 이득, 역수, 필터 계수는 파라미터 세트(vParamTask)에서 미리 계산됩니다.
  * @retval 없음
  */
 void vInitController(void){
 	uControlMode = SPDCONTL_MODE; /**< 기본 제어 모드를 속도 제어로 설정 */
 
-	vInintMotorParameter(&INV);
 	//// MOTOR1 초기화 시퀀스 ////
 	vInitCurrentControl(&INV, &INV.CC);
 	vInitSpeedControl(&INV, &INV.SC);
 	vInitSpeedObserver(&INV, &INV.SO);
+	vInitPowerLimit();
+	vTractionReset(&Traction);
 }
 
 /**
@@ -201,36 +208,6 @@ void vBootstrapCharge(TIM_HandleTypeDef *htim) {
 	}
 }
 
-/* 외부 신호(PWM 등) 캡처 결과 저장 변수 */
-volatile uint32_t uFrequency = 0;           /**< 입력 신호 측정 주파수 [Hz] */
-volatile float fDuty_Cycle = 0.0f;          /**< 입력 신호 측정 듀티 [%] */
-volatile uint32_t uLast_Capture_Time = 0;   /**< 마지막 캡처 시점 (타임아웃 감지용) */
-
-/**
- * @brief  타이머 입력 캡처 인터럽트 콜백 함수
- * @details 외부 PWM 신호의 주기(Period)와 펄스폭(Pulse Width)을 측정하여 주파수와 듀티를 계산합니다.
- * @param  htim 인터럽트가 발생한 타이머 핸들러
- */
-void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim)
-{
-    if (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_1)
-    {
-        /* 채널 1에서 주기 읽기, 채널 2에서 펄스폭 읽기 (PWM Input Mode) */
-        uint32_t uPeriod = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_1);
-        uint32_t uPulseWidth = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
-
-        if (uPeriod != 0)
-        {
-            /* 1MHz 타이머 클럭 기준 주파수 계산 */
-            uFrequency = 1000000 / uPeriod;
-            fDuty_Cycle = ((float)uPulseWidth / (float)uPeriod) * 100.0f;
-
-            /* 생존 확인을 위한 타임스탬프 기록 */
-            uLast_Capture_Time = HAL_GetTick();
-        }
-    }
-}
-
 /**
  * @brief  데이터 워치포인트 및 추적(DWT) 유닛을 사용하여 정밀한 사이클 카운터를 활성화합니다.
  * @details 코드의 실행 시간을 클럭 사이클 단위로 측정할 때 사용합니다.
@@ -5,41 +5,143 @@
  * @brief   MCU 내부 DAC를 이용한 실시간 모니터링 출력 구현 소스 파일
  * @details 제어 루프 내의 주요 변수(속도, 전류 등)를 아날로그 전압으로 출력하여
  * 오실로스코프 등을 통해 실시간으로 파형을 관측할 수 있도록 합니다.
+ *
+ * @details [타이머 트리거 DMA 출력 구조]
+ * | 단계 | 동작 |
+ * | :--- | :--- |
+ * | **1. vIntDacOut (ISR)** | 채널 디스크립터(IntDacCh)로 변수를 읽어 `값 × fScale + fOffset`을 12비트로 포화, RAM 버퍼에 기록 |
+ * | **2. TIM3 TRGO** | TIM1 TRGO(업데이트)로 리셋되는 TIM3의 리셋 이벤트가 DAC 트리거 (PWM 주기 경계에 정렬) |
+ * | **3. DAC 변환** | 트리거 시점에 DHR → DOR 이동 후 DMA 요청 |
+ * | **4. DMA** | DMA1_CH2: 버퍼 → DAC1 DHR12RD (CH1/CH2 동시), DMA1_CH3: 버퍼 → DAC2 DHR12R1 |
+ *
+ * | 시점 | DAC 출력(DOR) | DHR (DMA 적재) | RAM 버퍼 |
+ * | :--- | :--- | :--- | :--- |
+ * | **업데이트 k** | DHR(k−1 적재분) | 버퍼 = ISR k−1 값 (ISR k 기록 전) | ISR k−1 값 |
+ * | **ISR k 끝** | 〃 | 〃 | ISR k 값 |
+ * | **업데이트 k+1** | ISR k−1 값 | ISR k 값 | 〃 |
+ * | **업데이트 k+2** | ISR k 값 | ISR k+1 값 | ISR k+1 값 |
+ *
+ * 트리거가 먼저 DHR → DOR 이동을 하고 그 뒤에 DMA가 버퍼를 DHR로 옮기므로, ISR k에서 기록한 값은 k+2번째 업데이트
+ * 시점에 출력됩니다 (2 제어 주기 고정 지연). vIntDacOut은 ISR 끝에서 호출되어 같은 주기의 DMA 전송보다 항상 늦으므로
+ * 지연은 ISR 실행 시간 변동과 무관하게 일정하고, 모든 채널이 같은 시점에 갱신됩니다.
+ * TIM1 TRGO(업데이트)는 vControl을 호출하는 TIM1 업데이트 인터럽트와 같은 이벤트입니다. 중앙 정렬, RCR = 0에서는
+ * 오버플로와 언더플로 모두 업데이트가 발생하지만 인터럽트도 같은 이벤트로 발생하므로 제어 ISR 1회당 트리거는 1회입니다.
  */
 
 #include "Globalvar.h"
 #include "MotorControl.h"
 #include "IntDac.h"
+#include "VarTable.h"
 
 /** @brief 테스트용 내부 변수 */
 float fTest_Int = 0.0f;
 
-/** @brief DAC 채널별 출력 스케일링 계수 배열 (기본값: 1500 RPM 기준 스케일링) */
-float fIntDacScale[3] = {DAC_CODES_PER_VOLT / (1500.0f), DAC_CODES_PER_VOLT /(1500.0f), DAC_CODES_PER_VOLT / (1500.0f)};
+/** @brief DAC 채널 디스크립터 (기본값: 추정 속도, 1500 RPM 당 1V, 중심 2048) */
+sDataChannel IntDacCh[INT_DAC_CH_NUM] = {
+		{&INV.SO.fWrpmSC, DCH_TYPE_FLOAT, DAC_CODES_PER_VOLT / 1500.0f, DAC_CODE_CENTER},
+		{&INV.SO.fWrpmSC, DCH_TYPE_FLOAT, DAC_CODES_PER_VOLT / 1500.0f, DAC_CODE_CENTER},
+		{&INV.SO.fWrpmSC, DCH_TYPE_FLOAT, DAC_CODES_PER_VOLT / 1500.0f, DAC_CODE_CENTER},
+};
 
-/** @brief DAC 출력을 위해 참조할 데이터의 주소 포인터 배열 */
-uint16_t *uIntDacDatAddr[3] = {0u, 0u, 0u};
-
-/** @brief DAC 출력 데이터의 타입(모드) 설정 배열 */
-uint16_t uIntDacDatType[3] = {0u, 0u, 0u};
+/** @brief DAC1 이중 채널 DMA 버퍼 (DHR12RD 형식: [27:16] CH2, [11:0] CH1) */
+static volatile uint32_t ulIntDacDual = 0x08000800UL;
+/** @brief DAC2 채널 1 DMA 버퍼 */
+static volatile uint16_t uIntDacDac2 = 0x0800u;
 
 /** @brief STM32 HAL DAC1 핸들러 외칭 참조 */
 extern DAC_HandleTypeDef hdac1;
 /** @brief STM32 HAL DAC2 핸들러 외칭 참조 */
 extern DAC_HandleTypeDef hdac2;
 
+/**
+ * @brief  채널 값을 DAC 12비트 코드로 변환합니다.
+ * @param  pCh 채널 디스크립터 포인터
+ * @retval 0 ~ 4095 코드
+ */
+static inline uint32_t ulIntDacCode(const sDataChannel* pCh){
+	float fCode = fScaleDataChannel(pCh);
+	return (uint32_t)LIMIT(fCode, 0.0f, 4095.0f);
+}
+
+/**
+ * @brief  변수 레지스트리 ID로 DAC 채널을 지정합니다.
+ * @details 레지스트리의 주소/타입을 사용하고, 스케일은 1V당 물리량(fUnitPerVolt)으로, 오프셋은 중심 코드(1.65V)로 설정합니다.
+ * 디스크립터 필드를 하나씩 갱신하므로 ISR에서 잠시 혼합된 값이 출력될 수 있으나 모니터링 용도로는 무해합니다.
+ * @param  uCh DAC 채널 (0 ~ INT_DAC_CH_NUM-1)
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @param  fUnitPerVolt 출력 1V당 변수 값 [단위/V]
+ * @retval 1: 성공, 0: 잘못된 채널, ID 또는 스케일
+ */
+uint16_t uIntDacSelect(uint16_t uCh, uint16_t uId, float fUnitPerVolt){
+	sDataChannel Ch;
+
+	if((uCh >= INT_DAC_CH_NUM) || (fUnitPerVolt == 0.0f)) return 0u;
+	if(!uVarChannel(uId, &Ch)) return 0u;
+
+	Ch.fScale = DAC_CODES_PER_VOLT / fUnitPerVolt;
+	Ch.fOffset = DAC_CODE_CENTER;
+	IntDacCh[uCh] = Ch;
+	return 1u;
+}
+
+/**
+ * @brief  TIM1 TRGO에 동기되어 DAC 트리거를 생성하는 TIM3를 설정합니다.
+ * @details TIM3는 슬레이브 리셋 모드(TS = ITR0: TIM1)로 동작하며, MMS = Reset이므로
+ * TIM1 업데이트 이벤트(제어 ISR과 같은 이벤트)마다 TIM3 TRGO가 1회 발생합니다. ARR은 최대값으로 두어 자체 오버플로에 의한 트리거가 없습니다.
+ * @param  없음
+ * @retval 없음
+ */
+static void vInitIntDacTrigger(void){
+	RCC->APB1ENR1 |= RCC_APB1ENR1_TIM3EN;
+	(void)RCC->APB1ENR1;
+
+	TIM3->CR1 = 0u;
+	TIM3->PSC = 0u;
+	TIM3->ARR = 0xFFFFu;
+	TIM3->CR2 = 0u;                         /* MMS = 000: Reset → TRGO */
+	TIM3->SMCR = TIM_SMCR_SMS_2;            /* SMS = 100: Reset mode, TS = 000: ITR0 (TIM1 TRGO) */
+	TIM3->EGR = TIM_EGR_UG;
+	TIM3->CR1 = TIM_CR1_CEN;
+}
+
+/**
+ * @brief  DAC 데이터 전달용 DMA 채널을 설정합니다. (순환 모드, 1회 전송)
+ * @details DMAMUX1 채널 n-1이 DMA1 채널 n의 요청을 선택합니다.
+ * @param  없음
+ * @retval 없음
+ */
+static void vInitIntDacDma(void){
+	/* DMA1_CH2: ulIntDacDual → DAC1 DHR12RD (32bit) */
+	DMA1_Channel2->CCR = 0u;
+	DMAMUX1_Channel1->CCR = DMA_REQUEST_DAC1_CHANNEL1;
+	DMA1_Channel2->CPAR = (uint32_t)&DAC1->DHR12RD;
+	DMA1_Channel2->CMAR = (uint32_t)&ulIntDacDual;
+	DMA1_Channel2->CNDTR = 1u;
+	DMA1_Channel2->CCR = DMA_CCR_DIR | DMA_CCR_CIRC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | DMA_CCR_EN;
+
+	/* DMA1_CH3: uIntDacDac2 → DAC2 DHR12R1 (16bit) */
+	DMA1_Channel3->CCR = 0u;
+	DMAMUX1_Channel2->CCR = DMA_REQUEST_DAC2_CHANNEL1;
+	DMA1_Channel3->CPAR = (uint32_t)&DAC2->DHR12R1;
+	DMA1_Channel3->CMAR = (uint32_t)&uIntDacDac2;
+	DMA1_Channel3->CNDTR = 1u;
+	DMA1_Channel3->CCR = DMA_CCR_DIR | DMA_CCR_CIRC | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 | DMA_CCR_EN;
+}
+
 /**
  * @brief  내부 DAC1, DAC2의 각 채널을 초기화하고 시작합니다.
  * @details
- * - 트리거 없음(None), 출력 버퍼 활성화(Enable) 설정
+ * - TIM3 TRGO 트리거, 출력 버퍼 활성화(Enable) 설정
  * - DAC1 채널 1, 2 및 DAC2 채널 1을 시작하여 총 3채널 모니터링 준비
+ * - DAC1 CH1, DAC2 CH1의 DMA 요청을 활성화 (DAC1 CH2는 DHR12RD 이중 쓰기로 함께 갱신)
+ * @note   MX_DMA_Init(DMA1/DMAMUX1 클럭) 및 MX_TIM1_Init 이후 호출해야 합니다.
  * @retval 없음
  */
 void vInitIntDac(){
 
 	DAC_ChannelConfTypeDef sConfig = {0};
 
-	sConfig.DAC_Trigger = DAC_TRIGGER_NONE;
+	sConfig.DAC_Trigger = DAC_TRIGGER_T3_TRGO;
 	sConfig.DAC_OutputBuffer = DAC_OUTPUTBUFFER_ENABLE;
 	sConfig.DAC_ConnectOnChipPeripheral = DAC_CHIPCONNECT_DISABLE;
 	sConfig.DAC_UserTrimming = DAC_TRIMMING_FACTORY;
@@ -52,35 +154,23 @@ void vInitIntDac(){
 
 	HAL_DAC_ConfigChannel(&hdac1, &sConfig, DAC_CHANNEL_2);
 	HAL_DAC_Start(&hdac1, DAC_CHANNEL_2);
+
+	vInitIntDacDma();
+	DAC1->CR |= DAC_CR_DMAEN1;
+	DAC2->CR |= DAC_CR_DMAEN1;
+
+	vInitIntDacTrigger();
 }
 
 /**
- * @brief  실시간 루프에서 호출되어 설정된 변수를 DAC 데이터 레지스터에 기록합니다.
+ * @brief  실시간 루프에서 호출되어 설정된 변수를 DAC DMA 버퍼에 기록합니다.
  * @details
- * - 각 채널별로 타입(uIntDacDatType)에 따라 추정 속도 또는 사용자 지정 변수를 출력합니다.
- * - 12비트 DAC의 중간값인 2048(1.65V)을 오프셋으로 더하여 양/음의 신호를 모두 표현할 수 있습니다.
- * - 레지스터(DHR12R1, DHR12R2)에 직접 접근하여 처리 속도를 최적화하였습니다.
+ * - 각 채널은 디스크립터의 타입에 맞게 읽혀 곱셈-덧셈 1회로 DAC 코드로 변환됩니다.
+ * - 기본 오프셋 2048(1.65V)로 양/음의 신호를 모두 표현할 수 있습니다.
+ * - 실제 출력은 두 번째 TIM1 업데이트 시점에 세 채널이 동시에 갱신됩니다 (다음 업데이트에서 DMA가 DHR에 적재, 그다음 업데이트에서 출력).
  * @retval 없음
  */
 void vIntDacOut(){
-	///Channel_1 (DAC1_CH1)
-	if(uIntDacDatType[0] == 0){
-		DAC1->DHR12R1 = (uint16_t)(fIntDacScale[0] * (INV.SO.fWrpmSC) + 2048u);
-	}else{
-		DAC1->DHR12R1 =(uint16_t)(fIntDacScale[0] * (*(int *)(uIntDacDatAddr[0])) + 2048u);
-	}
-
-	///Channel_2 (DAC1_CH2)
-	if(uIntDacDatType[1] == 0){
-		DAC1->DHR12R2 = (uint16_t)(fIntDacScale[1] * (INV.SO.fWrpmSC) + 2048u);
-	}else{
-		DAC1->DHR12R2 =(uint16_t)(fIntDacScale[1] * (*(int *)(uIntDacDatAddr[1])) + 2048u);
-	}
-
-	///Channel_3 (DAC2_CH1)
-	if(uIntDacDatType[2] == 0){
-		DAC2->DHR12R1 = (uint16_t)(fIntDacScale[2] * (INV.SO.fWrpmSC) + 2048u);
-	}else{
-		DAC2->DHR12R1 =(uint16_t)(fIntDacScale[2] * (*(int *)(uIntDacDatAddr[2])) + 2048u);
-	}
+	ulIntDacDual = ulIntDacCode(&IntDacCh[0]) | (ulIntDacCode(&IntDacCh[1]) << 16);
+	uIntDacDac2 = (uint16_t)ulIntDacCode(&IntDacCh[2]);
 }
@@ -0,0 +1,126 @@
+/**
+ * @file    Mailbox.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 ISR과 백그라운드 코드 사이의 잠금 없는(Lock-free) 단일 생산자/단일 소비자 통신 구현 소스 파일
+ *
+ * @details [메모리 배리어 위치]
+ * | 함수 | 순서 |
+ * | :--- | :--- |
+ * | **uSpscPush** | 항목 기록 → DMB → uHead 증가 |
+ * | **uSpscPop** | uHead 판독 → DMB → 항목 판독 → DMB → uTail 증가 |
+ * | **vMbxWrite** | 비게시 슬롯 기록 → DMB → ulSeq 증가 |
+ * | **ulMbxRead** | ulSeq 판독 → DMB → 슬롯 복사 → DMB → ulSeq 재확인 |
+ *
+ * __DMB는 컴파일러 재배치도 막으므로 volatile이 아닌 버퍼 접근이 카운터 갱신을 넘어 이동하지 않습니다.
+ */
+
+#include <string.h>
+#include "main.h"
+#include "Mailbox.h"
+
+/**
+ * @brief  링 버퍼를 초기화합니다.
+ * @param  pRing 링 버퍼
+ * @param  pBuf 항목 버퍼
+ * @param  uSize 항목 수 (2의 거듭제곱)
+ * @retval 없음
+ */
+void vSpscInit(sSpscRing* pRing, uint32_t* pBuf, uint16_t uSize){
+	pRing->uHead = 0u;
+	pRing->uTail = 0u;
+	pRing->uMask = (uint16_t)(uSize - 1u);
+	pRing->pBuf = pBuf;
+	pRing->ulFullCnt = 0ul;
+}
+
+/**
+ * @brief  항목을 추가합니다. (생산자)
+ * @param  pRing 링 버퍼
+ * @param  ulItem 항목
+ * @retval 1: 성공, 0: 가득 참
+ */
+uint16_t uSpscPush(sSpscRing* pRing, uint32_t ulItem){
+	uint16_t uHead = pRing->uHead;
+
+	if((uint16_t)(uHead - pRing->uTail) > pRing->uMask) {
+		pRing->ulFullCnt++;
+		return 0u;
+	}
+
+	pRing->pBuf[uHead & pRing->uMask] = ulItem;
+	__DMB();
+	pRing->uHead = (uint16_t)(uHead + 1u);
+	return 1u;
+}
+
+/**
+ * @brief  가장 오래된 항목을 꺼냅니다. (소비자)
+ * @param  pRing 링 버퍼
+ * @param  pulItem 꺼낸 항목
+ * @retval 1: 성공, 0: 비어 있음
+ */
+uint16_t uSpscPop(sSpscRing* pRing, uint32_t* pulItem){
+	uint16_t uTail = pRing->uTail;
+
+	if(pRing->uHead == uTail) return 0u;
+	__DMB();
+
+	*pulItem = pRing->pBuf[uTail & pRing->uMask];
+	__DMB();
+	pRing->uTail = (uint16_t)(uTail + 1u);
+	return 1u;
+}
+
+/**
+ * @brief  우편함을 초기화하고 초기값을 게시합니다.
+ * @param  pMbx 우편함
+ * @param  pSlot0 슬롯 0 버퍼
+ * @param  pSlot1 슬롯 1 버퍼
+ * @param  uSize 슬롯 크기 [byte]
+ * @param  pInit 초기값
+ * @retval 없음
+ */
+void vMbxInit(sMbxLatest* pMbx, void* pSlot0, void* pSlot1, uint16_t uSize, const void* pInit){
+	pMbx->pSlot[0] = pSlot0;
+	pMbx->pSlot[1] = pSlot1;
+	pMbx->uSize = uSize;
+
+	memcpy(pSlot0, pInit, uSize);
+	memcpy(pSlot1, pInit, uSize);
+	__DMB();
+	pMbx->ulSeq = 0ul;
+}
+
+/**
+ * @brief  새 값을 게시합니다. (생산자)
+ * @param  pMbx 우편함
+ * @param  pSrc 게시할 값 (uSize byte)
+ * @retval 없음
+ */
+void vMbxWrite(sMbxLatest* pMbx, const void* pSrc){
+	uint32_t ulSeq = pMbx->ulSeq + 1ul;
+
+	memcpy(pMbx->pSlot[ulSeq & 1ul], pSrc, pMbx->uSize);
+	__DMB();
+	pMbx->ulSeq = ulSeq;
+}
+
+/**
+ * @brief  가장 최근에 게시된 값을 읽습니다. (소비자)
+ * @param  pMbx 우편함
+ * @param  pDst 읽은 값 (uSize byte)
+ * @retval 읽은 값의 게시 번호
+ */
+uint32_t ulMbxRead(sMbxLatest* pMbx, void* pDst){
+	uint32_t ulSeq;
+
+	do {
+		ulSeq = pMbx->ulSeq;
+		__DMB();
+		memcpy(pDst, pMbx->pSlot[ulSeq & 1ul], pMbx->uSize);
+		__DMB();
+	} while(ulSeq != pMbx->ulSeq);
+
+	return ulSeq;
+}
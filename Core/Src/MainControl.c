@@ -7,19 +7,20 @@
  * FOC(Field Oriented Control) 기반 모터 제어 및 보호 로직을 수행한다.
  *
  * @details [메인 제어 루프 실행 순서]
- * 1. 연산 시간 모니터링을 위한 CPU 사이클 카운트 시작
+ * 1. 연산 시간 모니터링을 위한 CPU 사이클 카운트 시작, 게시된 파라미터 세트로 교체 (vParamFetch), RC 스로틀 설정값 게시 (vThrottleUpdate), 명령 이벤트 처리 및 우선 출처의 설정값 스냅숏 적용 (vCmdFetch)
  * 2. 홀 센서 기반 회전자 위치 및 각도 정보 갱신 (fGetHallSensorInfo)
- * 3. H/W 및 S/W 고장(Fault) 검사: 과전압, 과전류, 과속도 감지 시 즉시 예외 처리
+ * 3. H/W 및 S/W 고장(Fault) 검사: 과전압/저전압, 상별 과전류, 과속도, 홀 무효, 연산 시간 초과를 원인별 디바운스 후 래치 (uFaultEvaluate)
  * 4. 리셋(Reset) 명령 처리 및 시스템 제어기 초기화
  * 5. 상태 머신(State Machine) 및 제어 모드(uControlMode)에 따른 제어 로직 수행
- * 6. 내부 변수 디버깅용 DAC 출력 (vIntDacOut) 및 제어 루프 소요 시간 계산
+ * 6. 블랙박스 기록 (vBlackBoxRecord), 소프트웨어 스코프 캡처 (vScopeRecord), 텔레메트리 프레임 기록 (vTelemRecord), 내부 변수 디버깅용 DAC 출력 (vIntDacOut) 및 제어 루프 소요 시간 계산
  *
  * @details [상태 머신 (State Machine) 구조]
  * | 상태 (State) | 주요 동작 및 특징 |
  * | :--- | :--- |
  * | **IDLE** | 제어기 초기화 및 PWM 차단. START 명령 시 부트스트랩 충전 후 상태 전이 대기 |
+ * | **FLYSTART** | PWM 차단 상태로 홀 에지 간격을 확인하여 회전 중이면 관측기/제어기 상태를 맞춘 뒤 곧바로 RUN, 정지 상태면 ALIGN으로 전이 |
  * | **ALIGN** | FOC 구동 전 회전자 초기 위치 정렬 수행. 정렬 완료 후 모드에 따라 전이 |
- * | **RUN** | 20kHz 주기로 전류 제어 및 전압 변조(SVPWM) 수행, 분주기(uSpdCnt)를 통한 속도 제어 수행 |
+ * | **RUN** | 20kHz 주기로 전류 제어 및 전압 변조(SVPWM) 수행, 분주기(uSpdCnt)를 통한 구동력 제어(fTractionUpdate) 및 속도 제어 수행. 고속 영역에서는 동기 PWM(vSyncPwmUpdate)으로 캐리어 주기 가변 |
  * | **FAULT** | 시스템 고장 감지 시 PWM을 즉시 차단하고 구동을 중지하여 하드웨어 보호 |
  *
  * @details [제어 모드 (uControlMode)에 따른 동작 분기]
@@ -28,18 +29,35 @@
  * | :--- | :--- | :--- |
  * | **DUTY_TEST_MODE**<br>**CONST_VOLT_MODE** | IDLE &rarr; RUN | 위치 정렬(ALIGN)이 필요 없는 테스트/전압 개루프 모드. 바로 RUN 상태로 진입. |
  * | **ALIGN_MODE** | IDLE &rarr; ALIGN &rarr; IDLE | 회전자 위치 정렬만 단독으로 수행하고 다시 대기(IDLE) 상태로 복귀. |
- * | **일반 구동 모드**<br>(FOC 등) | IDLE &rarr; ALIGN &rarr; RUN | 정상적인 모터 구동을 위해 위치 정렬 완료 후 RUN 상태로 진입. |
+ * | **VECTCONTL_MODE**<br>**SPDCONTL_MODE** | IDLE &rarr; FLYSTART &rarr; RUN<br>IDLE &rarr; FLYSTART &rarr; ALIGN &rarr; RUN | 회전 중이면 Align 없이 포착하여 RUN 진입, 정지 상태면 기존 위치 정렬 후 RUN 진입. |
+ * | **기타 구동 모드**<br>(CONST_CUR_MODE 등) | IDLE &rarr; ALIGN &rarr; RUN | 정상적인 모터 구동을 위해 위치 정렬 완료 후 RUN 상태로 진입. |
  */
 #include "GlobalVar.h"
 #include "UserMath.h"
 #include "MotorControl.h"
 #include "IntDac.h"
+#include "SyncPwm.h"
+#include "BlackBox.h"
+#include "Scope.h"
+#include "Telemetry.h"
+#include "EscTelem.h"
+#include "PowerLimit.h"
+#include "Command.h"
+#include "Param.h"
+#include "Can.h"
+#include "Throttle.h"
+#include "Traction.h"
+#include "Thermal.h"
 
 /** @brief 제어 루프 시작 시점의 CPU 사이클 카운트 저장 변수 */
 uint32_t ulControlStartClock = 0ul;
 /** @brief 제어 루프 연산 소요 시간 (us 단위) */
 float fElapsedTimeUs = 0.0f;
-/** @brief CAN 통신 송신 횟수 카운터 */
+/** @brief 직전 제어 루프 실행 사이클 수 (Overrun 판정용) */
+uint32_t ulControlCycles = 0ul;
+/** @brief 제어 주기 초과(Deadline Miss) 누적 횟수 */
+uint32_t ulOverrunCnt = 0ul;
+/** @brief CAN 상태 프레임 송신 분주 카운터 */
 uint16_t uCANTxCnt = 0u;
 
 /** @brief PWM 출력을 담당하는 타이머 1 핸들러 외부 참조 */
@@ -55,11 +73,11 @@ float fDutyTest2 = 0.0f;
 /** @brief 듀티 테스트용 디버깅 변수 3 */
 float fDutyTest3 = 0.0f;
 
-/** @brief 모터 제어 상태 머신 관리를 위한 정적 변수 (이전, 현재, 다음 상태) */
-static uint16_t uPrevState = IDLE_STATE, uCurrState = IDLE_STATE, uNextState = IDLE_STATE;
+/** @brief 모터 제어 상태 머신 관리 변수 (이전, 현재, 다음 상태). uCurrState는 블랙박스 등에서 외부 참조 */
+uint16_t uPrevState = IDLE_STATE, uCurrState = IDLE_STATE, uNextState = IDLE_STATE;
 
-/** @brief CAN 통신 송신 모드 설정 변수 */
-uint16_t uCANTxMode = 0u;
+/** @brief CAN 상태 프레임 송신 분주 (0: 송신 안 함, N: 저속 제어 N회마다 1회) */
+uint16_t uCANTxMode = CAN_STATUS_DIV;
 
 /** @brief 시스템 시작 플래그 (디버깅/테스트용 변수) */
 uint16_t uFlag_Start = 0u;
@@ -81,10 +99,19 @@ uint16_t uSpdCnt = 0u;
  * @retval 없음
  */
 void vControl(void){	// 20kHz Interrupt (TIM1)
-
+	uint16_t uFaultMask;
 
 	ulControlStartClock = DWT->CYCCNT;
 
+	/* 게시된 파라미터 세트가 있으면 포인터 교체 (이번 주기 전체가 같은 세트를 사용) */
+	vParamFetch();
+
+	/* RC 스로틀 입력이 출력 대상으로 설정되어 있으면 설정값을 스로틀 출처로 게시, 아니면 출처 해제 */
+	vThrottleUpdate();
+
+	/* 명령 이벤트(시작/정지/리셋) 처리, 우선 출처(스로틀 > CmdReq)의 설정값 스냅숏을 주기당 한 번 적용 */
+	vCmdFetch();
+
 	//MOT1.SO.fThetarm = (fGetEncoderInfo(&htim3, &MOT1.SO));
 	INV.SO.fThetar = (fGetHallSensorInfo(&INV.SO));
 
@@ -92,12 +119,19 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 	if (fVdc < 1.)      fInvVdc = 1.;
 	else                fInvVdc = 1. / fVdc;
 
+	/* 배터리 전류/전력 추정 및 동적 q축 전류 한계 (속도/전류 지령 제한에 사용) */
+	vPowerLimit();
+
 	////////////////////////////// State machine //////////////////////////////
 	/* 하드웨어 및 소프트웨어 Fault 검사 (과전압, 과전류, 과속도 감지) */
-	if((SW_Fault == 0u) &&
-			((ABS(fVdc) >= VDC_FAULT_LEV) || (ABS(INV.CC.fIasHall) >= CURR_FAULT_LEV)
-					|| (ABS(INV.CC.fIbsHall) >= CURR_FAULT_LEV) || (ABS(INV.CC.fIcsHall) >= CURR_FAULT_LEV)
-					|| (ABS(INV.SO.fWrpmSC) >= SPD_FAULT_LEV))) {
+	/* 홀 센서 무효 검사는 홀 각도를 사용하는 모드(벡터/속도 제어, 정렬)에서만 */
+	if(uCurrState == IDLE_STATE)									uFaultMask = FAULT_MASK_IDLE;
+	else if((uControlMode == DUTY_TEST_MODE) || (uControlMode == CONST_VOLT_MODE)
+			|| (uControlMode == CONST_CUR_MODE))					uFaultMask = FAULT_MASK_OPENLOOP;
+	else														uFaultMask = FAULT_MASK_ACTIVE;
+
+	if((uFaultEvaluate(&INV, &INV.Fault_Info, uFaultMask) != 0u)
+			&& (SW_Fault == 0u)) {
 
 		vSWFaultOperation();
 	}
@@ -110,7 +144,9 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 
 		uNextState = IDLE_STATE;
 		vClearFault();
+		vSyncPwmReset(&htim1);	/* 제어기 초기화가 공칭 fTsamp를 쓰도록 먼저 공칭 주기로 복귀 */
 		vInitController();
+		vCmdApply();		/* 리셋 이벤트로 0이 된 스냅숏과 요청된 제어 모드 반영 */
 
 	}else{}
 
@@ -123,8 +159,10 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 		if(uPrevState != IDLE_STATE){
 			Flag.START = 0u;
 			Flag.RESET = 0u;
-			vInitController();
 			vSwitchOffSettingTIM(&htim1);
+			vSyncPwmReset(&htim1);
+			vInitController();
+			vCmdApply();	/* 정지 후에도 요청된 제어 모드/목표값 유지 */
 			uBootStrapEnd = 0u;
 		}
 		else{}
@@ -141,6 +179,7 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 			if (uBootStrapEnd == 1u) {
 				// 부트스트랩 완료 후, 제어 모드에 따른 상태 분기
 				if (uControlMode == DUTY_TEST_MODE || uControlMode == CONST_VOLT_MODE) uNextState = RUN_STATE; // 위치 정렬이 필요 없는 모드: 바로 RUN 상태로 진입
+				else if (uControlMode == VECTCONTL_MODE || uControlMode == SPDCONTL_MODE) uNextState = FLYSTART_STATE; // 회전 중 재기동 여부 판별
 				 else 	uNextState = ALIGN_STATE;	// 일반 FOC 등 위치 정렬이 필요한 모드
 			} else 	uNextState = IDLE_STATE;	// 부트스트랩 충전 중에는 IDLE (또는 별도의 CHARGE_STATE가 있다면 그것을 사용)
 
@@ -152,6 +191,19 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 
 		break;
 
+	case FLYSTART_STATE:
+		/* PWM 차단 상태 유지 (부트스트랩 완료 시 MOE 해제됨), 홀 에지 정보로 회전 여부 판별 */
+		vFlyingStart(&INV, &INV.CC, &INV.SO, &INV.SC);
+
+		if(SW_Fault || TZ_Fault)							uNextState = FAULT_STATE;
+		else if(!Flag.START)								uNextState = IDLE_STATE;
+		else if(INV.SO.uFlyResult == FLY_RESULT_CAUGHT)	uNextState = RUN_STATE;
+		else if(INV.SO.uFlyResult == FLY_RESULT_ALIGN)		uNextState = ALIGN_STATE;
+		else												uNextState = FLYSTART_STATE;
+
+		if(uNextState != FLYSTART_STATE) INV.SO.uFlyResult = FLY_RESULT_NONE;
+		break;
+
 	case ALIGN_STATE:
 		if(uPrevState != ALIGN_STATE){
 			vSwitchOnSettingTIM(&htim1);
@@ -180,13 +232,16 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 		}
 
 		vSpeedObserver(&INV, &INV.SO, &INV.SC);
-		if(uSpdCnt >= 39u){
+		if(uSpdCnt >= (SC_DIV - 1u)){
+			/* 구동력/출발 제어: 가속도 추정 후 q축 전류 한계 갱신 (속도 제어기와 전류 지령 제한에 사용) */
+			fTractionUpdate(&Traction, INV.SO.fWrpmSC, INV.CC.fIqsrRef, pCtrlParam->fTeRefMax * pCtrlParam->fInvKT, pCtrlParam->fKT, (float)SC_DIV * fTsamp);
 			vSpeedControl(&INV, &INV.SO, &INV.SC);
 			uSpdCnt = 0u;
 		}
 
 		vCurrentRef(&INV.CC, &INV.SC);
 		vCurrentControl(&INV.CC, &INV.SO);
+		vSyncPwmUpdate(&htim1, &INV.SO);	// 다음 캐리어 주기(ARR) 결정 후 변조
 		vVoltageModulationTIM(&htim1, &INV.CC, &INV.SO);
 
 		if(SW_Fault || TZ_Fault)					uNextState = FAULT_STATE;
@@ -198,6 +253,7 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 
 	default: //case FAULT_STATE:
 		vSwitchOffSettingTIM(&htim1);
+		vSyncPwmReset(&htim1);
 		Flag.START = 0u;
 		uNextState = FAULT_STATE;
 		break;
@@ -205,22 +261,39 @@ void vControl(void){	// 20kHz Interrupt (TIM1)
 
 
 
+	vBlackBoxRecord();
+	vScopeRecord();
+	vTelemRecord();
 	vIntDacOut();
 	uMainControl++;
 
-	fElapsedTimeUs = (DWT->CYCCNT - ulControlStartClock) / fSysClkFreq * 1.0e6;
+	ulControlCycles = DWT->CYCCNT - ulControlStartClock;
+	ulOverrunCnt += (uint32_t)(ulControlCycles > (uint32_t)(fTsamp * fSysClkFreq));
+	fElapsedTimeUs = (float)ulControlCycles / fSysClkFreq * 1.0e6f;
 }
 
 
 
 /**
  * @brief  2kHz 주기로 실행되는 저속 제어 루틴 (Low Speed Control)
- * @details 현재 내부에 실행 코드는 없으나, 온도 모니터링, 통신 처리 등
- * 20kHz보다 느린 주기로 실행되어야 하는 상위 제어 로직을 추가하기 위한 함수입니다.
+ * @details 온도 모니터링, 통신 처리 등 20kHz보다 느린 주기로 실행되어야 하는 상위 제어 로직을 수행합니다.
+ * 1. CAN 상태 프레임 송신 (uCANTxMode 분주, vCanSendStatus)
+ * 2. 권선/MOSFET 열 모델 적분 및 피크 전류 디레이팅 (vThermalUpdate)
+ * 3. ESC 텔레메트리 값 갱신 및 KISS 프레임 송신 (vEscTelemUpdate)
  * @param  없음
  * @retval 없음
  */
 /// 2kHz Interrupt ///
 void vLowSpdControl(){
 
+	/* CAN 상태 프레임 (uCANTxMode = 0이면 송신 안 함) */
+	if(uCANTxMode && (++uCANTxCnt >= uCANTxMode)) {
+		uCANTxCnt = 0u;
+		vCanSendStatus();
+	}
+
+	/* 권선/MOSFET 열 모델과 피크 전류 디레이팅 (전원 제한 q축 기준값 상한) */
+	vThermalUpdate();
+
+	vEscTelemUpdate();
 }
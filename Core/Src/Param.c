@@ -0,0 +1,250 @@
+/**
+ * @file    Param.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 이득/제한값/필터 계수의 더블 버퍼 파라미터 세트 구현 소스 파일
+ *
+ * @details [파생값 계산식]
+ * | 항목 | 계산식 |
+ * | :--- | :--- |
+ * | **전류 제어기** | Kp = L·ωcc, Ki = Rs·ωcc, Ka = 1/Kp |
+ * | **속도 제어기** | Kp = ωsc·J, Ki = 0.2·ωsc²·J, Ka = 1/Kp |
+ * | **토크 제한** | ±1.5·P·λf·Is,peak (Is,peak = max(피크 전류, Is,max)), 1/KT = 1/(1.5·P·λf) |
+ * | **배터리 제한** | 값 ≤ 0이면 PWR_LIM_NONE, 제한기(방전/회생 공통) 적분 이득 = PWR_LIM_WC_RATIO·ωcc·Ts (공칭 주기) |
+ * | **과부하** | 1/Is,max², 권선 열 모델 이득 = THERM_TS/τw (열 모델 허용 전류가 Is,peak ~ Is,max 사이에서 토크 제한을 줄임) |
+ * | **가감속** | 기울기 × SC_DIV·Ts (vSpeedControl 호출 1회당 증분, 속도 제어 대역폭도 같은 주기로 검증) |
+ * | **PLL** | Kp = 2ζωc, Ki = ωc² |
+ * | **속도 LPF** | 2차 IIR (ζ = 0.707), 공칭 주기(1/fTimIntFreq) 기준 쌍선형 변환 |
+ * | **관측기/정렬** | 1/P, B/J 기반 외란 관측기 이득, 정렬 전류/속도 증분 × Ts, 기계각 속도 LPF (공칭 주기) |
+ *
+ * @details [필터 계수]
+ * IIR2 구조체는 계수와 상태를 함께 가지므로, 포인터 교체 시 계수 5개만 필터 인스턴스에 복사합니다 (상태 유지).
+ * 리셋/IDLE 진입의 vInitController는 필터 상태만 지우므로 제어 ISR 안에서 나눗셈이나 initiateIIR2를 호출하지 않습니다.
+ */
+
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "Filter.h"
+#include "Param.h"
+#include "PowerLimit.h"
+#include "Thermal.h"
+
+/** @brief 속도 LPF 인스턴스 외부 참조 (SpeedObserver.c) */
+extern IIR2 IIR2WrpmSCLPF, IIR2WrmSCLPF;
+
+/** @brief 파라미터 설계 입력 (편집용) */
+sCtrlParamCfg ParamCfg;
+/** @brief 파라미터 변경 요청 */
+sParamReq ParamReq;
+/** @brief 제어 ISR이 이번 주기에 사용하는 파라미터 세트 */
+const sCtrlParam* pCtrlParam = 0;
+
+/** @brief 파라미터 세트 더블 버퍼 */
+static sCtrlParam CtrlParamBuf[2];
+/** @brief 게시된 세트 (메인 루프 소유, ISR은 읽기만) */
+static const sCtrlParam* volatile pCtrlParamNext = 0;
+
+/**
+ * @brief  ωc·Ts가 이산화 한계 안에 있는지 확인합니다.
+ * @param  fWc 대역폭 [rad/s]
+ * @param  fTs 샘플링 주기 [s]
+ * @retval 1: 유효, 0: 범위 밖
+ */
+static uint16_t uParamWcValid(float fWc, float fTs){
+	return ((fWc > 0.0f) && ((fWc * fTs) <= PARAM_WC_TS_MAX)) ? 1u : 0u;
+}
+
+/**
+ * @brief  기본 설계값으로 첫 세트를 계산하여 즉시 활성화합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitParam(void){
+	ParamCfg.fRs = MOT_RS;
+	ParamCfg.fLd = MOT_LD;
+	ParamCfg.fLq = MOT_LQ;
+	ParamCfg.fLamf = MOT_LAMF;
+	ParamCfg.fPP = MOT_PP;
+	ParamCfg.fJm = MOT_JM;
+
+	ParamCfg.fWcCc = WC_CC;
+	ParamCfg.fWcSc = WC_SC;
+	ParamCfg.fWcPll = WC_PLL;
+	ParamCfg.fZetaPll = ZETA_PLL;
+	ParamCfg.fWcWrpmLpf = WC_WRPMSC_LPF;
+
+	ParamCfg.fIsMax = MOT_IS_RATED;
+	ParamCfg.fWrpmMax = MOT_WRPM_RATED;
+	ParamCfg.fWrpmAcc = PARAM_WRPM_ACC;
+	ParamCfg.fWrpmDec = PARAM_WRPM_DEC;
+
+	ParamCfg.fCurrFaultLev = CURR_FAULT_LEV;
+	ParamCfg.fVdcFaultLev = VDC_FAULT_LEV;
+	ParamCfg.fSpdFaultLev = SPD_FAULT_LEV;
+	ParamCfg.fVdcUvFaultLev = VDC_UV_FAULT_LEV;
+
+	ParamCfg.fIbatMax = PARAM_IBAT_MAX;
+	ParamCfg.fPbatMax = PARAM_PBAT_MAX;
+	ParamCfg.fVdcSagMin = PARAM_VDC_SAG_MIN;
+	ParamCfg.fVdcRegenMax = PARAM_VDC_REGEN_MAX;
+	ParamCfg.fIdBrakeMax = PARAM_ID_BRAKE_MAX;
+
+	ParamCfg.fIsPeak = PARAM_IS_PEAK;
+	ParamCfg.fTauWind = PARAM_TAU_WIND;
+
+	ParamReq.uCommit = 0u;
+	ParamReq.uErr = uParamBuild(&ParamCfg, &CtrlParamBuf[0]);
+	ParamReq.ulCommitCnt = 0ul;
+
+	pCtrlParamNext = &CtrlParamBuf[0];
+	pCtrlParam = &CtrlParamBuf[0];
+	vParamLoadFilter();
+}
+
+/**
+ * @brief  설계 입력으로 파생 파라미터를 계산하고 검증합니다.
+ * @param  pCfg 설계 입력
+ * @param  pOut 계산 결과
+ * @retval 검증 실패 원인 (PARAM_ERR_NONE: 성공)
+ */
+uint16_t uParamBuild(const sCtrlParamCfg* pCfg, sCtrlParam* pOut){
+	IIR2 Lpf;
+	float fKT, fBperJ, fIsPeak = MAX(pCfg->fIsPeak, pCfg->fIsMax);
+	float fTsNom = 1.0f / fTimIntFreq;		/* 공칭 제어 주기 (fTsamp는 SyncPwm이 운전 중 바꿈) */
+	float fTsSc = (float)SC_DIV * fTsNom;	/* 속도 제어 주기 (MainControl 분주) */
+	uint16_t uErr = PARAM_ERR_NONE, i;
+
+	if((pCfg->fRs <= 0.0f) || (pCfg->fLd <= 0.0f) || (pCfg->fLq <= 0.0f)
+			|| (pCfg->fLamf <= 0.0f) || (pCfg->fPP <= 0.0f) || (pCfg->fJm <= 0.0f))	uErr |= PARAM_ERR_MOTOR;
+	if(!uParamWcValid(pCfg->fWcCc, fTsNom) || !uParamWcValid(pCfg->fWcPll, fTsNom)
+			|| !uParamWcValid(pCfg->fWcWrpmLpf, fTsNom) || !uParamWcValid(pCfg->fWcSc, fTsSc)
+			|| (pCfg->fZetaPll <= 0.0f))												uErr |= PARAM_ERR_BW;
+	if((pCfg->fIsMax <= 0.0f) || (pCfg->fWrpmMax <= 0.0f)
+			|| (pCfg->fWrpmAcc <= 0.0f) || (pCfg->fWrpmDec <= 0.0f))					uErr |= PARAM_ERR_LIMIT;
+	if((pCfg->fIbatMax < 0.0f) || (pCfg->fPbatMax < 0.0f) || ((pCfg->fVdcSagMin != 0.0f)
+			&& ((pCfg->fVdcSagMin <= pCfg->fVdcUvFaultLev) || (pCfg->fVdcSagMin >= pCfg->fVdcFaultLev))))	uErr |= PARAM_ERR_LIMIT;
+	if((pCfg->fVdcRegenMax != 0.0f) && ((pCfg->fVdcRegenMax >= pCfg->fVdcFaultLev)
+			|| (pCfg->fVdcRegenMax <= MAX(pCfg->fVdcSagMin, pCfg->fVdcUvFaultLev))))		uErr |= PARAM_ERR_LIMIT;
+	if((pCfg->fIdBrakeMax < 0.0f) || ((fIsPeak * fIsPeak + pCfg->fIdBrakeMax * pCfg->fIdBrakeMax)
+			>= (pCfg->fCurrFaultLev * pCfg->fCurrFaultLev)))								uErr |= PARAM_ERR_LIMIT;
+	if(((pCfg->fIsPeak != 0.0f) && (pCfg->fIsPeak < pCfg->fIsMax)) || (pCfg->fTauWind <= 0.0f))	uErr |= PARAM_ERR_LIMIT;
+	if((pCfg->fCurrFaultLev <= 0.0f) || (pCfg->fSpdFaultLev <= 0.0f)
+			|| (pCfg->fVdcUvFaultLev >= pCfg->fVdcFaultLev))							uErr |= PARAM_ERR_FAULT;
+	if(uErr != PARAM_ERR_NONE) return uErr;
+
+	pOut->fKpdCc = pCfg->fLd * pCfg->fWcCc;
+	pOut->fKidCc = pCfg->fRs * pCfg->fWcCc;
+	pOut->fKadCc = 1.0f / pOut->fKpdCc;
+	pOut->fKpqCc = pCfg->fLq * pCfg->fWcCc;
+	pOut->fKiqCc = pCfg->fRs * pCfg->fWcCc;
+	pOut->fKaqCc = 1.0f / pOut->fKpqCc;
+
+	fKT = 1.5f * pCfg->fPP * pCfg->fLamf;
+	pOut->fKpSc = pCfg->fWcSc * pCfg->fJm;
+	pOut->fKiSc = 0.2f * pCfg->fWcSc * pCfg->fWcSc * pCfg->fJm;
+	pOut->fKaSc = 1.0f / pOut->fKpSc;
+	pOut->fTeRefMax = fKT * fIsPeak;
+	pOut->fTeRefMin = -pOut->fTeRefMax;
+	pOut->fInvKT = 1.0f / fKT;
+	pOut->fKT = fKT;
+	pOut->fPP = pCfg->fPP;
+	pOut->fInvPP = 1.0f / pCfg->fPP;
+	pOut->fLamf = pCfg->fLamf;
+	pOut->fWrpmRefMax = pCfg->fWrpmMax;
+	pOut->fDelWrpmAcc = pCfg->fWrpmAcc * fTsSc;
+	pOut->fDelWrpmDec = pCfg->fWrpmDec * fTsSc;
+
+	pOut->fKpPLL = 2.0f * pCfg->fZetaPll * pCfg->fWcPll;
+	pOut->fKiPLL = pCfg->fWcPll * pCfg->fWcPll;
+	initiateIIR2(&Lpf, K_LPF, pCfg->fWcWrpmLpf, 0.707f, fTsNom);
+	for(i = 0u; i < 5u; i++) {
+		pOut->fWrpmLpfCoeff[i] = Lpf.coeff[i];
+	}
+	initiateIIR2(&Lpf, K_LPF, WC_WRM_LPF, 0.707f, fTsNom);
+	for(i = 0u; i < 5u; i++) {
+		pOut->fWrmLpfCoeff[i] = Lpf.coeff[i];
+	}
+
+	fBperJ = MOT_BM / pCfg->fJm;
+	pOut->fK1So = WC_SO1 + 2.0f * ZETA_SO * WC_SO23 - fBperJ;
+	pOut->fK2TsSo = fTsNom * (2.0f * WC_SO1 * ZETA_SO * WC_SO23 + WC_SO23 * WC_SO23 - fBperJ * pOut->fK1So);
+	pOut->fK3TsSo = fTsNom * (WC_SO1 * WC_SO23 * WC_SO23);
+	pOut->fDelIdsrAlign = DEL_IDSR_REF_ALIGN * fTsNom;
+	pOut->fDelWrRefAlign = DEL_WR_REF_ALIGN * fTsNom;
+
+	pOut->fCurrFaultLev = pCfg->fCurrFaultLev;
+	pOut->fVdcFaultLev = pCfg->fVdcFaultLev;
+	pOut->fSpdFaultLev = pCfg->fSpdFaultLev;
+	pOut->fVdcUvFaultLev = pCfg->fVdcUvFaultLev;
+
+	pOut->fIbatMax = (pCfg->fIbatMax > 0.0f) ? pCfg->fIbatMax : PWR_LIM_NONE;
+	pOut->fPbatMax = (pCfg->fPbatMax > 0.0f) ? pCfg->fPbatMax : PWR_LIM_NONE;
+	pOut->fVdcSagMin = pCfg->fVdcSagMin;
+	pOut->fVdcRegenMax = pCfg->fVdcRegenMax;
+	pOut->fIdBrakeMax = pCfg->fIdBrakeMax;
+	pOut->fKiPwrLim = PWR_LIM_WC_RATIO * pCfg->fWcCc * fTsNom;
+
+	pOut->fIsPeak = fIsPeak;
+	pOut->fIsCont = pCfg->fIsMax;
+	pOut->fInvIsCont2 = 1.0f / (pCfg->fIsMax * pCfg->fIsMax);
+	pOut->fKThWind = THERM_TS / pCfg->fTauWind;
+
+	return PARAM_ERR_NONE;
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 변경 요청을 처리합니다.
+ * @details 직전 게시 세트를 ISR이 아직 가져가지 않았으면(pCtrlParam ≠ pCtrlParamNext) 요청을 유지한 채 다음 호출로 미룹니다.
+ * 그 외에는 ISR이 사용하지 않는 세트에 계산하고, 검증에 성공한 경우에만 게시합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vParamTask(void){
+	sCtrlParam* pFree;
+
+	if(!ParamReq.uCommit) return;
+	if(pCtrlParam != pCtrlParamNext) return;
+
+	pFree = (pCtrlParamNext == &CtrlParamBuf[0]) ? &CtrlParamBuf[1] : &CtrlParamBuf[0];
+
+	ParamReq.uCommit = 0u;
+	ParamReq.uErr = uParamBuild(&ParamCfg, pFree);
+	if(ParamReq.uErr != PARAM_ERR_NONE) return;
+
+	pFree->ulVersion = pCtrlParamNext->ulVersion + 1ul;
+	__DMB();
+	pCtrlParamNext = pFree;
+	ParamReq.ulCommitCnt++;
+}
+
+/**
+ * @brief  제어 주기 시작 시 호출되어 게시된 세트로 교체합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vParamFetch(void){
+	const sCtrlParam* pNext = pCtrlParamNext;
+
+	if(pNext == pCtrlParam) return;
+
+	__DMB();
+	pCtrlParam = pNext;
+	vParamLoadFilter();
+}
+
+/**
+ * @brief  현재 세트의 필터 계수를 필터 인스턴스에 적재합니다.
+ * @details IIR2 상태(reg)는 유지하고 계수만 바꿉니다. vInitParam에서 첫 세트를 활성화할 때와 ISR이 세트를 교체할 때 호출합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vParamLoadFilter(void){
+	uint16_t i;
+
+	if(pCtrlParam == 0) return;
+
+	for(i = 0u; i < 5u; i++) {
+		IIR2WrpmSCLPF.coeff[i] = pCtrlParam->fWrpmLpfCoeff[i];
+		IIR2WrmSCLPF.coeff[i] = pCtrlParam->fWrmLpfCoeff[i];
+	}
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    PowerLimit.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   직류단(배터리) 전류/전력 추정 및 동적 q축 전류 제한 구현 소스 파일
+ * @details 추정에는 직전 주기의 출력 전압(fVdsrOut, fVqsrOut)과 같은 주기에 측정한 전류(fIdsr, fIqsr)를 사용합니다.
+ * 나눗셈은 q축 환산 1회뿐이며, 제한값이 꺼져 있으면(PWR_LIM_NONE) 초과량이 음수로 유지되어 감소량은 0입니다.
+ */
+
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "UserMath.h"
+#include "Param.h"
+#include "PowerLimit.h"
+#include "Thermal.h"
+
+/** @brief 전원 제한 객체 */
+sPowerLimit PwrLim;
+
+/**
+ * @brief  추정값과 제한기 상태를 초기화합니다.
+ * @retval 없음
+ */
+void vInitPowerLimit(void){
+	PwrLim.fPbat = 0.0f;
+	PwrLim.fIbat = 0.0f;
+	PwrLim.fInteg = 0.0f;
+	PwrLim.fIqRed = 0.0f;
+	PwrLim.fIqMax = 0.0f;
+	PwrLim.fIqMin = 0.0f;
+	PwrLim.fOvInteg = 0.0f;
+	PwrLim.fIqRegenRed = 0.0f;
+	PwrLim.fIdBrake = 0.0f;
+	PwrLim.uActive = 0u;
+	PwrLim.uRegenActive = 0u;
+}
+
+/**
+ * @brief  배터리 전류/전력을 추정하고 동적 q축 전류 한계를 갱신합니다.
+ * @retval 없음
+ */
+void vPowerLimit(void){
+	float fIqBase = MIN(pCtrlParam->fTeRefMax * pCtrlParam->fInvKT, Thermal.fIsAllow);
+	float fIbatLim, fErr, fSag, fVq, fGainQ, fErrIq, fErrOv;
+
+	/* 1. 배터리측 전력/전류 추정 */
+	PwrLim.fPbat += PWR_PBAT_ALPHA * (1.5f * (INV.CC.fVdsrOut * INV.CC.fIdsr + INV.CC.fVqsrOut * INV.CC.fIqsr) - PwrLim.fPbat);
+	PwrLim.fIbat = PwrLim.fPbat * fInvVdc;
+
+	/* 2~3. 허용 전류 대비 초과량과 전압 하한 부족분 중 큰 쪽 (하한은 RUN에서 방전 중일 때만: 정지 중 낮은 개방 전압으로 적분 누적 방지) */
+	fIbatLim = MIN(pCtrlParam->fIbatMax, pCtrlParam->fPbatMax * fInvVdc);
+	fErr = PwrLim.fIbat - fIbatLim;
+	if(pCtrlParam->fVdcSagMin > 0.0f && uCurrState == RUN_STATE && PwrLim.fIbat > 0.0f){
+		fSag = (pCtrlParam->fVdcSagMin - fVdc) * PWR_SAG_GAIN;
+		fErr = MAX(fErr, fSag);
+	}
+
+	/* 4. q축 전류 환산 (∂Ibat/∂Iq = 1.5·|Vq| / Vdc) */
+	fVq = MAX(ABS(INV.CC.fVqsrOut), PWR_VQ_MIN);
+	fGainQ = fVdc / (1.5f * fVq);
+	fErrIq = LIMIT(fErr * fGainQ, -fIqBase, fIqBase);
+
+	/* 5. PI 제한기 (적분항은 감소량 범위로 포화) */
+	PwrLim.fInteg += pCtrlParam->fKiPwrLim * fErrIq;
+	PwrLim.fInteg = LIMIT(PwrLim.fInteg, 0.0f, fIqBase);
+	PwrLim.fIqRed = LIMIT(PWR_LIM_KP * fErrIq + PwrLim.fInteg, 0.0f, fIqBase);
+
+	/* 6. 회생 제한기: 전압 상한 초과분을 충전 전류 초과로 보고 같은 방식으로 q축 환산 */
+	if(pCtrlParam->fVdcRegenMax > 0.0f){
+		fErrOv = LIMIT((fVdc - pCtrlParam->fVdcRegenMax) * PWR_OV_GAIN * fGainQ, -fIqBase, fIqBase);
+		PwrLim.fOvInteg += pCtrlParam->fKiPwrLim * fErrOv;
+		PwrLim.fOvInteg = LIMIT(PwrLim.fOvInteg, 0.0f, fIqBase);
+		PwrLim.fIqRegenRed = LIMIT(PWR_OV_KP * fErrOv + PwrLim.fOvInteg, 0.0f, fIqBase);
+	}
+	else PwrLim.fIqRegenRed = 0.0f;
+
+	/* 7. d축 손실 제동 (회생 제한 중에만, 설정 상한 이내) */
+	PwrLim.fIdBrake = -MIN(PwrLim.fIqRegenRed, pCtrlParam->fIdBrakeMax);
+
+	/* 8. 전동 방향 한계에는 방전 감소량, 제동 방향 한계에는 회생 감소량 적용 */
+	if(INV.CC.fVqsrOut >= 0.0f){
+		PwrLim.fIqMax = fIqBase - PwrLim.fIqRed;
+		PwrLim.fIqMin = -(fIqBase - PwrLim.fIqRegenRed);
+	}
+	else {
+		PwrLim.fIqMax = fIqBase - PwrLim.fIqRegenRed;
+		PwrLim.fIqMin = -(fIqBase - PwrLim.fIqRed);
+	}
+
+	PwrLim.uActive = (PwrLim.fIqRed > 0.0f) ? 1u : 0u;
+	PwrLim.ulActiveCnt += PwrLim.uActive;
+	PwrLim.uRegenActive = (PwrLim.fIqRegenRed > 0.0f) ? 1u : 0u;
+	PwrLim.ulRegenActiveCnt += PwrLim.uRegenActive;
+}
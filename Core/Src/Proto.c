@@ -0,0 +1,405 @@
+/**
+ * @file    Proto.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   USART1 프레임 기반 요청/응답 명령·파라미터 프로토콜 구현 소스 파일
+ *
+ * @details [처리 흐름] (모두 메인 루프, vProtoTask)
+ * | 단계 | 동작 |
+ * | :--- | :--- |
+ * | **1. 송신 대기** | 이전 응답이 아직 시작되지 않았으면 송신을 재시도하고, 송신 중이면 응답 버퍼를 건드리지 않고 반환 |
+ * | **2. 수신 조립** | 수신 순환 버퍼에서 바이트를 꺼내 동기 워드 → 헤더 → 페이로드 → CRC 순으로 조립 |
+ * | **3. 처리** | CRC가 맞으면 명령 코드별 처리 후 응답 프레임을 만들어 송신 시작 (호출당 요청 1개) |
+ *
+ * @details [제어 ISR 전달 경로]
+ * | 요청 | 경로 |
+ * | :--- | :--- |
+ * | VAR_WRITE | uCmdVarWrite (값 슬롯 + 이벤트 큐, 설정값 항목은 CmdReq.Set, 읽기 전용 항목은 PROTO_ERR_RO) |
+ * | CMD | CmdReq.uStart/uStop/uReset → vCmdTask → 이벤트 큐 |
+ * | SET_WRITE | CmdReq.Set → vCmdTask → 설정값 우편함 |
+ * | PARAM_* | ParamCfg / ParamReq → vParamTask → 파라미터 세트 포인터 교체 |
+ * | SCOPE_ARM | 채널/조건 기록 후 CMD_SCOPE_ARM 이벤트 (ISR에서 vScopeArm) |
+ *
+ * VAR_READ는 변수마다 정렬된 단일 읽기이므로 각 값은 온전하지만, 여러 변수가 같은 제어 주기의 값이라는 보장은 없습니다.
+ * 같은 주기의 여러 변수가 필요하면 스코프를 사용합니다.
+ */
+
+#include <string.h>
+#include "main.h"
+#include "GlobalVar.h"
+#include "Uart.h"
+#include "VarTable.h"
+#include "Command.h"
+#include "Param.h"
+#include "Scope.h"
+#include "Telemetry.h"
+#include "Proto.h"
+
+/** @brief 프로토콜 객체 */
+sProto Proto;
+
+/** @brief 요청 프레임 조립 버퍼 */
+static uint8_t ProtoRxBuf[PROTO_FRAME_MAX];
+/** @brief 응답 프레임 버퍼 (송신 DMA가 읽는 동안 유지) */
+static uint8_t ProtoTxBuf[PROTO_FRAME_MAX];
+
+/** @brief 파라미터 설계 입력 필드 수 (sCtrlParamCfg는 float 필드만 가짐) */
+#define PROTO_PARAM_NUM     ((uint16_t)(sizeof(sCtrlParamCfg) / sizeof(float)))
+
+/** @brief 리틀 엔디언 16비트 읽기 */
+static inline uint16_t uGetU16(const uint8_t* p){ return (uint16_t)(p[0] | ((uint16_t)p[1] << 8)); }
+/** @brief 리틀 엔디언 32비트 읽기 */
+static inline uint32_t ulGetU32(const uint8_t* p){ return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+/** @brief 리틀 엔디언 float 읽기 */
+static inline float fGetF32(const uint8_t* p){ uint32_t ul = ulGetU32(p); float f; memcpy(&f, &ul, 4u); return f; }
+/** @brief 리틀 엔디언 16비트 쓰기 */
+static inline void vPutU16(uint8_t* p, uint16_t u){ p[0] = (uint8_t)u; p[1] = (uint8_t)(u >> 8); }
+/** @brief 리틀 엔디언 32비트 쓰기 */
+static inline void vPutU32(uint8_t* p, uint32_t ul){ p[0] = (uint8_t)ul; p[1] = (uint8_t)(ul >> 8); p[2] = (uint8_t)(ul >> 16); p[3] = (uint8_t)(ul >> 24); }
+/** @brief 리틀 엔디언 float 쓰기 */
+static inline void vPutF32(uint8_t* p, float f){ uint32_t ul; memcpy(&ul, &f, 4u); vPutU32(p, ul); }
+
+/**
+ * @brief  변수 레지스트리 항목을 타입에 맞게 읽어 32비트 원시값으로 반환합니다.
+ * @param  pVar 레지스트리 항목
+ * @retval 원시값 (float 비트 패턴, int16은 부호 확장)
+ */
+static uint32_t ulProtoVarRaw(const sVarEntry* pVar){
+	float f;
+	uint32_t ul;
+
+	switch(pVar->uType){
+	case DCH_TYPE_INT16:	return (uint32_t)(int32_t)(*(const volatile int16_t*)pVar->pAddr);
+	case DCH_TYPE_UINT16:	return *(const volatile uint16_t*)pVar->pAddr;
+	case DCH_TYPE_INT32:
+	case DCH_TYPE_UINT32:	return *(const volatile uint32_t*)pVar->pAddr;
+	default:
+		f = *(const volatile float*)pVar->pAddr;
+		memcpy(&ul, &f, 4u);
+		return ul;
+	}
+}
+
+/**
+ * @brief  스코프 무장 요청을 처리합니다.
+ * @details 잘못된 인자가 하나라도 있으면 아무 것도 바꾸지 않습니다. 설정 기록 중 진행되던 캡처는 재무장으로 폐기됩니다.
+ * @param  pReq 요청 페이로드
+ * @param  uLen 요청 페이로드 길이
+ * @retval 상태 코드
+ */
+static uint8_t uProtoScopeArm(const uint8_t* pReq, uint16_t uLen){
+	uint16_t uChNum, i;
+
+	if(uLen < 12u) return PROTO_ERR_LEN;
+	uChNum = pReq[1];
+	if(uLen != (uint16_t)(12u + 2u * uChNum)) return PROTO_ERR_LEN;
+	if((pReq[0] > SCOPE_MODE_NORMAL) || (uChNum == 0u) || (uChNum > SCOPE_CH_MAX)
+			|| (pReq[6] >= uChNum) || (pReq[7] > SCOPE_TRIG_CHANGE)) return PROTO_ERR_ARG;
+	for(i = 0u; i < uChNum; i++) {
+		if(pVarGet(uGetU16(&pReq[12u + 2u * i])) == 0) return PROTO_ERR_ARG;
+	}
+
+	Scope.uState = SCOPE_STATE_STOP;
+	for(i = 0u; i < uChNum; i++) {
+		(void)uScopeSelect(i, uGetU16(&pReq[12u + 2u * i]));
+	}
+	Scope.uMode = pReq[0];
+	Scope.uChNum = uChNum;
+	Scope.uDecim = uGetU16(&pReq[2]);
+	Scope.uPreTrig = uGetU16(&pReq[4]);
+	Scope.uTrigCh = pReq[6];
+	Scope.uTrigType = pReq[7];
+	Scope.fTrigLevel = fGetF32(&pReq[8]);
+	vScopeLock(0u);
+
+	return uCmdPost(CMD_SCOPE_ARM, 0u) ? PROTO_OK : PROTO_ERR_BUSY;
+}
+
+/**
+ * @brief  스코프 완료 버퍼를 읽습니다.
+ * @details 첫 요청에서 판독 잠금을 걸고, 잠금 유지 값이 0인 요청을 처리한 뒤 해제합니다.
+ * 채널 수는 잠금 이후 완료 버퍼의 고정값(uRdChNum)을 사용하므로 판독 도중 재무장해도 응답 배치가 바뀌지 않습니다.
+ * @param  pReq 요청 페이로드
+ * @param  uLen 요청 페이로드 길이
+ * @param  pRsp 응답 페이로드 (상태 코드 이후)
+ * @param  puRspLen 응답 데이터 길이
+ * @retval 상태 코드
+ */
+static uint8_t uProtoScopeRead(const uint8_t* pReq, uint16_t uLen, uint8_t* pRsp, uint16_t* puRspLen){
+	int16_t iSample[SCOPE_CH_MAX];
+	uint16_t uStart, uNum, uChNum, i, j;
+
+	if(uLen != 4u) return PROTO_ERR_LEN;
+	uStart = uGetU16(&pReq[0]);
+	uNum = pReq[2];
+	if(!Scope.uReady) return PROTO_ERR_BUSY;
+
+	vScopeLock(1u);
+	uChNum = Scope.uRdChNum;
+	if((uChNum == 0u) || (uNum == 0u) || ((uStart + uNum) > SCOPE_DEPTH)
+			|| ((uint16_t)(uNum * uChNum * 2u) > (PROTO_PAYLOAD_MAX - 1u))) {
+		if(!pReq[3]) vScopeLock(0u);
+		return PROTO_ERR_ARG;
+	}
+
+	for(i = 0u; i < uNum; i++) {
+		(void)uScopeRead((uint16_t)(uStart + i), iSample);
+		for(j = 0u; j < uChNum; j++) {
+			vPutU16(pRsp, (uint16_t)iSample[j]);
+			pRsp += 2;
+		}
+	}
+	if(!pReq[3]) vScopeLock(0u);
+
+	*puRspLen = (uint16_t)(uNum * uChNum * 2u);
+	return PROTO_OK;
+}
+
+/**
+ * @brief  요청 1개를 처리하여 응답 페이로드를 만듭니다.
+ * @param  uOp 명령 코드
+ * @param  pReq 요청 페이로드
+ * @param  uLen 요청 페이로드 길이
+ * @param  pRsp 응답 페이로드 (첫 바이트 = 상태 코드)
+ * @retval 응답 페이로드 길이 (1 이상)
+ */
+static uint16_t uProtoHandle(uint8_t uOp, const uint8_t* pReq, uint16_t uLen, uint8_t* pRsp){
+	const sVarEntry* pVar;
+	uint8_t* pData = &pRsp[1];
+	uint16_t uRspLen = 0u, uId, i, uNameLen;
+	uint8_t uStatus = PROTO_OK;
+
+	switch(uOp){
+	case PROTO_OP_PING:
+		vPutU16(&pData[0], PROTO_VERSION);
+		vPutU16(&pData[2], VAR_ID_NUM);
+		vPutU16(&pData[4], PROTO_PARAM_NUM);
+		vPutU16(&pData[6], PROTO_PAYLOAD_MAX);
+		uRspLen = 8u;
+		break;
+
+	case PROTO_OP_VAR_INFO:
+		if(uLen != 2u)									{ uStatus = PROTO_ERR_LEN; break; }
+		pVar = pVarGet(uGetU16(pReq));
+		if(pVar == 0)									{ uStatus = PROTO_ERR_ARG; break; }
+		uNameLen = (uint16_t)strlen(pVar->pName);
+		vPutU32(&pData[0], pVar->ulHash);
+		pData[4] = (uint8_t)pVar->uType;
+		pData[5] = (uint8_t)pVar->uUnit;
+		vPutF32(&pData[6], pVar->fScale);
+		memcpy(&pData[10], pVar->pName, uNameLen);
+		uRspLen = (uint16_t)(10u + uNameLen);
+		break;
+
+	case PROTO_OP_VAR_READ:
+		if((uLen == 0u) || (uLen & 1u) || (uLen > 2u * PROTO_READ_MAX))	{ uStatus = PROTO_ERR_LEN; break; }
+		for(i = 0u; i < (uLen >> 1); i++) {
+			if(pVarGet(uGetU16(&pReq[2u * i])) == 0)	{ uStatus = PROTO_ERR_ARG; break; }
+		}
+		if(uStatus != PROTO_OK) break;
+		for(i = 0u; i < (uLen >> 1); i++) {
+			vPutU32(&pData[4u * i], ulProtoVarRaw(pVarGet(uGetU16(&pReq[2u * i]))));
+		}
+		uRspLen = (uint16_t)(2u * uLen);
+		break;
+
+	case PROTO_OP_VAR_WRITE:
+		if(uLen != 6u)									{ uStatus = PROTO_ERR_LEN; break; }
+		uId = uGetU16(pReq);
+		switch(uCmdVarWrite(uId, ulGetU32(&pReq[2]))){
+		case CMD_VAR_OK:		break;
+		case CMD_VAR_ERR_RO:	uStatus = PROTO_ERR_RO;		break;
+		case CMD_VAR_ERR_BUSY:	uStatus = PROTO_ERR_BUSY;	break;
+		default:				uStatus = PROTO_ERR_ARG;	break;
+		}
+		break;
+
+	case PROTO_OP_CMD:
+		if(uLen != 1u)									{ uStatus = PROTO_ERR_LEN; break; }
+		switch(pReq[0]){
+		case CMD_START:	CmdReq.uStart = 1u;	break;
+		case CMD_STOP:	CmdReq.uStop = 1u;	break;
+		case CMD_RESET:	CmdReq.uReset = 1u;	break;
+		default:		uStatus = PROTO_ERR_ARG;	break;
+		}
+		break;
+
+	case PROTO_OP_SET_GET:
+		vPutF32(&pData[0], CmdReq.Set.fWrpmRefSet);
+		vPutF32(&pData[4], CmdReq.Set.fIdsrRefSet);
+		vPutF32(&pData[8], CmdReq.Set.fIqsrRefSet);
+		vPutF32(&pData[12], CmdReq.Set.fVdqsrRefSet);
+		vPutU16(&pData[16], CmdReq.Set.uControlMode);
+		uRspLen = 18u;
+		break;
+
+	case PROTO_OP_SET_WRITE:
+		if(uLen != 5u)									{ uStatus = PROTO_ERR_LEN; break; }
+		switch(pReq[0]){
+		case PROTO_SET_WRPM:	CmdReq.Set.fWrpmRefSet = fGetF32(&pReq[1]);		break;
+		case PROTO_SET_IDSR:	CmdReq.Set.fIdsrRefSet = fGetF32(&pReq[1]);		break;
+		case PROTO_SET_IQSR:	CmdReq.Set.fIqsrRefSet = fGetF32(&pReq[1]);		break;
+		case PROTO_SET_VDQSR:	CmdReq.Set.fVdqsrRefSet = fGetF32(&pReq[1]);	break;
+		case PROTO_SET_MODE:
+			if(ulGetU32(&pReq[1]) > ALIGN_MODE)			{ uStatus = PROTO_ERR_ARG; break; }
+			CmdReq.Set.uControlMode = (uint16_t)ulGetU32(&pReq[1]);
+			break;
+		default:				uStatus = PROTO_ERR_ARG;	break;
+		}
+		break;
+
+	case PROTO_OP_PARAM_GET:
+		if(uLen != 1u)									{ uStatus = PROTO_ERR_LEN; break; }
+		if(pReq[0] >= PROTO_PARAM_NUM)					{ uStatus = PROTO_ERR_ARG; break; }
+		vPutF32(pData, ((const float*)&ParamCfg)[pReq[0]]);
+		uRspLen = 4u;
+		break;
+
+	case PROTO_OP_PARAM_SET:
+		if(uLen != 5u)									{ uStatus = PROTO_ERR_LEN; break; }
+		if(pReq[0] >= PROTO_PARAM_NUM)					{ uStatus = PROTO_ERR_ARG; break; }
+		((float*)&ParamCfg)[pReq[0]] = fGetF32(&pReq[1]);
+		break;
+
+	case PROTO_OP_PARAM_COMMIT:
+		ParamReq.uCommit = 1u;
+		break;
+
+	case PROTO_OP_PARAM_STATUS:
+		vPutU16(&pData[0], ParamReq.uCommit);
+		vPutU16(&pData[2], ParamReq.uErr);
+		vPutU32(&pData[4], ParamReq.ulCommitCnt);
+		vPutU32(&pData[8], pCtrlParam->ulVersion);
+		uRspLen = 12u;
+		break;
+
+	case PROTO_OP_SCOPE_ARM:
+		uStatus = uProtoScopeArm(pReq, uLen);
+		break;
+
+	case PROTO_OP_SCOPE_STATUS:
+		pData[0] = (uint8_t)Scope.uState;
+		pData[1] = (uint8_t)Scope.uReady;
+		pData[2] = (uint8_t)(Scope.uReady ? Scope.uRdChNum : Scope.uChNum);
+		pData[3] = 0u;
+		vPutU16(&pData[4], Scope.uReady ? Scope.uRdPreTrig : Scope.uPreTrig);
+		vPutU16(&pData[6], SCOPE_DEPTH);
+		vPutU32(&pData[8], Scope.ulCaptureCnt);
+		uRspLen = 12u;
+		break;
+
+	case PROTO_OP_SCOPE_READ:
+		uStatus = uProtoScopeRead(pReq, uLen, pData, &uRspLen);
+		break;
+
+	case PROTO_OP_TELEM:
+		if(uLen != 2u)									{ uStatus = PROTO_ERR_LEN; break; }
+		if((pReq[1] != 0xFFu) && (pReq[1] != Telem.uMode) && !uTelemSetMode(pReq[1]))	{ uStatus = PROTO_ERR_ARG; break; }
+		Telem.uEnable = pReq[0] ? 1u : 0u;
+		break;
+
+	default:
+		uStatus = PROTO_ERR_OP;
+		break;
+	}
+
+	if(uStatus != PROTO_OK) uRspLen = 0u;
+	pRsp[0] = uStatus;
+	return (uint16_t)(uRspLen + 1u);
+}
+
+/**
+ * @brief  조립이 끝난 요청 프레임을 검사하고 응답 프레임을 만듭니다.
+ * @retval 1: 응답 생성, 0: CRC 오류로 폐기
+ */
+static uint16_t uProtoProcess(void){
+	uint16_t uLen = uGetU16(&ProtoRxBuf[4]);
+	uint16_t uCrc = uCrc16(CRC16_INIT, &ProtoRxBuf[2], (uint16_t)(uLen + 4u));
+	uint16_t uRspLen;
+
+	if(uCrc != uGetU16(&ProtoRxBuf[PROTO_HDR_LEN + uLen])) {
+		Proto.ulCrcErrCnt++;
+		return 0u;
+	}
+	Proto.ulReqCnt++;
+
+	uRspLen = uProtoHandle(ProtoRxBuf[3], &ProtoRxBuf[PROTO_HDR_LEN], uLen, &ProtoTxBuf[PROTO_HDR_LEN]);
+
+	vPutU16(&ProtoTxBuf[0], PROTO_SYNC_RSP);
+	ProtoTxBuf[2] = ProtoRxBuf[2];
+	ProtoTxBuf[3] = ProtoRxBuf[3];
+	vPutU16(&ProtoTxBuf[4], uRspLen);
+	vPutU16(&ProtoTxBuf[PROTO_HDR_LEN + uRspLen], uCrc16(CRC16_INIT, &ProtoTxBuf[2], (uint16_t)(uRspLen + 4u)));
+	Proto.uTxLen = (uint16_t)(PROTO_HDR_LEN + uRspLen + 2u);
+	return 1u;
+}
+
+/**
+ * @brief  수신 바이트 1개를 프레임 조립 버퍼에 추가합니다.
+ * @details 동기 워드가 맞지 않으면 처음부터 다시 찾고, 길이가 범위를 넘으면 프레임을 버립니다.
+ * @param  uByte 수신 바이트
+ * @retval 1: 프레임 조립 완료, 0: 진행 중
+ */
+static uint16_t uProtoRxByte(uint8_t uByte){
+	uint16_t uLen;
+
+	if((Proto.uRxLen == 0u) && (uByte != (uint8_t)PROTO_SYNC_REQ)) return 0u;
+	if((Proto.uRxLen == 1u) && (uByte != (uint8_t)(PROTO_SYNC_REQ >> 8))) {
+		Proto.uRxLen = (uByte == (uint8_t)PROTO_SYNC_REQ) ? 1u : 0u;
+		return 0u;
+	}
+
+	ProtoRxBuf[Proto.uRxLen++] = uByte;
+	if(Proto.uRxLen < PROTO_HDR_LEN) return 0u;
+
+	uLen = uGetU16(&ProtoRxBuf[4]);
+	if(uLen > PROTO_PAYLOAD_MAX) {
+		Proto.ulLenErrCnt++;
+		Proto.uRxLen = 0u;
+		return 0u;
+	}
+	return (Proto.uRxLen == (uint16_t)(PROTO_HDR_LEN + uLen + 2u)) ? 1u : 0u;
+}
+
+/**
+ * @brief  수신 상태를 초기화합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitProto(void){
+	memset(&Proto, 0, sizeof(Proto));
+	Proto.ulRxTick = HAL_GetTick();
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 수신 바이트를 조립하고 완성된 요청 1개를 처리하여 응답합니다.
+ * @details 응답 버퍼가 송신 중이거나 송신 대기 중이면 새 요청을 조립하지 않습니다 (수신 바이트는 순환 버퍼에 남음).
+ * @param  없음
+ * @retval 없음
+ */
+void vProtoTask(void){
+	uint8_t uByte;
+	uint16_t uCnt;
+
+	if(Proto.uTxPending) {
+		if(!uUartTxStart(ProtoTxBuf, Proto.uTxLen)) return;
+		Proto.uTxPending = 0u;
+	}
+	if(uUartTxBusyWith(ProtoTxBuf)) return;
+
+	if((Proto.uRxLen != 0u) && ((HAL_GetTick() - Proto.ulRxTick) > PROTO_RX_TIMEOUT_MS)) {
+		Proto.ulTimeoutCnt++;
+		Proto.uRxLen = 0u;
+	}
+
+	for(uCnt = 0u; (uCnt < PROTO_TASK_BYTES_MAX) && uUartRxRead(&uByte, 1u); uCnt++) {
+		Proto.ulRxTick = HAL_GetTick();
+		if(!uProtoRxByte(uByte)) continue;
+
+		Proto.uRxLen = 0u;
+		if(uProtoProcess()) {
+			Proto.uTxPending = uUartTxStart(ProtoTxBuf, Proto.uTxLen) ? 0u : 1u;
+		}
+		return;
+	}
+}
@@ -0,0 +1,226 @@
+/**
+ * @file    RcFrame.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   SBUS/CRSF 직렬 수신기 프레임 파서 및 CRSF 텔레메트리 프레임 생성 구현 소스 파일
+ * @details 표준 C 라이브러리만 사용합니다 (HAL, CMSIS 헤더 없음). 바이트당 처리는 저장과 비교 몇 번이며,
+ * 채널 풀기와 CRC는 프레임이 완성될 때 한 번만 수행합니다.
+ */
+
+#include "RcFrame.h"
+
+/** @brief CRSF CRC-8 바이트 테이블 (다항식 0xD5) */
+static const uint8_t uCrsfCrcTable[256] = {
+		0x00u, 0xD5u, 0x7Fu, 0xAAu, 0xFEu, 0x2Bu, 0x81u, 0x54u, 0x29u, 0xFCu, 0x56u, 0x83u, 0xD7u, 0x02u, 0xA8u, 0x7Du,
+		0x52u, 0x87u, 0x2Du, 0xF8u, 0xACu, 0x79u, 0xD3u, 0x06u, 0x7Bu, 0xAEu, 0x04u, 0xD1u, 0x85u, 0x50u, 0xFAu, 0x2Fu,
+		0xA4u, 0x71u, 0xDBu, 0x0Eu, 0x5Au, 0x8Fu, 0x25u, 0xF0u, 0x8Du, 0x58u, 0xF2u, 0x27u, 0x73u, 0xA6u, 0x0Cu, 0xD9u,
+		0xF6u, 0x23u, 0x89u, 0x5Cu, 0x08u, 0xDDu, 0x77u, 0xA2u, 0xDFu, 0x0Au, 0xA0u, 0x75u, 0x21u, 0xF4u, 0x5Eu, 0x8Bu,
+		0x9Du, 0x48u, 0xE2u, 0x37u, 0x63u, 0xB6u, 0x1Cu, 0xC9u, 0xB4u, 0x61u, 0xCBu, 0x1Eu, 0x4Au, 0x9Fu, 0x35u, 0xE0u,
+		0xCFu, 0x1Au, 0xB0u, 0x65u, 0x31u, 0xE4u, 0x4Eu, 0x9Bu, 0xE6u, 0x33u, 0x99u, 0x4Cu, 0x18u, 0xCDu, 0x67u, 0xB2u,
+		0x39u, 0xECu, 0x46u, 0x93u, 0xC7u, 0x12u, 0xB8u, 0x6Du, 0x10u, 0xC5u, 0x6Fu, 0xBAu, 0xEEu, 0x3Bu, 0x91u, 0x44u,
+		0x6Bu, 0xBEu, 0x14u, 0xC1u, 0x95u, 0x40u, 0xEAu, 0x3Fu, 0x42u, 0x97u, 0x3Du, 0xE8u, 0xBCu, 0x69u, 0xC3u, 0x16u,
+		0xEFu, 0x3Au, 0x90u, 0x45u, 0x11u, 0xC4u, 0x6Eu, 0xBBu, 0xC6u, 0x13u, 0xB9u, 0x6Cu, 0x38u, 0xEDu, 0x47u, 0x92u,
+		0xBDu, 0x68u, 0xC2u, 0x17u, 0x43u, 0x96u, 0x3Cu, 0xE9u, 0x94u, 0x41u, 0xEBu, 0x3Eu, 0x6Au, 0xBFu, 0x15u, 0xC0u,
+		0x4Bu, 0x9Eu, 0x34u, 0xE1u, 0xB5u, 0x60u, 0xCAu, 0x1Fu, 0x62u, 0xB7u, 0x1Du, 0xC8u, 0x9Cu, 0x49u, 0xE3u, 0x36u,
+		0x19u, 0xCCu, 0x66u, 0xB3u, 0xE7u, 0x32u, 0x98u, 0x4Du, 0x30u, 0xE5u, 0x4Fu, 0x9Au, 0xCEu, 0x1Bu, 0xB1u, 0x64u,
+		0x72u, 0xA7u, 0x0Du, 0xD8u, 0x8Cu, 0x59u, 0xF3u, 0x26u, 0x5Bu, 0x8Eu, 0x24u, 0xF1u, 0xA5u, 0x70u, 0xDAu, 0x0Fu,
+		0x20u, 0xF5u, 0x5Fu, 0x8Au, 0xDEu, 0x0Bu, 0xA1u, 0x74u, 0x09u, 0xDCu, 0x76u, 0xA3u, 0xF7u, 0x22u, 0x88u, 0x5Du,
+		0xD6u, 0x03u, 0xA9u, 0x7Cu, 0x28u, 0xFDu, 0x57u, 0x82u, 0xFFu, 0x2Au, 0x80u, 0x55u, 0x01u, 0xD4u, 0x7Eu, 0xABu,
+		0x84u, 0x51u, 0xFBu, 0x2Eu, 0x7Au, 0xAFu, 0x05u, 0xD0u, 0xADu, 0x78u, 0xD2u, 0x07u, 0x53u, 0x86u, 0x2Cu, 0xF9u,
+};
+
+/**
+ * @brief  11bit 패킹 채널 22byte를 16채널로 풉니다.
+ * @param  pData 패킹 데이터 (22byte)
+ * @param  pCh 채널 값 (RC_CH_NUM개)
+ * @retval 없음
+ */
+void vRcUnpackCh(const uint8_t* pData, uint16_t* pCh){
+	uint32_t ulAcc = 0u;
+	uint16_t uBits = 0u, i, j = 0u;
+
+	for(i = 0u; i < RC_CH_NUM; i++){
+		while(uBits < 11u){
+			ulAcc |= (uint32_t)pData[j++] << uBits;
+			uBits += 8u;
+		}
+		pCh[i] = (uint16_t)(ulAcc & 0x7FFu);
+		ulAcc >>= 11;
+		uBits -= 11u;
+	}
+}
+
+/**
+ * @brief  16채널을 11bit 패킹 22byte로 만듭니다.
+ * @param  pCh 채널 값 (RC_CH_NUM개)
+ * @param  pData 패킹 데이터 (22byte)
+ * @retval 없음
+ */
+void vRcPackCh(const uint16_t* pCh, uint8_t* pData){
+	uint32_t ulAcc = 0u;
+	uint16_t uBits = 0u, i, j = 0u;
+
+	for(i = 0u; i < RC_CH_NUM; i++){
+		ulAcc |= (uint32_t)(pCh[i] & 0x7FFu) << uBits;
+		uBits += 11u;
+		while(uBits >= 8u){
+			pData[j++] = (uint8_t)ulAcc;
+			ulAcc >>= 8;
+			uBits -= 8u;
+		}
+	}
+}
+
+/**
+ * @brief  SBUS 바이트 하나를 입력합니다.
+ * @param  pP 파서
+ * @param  uByte 수신 바이트
+ * @retval 1: 유효 프레임 완성, 0: 진행 중 또는 오류
+ */
+uint16_t uSbusPush(sSbusParser* pP, uint8_t uByte){
+	if(pP->uIdx == 0u && uByte != SBUS_START) return 0u;    /* 유휴 구간 뒤 첫 바이트가 시작 바이트일 때까지 무시 */
+	if(pP->uIdx >= SBUS_FRAME_LEN) return 0u;               /* 끝 바이트 이후 유휴 구간 없이 이어지는 바이트 */
+
+	pP->uBuf[pP->uIdx++] = uByte;
+	if(pP->uIdx < SBUS_FRAME_LEN) return 0u;
+
+	if(uByte != SBUS_END){
+		pP->ulErrCnt++;
+		return 0u;
+	}
+	vRcUnpackCh(&pP->uBuf[1], pP->uCh);
+	pP->uFlags = pP->uBuf[23];
+	pP->ulFrameCnt++;
+	return 1u;
+}
+
+/**
+ * @brief  SBUS 유휴 구간(프레임 경계)을 알립니다.
+ * @param  pP 파서
+ * @retval 없음
+ */
+void vSbusIdle(sSbusParser* pP){
+	if(pP->uIdx != 0u && pP->uIdx < SBUS_FRAME_LEN) pP->ulErrCnt++;
+	pP->uIdx = 0u;
+}
+
+/**
+ * @brief  CRSF 바이트 하나를 입력합니다.
+ * @param  pP 파서
+ * @param  uByte 수신 바이트
+ * @retval CRC가 맞는 프레임 완성 시 프레임 종류, 그 외 0
+ */
+uint8_t uCrsfPush(sCrsfParser* pP, uint8_t uByte){
+	uint16_t uLen;
+	uint8_t uType;
+
+	if(pP->uIdx == 0u){
+		if(uByte != CRSF_ADDR_FC && uByte != CRSF_ADDR_RX && uByte != CRSF_ADDR_TX) return 0u;
+	}
+	else if(pP->uIdx == 1u){
+		if(uByte < 2u || uByte > (CRSF_FRAME_MAX - 2u)){
+			pP->ulErrCnt++;
+			pP->uIdx = 0u;
+			return 0u;
+		}
+	}
+
+	pP->uBuf[pP->uIdx++] = uByte;
+	if(pP->uIdx < 2u) return 0u;
+
+	uLen = (uint16_t)(pP->uBuf[1] + 2u);
+	if(pP->uIdx < uLen) return 0u;
+
+	/* 프레임 완성: 다음 바이트부터 새 프레임 (CRSF는 프레임이 공백 없이 이어질 수 있음) */
+	pP->uIdx = 0u;
+	if(uCrsfCrc8(&pP->uBuf[2], (uint16_t)(uLen - 3u)) != pP->uBuf[uLen - 1u]){
+		pP->ulCrcErrCnt++;
+		return 0u;
+	}
+	pP->ulFrameCnt++;
+
+	uType = pP->uBuf[2];
+	if(uType == CRSF_TYPE_RC && uLen >= 26u) vRcUnpackCh(&pP->uBuf[3], pP->uCh);
+	else if(uType == CRSF_TYPE_LINK && uLen >= (4u + CRSF_LINK_LQ_OFS + 1u)) pP->uLinkLq = pP->uBuf[3u + CRSF_LINK_LQ_OFS];
+	return uType;
+}
+
+/**
+ * @brief  CRSF 유휴 구간(프레임 경계)을 알립니다.
+ * @param  pP 파서
+ * @retval 없음
+ */
+void vCrsfIdle(sCrsfParser* pP){
+	if(pP->uIdx != 0u) pP->ulErrCnt++;
+	pP->uIdx = 0u;
+}
+
+/**
+ * @brief  CRSF CRC-8 (다항식 0xD5)
+ * @param  pData 데이터
+ * @param  uLen 길이 [byte]
+ * @retval CRC
+ */
+uint8_t uCrsfCrc8(const uint8_t* pData, uint16_t uLen){
+	uint8_t uCrc = 0u;
+
+	while(uLen--) uCrc = uCrsfCrcTable[uCrc ^ *pData++];
+	return uCrc;
+}
+
+/**
+ * @brief  CRSF 프레임을 만듭니다.
+ * @param  uType 프레임 종류
+ * @param  pPayload 데이터
+ * @param  uLen 데이터 길이 [byte]
+ * @param  pOut 출력
+ * @retval 프레임 길이 [byte], 0: 길이 초과
+ */
+uint16_t uCrsfBuild(uint8_t uType, const uint8_t* pPayload, uint16_t uLen, uint8_t* pOut){
+	uint16_t i;
+
+	if(uLen > (CRSF_FRAME_MAX - 4u)) return 0u;
+
+	pOut[0] = CRSF_ADDR_FC;
+	pOut[1] = (uint8_t)(uLen + 2u);
+	pOut[2] = uType;
+	for(i = 0u; i < uLen; i++) pOut[3u + i] = pPayload[i];
+	pOut[3u + uLen] = uCrsfCrc8(&pOut[2], (uint16_t)(uLen + 1u));
+	return (uint16_t)(uLen + 4u);
+}
+
+/**
+ * @brief  CRSF 배터리 센서 프레임을 만듭니다.
+ * @param  fVolt 전압 [V]
+ * @param  fAmp 전류 [A]
+ * @param  ulMah 소모 용량 [mAh]
+ * @param  uPct 잔량 [%]
+ * @param  pOut 출력
+ * @retval 프레임 길이 [byte]
+ */
+uint16_t uCrsfBuildBattery(float fVolt, float fAmp, uint32_t ulMah, uint8_t uPct, uint8_t* pOut){
+	uint8_t uPl[8];
+	uint16_t uV = (fVolt > 0.0f) ? (uint16_t)(fVolt * 10.0f + 0.5f) : 0u;
+	uint16_t uA = (fAmp > 0.0f) ? (uint16_t)(fAmp * 10.0f + 0.5f) : 0u;
+
+	uPl[0] = (uint8_t)(uV >> 8); uPl[1] = (uint8_t)uV;
+	uPl[2] = (uint8_t)(uA >> 8); uPl[3] = (uint8_t)uA;
+	uPl[4] = (uint8_t)(ulMah >> 16); uPl[5] = (uint8_t)(ulMah >> 8); uPl[6] = (uint8_t)ulMah;
+	uPl[7] = uPct;
+	return uCrsfBuild(CRSF_TYPE_BATTERY, uPl, 8u, pOut);
+}
+
+/**
+ * @brief  CRSF RPM 센서 프레임(값 1개)을 만듭니다.
+ * @param  uSource 출처 ID
+ * @param  lRpm 회전수 [RPM]
+ * @param  pOut 출력
+ * @retval 프레임 길이 [byte]
+ */
+uint16_t uCrsfBuildRpm(uint8_t uSource, int32_t lRpm, uint8_t* pOut){
+	uint8_t uPl[4];
+
+	uPl[0] = uSource;
+	uPl[1] = (uint8_t)((uint32_t)lRpm >> 16); uPl[2] = (uint8_t)((uint32_t)lRpm >> 8); uPl[3] = (uint8_t)lRpm;
+	return uCrsfBuild(CRSF_TYPE_RPM, uPl, 4u, pOut);
+}
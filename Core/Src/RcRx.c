@@ -0,0 +1,202 @@
+/**
+ * @file    RcRx.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   USART3 직렬 수신기(SBUS/CRSF) 입력 및 CRSF 텔레메트리 송신 구현 소스 파일
+ *
+ * @details [자원 할당]
+ * | 자원 | 설정 |
+ * | :--- | :--- |
+ * | **USART3** | 레지스터 직접 제어, IDLE 인터럽트 (우선순위 2) |
+ * | **PB10 / PB11** | AF7 (USART3_TX / USART3_RX) |
+ * | **DMA2_CH1** | DMAMUX1_Channel8 = USART3_RX, RDR → RcRxBuf, Circular 모드, 절반/완료 인터럽트 (우선순위 2) |
+ * | **DMA2_CH2** | DMAMUX1_Channel9 = USART3_TX, RcTxBuf → TDR, Normal 모드 (CRSF 텔레메트리) |
+ *
+ * 세 인터럽트 모두 같은 우선순위이므로 서로 끼어들지 않으며, 판독 위치(uRd)와 파서 상태는 이 인터럽트들만 사용합니다.
+ * 스로틀 샘플은 순번과 펄스폭을 32bit 한 워드로 게시하여 제어 ISR이 찢어진 값을 읽지 않게 합니다.
+ */
+
+#include "main.h"
+#include "GlobalVar.h"
+#include "UserMath.h"
+#include "MotorControl.h"
+#include "EscTelem.h"
+#include "RcRx.h"
+
+/** @brief 직렬 수신기 객체 */
+sRcRx RcRx;
+
+/** @brief 수신 순환 버퍼 (DMA2_CH1 기록) */
+static uint8_t RcRxBuf[RC_RX_BUF_SIZE];
+/** @brief 텔레메트리 송신 버퍼 (DMA2_CH2 판독) */
+static uint8_t RcTxBuf[CRSF_FRAME_MAX];
+
+/**
+ * @brief  USART3 핀/DMA 클럭과 인터럽트를 준비하고 기본 프로토콜로 시작합니다.
+ * @retval 없음
+ */
+void vInitRcRx(void){
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+	__HAL_RCC_USART3_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+	__HAL_RCC_GPIOB_CLK_ENABLE();
+
+	GPIO_InitStruct.Pin = GPIO_PIN_10 | GPIO_PIN_11;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	GPIO_InitStruct.Alternate = GPIO_AF7_USART3;
+	HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+	RcRx.uThrCh = RC_THR_CH;
+	RcRx.uTelemEn = 1u;
+
+	HAL_NVIC_SetPriority(USART3_IRQn, 2, 0);
+	HAL_NVIC_SetPriority(DMA2_Channel1_IRQn, 2, 0);
+
+	vRcRxSetProto(RC_PROTO_DEFAULT);
+}
+
+/**
+ * @brief  프로토콜을 바꾸고 USART3와 수신/송신 DMA를 다시 설정합니다.
+ * @param  uProto 프로토콜 (RC_PROTO_*)
+ * @retval 없음
+ */
+void vRcRxSetProto(uint16_t uProto){
+	if(uProto > RC_PROTO_CRSF) return;
+
+	RcRx.uReady = 0u;
+	HAL_NVIC_DisableIRQ(USART3_IRQn);
+	HAL_NVIC_DisableIRQ(DMA2_Channel1_IRQn);
+
+	USART3->CR1 = 0u;
+	DMA2_Channel1->CCR = 0u;
+	DMA2_Channel2->CCR = 0u;
+
+	RcRx.uProto = uProto;
+	RcRx.uRd = 0u;
+	RcRx.uLinkOk = 1u;
+	RcRx.Sbus.uIdx = 0u;
+	RcRx.Crsf.uIdx = 0u;
+	if(uProto == RC_PROTO_NONE) return;
+
+	/* SBUS는 반전 신호이므로 Idle Low 풀다운, CRSF는 Idle High 풀업 */
+	GPIOB->PUPDR = (GPIOB->PUPDR & ~(GPIO_PUPDR_PUPD10 | GPIO_PUPDR_PUPD11))
+			| ((uProto == RC_PROTO_SBUS) ? (GPIO_PUPDR_PUPD10_1 | GPIO_PUPDR_PUPD11_1) : (GPIO_PUPDR_PUPD10_0 | GPIO_PUPDR_PUPD11_0));
+
+	if(uProto == RC_PROTO_SBUS){
+		USART3->BRR = (RC_KER_CLK + (RC_SBUS_BAUD >> 1)) / RC_SBUS_BAUD;
+		USART3->CR2 = USART_CR2_STOP_1 | USART_CR2_RXINV | USART_CR2_TXINV;
+	}
+	else {
+		USART3->BRR = (RC_KER_CLK + (RC_CRSF_BAUD >> 1)) / RC_CRSF_BAUD;
+		USART3->CR2 = 0u;
+	}
+	USART3->CR3 = USART_CR3_DMAR | USART_CR3_DMAT | USART_CR3_OVRDIS;
+
+	DMAMUX1_Channel8->CCR = DMA_REQUEST_USART3_RX;
+	DMA2_Channel1->CPAR = (uint32_t)&USART3->RDR;
+	DMA2_Channel1->CMAR = (uint32_t)RcRxBuf;
+	DMA2_Channel1->CNDTR = RC_RX_BUF_SIZE;
+	DMA2_Channel1->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_EN;
+
+	DMAMUX1_Channel9->CCR = DMA_REQUEST_USART3_TX;
+	DMA2_Channel2->CPAR = (uint32_t)&USART3->TDR;
+	DMA2_Channel2->CNDTR = 0u;
+
+	/* SBUS: 9bit 워드(8bit + 짝수 패리티), CRSF: 8bit */
+	USART3->ICR = 0xFFFFFFFFu;
+	USART3->CR1 = ((uProto == RC_PROTO_SBUS) ? (USART_CR1_M0 | USART_CR1_PCE) : 0u)
+			| USART_CR1_IDLEIE | USART_CR1_TE | USART_CR1_RE | USART_CR1_UE;
+
+	RcRx.uReady = 1u;
+	HAL_NVIC_EnableIRQ(USART3_IRQn);
+	HAL_NVIC_EnableIRQ(DMA2_Channel1_IRQn);
+}
+
+/**
+ * @brief  채널 값을 스로틀 샘플로 게시합니다.
+ * @param  pCh 채널 값
+ * @retval 없음
+ */
+static void vRcRxPublish(const uint16_t* pCh){
+	uint16_t uSeq = (uint16_t)((RcRx.ulSample >> 16) + 1u);
+
+	RcRx.ulSample = ((uint32_t)uSeq << 16) | RC_CH_TO_US(pCh[RcRx.uThrCh & (RC_CH_NUM - 1u)]);
+}
+
+/**
+ * @brief  링크 상태를 갱신합니다.
+ * @param  uOk 1: 정상
+ * @retval 없음
+ */
+static void vRcRxLink(uint16_t uOk){
+	if(uOk == 0u && RcRx.uLinkOk != 0u) RcRx.ulLinkFailCnt++;
+	RcRx.uLinkOk = uOk;
+}
+
+/**
+ * @brief  USART3 IDLE 및 DMA2_CH1 절반/완료 인터럽트에서 호출되어 새 바이트를 파싱합니다.
+ * @retval 없음
+ */
+void vRcRxIrq(void){
+	uint16_t uWr, uIdle = 0u;
+	uint8_t uByte, uType;
+
+	if(USART3->ISR & USART_ISR_IDLE){
+		USART3->ICR = USART_ICR_IDLECF;
+		uIdle = 1u;
+	}
+	DMA2->IFCR = DMA_IFCR_CHTIF1 | DMA_IFCR_CTCIF1 | DMA_IFCR_CGIF1;
+	if(RcRx.uReady == 0u) return;
+
+	uWr = (uint16_t)((RC_RX_BUF_SIZE - DMA2_Channel1->CNDTR) & (RC_RX_BUF_SIZE - 1u));
+
+	while(RcRx.uRd != uWr){
+		uByte = RcRxBuf[RcRx.uRd];
+		RcRx.uRd = (uint16_t)((RcRx.uRd + 1u) & (RC_RX_BUF_SIZE - 1u));
+
+		if(RcRx.uProto == RC_PROTO_SBUS){
+			if(uSbusPush(&RcRx.Sbus, uByte) != 0u){
+				vRcRxLink((RcRx.Sbus.uFlags & SBUS_FLAG_FAILSAFE) ? 0u : 1u);
+				if(RcRx.uLinkOk != 0u && (RcRx.Sbus.uFlags & SBUS_FLAG_LOST) == 0u) vRcRxPublish(RcRx.Sbus.uCh);
+			}
+		}
+		else {
+			uType = uCrsfPush(&RcRx.Crsf, uByte);
+			if(uType == CRSF_TYPE_LINK) vRcRxLink((RcRx.Crsf.uLinkLq >= RC_LQ_MIN) ? 1u : 0u);
+			else if(uType == CRSF_TYPE_RC && RcRx.uLinkOk != 0u) vRcRxPublish(RcRx.Crsf.uCh);
+		}
+	}
+
+	if(uIdle != 0u){
+		if(RcRx.uProto == RC_PROTO_SBUS) vSbusIdle(&RcRx.Sbus);
+		else                             vCrsfIdle(&RcRx.Crsf);
+	}
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 CRSF 텔레메트리를 송신합니다. (전류/용량은 ESC 텔레메트리 값 사용)
+ * @retval 없음
+ */
+void vRcRxTask(void){
+	uint32_t ulNow = HAL_GetTick();
+	uint16_t uLen;
+
+	if(RcRx.uReady == 0u || RcRx.uProto != RC_PROTO_CRSF || RcRx.uTelemEn == 0u) return;
+	if((ulNow - RcRx.ulTelemTick) < RC_TELEM_PERIOD_MS) return;
+	if(DMA2_Channel2->CNDTR != 0u) return;
+	RcRx.ulTelemTick = ulNow;
+
+	if(RcRx.uTelemSel == 0u) uLen = uCrsfBuildBattery(fVdc, EscTelem.fIdc, (uint32_t)EscTelem.fMah, 0u, RcTxBuf);
+	else                     uLen = uCrsfBuildRpm(RC_RPM_SOURCE_ID, (int32_t)INV.SO.fWrpmSC, RcTxBuf);
+	RcRx.uTelemSel ^= 1u;
+
+	DMA2_Channel2->CCR = 0u;
+	DMA2->IFCR = DMA_IFCR_CGIF2;
+	DMA2_Channel2->CMAR = (uint32_t)RcTxBuf;
+	DMA2_Channel2->CNDTR = uLen;
+	DMA2_Channel2->CCR = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_EN;
+	RcRx.ulTelemCnt++;
+}
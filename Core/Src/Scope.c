@@ -0,0 +1,232 @@
+/**
+ * @file    Scope.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 루프 내부 변수를 트리거 조건에 맞춰 RAM에 캡처하는 소프트웨어 오실로스코프 구현 소스 파일
+ *
+ * @details [캡처 시퀀스]
+ * | 상태 | 동작 | 다음 상태 |
+ * | :--- | :--- | :--- |
+ * | **STOP** | 기록 안 함 | vScopeArm → PRETRIG |
+ * | **PRETRIG** | uPreTrig 샘플이 채워질 때까지 기록만 수행 | ARMED |
+ * | **ARMED** | 매 샘플 트리거 판정 (트리거 채널의 16비트 샘플과 iTrigLevel 비교) | 조건 만족 → POSTTRIG |
+ * | **POSTTRIG** | 나머지 (SCOPE_DEPTH - uPreTrig - 1) 샘플 기록 | 완료 처리 |
+ * | **HOLD** | 판독 잠금(uRdLock) 중이라 완료 버퍼를 교체할 수 없어 대기 | 잠금 해제 시 완료 처리 |
+ *
+ * 완료 처리 시 기록 버퍼가 판독 버퍼(uRdBuf)가 되고, NORMAL 모드에서는 다른 버퍼로 즉시 재무장합니다.
+ * 이때 채널 수와 Pre-trigger 샘플 수를 uRdChNum/uRdPreTrig에 고정하므로, 판독 중 설정을 바꿔 재무장해도 완료 버퍼의 해석은 바뀌지 않습니다.
+ * 판독은 메인 루프, 디버거 또는 통신 링크에서 uScopeRead로 시간 순서대로 읽습니다.
+ *
+ * @details [실행 비용]
+ * 채널당 디스크립터 읽기, 곱셈 1회, 포화, 16비트 저장만 수행합니다 (iPackDataChannel).
+ * 트리거는 이미 변환된 정수 샘플끼리 비교하므로 추가 부동소수점 연산이 없습니다.
+ */
+
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "Scope.h"
+#include "VarTable.h"
+
+/** @brief 스코프 객체 */
+sScope Scope;
+
+/** @brief 스코프 채널 디스크립터 */
+sDataChannel ScopeCh[SCOPE_CH_MAX];
+
+/** @brief 스코프 더블 버퍼 [버퍼][샘플][채널] */
+int16_t iScopeBuf[2][SCOPE_DEPTH][SCOPE_CH_MAX];
+
+/**
+ * @brief  캡처 완료 처리: 판독 버퍼를 교체하고 모드에 따라 재무장 또는 정지합니다.
+ * @param  없음
+ * @retval 없음
+ */
+static void vScopeComplete(void){
+	if(Scope.uRdLock) {
+		Scope.uState = SCOPE_STATE_HOLD;
+		return;
+	}
+
+	Scope.uRdBuf = Scope.uWrBuf;
+	Scope.uRdChNum = Scope.uChNum;
+	Scope.uRdPreTrig = Scope.uPreTrig;
+	Scope.uReady = 1u;
+	Scope.ulCaptureCnt++;
+
+	if(Scope.uMode == SCOPE_MODE_NORMAL) {
+		Scope.uWrBuf ^= 1u;
+		Scope.uWrIdx = 0u;
+		Scope.uFillCnt = 0u;
+		Scope.uState = SCOPE_STATE_PRETRIG;
+	}
+	else {
+		Scope.uState = SCOPE_STATE_STOP;
+	}
+}
+
+/**
+ * @brief  기본 설정(정지 상태)으로 초기화합니다.
+ * @details 기본 채널: q축 전류/지령, 속도, 주 상태. 트리거: 주 상태 변화, Pre-trigger 64 샘플.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitScope(void){
+	(void)uScopeSelect(0u, VAR_ID_CC_IQSR);
+	(void)uScopeSelect(1u, VAR_ID_CC_IQSR_REF);
+	(void)uScopeSelect(2u, VAR_ID_SO_WRPM_SC);
+	(void)uScopeSelect(3u, VAR_ID_STATE);
+
+	Scope.uMode = SCOPE_MODE_SINGLE;
+	Scope.uChNum = 4u;
+	Scope.uDecim = 1u;
+	Scope.uPreTrig = 64u;
+	Scope.uTrigCh = 3u;
+	Scope.uTrigType = SCOPE_TRIG_CHANGE;
+	Scope.fTrigLevel = 0.0f;
+	Scope.uForce = 0u;
+
+	Scope.uState = SCOPE_STATE_STOP;
+	Scope.uWrBuf = 0u;
+	Scope.uRdBuf = 1u;
+	Scope.uRdChNum = 0u;
+	Scope.uRdPreTrig = 0u;
+	Scope.uReady = 0u;
+	Scope.uRdLock = 0u;
+	Scope.ulCaptureCnt = 0ul;
+}
+
+/**
+ * @brief  변수 레지스트리 ID로 스코프 채널을 지정합니다. (기본 스케일 사용)
+ * @note   캡처 중 변경하면 해당 채널의 기존 샘플과 스케일이 섞이므로 정지 상태에서 호출 후 vScopeArm으로 재무장합니다.
+ * @param  uCh 스코프 채널 (0 ~ SCOPE_CH_MAX-1)
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @retval 1: 성공, 0: 잘못된 채널 또는 ID
+ */
+uint16_t uScopeSelect(uint16_t uCh, uint16_t uId){
+	if(uCh >= SCOPE_CH_MAX) return 0u;
+	return uVarChannel(uId, &ScopeCh[uCh]);
+}
+
+/**
+ * @brief  현재 설정으로 캡처를 시작(재무장)합니다.
+ * @details 설정값을 범위 내로 제한하고, 트리거 레벨에 트리거 채널과 같은 변환(× fScale + fOffset, 포화)을 미리 적용합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vScopeArm(void){
+	float fLevel;
+
+	Scope.uState = SCOPE_STATE_STOP;
+
+	if(Scope.uChNum > SCOPE_CH_MAX)			Scope.uChNum = SCOPE_CH_MAX;
+	if(Scope.uDecim == 0u)					Scope.uDecim = 1u;
+	if(Scope.uPreTrig >= SCOPE_DEPTH)		Scope.uPreTrig = SCOPE_DEPTH - 1u;
+	if(Scope.uTrigCh >= Scope.uChNum)		Scope.uTrigCh = 0u;
+
+	fLevel = Scope.fTrigLevel * ScopeCh[Scope.uTrigCh].fScale + ScopeCh[Scope.uTrigCh].fOffset;
+	Scope.iTrigLevel = (int16_t)LIMIT(fLevel, -32768.0f, 32767.0f);
+	Scope.iTrigPrev = iPackDataChannel(&ScopeCh[Scope.uTrigCh]);
+
+	/* 판독 잠금 중인 완료 버퍼는 덮어쓰지 않음 */
+	Scope.uWrBuf = (Scope.uReady && Scope.uRdLock) ? (Scope.uRdBuf ^ 1u) : Scope.uWrBuf;
+	Scope.uDecimCnt = 0u;
+	Scope.uWrIdx = 0u;
+	Scope.uFillCnt = 0u;
+	Scope.uForce = 0u;
+	Scope.uState = SCOPE_STATE_PRETRIG;
+}
+
+/**
+ * @brief  제어 주기마다 호출되어 샘플을 기록하고 트리거를 판정합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vScopeRecord(void){
+	int16_t* piRow;
+	int16_t iCur, iPrev;
+	uint16_t uHit, i;
+
+	if(Scope.uState == SCOPE_STATE_STOP) return;
+	if(Scope.uState == SCOPE_STATE_HOLD) {
+		vScopeComplete();
+		return;
+	}
+
+	if(++Scope.uDecimCnt < Scope.uDecim) return;
+	Scope.uDecimCnt = 0u;
+
+	/* 1. 샘플 기록 */
+	piRow = iScopeBuf[Scope.uWrBuf][Scope.uWrIdx];
+	for(i = 0u; i < Scope.uChNum; i++) {
+		piRow[i] = iPackDataChannel(&ScopeCh[i]);
+	}
+	iCur = piRow[Scope.uTrigCh];
+	iPrev = Scope.iTrigPrev;
+	Scope.iTrigPrev = iCur;
+
+	/* 2. 상태별 처리 */
+	switch(Scope.uState){
+	case SCOPE_STATE_PRETRIG:
+		if(++Scope.uFillCnt >= Scope.uPreTrig) Scope.uState = SCOPE_STATE_ARMED;
+		break;
+
+	case SCOPE_STATE_ARMED:
+		switch(Scope.uTrigType){
+		case SCOPE_TRIG_RISING:		uHit = (iPrev < Scope.iTrigLevel) && (iCur >= Scope.iTrigLevel);	break;
+		case SCOPE_TRIG_FALLING:	uHit = (iPrev >= Scope.iTrigLevel) && (iCur < Scope.iTrigLevel);	break;
+		case SCOPE_TRIG_ABOVE:		uHit = (iCur >= Scope.iTrigLevel);									break;
+		case SCOPE_TRIG_BELOW:		uHit = (iCur < Scope.iTrigLevel);									break;
+		default:					uHit = (iCur != iPrev);												break;
+		}
+
+		if(uHit || Scope.uForce) {
+			Scope.uForce = 0u;
+			Scope.uTrigIdx[Scope.uWrBuf] = Scope.uWrIdx;
+			Scope.uPostCnt = SCOPE_DEPTH - Scope.uPreTrig - 1u;
+			Scope.uState = SCOPE_STATE_POSTTRIG;
+			if(Scope.uPostCnt == 0u) {
+				vScopeComplete();
+				return;
+			}
+		}
+		break;
+
+	default: //case SCOPE_STATE_POSTTRIG:
+		if(--Scope.uPostCnt == 0u) {
+			vScopeComplete();
+			return;
+		}
+		break;
+	}
+
+	Scope.uWrIdx = (Scope.uWrIdx + 1u) & SCOPE_DEPTH_MASK;
+}
+
+/**
+ * @brief  완료 버퍼의 판독 잠금을 설정/해제합니다.
+ * @details 잠금 중 새 캡처가 완료되면 HOLD 상태로 대기하며, 해제 후 다음 제어 주기에 버퍼가 교체됩니다.
+ * @param  uLock 1: 잠금, 0: 해제
+ * @retval 없음
+ */
+void vScopeLock(uint16_t uLock){
+	Scope.uRdLock = uLock;
+}
+
+/**
+ * @brief  완료 버퍼에서 시간 순서상 uSample번째 샘플(0 = 가장 오래된 샘플)을 복사합니다.
+ * @details 채널 수와 Pre-trigger 샘플 수는 완료 처리 시 고정한 값(uRdChNum/uRdPreTrig)을 사용합니다.
+ * @param  uSample 샘플 번호 (0 ~ SCOPE_DEPTH-1, uRdPreTrig 번째가 트리거 샘플)
+ * @param  piDst uRdChNum개 채널의 복사 대상 버퍼
+ * @retval 1: 성공, 0: 완료 버퍼 없음 또는 범위 밖
+ */
+uint16_t uScopeRead(uint16_t uSample, int16_t* piDst){
+	uint16_t uIdx, i;
+
+	if(!Scope.uReady || (uSample >= SCOPE_DEPTH)) return 0u;
+
+	uIdx = (uint16_t)(Scope.uTrigIdx[Scope.uRdBuf] - Scope.uRdPreTrig + uSample) & SCOPE_DEPTH_MASK;
+	for(i = 0u; i < Scope.uRdChNum; i++) {
+		piDst[i] = iScopeBuf[Scope.uRdBuf][uIdx][i];
+	}
+	return 1u;
+}
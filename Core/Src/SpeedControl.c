@@ -21,7 +21,7 @@
  * | :--- | :--- | :--- |
  * | **1. 지령 프로파일** | 비대칭 Ramp 적용 | 가속(1000)과 감속(500)의 기울기를 다르게 적용하여 급격한 변화 완화 및 rad/s 단위 변환 |
  * | **2. 오차 연산** | Error = Wrm_Ref - Wrm_SC | 기계적 각속도 지령값과 관측기(Observer) 피드백 속도 간의 오차 계산 |
- * | **3. PI & Anti-windup** | Te_Ref = Kp*Err + Integ | PI 연산을 통해 요구 토크 산출, 제한치(Limit) 초과 시 오차를 적분항에서 감산하여 Windup 방지 |
+ * | **3. PI & Anti-windup** | Te_Ref = Kp*Err + Integ | PI 연산을 통해 요구 토크 산출, 제한치(파라미터 한계, 배터리 동적 한계, 구동력 제어 한계 중 작은 값) 초과 시 오차를 적분항에서 감산하여 Windup 방지 |
  * | **4. 전류 지령 변환** | Iq_Ref = Te_Ref / Kt | 산출된 최종 요구 토크에 토크 상수 역수(InvKT)를 곱하여 Q축 전류 지령으로 변환 |
  */
 
@@ -29,6 +29,9 @@
 #include "math.h"
 #include "MotorControl.h"
 #include "UserMath.h"
+#include "Param.h"
+#include "PowerLimit.h"
+#include "Traction.h"
 
 /**
  * @brief  속도 제어기(PI) 파라미터 및 변수들을 초기화합니다.
@@ -45,13 +48,6 @@ void vInitSpeedControl(sMotorCtrl* MotorControl, sSpeedCtrl* SCtrl){
     SCtrl->fWrpmRefSet = 0.0f;
     SCtrl->fWrpmRef = 0.0f;
 
-    /* 비례 이득 (Kp = Wc * Jm) 및 적분 이득 (Ki) 계산 */
-    SCtrl->fKpSc = WC_SC* MotorControl->JM;
-    SCtrl->fKiSc = 0.2f * WC_SC * WC_SC * MotorControl->JM;
-
-    /* Anti-windup 이득 계산 (비례 이득의 역수 활용) */
-    SCtrl->fKaSc = 1.f / SCtrl->fKpSc;
-
     SCtrl->fWrmRef = 0.0f;
     SCtrl->fWrmSC = 0.0f;
 
@@ -63,10 +59,6 @@ void vInitSpeedControl(sMotorCtrl* MotorControl, sSpeedCtrl* SCtrl){
 
     SCtrl->fIqsrRamp_LIMIT = 0.0f;
     SCtrl->fIqsrRefSC = 0.0f;
-
-	/* 출력 토크(Te) 최대/최소 제한값 설정 (Te = 1.5 * P * Flux * Iq) */
-	SCtrl-> fTeRefMin = -1.5 * MotorControl->PP * MotorControl->LAMF * (MOT_IS_RATED);
-	SCtrl-> fTeRefMax = 1.5 * MotorControl->PP * MotorControl->LAMF * (MOT_IS_RATED);
 }
 
 /**
@@ -82,16 +74,17 @@ void vInitSpeedControl(sMotorCtrl* MotorControl, sSpeedCtrl* SCtrl){
  * @retval 없음
  */
 void vSpeedControl(sMotorCtrl* MotorControl, sSpeedObs* SObs, sSpeedCtrl* SCtrl){
+    float fTeMax, fTeMin;
 
     /* 1. 속도 지령 프로파일 생성 (가속 및 감속 기울기 비대칭 적용) */
     if (SCtrl->fWrpmRefSet >= SCtrl->fWrpmRef) {
-        vSlopeGenerator(&SCtrl->fWrpmRef, SCtrl->fWrpmRefSet, 1000.0f * fTSc);
+        vSlopeGenerator(&SCtrl->fWrpmRef, SCtrl->fWrpmRefSet, pCtrlParam->fDelWrpmAcc);
     }else {
-        vSlopeGenerator(&SCtrl->fWrpmRef, SCtrl->fWrpmRefSet, 0.5f * 1000.0f * fTSc);
+        vSlopeGenerator(&SCtrl->fWrpmRef, SCtrl->fWrpmRefSet, pCtrlParam->fDelWrpmDec);
     }
 
     /* RPM 지령 제한 및 기계적 각속도(rad/s)로 단위 변환 */
-    SCtrl->fWrpmRef = LIMIT(SCtrl->fWrpmRef, -MOT_WRPM_RATED, MOT_WRPM_RATED);
+    SCtrl->fWrpmRef = LIMIT(SCtrl->fWrpmRef, -pCtrlParam->fWrpmRefMax, pCtrlParam->fWrpmRefMax);
     SCtrl->fWrmRef = RPM2RM * SCtrl->fWrpmRef;
 
     /* 현재 관측된 피드백 속도(RPM)를 기계적 각속도(rad/s)로 변환 */
@@ -101,17 +94,19 @@ void vSpeedControl(sMotorCtrl* MotorControl, sSpeedObs* SObs, sSpeedCtrl* SCtrl)
     SCtrl->fErrWrm = SCtrl->fWrmRef - SCtrl->fWrmSC;
 
     /* 3. PI 제어기 연산 (적분항 누적 시 Anti-windup 보상 적용) */
-    SCtrl->fTeInteg += (40.0f * fTsamp) * SCtrl->fKiSc * (SCtrl->fErrWrm - (SCtrl->fKaSc * SCtrl->fTeRefAW));
+    SCtrl->fTeInteg += ((float)SC_DIV * fTsamp) * pCtrlParam->fKiSc * (SCtrl->fErrWrm - (pCtrlParam->fKaSc * SCtrl->fTeRefAW));
 
     /* 포화 전(Unsaturated) 토크 지령 산출 */
-    SCtrl->fTeRefUnsat = SCtrl->fKpSc * SCtrl->fErrWrm + SCtrl->fTeInteg;
+    SCtrl->fTeRefUnsat = pCtrlParam->fKpSc * SCtrl->fErrWrm + SCtrl->fTeInteg;
 
-    /* 출력 토크 지령 상하한 제한(Saturation) */
-    SCtrl->fTeRef = LIMIT(SCtrl->fTeRefUnsat, SCtrl->fTeRefMin, SCtrl->fTeRefMax);
+    /* 출력 토크 지령 상하한 제한(Saturation): 배터리 전류/전력 제한이나 구동력 제어가 동작하면 동적 한계가 더 좁음 */
+    fTeMax = MIN(pCtrlParam->fTeRefMax, pCtrlParam->fKT * MIN(PwrLim.fIqMax, Traction.fIqLim));
+    fTeMin = MAX(pCtrlParam->fTeRefMin, pCtrlParam->fKT * MAX(PwrLim.fIqMin, -Traction.fIqLim));
+    SCtrl->fTeRef = LIMIT(SCtrl->fTeRefUnsat, fTeMin, fTeMax);
 
     /* 4. Anti-windup을 위한 오차량 계산 (다음 주기의 적분항 보상용) */
     SCtrl->fTeRefAW = SCtrl->fTeRefUnsat - SCtrl->fTeRef;
 
     /* 5. 최종 요구 토크를 토크 상수의 역수를 이용하여 Q축 전류(Iq) 지령으로 변환 */
-    SCtrl->fIqsrRefSC = MotorControl->InvKT * SCtrl->fTeRef;
+    SCtrl->fIqsrRefSC = pCtrlParam->fInvKT * SCtrl->fTeRef;
 }
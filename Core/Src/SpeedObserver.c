@@ -12,10 +12,12 @@
  * @details [주요 관측 및 센서 함수 (Functions)]
  * | 함수명 | 주요 파라미터 | 역할 및 특징 |
  * | :--- | :--- | :--- |
- * | **vInitSpeedObserver** | `Motor`, `SObs` | 관측기 PLL 이득(Kp, Ki), 속도 노이즈 필터(IIR) 초기화 및 관련 변수 리셋 |
+ * | **vInitSpeedObserver** | `Motor`, `SObs` | 관측기/정렬 변수와 속도 노이즈 필터(IIR) 상태 리셋 (이득과 필터 계수는 파라미터 세트) |
  * | **vSinCos_Calculation** | `angle`, `*Cos`, `*Sin` | 라디안 각도를 Q31로 변환 후 하드웨어 CORDIC 모듈을 호출하여 결과값을 반환 |
  * | **vSpeedObserver** | `Motor`, `SObs`, `SCtrl` | 제어 모드(V/F 개루프 vs 벡터 제어 폐루프)에 따라 위상각을 생성하거나 PLL을 통해 속도/각도를 관측 |
  * | **fGetHallSensorInfo** | `SObs` | 3상 홀 센서 GPIO 핀 상태를 조합하여 1~6 상태 코드를 만들고, 이를 60도 간격의 전기각으로 출력 |
+ * | **vHallEdgeTiming** | `SObs`, `fThetarHall` | 홀 상태 전환(에지) 간 제어 주기 수를 측정하여 회전 방향, 전기각 속도, 에지 시점 각도를 산출 |
+ * | **vFlyingStart** | `Motor`, `CCtrl`, `SObs`, `SCtrl` | 회전 중인 회전자를 홀 에지 정보로 포착하여 PLL, 속도/전류 제어기 상태를 초기화 (Align 생략) |
  * | **fGetEncoderInfo** | `htim`, `SObs` | 증분형 엔코더의 타이머 카운트 레지스터(CNT)를 읽어 기계적 각도(-PI ~ PI)로 스케일링 |
  *
  * @details [초기 회전자 위치 정렬 (Align) 시퀀스]
@@ -27,11 +29,21 @@
  * | **Step 3~4** | 정지 및 회전자 고정 | 목표 상태를 찾으면 속도 지령을 0으로 낮추고, 일정 시간 대기하여 회전자의 기계적 진동을 안정화 |
  * | **Step 5** | 위치 오프셋 연산 | 회전자가 고정된 상태에서 읽힌 각도를 누적 및 평균 내어 정밀한 기준 오프셋 산출 |
  * | **Step 6~7** | 전류 차단 및 정렬 종료 | D축 전류를 다시 0으로 내리고, 연산된 오프셋을 관측기에 적용하며 Align 완료(uAlignEnd=1) 선언 |
+ *
+ * @details [회전 중 재기동 (Flying Start)]
+ * 차량이 관성으로 굴러가는 상태에서 START가 들어오면 d축 전류 스윕(Align)이 회전자와 충돌합니다.
+ * `fGetHallSensorInfo`는 모든 상태에서 매 주기 홀 에지 간격을 측정하고 있으므로, `vFlyingStart`는
+ * PWM을 끈 채로 최근 에지 정보만 확인하여 수 ms 안에 RUN으로 진입합니다.
+ * | 조건 | 결과 | 초기화 내용 |
+ * | :--- | :--- | :--- |
+ * | 같은 방향 에지 `FLY_EDGE_NUM_MIN`개 이상 & 속도 >= `FLY_WRPM_MIN` | FLY_RESULT_CAUGHT | PLL 각도/적분기, 속도 LPF, 속도 지령 램프, dq 전류 제어기 적분기(역기전력) |
+ * | `FLY_CNT_MAX` 동안 조건 불만족 | FLY_RESULT_ALIGN | 정지 또는 저속으로 판단하여 기존 Align 시퀀스 수행 |
  */
 
 #include "MotorControl.h"
 #include "Globalvar.h"
 #include "UserMath.h"
+#include "Param.h"
 
 /** @brief CORDIC 연산을 위한 외부 핸들러 참조 */
 extern CORDIC_HandleTypeDef hcordic;
@@ -46,8 +58,9 @@ IIR2 IIR2WrmSCLPF;
  * @details
  * 1. 위치 정렬(Align) 프로세스 관련 변수를 초기화합니다.
  * 2. 좌표 변환에 필요한 초기 Sin/Cos 값을 설정합니다.
- * 3. 기계 파라미터(관성, 마찰 등)를 기반으로 관측기 및 PLL의 이득을 계산합니다.
- * 4. 추정 속도를 위한 LPF(Low Pass Filter)를 초기화합니다.
+ * 3. 추정 속도를 위한 LPF(Low Pass Filter)의 상태를 0으로 지웁니다.
+ * @note   리셋/IDLE 진입 시 제어 ISR에서 호출되므로 나눗셈이나 필터 설계를 하지 않습니다.
+ * 관측기/PLL 이득, 정렬 증분, LPF 계수는 파라미터 세트(pCtrlParam)가 백그라운드에서 계산한 값을 사용합니다.
  * @param  MotorContorl 모터 물리 파라미터 구조체 포인터
  * @param  SObs 초기화할 속도/위치 관측기 구조체 포인터
  * @retval 없음
@@ -65,15 +78,23 @@ void vInitSpeedObserver(sMotorCtrl* MotorContorl, sSpeedObs* SObs){
 	SObs->fThetarAlignComp = 0.0f;
 	SObs->uAlignEnd = 0u;	/// Only uses Hall Sensor
 
-	SObs->fDelIdsrAlign = DEL_IDSR_REF_ALIGN * fTsamp;
-	SObs->fDelWrRefAlign = DEL_WR_REF_ALIGN * fTsamp;
-
 	SObs-> uHall_A = 0u;
 	SObs-> uHall_B = 0u;
 	SObs-> uHall_C = 0u;
 	SObs-> uHall_State = 0u;
 	SObs-> fThetar_Hall =0.0f;
 
+	SObs->uHall_PrevState = 0u;
+	SObs->iHallDir = 0;
+	SObs->uHallEdgeNum = 0u;
+	SObs->lHallEdgeCnt = 0ul;
+	SObs->lHallPeriodCnt = 0ul;
+	SObs->fThetarHallEdge = 0.0f;
+	SObs->fWrHallEdge = 0.0f;
+
+	SObs->uFlyResult = FLY_RESULT_NONE;
+	SObs->lFlyCnt = 0ul;
+
 	SObs->fSinThetarCC = 0.0f;
 	SObs->fCosThetarCC = 1.0f;
 	SObs->fSinThetarCompCC = 0.0f;
@@ -88,10 +109,6 @@ void vInitSpeedObserver(sMotorCtrl* MotorContorl, sSpeedObs* SObs){
 	SObs->fThetarEst = SObs->fThetarm;
 	SObs->fThetarmErr = 0.0f;
 
-	SObs->fInvJ = 1.0f / MotorContorl->JM;
-	SObs->fBperJ = MotorContorl->BM * SObs->fInvJ;
-	SObs->fInvPP = 1.0f / MotorContorl->PP;
-
 	SObs->fWrmEst = 0.0f;
 	SObs->fWrmEstLPF = 0.0f;
 	SObs->fWrEst = 0.0f;
@@ -108,16 +125,10 @@ void vInitSpeedObserver(sMotorCtrl* MotorContorl, sSpeedObs* SObs){
 
 	SObs->fEncScale = PI2 / (float)((ENCORDER_PPR * 4) - 1);
 
-	SObs->fK1 = WC_SO1 + 2 * ZETA_SO * WC_SO23 - SObs->fBperJ;
-	SObs->fK2Ts = fTsamp * (2 * WC_SO1 * ZETA_SO * WC_SO23 + WC_SO23 * WC_SO23 - SObs->fBperJ * SObs->fK1);
-	SObs->fK3Ts = fTsamp * (WC_SO1 * WC_SO23 * WC_SO23);
-
-	SObs-> fKpPLL = 2.0f * ZETA_PLL * WC_PLL;
-	SObs-> fKiPLL = WC_PLL * WC_PLL;
 	SObs-> fThetarmInteg = 0.0f;
 
-	initiateIIR2(&IIR2WrpmSCLPF, K_LPF, WC_WRPMSC_LPF, 0.707, fTsamp);
-	initiateIIR2(&IIR2WrmSCLPF, K_LPF, WC_WRM_LPF, 0.707, fTsamp);
+	presetIIR2(&IIR2WrpmSCLPF, 0.0f);	/* 계수는 vParamLoadFilter가 적재한 현재 세트 값 유지 */
+	presetIIR2(&IIR2WrmSCLPF, 0.0f);
 }
 
 /**
@@ -163,14 +174,14 @@ void vSpeedObserver(sMotorCtrl* MotorControl, sSpeedObs* SObs, sSpeedCtrl* SCtrl
 		vSlopeGenerator(&SObs->fWrpmRefIbyF, SCtrl-> fWrpmRefSet, SObs->fDelWrpmRefIbyF);    //fWrpmRefSet 으로 변경
 
 		SObs->fWrpmRefIbyF = LIMIT(SObs->fWrpmRefIbyF, 0.0f, 0.8f * MOT_WRPM_RATED);
-		SObs->fWrRefIbyF = SObs->fWrpmRefIbyF * RPM2RM * MotorControl->PP;
+		SObs->fWrRefIbyF = SObs->fWrpmRefIbyF * RPM2RM * pCtrlParam->fPP;
 
 
 		SObs->fThetarIbyF = BOUND_PI(SObs->fThetarIbyF + fTsamp * SObs->fWrRefIbyF);
 		SObs->fThetarCompIbyF = BOUND_PI(SObs->fThetarIbyF + 1.5f * fTsamp * SObs->fWrRefIbyF);
 
 		SObs->fWrCC = SObs->fWrRefIbyF;
-		SObs->fWrpmSC = SObs->fWrRefIbyF * RM2RPM * SObs->fInvPP;
+		SObs->fWrpmSC = SObs->fWrRefIbyF * RM2RPM * pCtrlParam->fInvPP;
 
 		vSinCos_Calculation(SObs->fThetarIbyF, &SObs->fCosThetarCC, &SObs->fSinThetarCC);
 		vSinCos_Calculation(SObs->fThetarCompIbyF, &SObs->fCosThetarCompCC, &SObs->fSinThetarCompCC);
@@ -180,16 +191,16 @@ void vSpeedObserver(sMotorCtrl* MotorControl, sSpeedObs* SObs, sSpeedCtrl* SCtrl
 	case SPDCONTL_MODE:
 		//		/* PLL: 위치 오차로 속도/각도 추정 */
 		SObs->fThetarErr = BOUND_PI(SObs->fThetar - SObs->fThetarEst);
-		SObs->fThetarInteg += fTsamp * SObs->fKiPLL * SObs->fThetarErr;
+		SObs->fThetarInteg += fTsamp * pCtrlParam->fKiPLL * SObs->fThetarErr;
 
-		SObs->fWrEst     = SObs->fKpPLL * SObs-> fThetarErr + SObs->fThetarInteg;
-		SObs->fWrpmEst = RM2RPM * SObs->fWrEst * SObs->fInvPP;
+		SObs->fWrEst     = pCtrlParam->fKpPLL * SObs-> fThetarErr + SObs->fThetarInteg;
+		SObs->fWrpmEst = RM2RPM * SObs->fWrEst * pCtrlParam->fInvPP;
 
 		SObs->fThetarEst += fTsamp * SObs->fWrEst;
 		SObs->fThetarEst = BOUND_PI(SObs->fThetarEst);
 
 		SObs->fWrpmEstLPF = IIR2Update(&IIR2WrpmSCLPF, SObs->fWrpmEst);
-		SObs->fWrCC = SObs->fWrpmEstLPF * MotorControl->PP * RPM2RM;
+		SObs->fWrCC = SObs->fWrpmEstLPF * pCtrlParam->fPP * RPM2RM;
 		SObs-> fWrpmSC = SObs->fWrpmEstLPF;
 
 		SObs->fThetarCC = SObs->fThetarEst;
@@ -217,6 +228,62 @@ uint8_t GetHallSensorState(GPIO_PinState hall_sensor_1, GPIO_PinState hall_senso
 	return hall_state;
 }
 
+/**
+ * @brief  홀 센서 상태 전환(에지) 간격을 측정하여 회전 방향과 전기각 속도를 추정합니다.
+ * @details
+ * - 매 제어 주기 호출되며, 상태 변화가 없으면 경과 주기 카운터만 증가시킵니다.
+ * - 에지 발생 시 이전/현재 전기각 차이의 부호로 방향을 판정하고, 60도 구간 통과 시간으로 속도를 계산합니다.
+ * - 홀 상태 값은 각 60도 구간의 중앙 각도이므로, 에지 시점의 실제 전기각은 두 값의 중간(구간 경계)입니다.
+ * - 직전 구간 시간의 2배 이상 에지가 없으면 감속/정지로 보고 추정치를 무효화합니다.
+ * @note   나눗셈은 에지 발생 시에만 수행되므로 고속 운전에서도 주기당 연산량은 거의 일정합니다.
+ * @param  SObs 속도 및 위치 관측기 구조체 포인터
+ * @param  fThetarHall 이번 주기에 읽은 홀 센서 전기각 [rad]
+ * @retval 없음
+ */
+static void vHallEdgeTiming(sSpeedObs* SObs, float fThetarHall){
+	float fDelThetar;
+	int16_t iDir;
+
+	SObs->lHallEdgeCnt++;
+
+	if(SObs->uHall_State != SObs->uHall_PrevState) {
+		/* 0, 7은 유효하지 않은 홀 조합 */
+		if((SObs->uHall_State != 0u) && (SObs->uHall_State != 7u) &&
+				(SObs->uHall_PrevState != 0u) && (SObs->uHall_PrevState != 7u)) {
+
+			fDelThetar = BOUND_PI(fThetarHall - SObs->fThetar_Hall);
+			iDir = (fDelThetar > 0.0f) ? 1 : -1;
+
+			if(ABS(fDelThetar) > 1.5f * PIBY3) {
+				/* 구간을 건너뛴 경우(노이즈 또는 결선 이상): 추정 재시작 */
+				SObs->iHallDir = 0;
+				SObs->uHallEdgeNum = 0u;
+			}
+			else if(iDir == SObs->iHallDir) {
+				if(SObs->uHallEdgeNum < 0xFFFFu) SObs->uHallEdgeNum++;
+			}
+			else {
+				SObs->iHallDir = iDir;
+				SObs->uHallEdgeNum = 1u;
+			}
+
+			SObs->lHallPeriodCnt = SObs->lHallEdgeCnt;
+			SObs->fThetarHallEdge = BOUND_PI(SObs->fThetar_Hall + 0.5f * fDelThetar);
+			SObs->fWrHallEdge = (float)SObs->iHallDir * PIBY3 / ((float)SObs->lHallPeriodCnt * fTsamp);
+		}
+		SObs->lHallEdgeCnt = 0ul;
+	}
+	else if((SObs->uHallEdgeNum != 0u) && (SObs->lHallEdgeCnt > (SObs->lHallPeriodCnt << 1))) {
+		/* 에지 간격이 직전 대비 2배 이상 길어짐: 감속 또는 정지 */
+		SObs->iHallDir = 0;
+		SObs->uHallEdgeNum = 0u;
+		SObs->fWrHallEdge = 0.0f;
+	}
+
+	SObs->uHall_PrevState = SObs->uHall_State;
+	SObs->fThetar_Hall = fThetarHall;
+}
+
 /**
  * @brief  홀 센서 상태를 기반으로 60도 간격의 회전자 전기각(전기적 위치)을 반환합니다.
  * @param  SObs 속도 및 위치 관측기 구조체 포인터 (핀 상태 저장용)
@@ -238,9 +305,81 @@ float fGetHallSensorInfo(sSpeedObs* SObs){
 	case 3: fThetar_HallSensor = -2.f * PIBY3; break;
 	case 2: fThetar_HallSensor = -PIBY3;      break;
 	}
+
+	vHallEdgeTiming(SObs, fThetar_HallSensor);
+
 	return fThetar_HallSensor;
 }
 
+/**
+ * @brief  회전 중인 회전자를 포착(Catch-on-the-fly)하여 RUN 진입을 위한 상태를 초기화합니다.
+ * @details FLYSTART_STATE에서 PWM을 끈 채 매 주기 호출됩니다.
+ * 1. 홀 에지 기반 속도/방향이 유효하고 FLY_WRPM_MIN 이상이면 회전자를 포착합니다.
+ * 2. 마지막 에지 시점의 경계 각도에 경과 시간만큼 속도를 적분하여 현재 전기각을 외삽합니다.
+ * 3. PLL 각도/적분기(속도), 속도 LPF 상태, 전류 제어용 Sin/Cos 값을 포착한 값으로 설정합니다.
+ * 4. 속도 지령 램프는 현재 속도에서 시작하고, 속도 제어기 적분기는 0 토크(관성 주행 상태)로 둡니다.
+ * 5. q축 전류 제어기 적분기에 역기전력(We · λf, 파라미터 세트)을 미리 넣어 PWM 인가 순간의 전류 충격을 방지합니다.
+ * 6. FLY_CNT_MAX 동안 조건을 만족하지 못하면 정지 상태로 판단하여 Align으로 넘깁니다.
+ * @param  MotorControl 모터 파라미터 구조체 포인터
+ * @param  CCtrl 전류 제어기 구조체 포인터
+ * @param  SObs 속도 및 위치 관측기 구조체 포인터
+ * @param  SCtrl 속도 제어기 구조체 포인터
+ * @retval 없음
+ */
+void vFlyingStart(sMotorCtrl* MotorControl, sCurrentCtrl* CCtrl, sSpeedObs* SObs, sSpeedCtrl* SCtrl){
+	float fWr, fWrpm, fThetar;
+
+	SObs->lFlyCnt++;
+	fWr = SObs->fWrHallEdge;
+	fWrpm = RM2RPM * fWr * pCtrlParam->fInvPP;
+
+	if((SObs->uHallEdgeNum >= FLY_EDGE_NUM_MIN) && (ABS(fWrpm) >= FLY_WRPM_MIN)) {
+		fThetar = BOUND_PI(SObs->fThetarHallEdge + fWr * fTsamp * (float)SObs->lHallEdgeCnt);
+
+		/* PLL 상태 초기화 (적분기 = 전기각 속도) */
+		SObs->fThetarEst = fThetar;
+		SObs->fThetarErr = 0.0f;
+		SObs->fThetarInteg = fWr;
+		SObs->fWrEst = fWr;
+		SObs->fWrpmEst = fWrpm;
+
+		presetIIR2(&IIR2WrpmSCLPF, fWrpm);
+		SObs->fWrpmEstLPF = fWrpm;
+		SObs->fWrpmSC = fWrpm;
+		SObs->fWrCC = fWr;
+
+		SObs->fThetarCC = fThetar;
+		SObs->fThetarCompCC = BOUND_PI(fThetar + 1.5f * fWr * fTsamp);
+		vSinCos_Calculation(SObs->fThetarCC, &SObs->fCosThetarCC, &SObs->fSinThetarCC);
+		vSinCos_Calculation(SObs->fThetarCompCC, &SObs->fCosThetarCompCC, &SObs->fSinThetarCompCC);
+
+		/* 속도 제어기: 현재 속도에서 램프 시작, 0 토크에서 시작 */
+		SCtrl->fWrpmRef = fWrpm;
+		SCtrl->fTeInteg = 0.0f;
+		SCtrl->fTeRefAW = 0.0f;
+		SCtrl->fTeRef = 0.0f;
+		SCtrl->fIqsrRefSC = 0.0f;
+
+		/* 전류 제어기: 역기전력만큼 q축 전압을 미리 인가 */
+		CCtrl->fIdsrInteg = 0.0f;
+		CCtrl->fIqsrInteg = fWr * pCtrlParam->fLamf;
+		CCtrl->fVdsrRef = 0.0f;
+		CCtrl->fVdsrOut = 0.0f;
+		CCtrl->fVqsrRef = CCtrl->fIqsrInteg;
+		CCtrl->fVqsrOut = CCtrl->fIqsrInteg;
+
+		SObs->uFlyResult = FLY_RESULT_CAUGHT;
+		SObs->lFlyCnt = 0ul;
+	}
+	else if(SObs->lFlyCnt >= FLY_CNT_MAX) {
+		SObs->uFlyResult = FLY_RESULT_ALIGN;
+		SObs->lFlyCnt = 0ul;
+	}
+	else {
+		SObs->uFlyResult = FLY_RESULT_NONE;
+	}
+}
+
 /**
  * @brief  홀 센서 기반의 초기 회전자 위치 정렬(Align) 시퀀스를 수행합니다.
  * @details D축 전류를 점진적으로 인가한 뒤, 모터를 미세하게 회전시켜
@@ -269,12 +408,12 @@ void vAlignHallSensor(sCurrentCtrl* CCtrl, sSpeedObs *SObs){
 		break;
 
 	case 1:	// Current Set
-		vSlopeGenerator(&SObs->fIdsrRefAlign, IDSR_REF_SET_ALIGN, SObs->fDelIdsrAlign);
+		vSlopeGenerator(&SObs->fIdsrRefAlign, IDSR_REF_SET_ALIGN, pCtrlParam->fDelIdsrAlign);
 		if(SObs->fIdsrRefAlign == IDSR_REF_SET_ALIGN) SObs->uAlignStep++;
 		break;
 
 	case 2:	// Speed Set
-		vSlopeGenerator(&SObs->fWrRefAlign, WR_REF_SET_ALIGN, SObs->fDelWrRefAlign);
+		vSlopeGenerator(&SObs->fWrRefAlign, WR_REF_SET_ALIGN, pCtrlParam->fDelWrRefAlign);
 
 		if((uPrev_Hall_State == 2u) && (uCurr_Hall_State == 6u)) {	// Find Theta to the uHall_State = 6 --> Next Step
 			SObs->uAlignStep++;
@@ -282,7 +421,7 @@ void vAlignHallSensor(sCurrentCtrl* CCtrl, sSpeedObs *SObs){
 		break;
 
 	case 3:	// Speed 0
-		vSlopeGenerator(&SObs->fWrRefAlign, 0.0f, 100.0f * SObs->fDelWrRefAlign);
+		vSlopeGenerator(&SObs->fWrRefAlign, 0.0f, 100.0f * pCtrlParam->fDelWrRefAlign);
 		if(SObs->fWrRefAlign == 0.0f) {
 			SObs->fThetarAlign = 0.0f;
 			SObs->uAlignStep++;
@@ -311,7 +450,7 @@ void vAlignHallSensor(sCurrentCtrl* CCtrl, sSpeedObs *SObs){
 		break;
 
 	case 6:	// Currnet 0
-		vSlopeGenerator(&SObs->fIdsrRefAlign, 0.0f, SObs->fDelIdsrAlign);
+		vSlopeGenerator(&SObs->fIdsrRefAlign, 0.0f, pCtrlParam->fDelIdsrAlign);
 		if(SObs->fIdsrRefAlign == 0.0f)
 			SObs->uAlignStep++;
 		break;
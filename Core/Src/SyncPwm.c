@@ -0,0 +1,169 @@
+/**
+ * @file    SyncPwm.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   고속 운전 영역에서 TIM1 캐리어를 전기 주파수의 정수배로 맞추는 동기 PWM 구현 소스 파일
+ *
+ * @details [동작 개요]
+ * 소형 RC 모터는 전기 주파수가 높아 20kHz 캐리어로는 전기 1주기당 수십 개의 펄스만 남습니다.
+ * 이때 비동기 샘플링은 저조파 및 맥놀이 전류를 만들므로, 펄스 비가 `SYNC_PULSE_RATIO_ON` 이하로
+ * 떨어지면 캐리어 주기를 `2π / (N · ωe)`로 바꾸어 샘플링 시점을 회전자 각도 격자(k · 2π/N)에 고정합니다.
+ *
+ * | 항목 | 내용 |
+ * | :--- | :--- |
+ * | **펄스 수 N** | 3의 홀수배 후보(uSyncPulseTable) 중 공칭 캐리어 주파수를 넘지 않는 최대값 |
+ * | **N 변경 시점** | 전기각 0 통과 시점(A상 구간 경계). 모든 N의 격자가 공유하는 위상이므로 잠금이 끊기지 않음 |
+ * | **위상 잠금** | 다음 샘플 예측 각도의 격자 오차를 SYNC_KP_PHASE 비율만큼 다음 주기 길이에서 보정 |
+ * | **주기 반영** | ARR 프리로드(ARPE) 사용. 이번 ISR에서 쓴 ARR/CCR은 다음 업데이트 이벤트에 함께 적용 |
+ *
+ * @details [가변 샘플링 주기 파이프라인]
+ * ISR k에서 기록한 ARR은 ISR k+1 ~ k+2 구간에 적용됩니다. 따라서 ISR k+1의 적분 연산(PLL, 전류 PI 등)이
+ * 사용할 `fTsamp`는 ISR k-1에서 기록된 주기(fTsampNext)이며, 이 값을 갱신 함수 말미에 넘겨줍니다.
+ * 전류 제어, 관측기, 지연 보상(1.5·Ts)은 모두 런타임에 `fTsamp`를 읽으므로 별도 수정 없이 가변 주기를 따릅니다.
+ *
+ * @note `vSyncPwmUpdate`는 `vVoltageModulationTIM`보다 먼저 호출해야 CCR이 새 ARR 기준으로 계산됩니다.
+ * @note 초기화 시 이산화된 필터 계수(속도 LPF 등)는 공칭 주기 기준이므로 동기 구간에서는 차단 주파수가 약간 낮아집니다.
+ */
+
+#include "GlobalVar.h"
+#include "UserMath.h"
+#include "MotorControl.h"
+#include "SyncPwm.h"
+
+/** @brief 동기 PWM 전역 객체 */
+sSyncPwm SyncPwm;
+
+/** @brief 동기 PWM 펄스 수 후보 (3상 대칭을 위해 3의 홀수배, 내림차순) */
+static const uint16_t uSyncPulseTable[SYNC_PULSE_TABLE_NUM] = {27u, 21u, 15u, 9u};
+
+/** @brief 펄스 수별 격자 각도 간격 (2π / N) [rad] */
+static const float fSyncDelThetaTable[SYNC_PULSE_TABLE_NUM] = {PI2 / 27.0f, PI2 / 21.0f, PI2 / 15.0f, PI2 / 9.0f};
+
+/** @brief 현재 펄스 수의 테이블 인덱스 */
+static uint16_t uSyncPulseIdx = 0u;
+
+/**
+ * @brief  펄스 비에 맞는 펄스 수 테이블 인덱스를 선택합니다.
+ * @param  fPulseRatio 공칭 캐리어 주파수 / 전기 주파수
+ * @retval 공칭 캐리어 주파수를 넘지 않는 최대 펄스 수의 인덱스
+ */
+static uint16_t uSelectPulseIdx(float fPulseRatio){
+	uint16_t i;
+	for(i = 0u; i < (SYNC_PULSE_TABLE_NUM - 1u); i++) {
+		if((float)uSyncPulseTable[i] <= fPulseRatio) break;
+	}
+	return i;
+}
+
+/**
+ * @brief  공칭 캐리어 주기를 저장하고 ARR 프리로드를 활성화합니다.
+ * @note   MX_TIM1_Init에서 fTsamp가 계산된 이후, TIM1 인터럽트를 시작하기 전에 호출해야 합니다.
+ * @param  htim PWM 타이머 핸들러
+ * @retval 없음
+ */
+void vInitSyncPwm(TIM_HandleTypeDef *htim){
+	SyncPwm.uEnable = 0u;
+	SyncPwm.uActive = 0u;
+	SyncPwm.uPulseNum = 0u;
+	SyncPwm.uPulseNumReq = 0u;
+
+	SyncPwm.ulArrNominal = htim->Instance->ARR;
+	SyncPwm.fTsampNominal = fTsamp;
+	SyncPwm.fTsampNext = fTsamp;
+	SyncPwm.fArrPerSec = (float)SyncPwm.ulArrNominal / fTsamp;
+
+	SyncPwm.fPulseRatio = 0.0f;
+	SyncPwm.fThetarPrev = 0.0f;
+	SyncPwm.fPhaseErr = 0.0f;
+
+	/* ARR 변경이 CCR과 같은 업데이트 이벤트에 반영되도록 프리로드 사용 */
+	htim->Instance->CR1 |= TIM_CR1_ARPE;
+}
+
+/**
+ * @brief  동기 PWM을 해제하고 공칭 캐리어 주기로 복귀합니다.
+ * @details 리셋, IDLE 진입 및 FAULT 상태에서 호출되어 다음 기동이 항상 공칭 주기에서 시작되도록 합니다.
+ * 리셋/IDLE 진입 시에는 vInitController보다 먼저 호출하여 초기화가 공칭 fTsamp를 사용하게 합니다.
+ * @param  htim PWM 타이머 핸들러
+ * @retval 없음
+ */
+void vSyncPwmReset(TIM_HandleTypeDef *htim){
+	SyncPwm.uActive = 0u;
+	SyncPwm.uPulseNum = 0u;
+	SyncPwm.uPulseNumReq = 0u;
+	SyncPwm.fPhaseErr = 0.0f;
+
+	htim->Instance->ARR = SyncPwm.ulArrNominal;
+	uMaxCountSampHalf = (uint16_t)((SyncPwm.ulArrNominal >> 1) + 1u);
+
+	fTsamp = SyncPwm.fTsampNominal;
+	SyncPwm.fTsampNext = SyncPwm.fTsampNominal;
+}
+
+/**
+ * @brief  전기 주파수에 맞추어 다음 캐리어 주기(ARR)와 fTsamp를 갱신합니다.
+ * @details
+ * 1. 공칭 캐리어 대비 펄스 비를 계산하고 히스테리시스를 적용하여 요청 펄스 수를 정합니다.
+ * 2. 전기각이 0을 지나는 구간 경계에서만 펄스 수(또는 동기/비동기 전환)를 적용합니다.
+ * 3. 동기 운전 중에는 다음 샘플 예측 각도의 격자 오차를 보정하도록 다음 주기 길이를 계산합니다.
+ * 4. ARR 프리로드 레지스터를 갱신하고, 다음 ISR이 사용할 fTsamp를 넘겨줍니다.
+ * @param  htim PWM 타이머 핸들러
+ * @param  SObs 속도 및 위치 관측기 구조체 포인터
+ * @retval 없음
+ */
+void vSyncPwmUpdate(TIM_HandleTypeDef *htim, sSpeedObs* SObs){
+	float fWrAbs, fTperiodNow, fTsampNew, fThetarNext, fDelTheta, fGridIdx;
+	uint16_t uReqIdx = uSyncPulseIdx;
+	uint32_t ulArr;
+
+	fWrAbs = ABS(SObs->fWrCC);
+	fTperiodNow = SyncPwm.fTsampNext;
+
+	/* 1. 펄스 비 및 요청 펄스 수 결정 */
+	SyncPwm.fPulseRatio = (fWrAbs > PI2) ? (PI2 / (fWrAbs * SyncPwm.fTsampNominal)) : 1.0e6f;
+
+	if(!SyncPwm.uEnable) {
+		SyncPwm.uPulseNumReq = 0u;
+	}
+	else if((SyncPwm.uActive ? SYNC_PULSE_RATIO_OFF : SYNC_PULSE_RATIO_ON) < SyncPwm.fPulseRatio) {
+		SyncPwm.uPulseNumReq = 0u;
+	}
+	else {
+		uReqIdx = uSelectPulseIdx(SyncPwm.fPulseRatio);
+		SyncPwm.uPulseNumReq = uSyncPulseTable[uReqIdx];
+	}
+
+	/* 2. 구간 경계(전기각 0 통과)에서만 펄스 수 변경 */
+	if((SyncPwm.uPulseNumReq != SyncPwm.uPulseNum) &&
+			((SyncPwm.fThetarPrev * SObs->fThetarCC) <= 0.0f) && (ABS(SyncPwm.fThetarPrev) < PIBY3)) {
+		SyncPwm.uPulseNum = SyncPwm.uPulseNumReq;
+		SyncPwm.uActive = (SyncPwm.uPulseNum != 0u) ? 1u : 0u;
+		uSyncPulseIdx = uReqIdx;
+	}
+	SyncPwm.fThetarPrev = SObs->fThetarCC;
+
+	/* 3. 다음 캐리어 주기 계산 */
+	if(SyncPwm.uActive) {
+		fDelTheta = fSyncDelThetaTable[uSyncPulseIdx];
+
+		/* 다음 ISR 시점의 예측 전기각과 가장 가까운 격자점 사이의 오차 (회전 방향 기준) */
+		fThetarNext = BOUND_PI(SObs->fThetarCC + SObs->fWrCC * fTperiodNow);
+		fGridIdx = fThetarNext / fDelTheta;
+		fGridIdx = (float)(int32_t)(fGridIdx + ((fGridIdx >= 0.0f) ? 0.5f : -0.5f));
+		SyncPwm.fPhaseErr = (float)SIGN(SObs->fWrCC) * (fThetarNext - fDelTheta * fGridIdx);
+
+		fTsampNew = (fDelTheta - SYNC_KP_PHASE * SyncPwm.fPhaseErr) / fWrAbs;
+		fTsampNew = LIMIT(fTsampNew, SYNC_TSAMP_MIN_RATIO * SyncPwm.fTsampNominal, 65535.0f / SyncPwm.fArrPerSec);
+	}
+	else {
+		fTsampNew = SyncPwm.fTsampNominal;
+	}
+
+	/* 4. ARR 반영 (정수화된 실제 주기로 재계산) */
+	ulArr = (uint32_t)(fTsampNew * SyncPwm.fArrPerSec + 0.5f);
+	htim->Instance->ARR = ulArr;
+	uMaxCountSampHalf = (uint16_t)((ulArr >> 1) + 1u);
+
+	fTsamp = fTperiodNow;
+	SyncPwm.fTsampNext = (float)ulArr / SyncPwm.fArrPerSec;
+}
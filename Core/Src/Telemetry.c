@@ -0,0 +1,295 @@
+/**
+ * @file    Telemetry.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   제어 주기 단위 바이너리 텔레메트리 스트림(USART1 + DMA) 구현 소스 파일
+ *
+ * @details [고정 형식 모드 (TELEM_MODE_RAW)]
+ * | 단계 | 동작 |
+ * | :--- | :--- |
+ * | **1. 기록 (ISR)** | 채널 샘플을 TelemBuf[uWrBuf]의 다음 프레임 위치에 직접 기록하고 CRC를 채움 (추가 복사 없음) |
+ * | **2. 버퍼 완료** | TELEM_FRAME_NUM 프레임이 차면 해당 버퍼 전체를 DMA 송신 시작 후 다른 버퍼로 전환 |
+ * | **3. 링크 지연** | 다른 버퍼가 아직 송신 중이면 현재 버퍼를 버리고 같은 버퍼에 다시 기록 (ulDropCnt 증가) |
+ *
+ * 버려진 구간은 수신측에서 uSeq 불연속으로 검출됩니다. 송신 중인 버퍼에는 절대 기록하지 않으므로
+ * 프레임이 중간에 덮어써지는 일은 없습니다.
+ *
+ * @details [차분 압축 모드 (TELEM_MODE_DELTA)]
+ * | 단계 | 실행 위치 | 동작 |
+ * | :--- | :--- | :--- |
+ * | **1. 원시 기록** | 제어 ISR | 16비트 샘플만 링 버퍼(TelemRaw)에 기록. 블록 시작 시 여유가 없으면 블록 전체를 버림 |
+ * | **2. 압축** | 메인 루프 (vTelemTask) | 완성된 블록을 1차/2차 차분 + ZigZag + 고정 폭 비트 패킹으로 기록 버퍼에 추가 |
+ * | **3. 송신** | 메인 루프 (vTelemTask) | DMA가 유휴이면 쌓인 바이트를 송신 시작하고 다른 버퍼로 전환 |
+ *
+ * 블록 단위로만 버리므로 링 버퍼의 블록은 항상 연속 샘플이며, 블록 순번은 TelemRawSeq에 보관합니다.
+ * 압축은 블록당 고정 횟수의 연산(채널 × 블록 길이)만 수행하고, 호출당 TELEM_TASK_BLOCK_MAX 블록으로 제한합니다.
+ *
+ * @details [실행 비용]
+ * 고정 형식 모드: 채널당 iPackDataChannel 1회와 12byte CRC 테이블 연산, DMA 시작은 버퍼당 1회(레지스터 4개).
+ * 압축 모드 ISR: 채널당 iPackDataChannel 1회와 링 버퍼 저장.
+ */
+
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "Uart.h"
+#include "VarTable.h"
+#include "Telemetry.h"
+
+/** @brief CRC 계산 구간 길이 (uSeq ~ iCh[]) [byte] */
+#define TELEM_CRC_LEN       ((uint16_t)(sizeof(uint16_t) * (1u + TELEM_CH_NUM)))
+
+/** @brief 송신 버퍼(반쪽) 크기 [byte] */
+#define TELEM_TXBUF_SIZE    (TELEM_FRAME_NUM * sizeof(sTelemFrame))
+
+/** @brief 압축 블록 헤더 길이 (동기 워드 ~ 페이로드 길이) [byte] */
+#define TELEM_DELTA_HDR_LEN 8u
+
+/**
+ * @struct sBitWriter
+ * @brief  LSB 우선 비트 패킹 상태
+ */
+typedef struct {
+	uint8_t* pDst;              /**< 출력 버퍼 */
+	uint32_t ulAcc;             /**< 아직 출력하지 않은 비트 */
+	uint16_t uBits;             /**< ulAcc의 유효 비트 수 (< 8) */
+	uint16_t uLen;              /**< 출력한 바이트 수 */
+} sBitWriter;
+
+/** @brief 텔레메트리 객체 */
+sTelem Telem;
+
+/** @brief 텔레메트리 채널 디스크립터 */
+sDataChannel TelemCh[TELEM_CH_NUM];
+
+/** @brief 텔레메트리 더블 버퍼 (고정 형식 프레임 또는 압축 블록 바이트열) */
+static union {
+	sTelemFrame Frame[2][TELEM_FRAME_NUM];
+	uint8_t uByte[2][TELEM_TXBUF_SIZE];
+} TelemBuf;
+
+/** @brief 압축 모드 원시 샘플 링 버퍼 [샘플][채널] */
+static int16_t TelemRaw[TELEM_RAW_DEPTH][TELEM_CH_NUM];
+
+/** @brief 압축 모드 링 버퍼 블록별 첫 샘플 순번 */
+static uint16_t TelemRawSeq[TELEM_RAW_BLOCK_NUM];
+
+/* 압축 블록 최대 크기가 송신 버퍼에 들어가야 함 */
+typedef char TelemDeltaFrameFits[(TELEM_DELTA_FRAME_MAX <= TELEM_TXBUF_SIZE) ? 1 : -1];
+
+/**
+ * @brief  값의 하위 uNum 비트를 출력 버퍼에 추가합니다.
+ * @param  pBw 비트 패킹 상태
+ * @param  ulVal 값
+ * @param  uNum 비트 수 (0 ~ 24)
+ * @retval 없음
+ */
+static inline void vPutBits(sBitWriter* pBw, uint32_t ulVal, uint16_t uNum){
+	if(uNum == 0u) return;
+
+	pBw->ulAcc |= (ulVal & ((1UL << uNum) - 1UL)) << pBw->uBits;
+	pBw->uBits += uNum;
+	while(pBw->uBits >= 8u) {
+		pBw->pDst[pBw->uLen++] = (uint8_t)pBw->ulAcc;
+		pBw->ulAcc >>= 8;
+		pBw->uBits -= 8u;
+	}
+}
+
+/**
+ * @brief  16비트 값을 리틀 엔디안으로 기록합니다.
+ * @param  pDst 출력 위치
+ * @param  uVal 값
+ * @retval 없음
+ */
+static inline void vPutU16(uint8_t* pDst, uint16_t uVal){
+	pDst[0] = (uint8_t)uVal;
+	pDst[1] = (uint8_t)(uVal >> 8);
+}
+
+/**
+ * @brief  링 버퍼의 블록 1개를 압축하여 기록합니다.
+ * @param  pDst 출력 위치 (TELEM_DELTA_FRAME_MAX 이상 여유 필요)
+ * @param  uRd 블록 첫 샘플의 링 버퍼 판독 카운터
+ * @retval 기록한 바이트 수
+ */
+static uint16_t uTelemEncodeBlock(uint8_t* pDst, uint16_t uRd){
+	uint32_t ulRes[TELEM_BLOCK_LEN];
+	sBitWriter Bw = {&pDst[TELEM_DELTA_HDR_LEN], 0ul, 0u, 0u};
+	int32_t lX, lX1, lX2, lRes;
+	uint32_t ulMax;
+	uint16_t uCh, k, uWidth, uOrder2;
+
+	for(uCh = 0u; uCh < TELEM_CH_NUM; uCh++) {
+		uOrder2 = (Telem.uOrderMask >> uCh) & 1u;
+		lX1 = TelemRaw[uRd & TELEM_RAW_MASK][uCh];
+		lX2 = lX1;
+		ulMax = 0ul;
+
+		for(k = 1u; k < TELEM_BLOCK_LEN; k++) {
+			lX = TelemRaw[(uint16_t)(uRd + k) & TELEM_RAW_MASK][uCh];
+			lRes = (uOrder2 && (k >= 2u)) ? (lX - (2 * lX1 - lX2)) : (lX - lX1);
+			ulRes[k] = ((uint32_t)lRes << 1) ^ (uint32_t)(lRes >> 31);
+			ulMax |= ulRes[k];
+			lX2 = lX1;
+			lX1 = lX;
+		}
+
+		uWidth = (uint16_t)(32u - __CLZ(ulMax));
+		vPutBits(&Bw, uWidth, 5u);
+		vPutBits(&Bw, (uint16_t)TelemRaw[uRd & TELEM_RAW_MASK][uCh], 16u);
+		for(k = 1u; k < TELEM_BLOCK_LEN; k++) {
+			vPutBits(&Bw, ulRes[k], uWidth);
+		}
+	}
+	vPutBits(&Bw, 0ul, (uint16_t)((8u - Bw.uBits) & 7u));
+
+	vPutU16(&pDst[0], TELEM_SYNC_DELTA);
+	vPutU16(&pDst[2], TelemRawSeq[(uRd / TELEM_BLOCK_LEN) % TELEM_RAW_BLOCK_NUM]);
+	pDst[4] = (uint8_t)TELEM_BLOCK_LEN;
+	pDst[5] = (uint8_t)Telem.uOrderMask;
+	vPutU16(&pDst[6], Bw.uLen);
+	vPutU16(&pDst[TELEM_DELTA_HDR_LEN + Bw.uLen],
+			uCrc16(CRC16_INIT, &pDst[2], (uint16_t)(TELEM_DELTA_HDR_LEN - 2u + Bw.uLen)));
+
+	return (uint16_t)(TELEM_DELTA_HDR_LEN + Bw.uLen + 2u);
+}
+
+/**
+ * @brief  기본 채널로 초기화하고 송신을 시작합니다.
+ * @details 기본 채널: q축 전류, q축 전류 지령, 추정 속도, DC 링크 전압.
+ * 압축 모드 예측 차수는 전류/속도 채널 2차, 전압 채널 1차입니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitTelemetry(void){
+	(void)uTelemSelect(0u, VAR_ID_CC_IQSR);
+	(void)uTelemSelect(1u, VAR_ID_CC_IQSR_REF);
+	(void)uTelemSelect(2u, VAR_ID_SO_WRPM_SC);
+	(void)uTelemSelect(3u, VAR_ID_VDC);
+
+	Telem.uDecim = 1u;
+	Telem.uOrderMask = 0x07u;
+	Telem.uSeq = 0u;
+	Telem.uWrBuf = 0u;
+	Telem.ulTxCnt = 0ul;
+	Telem.ulDropCnt = 0ul;
+	(void)uTelemSetMode(TELEM_MODE_RAW);
+}
+
+/**
+ * @brief  변수 레지스트리 ID로 텔레메트리 채널을 지정합니다. (기본 스케일 사용)
+ * @param  uCh 채널 (0 ~ TELEM_CH_NUM-1)
+ * @param  uId 변수 ID (VAR_ID_*)
+ * @retval 1: 성공, 0: 잘못된 채널 또는 ID
+ */
+uint16_t uTelemSelect(uint16_t uCh, uint16_t uId){
+	if(uCh >= TELEM_CH_NUM) return 0u;
+	return uVarChannel(uId, &TelemCh[uCh]);
+}
+
+/**
+ * @brief  송신 모드를 변경하고 버퍼를 초기화합니다. (메인 루프 또는 통신 처리에서 호출)
+ * @details 기록을 멈춘 상태에서 기록 위치만 초기화합니다. 송신 중일 수 있는 버퍼는 uWrBuf의 반대편이므로 건드리지 않습니다.
+ * @param  uMode 송신 모드 (TELEM_MODE_*)
+ * @retval 1: 성공, 0: 잘못된 모드
+ */
+uint16_t uTelemSetMode(uint16_t uMode){
+	if(uMode > TELEM_MODE_DELTA) return 0u;
+
+	Telem.uEnable = 0u;
+
+	Telem.uMode = uMode;
+	Telem.uDecimCnt = 0u;
+	Telem.uWrIdx = 0u;
+	Telem.uTxLen = 0u;
+	Telem.uBlkCnt = 0u;
+	Telem.uRawSkip = 0u;
+	Telem.uRawRd = Telem.uRawWr;
+	Telem.ulRawBytes = 0ul;
+	Telem.ulCompBytes = 0ul;
+
+	Telem.uEnable = 1u;
+	return 1u;
+}
+
+/**
+ * @brief  제어 주기마다 호출되어 프레임(또는 원시 샘플)을 기록하고, 가득 찬 버퍼를 DMA로 송신합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vTelemRecord(void){
+	sTelemFrame* pFrame;
+	int16_t* piRaw;
+	uint16_t i;
+
+	if(!Telem.uEnable) return;
+	if(++Telem.uDecimCnt < Telem.uDecim) return;
+	Telem.uDecimCnt = 0u;
+
+	if(Telem.uMode == TELEM_MODE_DELTA) {
+		if(Telem.uBlkCnt == 0u) {
+			Telem.uRawSkip = ((uint16_t)(Telem.uRawWr - Telem.uRawRd) > (TELEM_RAW_DEPTH - TELEM_BLOCK_LEN)) ? 1u : 0u;
+			if(Telem.uRawSkip)	Telem.ulDropCnt += TELEM_BLOCK_LEN;
+			else				TelemRawSeq[(Telem.uRawWr / TELEM_BLOCK_LEN) % TELEM_RAW_BLOCK_NUM] = Telem.uSeq;
+		}
+		if(!Telem.uRawSkip) {
+			piRaw = TelemRaw[Telem.uRawWr & TELEM_RAW_MASK];
+			for(i = 0u; i < TELEM_CH_NUM; i++) {
+				piRaw[i] = iPackDataChannel(&TelemCh[i]);
+			}
+			Telem.uRawWr++;
+		}
+		Telem.uSeq++;
+		if(++Telem.uBlkCnt >= TELEM_BLOCK_LEN) Telem.uBlkCnt = 0u;
+		return;
+	}
+
+	pFrame = &TelemBuf.Frame[Telem.uWrBuf][Telem.uWrIdx];
+	pFrame->uSync = TELEM_SYNC;
+	pFrame->uSeq = Telem.uSeq++;
+	for(i = 0u; i < TELEM_CH_NUM; i++) {
+		pFrame->iCh[i] = iPackDataChannel(&TelemCh[i]);
+	}
+	pFrame->uCrc = uCrc16(CRC16_INIT, &pFrame->uSeq, TELEM_CRC_LEN);
+
+	if(++Telem.uWrIdx < TELEM_FRAME_NUM) return;
+	Telem.uWrIdx = 0u;
+
+	if(uUartTxStart(TelemBuf.Frame[Telem.uWrBuf], (uint16_t)sizeof(TelemBuf.Frame[0]))) {
+		Telem.uWrBuf ^= 1u;
+		Telem.ulTxCnt++;
+	}
+	else {
+		Telem.ulDropCnt += TELEM_FRAME_NUM;
+	}
+}
+
+/**
+ * @brief  메인 루프에서 호출되어 원시 샘플을 블록 단위로 압축하고 송신합니다.
+ * @details 호출당 최대 TELEM_TASK_BLOCK_MAX 블록을 압축하며, 기록 버퍼에 최대 블록 크기만큼의 여유가 없으면
+ * 다음 호출로 미룹니다 (링 버퍼가 그동안의 샘플을 보관).
+ * @param  없음
+ * @retval 없음
+ */
+void vTelemTask(void){
+	uint16_t uBlk, uLen;
+
+	if(!Telem.uEnable || (Telem.uMode != TELEM_MODE_DELTA)) return;
+
+	for(uBlk = 0u; uBlk < TELEM_TASK_BLOCK_MAX; uBlk++) {
+		if((uint16_t)(Telem.uRawWr - Telem.uRawRd) < TELEM_BLOCK_LEN) break;
+		if((Telem.uTxLen + TELEM_DELTA_FRAME_MAX) > TELEM_TXBUF_SIZE) break;
+
+		uLen = uTelemEncodeBlock(&TelemBuf.uByte[Telem.uWrBuf][Telem.uTxLen], Telem.uRawRd);
+		Telem.uTxLen += uLen;
+		Telem.uRawRd += TELEM_BLOCK_LEN;
+		Telem.ulRawBytes += TELEM_BLOCK_LEN * sizeof(sTelemFrame);
+		Telem.ulCompBytes += uLen;
+	}
+
+	if((Telem.uTxLen != 0u) && uUartTxStart(TelemBuf.uByte[Telem.uWrBuf], Telem.uTxLen)) {
+		Telem.uWrBuf ^= 1u;
+		Telem.uTxLen = 0u;
+		Telem.ulTxCnt++;
+	}
+}
@@ -0,0 +1,70 @@
+/**
+ * @file    Thermal.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   권선/MOSFET 열 모델(I²t 과부하) 기반 피크 전류 허용 및 디레이팅 구현 소스 파일
+ * @details 제어 ISR이 계산한 dq 전류와 직류단 전압만 읽습니다. 권선 모델은 파라미터 세트의 1/Is,cont²와 Ts/τw로
+ * 곱셈만 사용하고, 스위칭 손실용 제곱근과 스위칭 주파수 역수 계산이 주기당 한 번씩 있습니다.
+ */
+
+#include "GlobalVar.h"
+#include "math.h"
+#include "MotorControl.h"
+#include "UserMath.h"
+#include "Param.h"
+#include "EscTelem.h"
+#include "Thermal.h"
+
+/** @brief 열 모델 객체 */
+sThermal Thermal;
+
+/**
+ * @brief  열 상태를 냉간(주위 온도)으로 초기화합니다.
+ * @retval 없음
+ */
+void vInitThermal(void){
+	Thermal.fIs2 = 0.0f;
+	Thermal.fThWind = 0.0f;
+	Thermal.fPfet = 0.0f;
+	Thermal.fTamb = THERM_TAMB_DEFAULT;
+	Thermal.fDtCa = 0.0f;
+	Thermal.fDtJc = 0.0f;
+	Thermal.fTj = THERM_TAMB_DEFAULT;
+	Thermal.fIsWind = pCtrlParam->fIsPeak;
+	Thermal.fIsFet = pCtrlParam->fIsPeak;
+	Thermal.fIsAllow = pCtrlParam->fIsPeak;
+	Thermal.uDerate = 0u;
+	Thermal.ulDerateCnt = 0u;
+}
+
+/**
+ * @brief  열 모델을 적분하고 허용 전류를 갱신합니다.
+ * @retval 없음
+ */
+void vThermalUpdate(void){
+	float fIsCont = pCtrlParam->fIsCont, fIsBoost = pCtrlParam->fIsPeak - pCtrlParam->fIsCont;
+	float fIs, fFsw, fK;
+
+	/* 1. 권선: I²t 1차 모델 (정규화 열 상태) */
+	Thermal.fIs2 = INV.CC.fIdsr * INV.CC.fIdsr + INV.CC.fIqsr * INV.CC.fIqsr;
+	Thermal.fThWind += pCtrlParam->fKThWind * (Thermal.fIs2 * pCtrlParam->fInvIsCont2 - Thermal.fThWind);
+
+	/* 2. MOSFET: 도통 + 스위칭 손실, 접합-케이스/방열판-주위 2차 모델 */
+	fIs = sqrtf(Thermal.fIs2);
+	fFsw = (fTsamp > 0.0f) ? (1.0f / fTsamp) : 0.0f;
+	Thermal.fPfet = 1.5f * Thermal.fIs2 * THERM_FET_RDS + THERM_SW_FACTOR * fVdc * fIs * THERM_FET_TSW * fFsw;
+	if(EscTelem.uReady != 0u) Thermal.fTamb = EscTelem.fTempC;
+	Thermal.fDtCa += (THERM_TS / THERM_TAU_CA) * (Thermal.fPfet * THERM_RTH_CA - Thermal.fDtCa);
+	Thermal.fDtJc += (THERM_TS / THERM_TAU_JC) * (Thermal.fPfet * (THERM_RTH_JC / 6.0f) - Thermal.fDtJc);
+	Thermal.fTj = Thermal.fTamb + Thermal.fDtCa + Thermal.fDtJc;
+
+	/* 3. 디레이팅: 시작점 이하 피크, 한계점 이상 연속 정격 (사이 선형) */
+	fK = LIMIT((1.0f - Thermal.fThWind) * (1.0f / (1.0f - THERM_WIND_DERATE)), 0.0f, 1.0f);
+	Thermal.fIsWind = fIsCont + fIsBoost * fK;
+	fK = LIMIT((THERM_TJ_MAX - Thermal.fTj) * (1.0f / (THERM_TJ_MAX - THERM_TJ_DERATE)), 0.0f, 1.0f);
+	Thermal.fIsFet = fIsCont + fIsBoost * fK;
+
+	Thermal.fIsAllow = MIN(Thermal.fIsWind, Thermal.fIsFet);
+	Thermal.uDerate = (Thermal.fIsAllow < pCtrlParam->fIsPeak) ? 1u : 0u;
+	Thermal.ulDerateCnt += Thermal.uDerate;
+}
@@ -0,0 +1,540 @@
+/**
+ * @file    Throttle.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   RC PWM/DShot 스로틀 입력 처리 구현 소스 파일
+ *
+ * @details [자원 할당]
+ * | 자원 | 설정 |
+ * | :--- | :--- |
+ * | **PB2** | TIM5_CH1 (MX_TIM5_Init, 풀다운) |
+ * | **TIM5** | 상승 에지에서 카운터 리셋 (Slave Reset), CCR1 = 주기, CCR2 = High 시간. PWM: 1MHz, ARR 0xFFFF / DShot: 170MHz, ARR 0xFFFFFFFF |
+ * | **DMA1_CH6** | DMAMUX1_Channel5 = TIM5_CH2, Circular 모드. PWM: CCR2 → ThrRing (32 → 16bit) / DShot: DMAR Burst(CCR1, CCR2) → ThrDshotRing (32bit) |
+ * | **TIM5 CC4** | 양방향 DShot: 프레임 끝 + THR_BDSHOT_PREP_US 비교 인터럽트 (우선순위 1, 마지막 프레임 확인 후 응답 준비) |
+ * | **TIM5 CC3** | 양방향 DShot: 프레임 끝 + THR_BDSHOT_TURN_US 비교 DMA 요청 (준비된 경우에만 CC3DE, 응답 송신 시작) |
+ * | **DMA1_CH8** | DMAMUX1_Channel7 = TIM5_CH3, ulThrTim6Start → TIM6->CR1, 32bit, 1워드, Normal 모드 |
+ * | **TIM6** | 양방향 DShot: eRPM 응답 비트 주기 (170MHz, DShot 비트율 × 5/4), 업데이트 DMA 요청 |
+ * | **DMA1_CH7** | DMAMUX1_Channel6 = TIM6_UP, ThrTxBuf → GPIOB->BSRR, 32bit, Normal 모드, 전송 완료 인터럽트 (우선순위 1) |
+ *
+ * 하강 에지마다 DMA가 캡처값을 링 버퍼에 기록하므로 캡처 인터럽트가 없습니다.
+ * 제어 ISR은 CNDTR로 기록 위치를 계산하여 새 샘플만 처리하고, 새 샘플이 없는 주기에는 끊김 시간만 누적합니다.
+ * 곡선 테이블은 메인 루프에서만 다시 만들며, 그동안 출력은 THR_OUT_OFF로 두어 ISR이 테이블을 읽지 않게 합니다.
+ */
+
+#include "main.h"
+#include "GlobalVar.h"
+#include "UserMath.h"
+#include "MotorControl.h"
+#include "Param.h"
+#include "Throttle.h"
+#include "RcRx.h"
+#include "Command.h"
+
+/** @name PB2 제어
+ * @{ */
+#define THR_PIN_HIGH        GPIO_BSRR_BS2                                   /**< BSRR: High */
+#define THR_PIN_LOW         GPIO_BSRR_BR2                                   /**< BSRR: Low */
+#define THR_MODER_MASK      GPIO_MODER_MODE2                                /**< MODER 필드 */
+#define THR_MODER_OUT       GPIO_MODER_MODE2_0                              /**< 범용 출력 */
+#define THR_MODER_AF        GPIO_MODER_MODE2_1                              /**< 대체 기능 (TIM5_CH1) */
+/** @} */
+
+/** @brief 스로틀 객체 */
+sThrottle Throttle;
+
+/** @brief 펄스폭 캡처 링 버퍼 (DMA1_CH6 기록) */
+static volatile uint16_t ThrRing[THR_RING_SIZE];
+/** @brief DShot (주기, High 시간) 쌍 캡처 링 버퍼 (DMA1_CH6 Burst 기록) */
+static volatile uint32_t ThrDshotRing[THR_DSHOT_RING_SIZE];
+/** @brief eRPM 응답 BSRR 워드 (TIM5 인터럽트가 채우고 DMA1_CH7이 읽음) */
+static uint32_t ThrTxBuf[THR_BDSHOT_TX_LEN];
+/** @brief TIM5 CC3 DMA 요청이 TIM6->CR1에 쓰는 값 (응답 비트 타이머 시작) */
+static const uint32_t ulThrTim6Start = TIM_CR1_CEN;
+/** @brief 캡처 모드 SMCR (응답 송신 중 Slave Reset을 끄고 완료 후 복원) */
+static uint32_t ulThrSmcr;
+/** @brief 캡처 틱 → µs 환산 계수 */
+static float fThrTickUs = 1.0f;
+/** @brief Expo 곡선 테이블 (입력 0 ~ 1 등간격) */
+static float fThrLut[THR_LUT_NUM];
+
+/**
+ * @brief  기본 보정값으로 초기화하고 TIM5 CCR2 → DMA1_CH6 캡처를 시작합니다.
+ * @retval 없음
+ */
+void vInitThrottle(void){
+	Throttle.uOutMode = THR_OUT_OFF;
+	Throttle.uBidir = 0u;
+	Throttle.fMinUs = THR_MIN_US;
+	Throttle.fCenterUs = THR_CENTER_US;
+	Throttle.fMaxUs = THR_MAX_US;
+	Throttle.fDeadband = THR_DEADBAND;
+	Throttle.fExpo = THR_EXPO;
+	Throttle.fAlpha = THR_ALPHA;
+
+	Throttle.uMed[0] = Throttle.uMed[1] = Throttle.uMed[2] = (uint16_t)THR_MIN_US;
+	Throttle.uPeriodUs = 0u;
+	Throttle.uDshotValue = 0u;
+	Throttle.uDshotCmd = 0u;
+	Throttle.fPulseUs = THR_MIN_US;
+	Throttle.fLatencyUs = 0.0f;
+	Throttle.fLatencyMaxUs = 0.0f;
+	Throttle.ulSampleCnt = 0u;
+	Throttle.ulRejectCnt = 0u;
+	Throttle.ulFailsafeCnt = 0u;
+
+	vThrModeInit(&Throttle.Mode);
+	vThrottleBuildLut();
+	vThrottleSetInput(THR_INPUT_DEFAULT);
+}
+
+/**
+ * @brief  입력 방식을 바꾸고 TIM5 분주/DMA를 다시 설정합니다.
+ * @param  uInput 입력 방식 (THR_INPUT_*)
+ * @retval 없음
+ */
+void vThrottleSetInput(uint16_t uInput){
+	uint32_t ulBps;
+
+	if(uInput > THR_INPUT_SERIAL) return;
+
+	Throttle.uReady = 0u;
+	__DSB();
+
+	TIM5->CR1 &= ~TIM_CR1_CEN;
+	TIM5->DIER = 0u;
+	DMA1_Channel6->CCR = 0u;
+	DMAMUX1_Channel5->CCR = DMA_REQUEST_TIM5_CH2;
+
+	/* 송신 중이었으면 중단하고 캡처 입력으로 복귀 */
+	TIM6->CR1 = 0u;
+	DMA1_Channel7->CCR = 0u;
+	DMA1_Channel8->CCR = 0u;
+	GPIOB->MODER = (GPIOB->MODER & ~THR_MODER_MASK) | THR_MODER_AF;
+	if(ulThrSmcr != 0u) TIM5->SMCR = ulThrSmcr;
+	ulThrSmcr = TIM5->SMCR;
+	Throttle.uTelemArm = 0u;
+
+	/* 양방향 DShot은 반전 신호: 하강 에지에서 리셋/주기, 상승 에지에서 Low 시간 캡처, Idle High 풀업 */
+	TIM5->CCER &= ~(TIM_CCER_CC1E | TIM_CCER_CC2E | TIM_CCER_CC1P | TIM_CCER_CC2P);
+	if(THR_IS_DSHOT(uInput) && Throttle.uDshotTelem != 0u){
+		TIM5->CCER |= TIM_CCER_CC1P;
+		GPIOB->PUPDR = (GPIOB->PUPDR & ~GPIO_PUPDR_PUPD2) | GPIO_PUPDR_PUPD2_0;
+	}
+	else {
+		TIM5->CCER |= TIM_CCER_CC2P;
+		GPIOB->PUPDR = (GPIOB->PUPDR & ~GPIO_PUPDR_PUPD2) | GPIO_PUPDR_PUPD2_1;
+	}
+
+	Throttle.uInput = uInput;
+	Throttle.uRd = 0u;
+	Throttle.uFailsafe = 1u;        /* 시작 또는 입력 변경 시 스로틀을 0으로 내려야 무장 */
+	Throttle.uArmCnt = 0u;
+	Throttle.fLossTime = 0.0f;
+	Throttle.fOut = 0.0f;
+	vThrModeReset(&Throttle.Mode);
+
+	if(!THR_IS_DSHOT(uInput)){
+		TIM5->PSC = (THR_TIM_CLK / 1000000u) - 1u;
+		TIM5->ARR = 0xFFFFu;
+		TIM5->DCR = 0u;
+		fThrTickUs = 1.0f;
+
+		DMA1_Channel6->CPAR = (uint32_t)&TIM5->CCR2;
+		DMA1_Channel6->CMAR = (uint32_t)ThrRing;
+		DMA1_Channel6->CNDTR = THR_RING_SIZE;
+		DMA1_Channel6->CCR = DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_0 | DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_EN;
+	}
+	else {
+		/* DShot150 × 1/2/4 */
+		ulBps = THR_DSHOT_BASE_BPS << (uInput - THR_INPUT_DSHOT150);
+		vDshotDecInit(&Throttle.Dshot, THR_TIM_CLK / ulBps, Throttle.uDshotTelem);
+
+		TIM5->PSC = 0u;
+		TIM5->ARR = 0xFFFFFFFFu;
+		/* CC2 요청마다 CCR1(DBA = 13), CCR2 두 워드를 DMAR로 전송 (DBL = 1) */
+		TIM5->DCR = (1u << TIM_DCR_DBL_Pos) | (((uint32_t)(&TIM5->CCR1) - (uint32_t)TIM5) >> 2);
+		fThrTickUs = 1.0e6f / (float)THR_TIM_CLK;
+
+		DMA1_Channel6->CPAR = (uint32_t)&TIM5->DMAR;
+		DMA1_Channel6->CMAR = (uint32_t)ThrDshotRing;
+		DMA1_Channel6->CNDTR = THR_DSHOT_RING_SIZE;
+		DMA1_Channel6->CCR = DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_EN;
+
+		if(Throttle.uDshotTelem != 0u){
+			/* 프레임 안에서는 비트마다 리셋되어 일치하지 않고, 마지막 비트 시작 후 (1비트 + 준비/응답 지연)에 일치 */
+			TIM5->CCMR2 &= ~(TIM_CCMR2_CC3S | TIM_CCMR2_OC3M | TIM_CCMR2_CC4S | TIM_CCMR2_OC4M);
+			TIM5->CCR3 = (THR_TIM_CLK / ulBps) + (THR_TIM_CLK / 1000000u) * THR_BDSHOT_TURN_US;
+			TIM5->CCR4 = (THR_TIM_CLK / ulBps) + (THR_TIM_CLK / 1000000u) * THR_BDSHOT_PREP_US;
+
+			/* 응답 비트 주기 = DShot 비트 주기 × 4/5 */
+			__HAL_RCC_TIM6_CLK_ENABLE();
+			TIM6->CR1 = 0u;
+			TIM6->PSC = 0u;
+			TIM6->ARR = ((THR_TIM_CLK * 4u) / (ulBps * 5u)) - 1u;
+			TIM6->DIER = TIM_DIER_UDE;
+
+			DMAMUX1_Channel6->CCR = DMA_REQUEST_TIM6_UP;
+			DMA1_Channel7->CPAR = (uint32_t)&GPIOB->BSRR;
+			DMAMUX1_Channel7->CCR = DMA_REQUEST_TIM5_CH3;
+			DMA1_Channel8->CPAR = (uint32_t)&TIM6->CR1;
+			HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 1, 0);
+			HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+		}
+	}
+
+	TIM5->EGR = TIM_EGR_UG;         /* 분주 즉시 적용 */
+	TIM5->SR = 0u;
+	TIM5->DIER = TIM_DIER_CC2DE | ((THR_IS_DSHOT(uInput) && Throttle.uDshotTelem != 0u) ? TIM_DIER_CC4IE : 0u);
+	TIM5->CCER |= TIM_CCER_CC1E | TIM_CCER_CC2E;
+	TIM5->CR1 |= TIM_CR1_CEN;
+
+	__DSB();
+	Throttle.uReady = 1u;
+}
+
+/**
+ * @brief  Expo 곡선 룩업 테이블을 다시 만듭니다. y = (1 - e)·x + e·x³
+ * @retval 없음
+ */
+void vThrottleBuildLut(void){
+	float fExpo = LIMIT(Throttle.fExpo, 0.0f, 1.0f);
+	float fX;
+	uint16_t i;
+
+	for(i = 0u; i < THR_LUT_NUM; i++){
+		fX = (float)i / (float)(THR_LUT_NUM - 1u);
+		fThrLut[i] = (1.0f - fExpo) * fX + fExpo * fX * fX * fX;
+	}
+}
+
+/**
+ * @brief  최근 세 값의 중앙값을 구합니다.
+ * @retval 중앙값
+ */
+static uint16_t uThrMedian3(uint16_t a, uint16_t b, uint16_t c){
+	if(a > b){ uint16_t t = a; a = b; b = t; }
+	if(b > c) b = c;
+	return (a > b) ? a : b;
+}
+
+/**
+ * @brief  정규화 입력에 불감대와 Expo 곡선을 적용합니다.
+ * @param  fX 정규화 입력 (-1 ~ 1)
+ * @param  fDeadband 불감대
+ * @retval 출력 (-1 ~ 1)
+ */
+static float fThrCurve(float fX, float fDeadband){
+	float fSign = 1.0f, fIdx;
+	uint16_t uIdx;
+
+	if(fX < 0.0f){ fSign = -1.0f; fX = -fX; }
+
+	/* 불감대 제거 후 나머지 구간을 0 ~ 1로 재정규화 */
+	if(fX <= fDeadband) return 0.0f;
+	fX = (fX - fDeadband) / (1.0f - fDeadband);
+	if(fX >= 1.0f) return fSign * fThrLut[THR_LUT_NUM - 1u];
+
+	fIdx = fX * (float)(THR_LUT_NUM - 1u);
+	uIdx = (uint16_t)fIdx;
+	return fSign * (fThrLut[uIdx] + (fIdx - (float)uIdx) * (fThrLut[uIdx + 1u] - fThrLut[uIdx]));
+}
+
+/**
+ * @brief  필터된 펄스폭을 보정된 끝점으로 정규화하고 곡선을 적용합니다.
+ * @param  fPulseUs 펄스폭 [µs]
+ * @retval 출력 (단방향 0 ~ 1, 양방향 -1 ~ 1)
+ */
+static float fThrShapePwm(float fPulseUs){
+	float fX;
+
+	if(Throttle.uBidir != 0u){
+		if(fPulseUs >= Throttle.fCenterUs) fX = (fPulseUs - Throttle.fCenterUs) / (Throttle.fMaxUs - Throttle.fCenterUs);
+		else                               fX = (fPulseUs - Throttle.fCenterUs) / (Throttle.fCenterUs - Throttle.fMinUs);
+	}
+	else {
+		fX = (fPulseUs - Throttle.fMinUs) / (Throttle.fMaxUs - Throttle.fMinUs);
+		if(fX < 0.0f) fX = 0.0f;
+	}
+
+	return fThrCurve(fX, Throttle.fDeadband);
+}
+
+/**
+ * @brief  DShot 스로틀 값을 정규화하고 곡선을 적용합니다. (불감대 없음)
+ * @param  uValue 스로틀 값 (0 ~ 2047)
+ * @retval 출력 (단방향 0 ~ 1, 양방향 -1 ~ 1)
+ */
+static float fThrShapeDshot(uint16_t uValue){
+	float fX;
+
+	if(uValue < DSHOT_THR_MIN){
+		if(uValue != 0u) Throttle.uDshotCmd = uValue;
+		return 0.0f;
+	}
+
+	if(Throttle.uBidir != 0u){
+		/* 48 ~ 1047: 역방향, 1048 ~ 2047: 정방향 (양쪽 모두 중립에서 멀수록 큼) */
+		if(uValue >= 1048u) fX = (float)(uValue - 1048u) * (1.0f / 999.0f);
+		else                fX = -(float)(uValue - DSHOT_THR_MIN) * (1.0f / 999.0f);
+	}
+	else fX = (float)(uValue - DSHOT_THR_MIN) * (1.0f / (float)(DSHOT_THR_MAX - DSHOT_THR_MIN));
+
+	return fThrCurve(fX, 0.0f);
+}
+
+/**
+ * @brief  펄스폭 샘플 하나를 검증하고 중앙값/IIR 필터에 넣습니다.
+ * @param  uRaw 펄스폭 [µs]
+ * @retval 1: 유효 샘플
+ */
+static uint16_t uThrFilterPulse(uint16_t uRaw){
+	if(uRaw < THR_PULSE_MIN_US || uRaw > THR_PULSE_MAX_US){
+		Throttle.ulRejectCnt++;
+		return 0u;
+	}
+
+	Throttle.uMed[0] = Throttle.uMed[1];
+	Throttle.uMed[1] = Throttle.uMed[2];
+	Throttle.uMed[2] = uRaw;
+	Throttle.fPulseUs += Throttle.fAlpha * ((float)uThrMedian3(Throttle.uMed[0], Throttle.uMed[1], Throttle.uMed[2]) - Throttle.fPulseUs);
+	Throttle.ulSampleCnt++;
+	return 1u;
+}
+
+/**
+ * @brief  PWM 링 버퍼의 새 펄스폭을 필터링합니다.
+ * @retval 1: 유효 샘플 있음
+ */
+static uint16_t uThrPollPwm(void){
+	uint16_t uWr, uNew = 0u;
+
+	uWr = (uint16_t)((THR_RING_SIZE - DMA1_Channel6->CNDTR) & (THR_RING_SIZE - 1u));
+
+	while(Throttle.uRd != uWr){
+		uNew |= uThrFilterPulse(ThrRing[Throttle.uRd]);
+		Throttle.uRd = (uint16_t)((Throttle.uRd + 1u) & (THR_RING_SIZE - 1u));
+	}
+
+	if(uNew != 0u){
+		Throttle.uPeriodUs = (uint16_t)TIM5->CCR1;
+		Throttle.fOut = fThrShapePwm(Throttle.fPulseUs);
+	}
+	return uNew;
+}
+
+/**
+ * @brief  직렬 수신기가 게시한 새 채널 샘플을 필터링합니다.
+ * @note   uRd에 마지막으로 처리한 샘플 순번을 보관합니다.
+ * @retval 1: 유효 샘플 있음
+ */
+static uint16_t uThrPollSerial(void){
+	uint32_t ulSample = RcRx.ulSample;
+	uint16_t uSeq = (uint16_t)(ulSample >> 16);
+
+	if(uSeq == Throttle.uRd) return 0u;
+	Throttle.uRd = uSeq;
+
+	if(uThrFilterPulse((uint16_t)ulSample) == 0u) return 0u;
+	Throttle.fOut = fThrShapePwm(Throttle.fPulseUs);
+	return 1u;
+}
+
+/**
+ * @brief  DShot 링 버퍼의 새 비트를 복호합니다. 한 주기에 여러 프레임이 완성되면 마지막 프레임을 사용합니다.
+ * @retval 1: CRC가 맞는 프레임 있음
+ */
+static uint16_t uThrPollDshot(void){
+	uint16_t uWr, uFrame, uNew = 0u;
+
+	/* Burst 도중(한 워드만 기록)이면 쌍이 완성될 때까지 다음 주기로 미룸 */
+	uWr = (uint16_t)((THR_DSHOT_RING_SIZE - DMA1_Channel6->CNDTR) & (THR_DSHOT_RING_SIZE - 2u));
+
+	while(Throttle.uRd != uWr){
+		if(uDshotDecBit(&Throttle.Dshot, ThrDshotRing[Throttle.uRd], ThrDshotRing[Throttle.uRd + 1u], &uFrame) != 0u){
+			Throttle.uDshotValue = DSHOT_VALUE(uFrame);
+			if(DSHOT_TELEM(uFrame) != 0u) Throttle.uTelemReq = 1u;
+			Throttle.ulSampleCnt++;
+			uNew = 1u;
+		}
+		Throttle.uRd = (uint16_t)((Throttle.uRd + 2u) & (THR_DSHOT_RING_SIZE - 1u));
+	}
+
+	if(uNew != 0u) Throttle.fOut = fThrShapeDshot(Throttle.uDshotValue);
+	return uNew;
+}
+
+/**
+ * @brief  새 캡처 샘플을 처리하고, 출력 대상에 따라 설정값 스냅숏을 명령 모듈의 스로틀 출처로 게시합니다.
+ * @details 제어 변수에 직접 쓰지 않습니다. 출력 대상이 THR_OUT_OFF이거나 재설정 중이면 스로틀 출처를 해제하여 CmdReq 설정값으로 돌아갑니다.
+ * @note   제어 ISR(vControl)에서 vParamFetch 이후, vCmdFetch 이전에 호출합니다. (같은 주기에 적용)
+ * @retval 없음
+ */
+void vThrottleUpdate(void){
+	sCmdSetpoint ThrSet;
+	uint32_t ulCnt, ulCap;
+	uint16_t uNew, uLinkLost = 0u;
+	float fLatency, fErpm;
+
+	if(Throttle.uReady == 0u){
+		vCmdThrottleRelease();
+		return;
+	}
+
+	if(Throttle.uInput == THR_INPUT_SERIAL){
+		uNew = uThrPollSerial();
+		/* 수신기 Failsafe/링크 품질 부족은 끊김 시간을 기다리지 않고 즉시 반영 */
+		if(RcRx.uLinkOk == 0u){
+			uNew = 0u;
+			uLinkLost = 1u;
+		}
+	}
+	else if(THR_IS_DSHOT(Throttle.uInput)) uNew = uThrPollDshot();
+	else                                   uNew = uThrPollPwm();
+
+	if(uNew != 0u){
+		/* 카운터는 상승 에지에서 리셋되므로 CNT - CCR2 = 마지막 하강 에지(캡처) 이후 경과 시간 (직렬 입력은 해당 없음) */
+		ulCnt = TIM5->CNT;
+		ulCap = TIM5->CCR2;
+		if(Throttle.uInput != THR_INPUT_SERIAL && ulCnt >= ulCap){
+			fLatency = (float)(ulCnt - ulCap) * fThrTickUs;
+			Throttle.fLatencyUs = fLatency;
+			if(fLatency > Throttle.fLatencyMaxUs) Throttle.fLatencyMaxUs = fLatency;
+		}
+		Throttle.fLossTime = 0.0f;
+
+		/* 재무장: 출력 0 샘플이 연속되어야 Failsafe 해제 */
+		if(Throttle.uFailsafe != 0u){
+			if(Throttle.fOut == 0.0f){
+				if(++Throttle.uArmCnt >= THR_ARM_SAMPLES) Throttle.uFailsafe = 0u;
+			}
+			else Throttle.uArmCnt = 0u;
+		}
+	}
+	else {
+		if(Throttle.fLossTime < THR_LOSS_S) Throttle.fLossTime += fTsamp;
+		if((uLinkLost != 0u || Throttle.fLossTime >= THR_LOSS_S) && Throttle.uFailsafe == 0u){
+			Throttle.uFailsafe = 1u;
+			Throttle.uArmCnt = 0u;
+			Throttle.ulFailsafeCnt++;
+		}
+	}
+
+	if(Throttle.uFailsafe != 0u){
+		Throttle.fOut = 0.0f;
+		vThrModeReset(&Throttle.Mode);
+	}
+
+	/* eRPM 응답 워드: 전기 1회전 주기 [µs] = 60e6 / (|RPM| × 극쌍수) */
+	if(THR_IS_DSHOT(Throttle.uInput) && Throttle.uDshotTelem != 0u){
+		fErpm = ABS(INV.SO.fWrpmSC) * pCtrlParam->fPP;
+		Throttle.uTelemWord = uDshotErpmEncode((fErpm > THR_ERPM_MIN) ? (uint32_t)(60.0e6f / fErpm) : 0xFFFFFFFFu);
+		Throttle.uTelemArm = (Throttle.ulSampleCnt != 0u && Throttle.fLossTime < THR_LOSS_S) ? 1u : 0u;
+	}
+
+	ThrSet.fWrpmRefSet = 0.0f;
+	ThrSet.fIdsrRefSet = 0.0f;
+	ThrSet.fIqsrRefSet = 0.0f;
+	ThrSet.fVdqsrRefSet = 0.0f;
+	ThrSet.fIqsrSlopeSet = CC_IQ_SLOPE;
+	ThrSet.uReserved = 0u;
+
+	switch(Throttle.uOutMode){
+	case THR_OUT_TORQUE:
+		ThrSet.uControlMode = VECTCONTL_MODE;
+		ThrSet.fIqsrSlopeSet = THR_IQ_SLOPE;
+		ThrSet.fIqsrRefSet = (Throttle.uFailsafe != 0u) ? 0.0f
+				: fThrModeUpdate(&Throttle.Mode, Throttle.fOut, INV.SO.fWrpmSC, pCtrlParam->fTeRefMax * pCtrlParam->fInvKT, fTsamp);
+		vCmdThrottlePost(&ThrSet);
+		break;
+
+	case THR_OUT_SPEED:
+		ThrSet.uControlMode = SPDCONTL_MODE;
+		ThrSet.fWrpmRefSet = Throttle.fOut * pCtrlParam->fWrpmRefMax;
+		vCmdThrottlePost(&ThrSet);
+		break;
+
+	default:
+		vCmdThrottleRelease();
+		break;
+	}
+}
+
+/**
+ * @brief  응답 송신을 끝내고 PB2를 캡처 입력으로 되돌립니다.
+ * @retval 없음
+ */
+static void vThrTxEnd(void){
+	TIM5->DIER &= ~TIM_DIER_CC3DE;
+	DMA1_Channel8->CCR = 0u;
+	TIM6->CR1 = 0u;
+	DMA1_Channel7->CCR = 0u;
+
+	GPIOB->MODER = (GPIOB->MODER & ~THR_MODER_MASK) | THR_MODER_AF;
+	TIM5->SR = ~(TIM_SR_CC1IF | TIM_SR_CC2IF | TIM_SR_CC1OF | TIM_SR_CC2OF);
+	TIM5->CCER |= TIM_CCER_CC1E | TIM_CCER_CC2E;
+	TIM5->SMCR = ulThrSmcr;
+}
+
+/**
+ * @brief  TIM5 CC4(프레임 끝 + THR_BDSHOT_PREP_US)에서 방금 받은 프레임이 유효하면 eRPM 응답을 준비합니다.
+ * @details 송신 시작 시각은 TIM5 CC3 일치가 DMA1_CH8로 TIM6을 켜는 하드웨어 경로로 정해지므로,
+ * 이 인터럽트가 제어 ISR에 밀려도 CC3 전에만 끝나면 응답 지연이 흔들리지 않습니다.
+ * @retval 없음
+ */
+void vThrottleTurnIrq(void){
+	uint32_t ulLevels;
+	uint16_t i, uWr, uFrame;
+
+	if((TIM5->SR & TIM_SR_CC4IF) == 0u) return;
+	TIM5->SR = ~TIM_SR_CC4IF;
+	if(Throttle.uTelemArm == 0u) return;
+
+	/* 제어 ISR의 복호 진행과 별개로, 링 버퍼의 마지막 16쌍이 CRC까지 맞는 프레임일 때만 응답 */
+	uWr = (uint16_t)((THR_DSHOT_RING_SIZE - DMA1_Channel6->CNDTR) & (THR_DSHOT_RING_SIZE - 2u));
+	if(uDshotDecLast(&Throttle.Dshot, ThrDshotRing, THR_DSHOT_RING_SIZE - 1u, uWr, &uFrame) == 0u){
+		Throttle.ulTelemSkipCnt++;
+		return;
+	}
+
+	ulLevels = ulDshotGcrEncode(Throttle.uTelemWord);
+	for(i = 0u; i < DSHOT_GCR_BITS; i++) ThrTxBuf[i] = ((ulLevels >> (DSHOT_GCR_BITS - 1u - i)) & 1u) ? THR_PIN_HIGH : THR_PIN_LOW;
+	ThrTxBuf[DSHOT_GCR_BITS] = THR_PIN_HIGH;
+
+	/* 자기 송신 에지로 캡처/카운터 리셋이 일어나지 않도록 입력을 끊고 Idle High로 출력 전환 (선은 이미 Idle High) */
+	TIM5->SMCR = ulThrSmcr & ~TIM_SMCR_SMS;
+	TIM5->CCER &= ~(TIM_CCER_CC1E | TIM_CCER_CC2E);
+	GPIOB->BSRR = THR_PIN_HIGH;
+	GPIOB->MODER = (GPIOB->MODER & ~THR_MODER_MASK) | THR_MODER_OUT;
+
+	/* CNT = ARR: CEN 후 1틱 만에 첫 업데이트 요청(시작 비트), 이후 비트 주기마다 다음 레벨 */
+	TIM6->CR1 = 0u;
+	TIM6->CNT = TIM6->ARR;
+	DMA1_Channel7->CCR = 0u;
+	DMA1_Channel7->CMAR = (uint32_t)ThrTxBuf;
+	DMA1_Channel7->CNDTR = THR_BDSHOT_TX_LEN;
+	DMA1_Channel7->CCR = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | DMA_CCR_TCIE | DMA_CCR_EN;
+
+	/* CC3 일치 → DMA1_CH8이 TIM6->CR1 = CEN */
+	DMA1_Channel8->CCR = 0u;
+	DMA1_Channel8->CMAR = (uint32_t)&ulThrTim6Start;
+	DMA1_Channel8->CNDTR = 1u;
+	DMA1_Channel8->CCR = DMA_CCR_DIR | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | DMA_CCR_EN;
+	TIM5->DIER |= TIM_DIER_CC3DE;
+
+	/* 요청 허용 전에 이미 CC3가 지났으면 시작되지 않으므로 이번 응답은 건너뜀 */
+	if((TIM5->CNT >= TIM5->CCR3) && (DMA1_Channel8->CNDTR != 0u)){
+		vThrTxEnd();
+		Throttle.ulTelemLateCnt++;
+		return;
+	}
+	Throttle.ulTelemCnt++;
+}
+
+/**
+ * @brief  eRPM 응답 송신이 끝나면 PB2를 캡처 입력으로 되돌립니다.
+ * @retval 없음
+ */
+void vThrottleTxDoneIrq(void){
+	DMA1->IFCR = DMA_IFCR_CGIF7;
+	vThrTxEnd();
+}
@@ -0,0 +1,146 @@
+/**
+ * @file    ThrottleMode.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   RC 스로틀 운전 모드(전진/제동, 전진/제동/후진, 3D 양방향) 및 드래그 브레이크 구현 소스 파일
+ * @details 표준 C만 사용합니다 (HAL, CMSIS 헤더 없음). 호출당 비교 몇 번과 나눗셈 1회(제동 감쇄)만 수행합니다.
+ *
+ * [전진/제동/후진 상태 전이] (iDir: 현재 구동 방향, 요청: 스틱 부호, 정지: |속도| < fStopRpm)
+ * | 상태 | 조건 | 다음 상태 |
+ * | :--- | :--- | :--- |
+ * | **DRIVE** | 요청 = -iDir | BRAKE |
+ * | **BRAKE** | 요청 = 0 또는 iDir | DRIVE |
+ * | **BRAKE** | 정지, iDir = +1 (후진 모드만) | REV_WAIT |
+ * | **BRAKE** | 정지, iDir = -1 | DRIVE (iDir = +1, 지연 없음) |
+ * | **REV_WAIT** | 요청 ≥ 0 (중립 또는 전진, 후진 취소) | DRIVE (iDir = +1) |
+ * | **REV_WAIT** | 요청 < 0이 fRevDelayS 동안 유지 | DRIVE (iDir = -1) |
+ */
+
+#include "ThrottleMode.h"
+
+/**
+ * @brief  회전 반대 방향 제동 전류를 계산합니다. (저속에서 선형 감쇄)
+ * @param  pM 운전 모드
+ * @param  fCurr 제동 전류 크기 [A]
+ * @param  fWrpm 회전 속도 [RPM]
+ * @retval q축 전류 [A]
+ */
+static float fThrModeBrake(const sThrMode* pM, float fCurr, float fWrpm){
+	float fAbs = (fWrpm >= 0.0f) ? fWrpm : -fWrpm;
+
+	if(fAbs < pM->fFadeRpm) fCurr *= fAbs / pM->fFadeRpm;
+	return (fWrpm >= 0.0f) ? -fCurr : fCurr;
+}
+
+/**
+ * @brief  기본 설정으로 초기화합니다.
+ * @param  pM 운전 모드
+ * @retval 없음
+ */
+void vThrModeInit(sThrMode* pM){
+	pM->uMode = THRM_DIRECT;
+	pM->fBrakeCurr = THRM_BRAKE_CURR;
+	pM->fDragCurr = THRM_DRAG_CURR;
+	pM->fRevScale = THRM_REV_SCALE;
+	pM->fRevDelayS = THRM_REV_DELAY_S;
+	pM->fStopRpm = THRM_STOP_RPM;
+	pM->fFadeRpm = THRM_FADE_RPM;
+	pM->ulRevCnt = 0u;
+	vThrModeReset(pM);
+}
+
+/**
+ * @brief  상태를 전진 구동으로 되돌립니다.
+ * @param  pM 운전 모드
+ * @retval 없음
+ */
+void vThrModeReset(sThrMode* pM){
+	pM->uState = THRM_ST_DRIVE;
+	pM->iDir = 1;
+	pM->fTimer = 0.0f;
+	pM->fIqRef = 0.0f;
+}
+
+/**
+ * @brief  스틱 값과 속도로 상태를 갱신하고 q축 전류 목표를 계산합니다.
+ * @param  pM 운전 모드
+ * @param  fStick 스로틀 출력 (-1 ~ 1)
+ * @param  fWrpm 회전 속도 [RPM]
+ * @param  fIqMax q축 전류 최대값 [A]
+ * @param  fTs 호출 주기 [s]
+ * @retval q축 전류 목표 [A]
+ */
+float fThrModeUpdate(sThrMode* pM, float fStick, float fWrpm, float fIqMax, float fTs){
+	float fAbsStick = (fStick >= 0.0f) ? fStick : -fStick;
+	float fBrake = (pM->fBrakeCurr < fIqMax) ? pM->fBrakeCurr : fIqMax;
+	float fDrag = (pM->fDragCurr < fIqMax) ? pM->fDragCurr : fIqMax;
+	int16_t iReq = (fStick > 0.0f) ? 1 : ((fStick < 0.0f) ? -1 : 0);
+	int16_t iRot = 0;
+	float fIq;
+
+	if(fWrpm >= pM->fStopRpm) iRot = 1;
+	else if(fWrpm <= -pM->fStopRpm) iRot = -1;
+
+	switch(pM->uMode){
+	case THRM_FWD_BRAKE:
+	case THRM_FWD_BRAKE_REV:
+		if(pM->uMode == THRM_FWD_BRAKE) pM->iDir = 1;
+
+		if(pM->uState == THRM_ST_DRIVE){
+			if(iReq == -pM->iDir) pM->uState = THRM_ST_BRAKE;
+		}
+		else if(pM->uState == THRM_ST_BRAKE){
+			if(iReq != -pM->iDir) pM->uState = THRM_ST_DRIVE;
+			else if(iRot == 0 && pM->uMode == THRM_FWD_BRAKE_REV){
+				if(pM->iDir > 0){
+					pM->uState = THRM_ST_REV_WAIT;
+					pM->fTimer = 0.0f;
+				}
+				else {
+					pM->uState = THRM_ST_DRIVE;
+					pM->iDir = 1;
+				}
+			}
+		}
+		else {
+			if(iReq >= 0){
+				pM->uState = THRM_ST_DRIVE;
+				pM->iDir = 1;
+			}
+			else if((pM->fTimer += fTs) >= pM->fRevDelayS){
+				pM->uState = THRM_ST_DRIVE;
+				pM->iDir = -1;
+				pM->ulRevCnt++;
+			}
+		}
+
+		if(pM->uState == THRM_ST_BRAKE)         fIq = fThrModeBrake(pM, fAbsStick * fBrake, fWrpm);
+		else if(pM->uState == THRM_ST_REV_WAIT) fIq = 0.0f;
+		else if(iReq == 0)                      fIq = fThrModeBrake(pM, fDrag, fWrpm);
+		else                                    fIq = fStick * fIqMax * ((pM->iDir < 0) ? pM->fRevScale : 1.0f);
+		break;
+
+	case THRM_BIDIR_3D:
+		if(iReq == 0){
+			pM->uState = THRM_ST_DRIVE;
+			fIq = fThrModeBrake(pM, fDrag, fWrpm);
+		}
+		else if(iRot == -iReq){
+			pM->uState = THRM_ST_BRAKE;
+			fIq = fThrModeBrake(pM, fAbsStick * fBrake, fWrpm);
+		}
+		else {
+			pM->uState = THRM_ST_DRIVE;
+			pM->iDir = iReq;
+			fIq = fStick * fIqMax;
+		}
+		break;
+
+	default:
+		fIq = fStick * fIqMax;
+		break;
+	}
+
+	pM->fIqRef = fIq;
+	return fIq;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file    Traction.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   속도 미분 기반 구동력 제어(Traction Control) 및 출발 제어(Launch Control) 구현 소스 파일
+ * @details 표준 C만 사용합니다 (HAL, CMSIS 헤더 없음). 분기만 있고 반복문이 없어 호출당 연산량이 일정합니다.
+ *
+ * [출발 상태 전이] (정지: |속도| < fStopRpm, 지령: |Iq| ≥ TC_IQ_ON)
+ * | 상태 | 조건 | 다음 상태 |
+ * | :--- | :--- | :--- |
+ * | **OFF** | 정지, 지령 없음 | READY |
+ * | **READY** | 정지 아님 (굴러가는 중 출발) | OFF |
+ * | **READY** | 지령 | ACTIVE (타이머 0) |
+ * | **ACTIVE** | fLaunchTimeS 경과 | OFF |
+ */
+
+#include "Traction.h"
+
+/** @brief 구동력/출발 제어 객체 */
+sTraction Traction;
+
+/** @brief 기본 출발 프로파일 (Iq,max 대비 비율) */
+static const float fTcLaunchProfDefault[TC_LAUNCH_PTS] = { 0.4f, 0.55f, 0.7f, 0.85f, 1.0f };
+
+/**
+ * @brief  기본 설정으로 초기화합니다.
+ * @param  pT 구동력 제어
+ * @retval 없음
+ */
+void vTractionInit(sTraction* pT){
+	uint16_t i;
+
+	pT->uEn = 0u;
+	pT->uLaunchEn = 0u;
+	pT->fAccMax = TC_ACC_MAX;
+	pT->fJeq = TC_JEQ;
+	pT->fSlipRatio = TC_SLIP_RATIO;
+	pT->fCutRatio = TC_CUT_RATIO;
+	pT->fIqFloor = TC_IQ_FLOOR;
+	pT->fHoldS = TC_HOLD_S;
+	pT->fRecoverRate = TC_RECOVER_RATE;
+	pT->fLaunchTimeS = TC_LAUNCH_TIME_S;
+	for(i = 0u; i < TC_LAUNCH_PTS; i++) pT->fLaunchProf[i] = fTcLaunchProfDefault[i];
+	pT->fStopRpm = TC_STOP_RPM;
+	pT->ulSlipCnt = 0u;
+	pT->ulLaunchCnt = 0u;
+	vTractionReset(pT);
+}
+
+/**
+ * @brief  추정/제한 상태를 초기화합니다.
+ * @param  pT 구동력 제어
+ * @retval 없음
+ */
+void vTractionReset(sTraction* pT){
+	pT->fWrpmPrev = 0.0f;
+	pT->fAcc = 0.0f;
+	pT->fAccLim = pT->fAccMax;
+	pT->fIqTc = TC_LIM_NONE;
+	pT->fHoldTimer = 0.0f;
+	pT->fLaunchTimer = 0.0f;
+	pT->fIqLim = TC_LIM_NONE;
+	pT->uSlip = 0u;
+	pT->uLaunchState = TC_LAUNCH_OFF;
+	pT->uInit = 0u;
+}
+
+/**
+ * @brief  출발 프로파일 값을 선형 보간합니다.
+ * @param  pT 구동력 제어
+ * @retval Iq,max 대비 비율
+ */
+static float fTractionLaunchProf(const sTraction* pT){
+	float fPos;
+	uint16_t uIdx;
+
+	if(pT->fLaunchTimer >= pT->fLaunchTimeS) return pT->fLaunchProf[TC_LAUNCH_PTS - 1u];
+
+	fPos = pT->fLaunchTimer * (float)(TC_LAUNCH_PTS - 1u) / pT->fLaunchTimeS;
+	uIdx = (uint16_t)fPos;
+	return pT->fLaunchProf[uIdx] + (pT->fLaunchProf[uIdx + 1u] - pT->fLaunchProf[uIdx]) * (fPos - (float)uIdx);
+}
+
+/**
+ * @brief  속도 제어 주기마다 가속도를 추정하고 q축 전류 한계를 갱신합니다.
+ * @param  pT 구동력 제어
+ * @param  fWrpm 관측기 속도 [RPM]
+ * @param  fIqRef 현재 q축 전류 지령 [A]
+ * @param  fIqMax q축 전류 최대값 [A]
+ * @param  fKT 토크 상수 [Nm/A]
+ * @param  fTs 호출 주기 [s]
+ * @retval q축 전류 한계 크기 [A]
+ */
+float fTractionUpdate(sTraction* pT, float fWrpm, float fIqRef, float fIqMax, float fKT, float fTs){
+	float fAbsIq = (fIqRef >= 0.0f) ? fIqRef : -fIqRef;
+	float fAbsW = (fWrpm >= 0.0f) ? fWrpm : -fWrpm;
+	float fAccDir, fModel, fFloor, fLaunch = TC_LIM_NONE;
+	uint16_t uSlip;
+
+	/* 1. 가속도 추정 (첫 호출은 기준값만 저장) */
+	if(pT->uInit == 0u){
+		pT->fWrpmPrev = fWrpm;
+		pT->uInit = 1u;
+	}
+	pT->fAcc += TC_ACC_ALPHA * ((fWrpm - pT->fWrpmPrev) / fTs - pT->fAcc);
+	pT->fWrpmPrev = fWrpm;
+
+	/* 2. 미끄럼 한계: 고정 한계와 차량 모델(KT·Iq / Jeq) 중 작은 값 */
+	pT->fAccLim = pT->fAccMax;
+	if(pT->fJeq > 0.0f){
+		fModel = pT->fSlipRatio * fKT * fAbsIq / pT->fJeq * TC_RADS_TO_RPM + TC_ACC_MARGIN;
+		if(fModel < pT->fAccLim) pT->fAccLim = fModel;
+	}
+
+	/* 3. 토크 방향 가속도로 미끄럼 판정 (구동 헛돎, 제동 잠김) */
+	fAccDir = (fIqRef >= 0.0f) ? pT->fAcc : -pT->fAcc;
+	uSlip = (pT->uEn != 0u && fAbsIq >= TC_IQ_ON && fAccDir > pT->fAccLim) ? 1u : 0u;
+
+	/* 4~5. 차단 후 유지, 기울기로 복귀 */
+	if(pT->uEn == 0u) pT->fIqTc = TC_LIM_NONE;
+	else if(uSlip != 0u){
+		if(pT->uSlip == 0u) pT->ulSlipCnt++;
+		fFloor = (pT->fIqFloor < fIqMax) ? pT->fIqFloor : fIqMax;
+		pT->fIqTc = ((pT->fIqTc < fAbsIq) ? pT->fIqTc : fAbsIq) * pT->fCutRatio;
+		if(pT->fIqTc < fFloor) pT->fIqTc = fFloor;
+		pT->fHoldTimer = pT->fHoldS;
+	}
+	else if(pT->fHoldTimer > 0.0f) pT->fHoldTimer -= fTs;
+	else pT->fIqTc += pT->fRecoverRate * fTs;
+
+	if(pT->fIqTc > fIqMax) pT->fIqTc = (pT->uEn != 0u) ? fIqMax : TC_LIM_NONE;
+	pT->uSlip = uSlip;
+
+	/* 6. 출발 프로파일 */
+	if(pT->uLaunchEn == 0u) pT->uLaunchState = TC_LAUNCH_OFF;
+	else if(pT->uLaunchState == TC_LAUNCH_OFF){
+		if(fAbsW < pT->fStopRpm && fAbsIq < TC_IQ_ON) pT->uLaunchState = TC_LAUNCH_READY;
+	}
+	else if(pT->uLaunchState == TC_LAUNCH_READY){
+		if(fAbsW >= pT->fStopRpm) pT->uLaunchState = TC_LAUNCH_OFF;
+		else if(fAbsIq >= TC_IQ_ON){
+			pT->uLaunchState = TC_LAUNCH_ACTIVE;
+			pT->fLaunchTimer = 0.0f;
+			pT->ulLaunchCnt++;
+		}
+	}
+	else if((pT->fLaunchTimer += fTs) >= pT->fLaunchTimeS) pT->uLaunchState = TC_LAUNCH_OFF;
+
+	if(pT->uLaunchState == TC_LAUNCH_READY)       fLaunch = pT->fLaunchProf[0] * fIqMax;
+	else if(pT->uLaunchState == TC_LAUNCH_ACTIVE) fLaunch = fTractionLaunchProf(pT) * fIqMax;
+
+	pT->fIqLim = (pT->fIqTc < fLaunch) ? pT->fIqTc : fLaunch;
+	return pT->fIqLim;
+}
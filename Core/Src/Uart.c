@@ -0,0 +1,188 @@
+/**
+ * @file    Uart.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   USART1 레지스터 직접 제어 드라이버 구현 소스 파일
+ *
+ * @details [자원 할당]
+ * | 자원 | 설정 |
+ * | :--- | :--- |
+ * | **USART1** | 8N1, OVER8, 커널 클럭 PCLK2 (170MHz) |
+ * | **PB6 / PB7** | AF7 (USART1_TX / USART1_RX) |
+ * | **DMA1_CH4** | DMAMUX1_Channel3 = USART1_TX, 메모리 → TDR, 바이트 단위, Normal 모드 |
+ * | **DMA1_CH5** | DMAMUX1_Channel4 = USART1_RX, RDR → UartRxBuf, 바이트 단위, Circular 모드 |
+ *
+ * 전송 완료는 CNDTR이 0이 되는 것으로 판단하므로 송신 인터럽트를 사용하지 않습니다.
+ * 수신은 DMA가 순환 버퍼에 계속 기록하고, 메인 루프가 CNDTR로 기록 위치를 계산하여 읽습니다 (수신 인터럽트 없음).
+ * 판독이 버퍼 한 바퀴 이상 늦으면 데이터가 덮어써지며, 이는 상위 프레임의 CRC로 검출됩니다.
+ * 오버런(ORE)은 OVRDIS로 무시하여 수신 DMA가 멈추지 않게 합니다.
+ *
+ * @details [CRC-16]
+ * 프레임 무결성 검사는 CRC-16/CCITT-FALSE(다항식 0x1021, 초기값 0xFFFF, 반사 없음)를 테이블로 계산합니다.
+ * 하드웨어 CRC 유닛은 플래시 로그(메인 루프)가 사용하므로 ISR에서 공유하지 않습니다.
+ */
+
+#include "main.h"
+#include "Uart.h"
+
+/** @brief 수신 순환 버퍼 (DMA1_CH5 기록) */
+static uint8_t UartRxBuf[UART_RX_BUF_SIZE];
+/** @brief 수신 판독 위치 (메인 루프 소유) */
+static uint16_t uUartRxRd = 0u;
+
+/** @brief CRC-16/CCITT 바이트 테이블 (다항식 0x1021) */
+static const uint16_t uCrc16Table[256] = {
+		0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+		0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+		0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+		0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+		0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+		0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+		0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+		0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+		0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+		0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+		0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+		0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+		0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+		0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+		0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+		0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+		0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+		0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+		0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+		0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+		0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+		0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+		0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+		0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+		0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+		0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+		0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+		0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+		0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+		0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+		0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+		0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u,
+};
+
+/**
+ * @brief  USART1과 송신 DMA(DMA1_CH4), 수신 DMA(DMA1_CH5)를 초기화합니다. (8N1)
+ * @note   MX_DMA_Init(DMA1/DMAMUX1 클럭) 이후 호출해야 합니다.
+ * @param  ulBaud 통신 속도 [bps]
+ * @retval 없음
+ */
+void vInitUart(uint32_t ulBaud){
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+	uint32_t ulDiv;
+
+	__HAL_RCC_USART1_CLK_ENABLE();
+	__HAL_RCC_GPIOB_CLK_ENABLE();
+
+	GPIO_InitStruct.Pin = GPIO_PIN_6 | GPIO_PIN_7;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_PULLUP;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+	GPIO_InitStruct.Alternate = GPIO_AF7_USART1;
+	HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+	/* OVER8: USARTDIV = 2·fck / baud, BRR[3] = 0, BRR[2:0] = USARTDIV[3:0] >> 1 */
+	ulDiv = (2u * UART_KER_CLK + (ulBaud >> 1)) / ulBaud;
+
+	USART1->CR1 = 0u;
+	USART1->BRR = (ulDiv & 0xFFF0u) | ((ulDiv & 0x000Fu) >> 1);
+	USART1->CR2 = 0u;
+	USART1->CR3 = USART_CR3_DMAT | USART_CR3_DMAR | USART_CR3_OVRDIS;
+
+	DMA1_Channel5->CCR = 0u;
+	DMAMUX1_Channel4->CCR = DMA_REQUEST_USART1_RX;
+	DMA1_Channel5->CPAR = (uint32_t)&USART1->RDR;
+	DMA1_Channel5->CMAR = (uint32_t)UartRxBuf;
+	DMA1_Channel5->CNDTR = UART_RX_BUF_SIZE;
+	DMA1_Channel5->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_EN;
+	uUartRxRd = 0u;
+
+	USART1->CR1 = USART_CR1_OVER8 | USART_CR1_TE | USART_CR1_RE | USART_CR1_UE;
+
+	DMA1_Channel4->CCR = 0u;
+	DMAMUX1_Channel3->CCR = DMA_REQUEST_USART1_TX;
+	DMA1_Channel4->CPAR = (uint32_t)&USART1->TDR;
+	DMA1_Channel4->CNDTR = 0u;
+	DMA1_Channel4->CCR = DMA_CCR_DIR | DMA_CCR_MINC;
+}
+
+/**
+ * @brief  송신 DMA가 전송 중인지 확인합니다.
+ * @retval 1: 전송 중, 0: 유휴
+ */
+uint16_t uUartTxBusy(void){
+	return (DMA1_Channel4->CNDTR != 0u) ? 1u : 0u;
+}
+
+/**
+ * @brief  버퍼를 DMA로 송신합니다. (비차단)
+ * @param  pData 송신 버퍼
+ * @param  uLen 송신 바이트 수 (1 이상)
+ * @retval 1: 전송 시작, 0: 이전 전송 진행 중
+ */
+uint16_t uUartTxStart(const void* pData, uint16_t uLen){
+	uint32_t ulPrimask = __get_PRIMASK();
+
+	__disable_irq();
+	if(uUartTxBusy()) {
+		__set_PRIMASK(ulPrimask);
+		return 0u;
+	}
+
+	DMA1_Channel4->CCR &= ~DMA_CCR_EN;
+	DMA1->IFCR = DMA_IFCR_CGIF4;
+	DMA1_Channel4->CMAR = (uint32_t)pData;
+	DMA1_Channel4->CNDTR = uLen;
+	DMA1_Channel4->CCR |= DMA_CCR_EN;
+	__set_PRIMASK(ulPrimask);
+	return 1u;
+}
+
+/**
+ * @brief  지정한 버퍼가 아직 송신 중인지 확인합니다.
+ * @details CMAR을 먼저 읽으므로, 그 사이 다른 문맥이 새 전송을 시작했다면 (이전 전송은 이미 끝난 것) 한 번 더 바쁨으로 보고될 뿐입니다.
+ * @param  pData 송신을 요청했던 버퍼
+ * @retval 1: 해당 버퍼 송신 중, 0: 송신 완료 (버퍼 재사용 가능)
+ */
+uint16_t uUartTxBusyWith(const void* pData){
+	if(DMA1_Channel4->CMAR != (uint32_t)pData) return 0u;
+	return uUartTxBusy();
+}
+
+/**
+ * @brief  수신 순환 버퍼에서 아직 읽지 않은 바이트를 꺼냅니다. (메인 루프 전용)
+ * @param  pDst 복사 대상
+ * @param  uMax 최대 바이트 수
+ * @retval 꺼낸 바이트 수
+ */
+uint16_t uUartRxRead(uint8_t* pDst, uint16_t uMax){
+	uint16_t uWr = (uint16_t)((UART_RX_BUF_SIZE - DMA1_Channel5->CNDTR) & (UART_RX_BUF_SIZE - 1u));
+	uint16_t uLen = 0u;
+
+	while((uUartRxRd != uWr) && (uLen < uMax)) {
+		pDst[uLen++] = UartRxBuf[uUartRxRd];
+		uUartRxRd = (uint16_t)((uUartRxRd + 1u) & (UART_RX_BUF_SIZE - 1u));
+	}
+	return uLen;
+}
+
+/**
+ * @brief  CRC-16/CCITT를 누적 계산합니다.
+ * @param  uCrc 초기값 (CRC16_INIT) 또는 이전 누적값
+ * @param  pData 데이터
+ * @param  uLen 바이트 수
+ * @retval 누적 CRC
+ */
+uint16_t uCrc16(uint16_t uCrc, const void* pData, uint16_t uLen){
+	const uint8_t* pByte = (const uint8_t*)pData;
+
+	while(uLen--) {
+		uCrc = (uint16_t)((uCrc << 8) ^ uCrc16Table[(uint8_t)((uCrc >> 8) ^ *pByte++)]);
+	}
+	return uCrc;
+}
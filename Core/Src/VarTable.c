@@ -0,0 +1,70 @@
+/**
+ * @file    VarTable.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   모니터링 가능한 변수의 컴파일 타임 레지스트리(심볼 테이블) 구현 소스 파일
+ * @details VAR_TABLE_LIST로부터 플래시 상수 테이블을 생성합니다. 이름 해시는 컴파일 시 상수로 계산되므로
+ * 런타임 초기화나 RAM 사용이 없습니다.
+ */
+
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "SyncPwm.h"
+#include "Throttle.h"
+#include "RcRx.h"
+#include "EscTelem.h"
+#include "PowerLimit.h"
+#include "Traction.h"
+#include "Thermal.h"
+#include "VarTable.h"
+
+/** @brief 변수 레지스트리 (플래시) */
+const sVarEntry VarTable[VAR_ID_NUM] = {
+#define VAR_TABLE_ENTRY(id, name, addr, type, unit, scale, acc)	{VAR_HASH(name), name, addr, type, unit, scale, acc, 0u},
+	VAR_TABLE_LIST(VAR_TABLE_ENTRY)
+#undef VAR_TABLE_ENTRY
+};
+
+/** @brief 변수 레지스트리 헤더 (플래시, 호스트 도구의 ELF 탐색 기준점) */
+const sVarTableInfo VarTableInfo = {VAR_TABLE_MAGIC, (uint16_t)VAR_ID_NUM, (uint16_t)sizeof(sVarEntry), VarTable};
+
+/**
+ * @brief  ID로 레지스트리 항목을 조회합니다. (O(1))
+ * @param  uId 변수 ID
+ * @retval 항목 포인터 (범위 밖이면 0)
+ */
+const sVarEntry* pVarGet(uint16_t uId){
+	return (uId < VAR_ID_NUM) ? &VarTable[uId] : 0;
+}
+
+/**
+ * @brief  이름 해시로 변수 ID를 검색합니다. (항목 수에 비례, 통신 초기화 등 비실시간 용도)
+ * @param  ulHash 이름 해시
+ * @retval 변수 ID (없으면 VAR_ID_NUM)
+ */
+uint16_t uVarFindHash(uint32_t ulHash){
+	uint16_t i;
+
+	for(i = 0u; i < VAR_ID_NUM; i++) {
+		if(VarTable[i].ulHash == ulHash) return i;
+	}
+	return VAR_ID_NUM;
+}
+
+/**
+ * @brief  ID의 주소/타입/기본 스케일로 채널 디스크립터를 구성합니다. (오프셋 0)
+ * @param  uId 변수 ID
+ * @param  pCh 구성할 채널 디스크립터
+ * @retval 1: 성공, 0: 잘못된 ID
+ */
+uint16_t uVarChannel(uint16_t uId, sDataChannel* pCh){
+	const sVarEntry* pVar = pVarGet(uId);
+
+	if(pVar == 0) return 0u;
+
+	pCh->pAddr = pVar->pAddr;
+	pCh->uType = pVar->uType;
+	pCh->fScale = pVar->fScale;
+	pCh->fOffset = 0.0f;
+	return 1u;
+}
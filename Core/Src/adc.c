@@ -7,8 +7,10 @@
 
 #include "stm32g4xx_hal.h"
 #include "stm32g4xx_hal_adc.h"
+#include <string.h>
 #include "Globalvar.h"
 #include "MotorControl.h"
+#include "FlashLog.h"
 
 /** @brief ADC 상태 전이를 관리하는 상태 변수 */
 static uint16_t uCurrAdcState = ADC_EXTERNAL_OFFSET_CALIBRATION, uNextAdcState = ADC_EXTERNAL_OFFSET_CALIBRATION;
@@ -21,6 +23,13 @@ static uint16_t uAdcOffsetCnt = 0u;       /**< 현재 오프셋 측정 카운트
 static uint16_t uAdcStandbyCnt = 1000u;   /**< ADC 주변장치 안정화를 위한 대기 카운트 */
 static uint16_t uAdcOffsetCntMax = 5000u; /**< 오프셋 값을 누적할 최대 횟수 (예: 0.5s) */
 
+/** @brief 저장 기준 오프셋: 플래시의 최근 기록, 새로 기록하면 그 값으로 갱신 (uAdcCalibStored = 1일 때 유효) */
+static sFlashLogCalib AdcCalibStored;
+static volatile uint16_t uAdcCalibStored = 0u;
+
+/** @brief 오프셋 출처 (ADC_CALIB_SRC_*) */
+uint16_t uAdcCalibSrc = ADC_CALIB_SRC_NONE;
+
 /** @brief ADC1 결과 임계값 (현재 미사용 또는 외부 참조용) */
 uint16_t uADC1ResultTresh = 0u;
 
@@ -44,10 +53,70 @@ void vInitAdc(void){
 	HAL_ADC_Start_DMA(&hadc1, (uint32_t *)uADC1Result, ADC1_CHANNEL_NUM);
 }
 
+/**
+ * @brief  플래시 로그의 최근 오프셋 기록을 읽어 보정 기준값으로 둡니다.
+ * @note   로그 영역이 순환하며 기록을 덮어써 찾지 못하면, 다음 보정 완료 시 측정값을 다시 저장합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vAdcLoadCalib(void){
+	sFlashLogRec Rec;
+
+	if(uFlashLogReadLatest(FLOG_TYPE_CALIB, &Rec) && (Rec.uLen == sizeof(sFlashLogCalib))) {
+		memcpy(&AdcCalibStored, Rec.uPayload, sizeof(sFlashLogCalib));
+		uAdcCalibStored = 1u;
+	}
+}
+
+/**
+ * @brief  측정 오프셋을 저장 기준값과 비교하여 채택하거나 저장값으로 되돌리고, 히스테리시스를 벗어났을 때만 새로 기록합니다.
+ * @details 비교 대상은 항상 이번에 측정한 오프셋과 저장 기준값(AdcCalibStored)입니다.
+ * 기록하면 저장 기준값도 같은 값으로 갱신하므로, 같은 오프셋이 유지되는 동안에는 다시 기록하지 않습니다.
+ * 기준값은 측정값이 ±ADC_CALIB_SAVE_CNT 밖으로 벗어났을 때만 움직이므로, 그 안의 측정 잡음이나 기동 온도 차이로는 플래시를 쓰지 않습니다.
+ *
+ * | 비교 (상별 최대 편차) | 동작 |
+ * | :--- | :--- |
+ * | **저장값 없음** | 측정값 사용, 기록 |
+ * | **≤ ADC_CALIB_SAVE_CNT** | 측정값 사용 (히스테리시스 안, 플래시 쓰기 없음) |
+ * | **< ADC_CALIB_TOL_CNT** | 측정값 사용, 기록 및 기준값 갱신 (온도 등 서서히 변한 오프셋 추종) |
+ * | **≥ ADC_CALIB_TOL_CNT** | 기동 중 전류가 흐른 것으로 보고 저장값 사용 |
+ * @param  없음
+ * @retval 없음
+ */
+static void vAdcCalibApply(void){
+	sFlashLogCalib Calib;
+	float fDiff = 0.0f;
+
+	if(uAdcCalibStored != 0u) {
+		fDiff = MAX(ABS(INV.ADC1Meas.fIaADC1Offset - AdcCalibStored.fIaOffset), ABS(INV.ADC1Meas.fIbADC1Offset - AdcCalibStored.fIbOffset));
+		fDiff = MAX(fDiff, ABS(INV.ADC1Meas.fIcADC1Offset - AdcCalibStored.fIcOffset));
+	}
+
+	if((uAdcCalibStored != 0u) && (fDiff >= ADC_CALIB_TOL_CNT)) {
+		INV.ADC1Meas.fIaADC1Offset = AdcCalibStored.fIaOffset;
+		INV.ADC1Meas.fIbADC1Offset = AdcCalibStored.fIbOffset;
+		INV.ADC1Meas.fIcADC1Offset = AdcCalibStored.fIcOffset;
+		uAdcCalibSrc = ADC_CALIB_SRC_FLASH;
+		return;
+	}
+
+	uAdcCalibSrc = ADC_CALIB_SRC_MEAS;
+	if((uAdcCalibStored == 0u) || (fDiff > ADC_CALIB_SAVE_CNT)) {
+		Calib.fIaOffset = INV.ADC1Meas.fIaADC1Offset;
+		Calib.fIbOffset = INV.ADC1Meas.fIbADC1Offset;
+		Calib.fIcOffset = INV.ADC1Meas.fIcADC1Offset;
+		Calib.ulReserved = 0ul;
+		if(uFlashLogPush(FLOG_TYPE_CALIB, &Calib, sizeof(Calib))) {
+			AdcCalibStored = Calib;
+			uAdcCalibStored = 1u;
+		}
+	}
+}
+
 /**
  * @brief  전류 센서의 외부 ADC 오프셋을 측정하고 평균값을 계산합니다.
  * @note   초기 안정화를 위해 일정 횟수 대기한 후, 지정된 횟수(uAdcOffsetCntMax)만큼
- * ADC 변환 값을 누적하여 평균 오프셋 수치를 도출합니다. 완료 시 다음 상태로 전이합니다.
+ * ADC 변환 값을 누적하여 평균 오프셋 수치를 도출합니다. 플래시 저장값과 비교(vAdcCalibApply)한 뒤 다음 상태로 전이합니다.
  * @param  없음
  * @retval 없음
  */
@@ -63,6 +132,9 @@ void vAdcOffsetCalibration(void){
 		INV.ADC1Meas.fIaADC1Offset = INV.ADC1Meas.fIaADC1Offset / (float)(uAdcOffsetCntMax);		// ADC Offset Calibration
 		INV.ADC1Meas.fIbADC1Offset = INV.ADC1Meas.fIbADC1Offset / (float)(uAdcOffsetCntMax);
 		INV.ADC1Meas.fIcADC1Offset = INV.ADC1Meas.fIcADC1Offset / (float)(uAdcOffsetCntMax);
+		vAdcCalibApply();		// 저장값과 비교 (채택/복원/기록)
+
+		vSetHwTripLevel(fHwCurrTripLev, fHwVdcTripLev);	// 측정된 오프셋으로 하드웨어 차단 레벨 갱신
 
 		uAdcOffsetCnt = 0u;
 		uNextAdcState = ADC_GET_SCALED_VALUE;
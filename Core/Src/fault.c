@@ -12,12 +12,55 @@
  * | 변수명 | 상태값 | 판별 조건 (트리거) |
  * | :--- | :--- | :--- |
  * | **SW_Fault** | 0 (정상) | 시스템 정상 동작 중 |
- * | **SW_Fault** | 1 (고장) | 아래 3가지 조건 중 하나라도 만족할 경우 발생<br> 1. **과전압 (OVP)** : `|fVdc| >= VDC_FAULT_LEV`<br> 2. **과전류 (OCP)** : `|Ias|`, `|Ibs|`, `|Ics|` 중 하나라도 `>= CURR_FAULT_LEV`<br> 3. **과속도 (OSP)** : 모터 속도 `|fWrpmSC| >= SPD_FAULT_LEV` |
+ * | **SW_Fault** | 1 (고장) | `uFaultEvaluate()`에서 디바운스를 통과한 원인이 하나라도 래치된 경우 발생 (아래 원인 표 참조) |
+ * | **TZ_Fault** | 1 (고장) | 소프트웨어 요청 없이 TIM1 Break가 발생한 경우 (비교기에 의한 하드웨어 차단) |
+ *
+ * @details [고장 원인 비트 (uFaultEvaluate)]
+ * 모든 비교를 분기 없이 한 번에 수행하여 비트필드(uFaultRaw)로 만든 뒤, 원인별 카운터로 디바운스하고
+ * 상태/제어 모드별 허용 마스크(FAULT_MASK_IDLE / FAULT_MASK_OPENLOOP / FAULT_MASK_ACTIVE)를 적용하여 uFaultLatch에 누적합니다.
+ * 결과와 무관하게 항상 같은 연산을 수행하므로 실행 시간이 일정합니다.
+ *
+ * | 비트 | 조건 | 디바운스 [주기] |
+ * | :--- | :--- | :--- |
+ * | **FAULT_BIT_OV** | `fVdc >= pCtrlParam->fVdcFaultLev` | FAULT_DEB_OV |
+ * | **FAULT_BIT_UV** | `fVdc <= pCtrlParam->fVdcUvFaultLev` (IDLE 제외) | FAULT_DEB_UV |
+ * | **FAULT_BIT_OC_A/B/C** | `|Ixs| >= pCtrlParam->fCurrFaultLev` | FAULT_DEB_OC |
+ * | **FAULT_BIT_OSPD** | `|fWrpmSC| >= pCtrlParam->fSpdFaultLev` | FAULT_DEB_OSPD |
+ * | **FAULT_BIT_HALL** | 홀 상태 000 또는 111 (IDLE, 홀 미사용 모드 제외) | FAULT_DEB_HALL |
+ * | **FAULT_BIT_OVERRUN** | 직전 vControl 실행 사이클 > 제어 주기 사이클 | FAULT_DEB_OVERRUN |
+ *
+ * @details [하드웨어 1차 보호 (COMP + DAC3 → TIM1 Break)]
+ * 소프트웨어 검사는 제어 주기(50µs)마다 한 번 수행되므로, 단락 시 최대 한 주기 이상 전류가 흐를 수 있습니다.
+ * 이를 보완하기 위해 ADC 입력 핀을 내부 비교기에 함께 연결하고 DAC3 내부 출력을 기준 전압으로 사용하여,
+ * 비교기 출력이 TIM1 Break 입력(BKCMPxE)을 직접 구동하도록 구성합니다. CPU 개입 없이 수백 ns 이내에 MOE가 해제됩니다.
+ *
+ * | 비교기 | (+) 입력 | (-) 입력 | 보호 항목 |
+ * | :--- | :--- | :--- | :--- |
+ * | **COMP3** | PA0 (Ia) | DAC3_CH1 | A상 정방향 과전류 |
+ * | **COMP1** | PA1 (Ib) | DAC3_CH1 | B상 정방향 과전류 |
+ * | **COMP2** | PA3 (Vdc) | DAC3_CH2 | 직류단 과전압 |
+ *
+ * @note 하드웨어 과전류 보호는 A/B상 정방향만 담당하는 단방향 보호입니다.
+ * G474 비교기는 윈도우 모드가 없어 비교기 하나가 한 방향만 검출하고, 부방향 검출에는 같은 핀을 (+) 입력으로 받는 비교기가 하나 더 필요합니다.
+ * 그러나 PA0/PA1을 (+) 입력으로 받을 수 있는 비교기는 이미 사용 중인 COMP3/COMP1뿐이고,
+ * 남는 COMP4/5/6의 (+) 입력은 PB0/PE7, PB13/PD12, PB11/PD11이며 PA2(Ic)는 어느 비교기의 (+) 입력도 아닙니다.
+ * 부방향 검출을 하드웨어로 추가하려면 전류 신호를 위 핀 중 하나에 함께 배선하는 기판 변경이 필요합니다.
+ *
+ * | 단락 경로 (전류 유입 → 유출) | 1차 보호 (COMP) | 2차 보호 (소프트웨어) |
+ * | :--- | :--- | :--- |
+ * | **A → B, A → C** | COMP3 (+Ia) | FAULT_BIT_OC_A/B/C |
+ * | **B → A, B → C** | COMP1 (+Ib) | FAULT_BIT_OC_A/B/C |
+ * | **C → A, C → B** | 없음 (-Ia 또는 -Ib, +Ic) | FAULT_BIT_OC_A/B/C, 최대 FAULT_DEB_OC 제어 주기 지연 |
+ * | **한 레그 상하단 단락 (Shoot-through)** | 없음 (상 전류 센서를 지나지 않음) | 없음 (TIM1 데드타임으로 예방) |
  */
 
+#include <math.h>
 #include <Fault.h>
 #include <GlobalVar.h>
 #include <MotorControl.h>
+#include <BlackBox.h>
+#include <FlashLog.h>
+#include "Param.h"
 #include <stm32g474xx.h>
 #include <stm32g4xx_hal_tim.h>
 #include <sys/_stdint.h>
@@ -31,9 +74,42 @@ uint16_t SW_Fault = 0u;
 /** @brief 시스템 전체 Fault 통합 플래그 */
 uint16_t uFaultFlag = 0u;
 
+/** @brief 고장 원인별 디바운스 횟수 (FAULT_BIT_* 비트 순서) */
+static const uint16_t uFaultDebMax[FAULT_CAUSE_NUM] = {
+		FAULT_DEB_OV, FAULT_DEB_UV, FAULT_DEB_OC, FAULT_DEB_OC,
+		FAULT_DEB_OC, FAULT_DEB_OSPD, FAULT_DEB_HALL, FAULT_DEB_OVERRUN
+};
+
+/** @brief 하드웨어 1차 보호 레벨 (vSetHwTripLevel로 변경) */
+float fHwCurrTripLev = HW_CURR_TRIP_LEV; /**< 과전류 [A] */
+float fHwVdcTripLev = HW_VDC_TRIP_LEV;   /**< 과전압 [V] */
+
 /** @brief PWM 제어에 사용되는 메인 타이머 핸들러 외부 참조 */
 extern TIM_HandleTypeDef htim1;
 
+/**
+ * @brief  고장 정보를 16비트로 압축하여 플래시 로그 큐에 넣습니다.
+ * @note   실제 플래시 기록은 메인 루프의 vFlashLogTask에서 Bank 2에 수행되므로 ISR 지연이 없습니다.
+ * @param  Fault_Infomation 고장 정보 구조체 포인터
+ * @retval 없음
+ */
+static void vFaultLogPush(const sFault_Info* Fault_Infomation){
+	sFlashLogFault Rec;
+
+	Rec.uFaultFirst = Fault_Infomation->uFaultFirst;
+	Rec.uFaultLatch = Fault_Infomation->uFaultLatch;
+	Rec.uTripSrc = Fault_Infomation->uTripSrc;
+	Rec.uState = uCurrState;
+	Rec.iIa = (int16_t)LIMIT(1000.0f * Fault_Infomation->Ia_Fault, -32768.0f, 32767.0f);
+	Rec.iIb = (int16_t)LIMIT(1000.0f * Fault_Infomation->Ib_Fault, -32768.0f, 32767.0f);
+	Rec.iIc = (int16_t)LIMIT(1000.0f * Fault_Infomation->Ic_Fault, -32768.0f, 32767.0f);
+	Rec.iVdc = (int16_t)LIMIT(100.0f * Fault_Infomation->Vdc_Fault, -32768.0f, 32767.0f);
+	Rec.iWrpm = (int16_t)LIMIT(Fault_Infomation->Wrpm_Fault, -32768.0f, 32767.0f);
+	Rec.uReserved = 0u;
+
+	uFlashLogPush(FLOG_TYPE_FAULT, &Rec, sizeof(Rec));
+}
+
 /**
  * @brief  Fault 발생 시 호출되어 하드웨어 출력을 차단하고 당시의 시스템 상태를 기록합니다.
  * @details
@@ -49,11 +125,20 @@ void vFaultEvent(sMotorCtrl* MotorControl, sFault_Info* Fault_Infomation){
 	TIM1->SR = ~TIM_SR_BIF;      /**< Break Interrupt Flag 클리어 */
 	TIM1->BDTR &= ~TIM_BDTR_MOE; /**< Main Output Enable 비트 해제 (PWM 출력 차단) */
 
+	/* 비교기 출력 기록 및 소프트웨어 요청이 아닌 Break는 하드웨어 고장으로 분류 */
+	Fault_Infomation->uTripSrc = ((COMP3->CSR & COMP_CSR_VALUE) ? HW_TRIP_OC_A : HW_TRIP_NONE)
+			| ((COMP1->CSR & COMP_CSR_VALUE) ? HW_TRIP_OC_B : HW_TRIP_NONE)
+			| ((COMP2->CSR & COMP_CSR_VALUE) ? HW_TRIP_OV : HW_TRIP_NONE);
+	if(SW_Fault == 0u) TZ_Fault = 1u;
+	__HAL_TIM_DISABLE_IT(&htim1, TIM_IT_BREAK); /**< 비교기 출력이 유지되는 동안 반복 인터럽트 방지 (vClearFault에서 재활성화) */
+
+	vBlackBoxTrigger(uCurrState, Fault_Infomation->uFaultLatch); /**< 블랙박스 Post-trigger 기록 후 동결 */
+
 	Flag.START = 0u;             /**< 시스템 가동 플래그 해제 */
 
 	vSwitchOffSettingTIM(&htim1); /**< 타이머 채널별 안전 상태 설정 */
 
-	/* 고장 시점의 데이터 캡처 (Black Box 역할) */
+	/* 고장 시점의 데이터 캡처 (직전 이력은 BlackBox 링 버퍼 참조) */
 	Fault_Infomation->Ia_Fault = MotorControl->CC.fIasHall;
 	Fault_Infomation->Ib_Fault = MotorControl->CC.fIbsHall;
 	Fault_Infomation->Ic_Fault = MotorControl->CC.fIcsHall;
@@ -63,6 +148,52 @@ void vFaultEvent(sMotorCtrl* MotorControl, sFault_Info* Fault_Infomation){
 
 	Fault_Infomation->Vdc_Fault = fVdc;
 	Fault_Infomation->Wrpm_Fault = MotorControl->SO.fWrpmSC;
+
+	vFaultLogPush(Fault_Infomation);
+}
+
+/**
+ * @brief  모든 보호 조건을 한 번에 비교하여 원인별 디바운스 및 래치를 수행합니다.
+ * @details
+ * 1. 각 비교 결과(0/1)를 시프트하여 uFaultRaw 비트필드로 합칩니다. (조건 분기 없음)
+ * 2. 원인별 카운터는 검출 시 증가, 미검출 시 0으로 곱셈 리셋되며 디바운스 횟수에서 포화됩니다.
+ * 3. 디바운스를 통과한 원인 중 허용 마스크에 포함된 원인을 래치하고, 최초 원인을 별도로 기록합니다.
+ * @note   홀 무효 판정: `((state + 1) & 7) < 2` 는 state가 0 또는 7일 때만 참입니다.
+ * @param  MotorControl 모터 제어 통합 구조체 포인터
+ * @param  Fault_Infomation 고장 정보 구조체 포인터
+ * @param  uEnMask 현재 상태에서 허용할 고장 원인 마스크 (FAULT_MASK_*)
+ * @retval 래치된 고장 원인 비트 (0: 정상)
+ */
+uint16_t uFaultEvaluate(sMotorCtrl* MotorControl, sFault_Info* Fault_Infomation, uint16_t uEnMask){
+	uint16_t uRaw, uTrip = 0u, uBit, uCnt, uPrevLatch, i;
+	uint32_t ulBudget = (uint32_t)(fTsamp * fSysClkFreq);
+
+	/* 1. 전체 비교를 비트필드로 변환 */
+	uRaw = (uint16_t)((fVdc >= pCtrlParam->fVdcFaultLev) << 0)
+			| (uint16_t)((fVdc <= pCtrlParam->fVdcUvFaultLev) << 1)
+			| (uint16_t)((fabsf(MotorControl->CC.fIasHall) >= pCtrlParam->fCurrFaultLev) << 2)
+			| (uint16_t)((fabsf(MotorControl->CC.fIbsHall) >= pCtrlParam->fCurrFaultLev) << 3)
+			| (uint16_t)((fabsf(MotorControl->CC.fIcsHall) >= pCtrlParam->fCurrFaultLev) << 4)
+			| (uint16_t)((fabsf(MotorControl->SO.fWrpmSC) >= pCtrlParam->fSpdFaultLev) << 5)
+			| (uint16_t)((((MotorControl->SO.uHall_State + 1u) & 0x7u) < 2u) << 6)
+			| (uint16_t)((ulControlCycles > ulBudget) << 7);
+	Fault_Infomation->uFaultRaw = uRaw;
+
+	/* 2. 원인별 디바운스 (고정 반복 횟수) */
+	for(i = 0u; i < FAULT_CAUSE_NUM; i++) {
+		uBit = (uRaw >> i) & 1u;
+		uCnt = (uint16_t)((Fault_Infomation->uDebCnt[i] + uBit) * uBit);
+		uCnt -= (uint16_t)(uCnt > uFaultDebMax[i]);
+		Fault_Infomation->uDebCnt[i] = uCnt;
+		uTrip |= (uint16_t)((uCnt >= uFaultDebMax[i]) << i);
+	}
+
+	/* 3. 래치 및 최초 원인 기록 */
+	uPrevLatch = Fault_Infomation->uFaultLatch;
+	Fault_Infomation->uFaultLatch = uPrevLatch | (uTrip & uEnMask);
+	Fault_Infomation->uFaultFirst |= Fault_Infomation->uFaultLatch & (uint16_t)(0u - (uint16_t)(uPrevLatch == 0u));
+
+	return Fault_Infomation->uFaultLatch;
 }
 
 /**
@@ -96,6 +227,13 @@ void vInitFault(sFault_Info* Fault_Infomation){
 
 	Fault_Infomation->Vdc_Fault = 0.0f;
 	Fault_Infomation->Wrpm_Fault = 0.0f;
+
+	Fault_Infomation->uTripSrc = HW_TRIP_NONE;
+
+	Fault_Infomation->uFaultRaw = 0u;
+	Fault_Infomation->uFaultLatch = 0u;
+	Fault_Infomation->uFaultFirst = 0u;
+	for(uint16_t i = 0u; i < FAULT_CAUSE_NUM; i++) Fault_Infomation->uDebCnt[i] = 0u;
 }
 
 /**
@@ -108,4 +246,64 @@ void vClearFault(){
 	vInitFault(&INV.Fault_Info); /**< 내부 고장 데이터 초기화 */
 	TIM1->SR = ~TIM_SR_BIF;      /**< 남아있는 Break 플래그 클리어 */
 	TIM1->BDTR |= TIM_BDTR_MOE;  /**< Main Output 재활성화 (PWM 가동 가능 상태) */
+	__HAL_TIM_ENABLE_IT(&htim1, TIM_IT_BREAK); /**< 하드웨어 차단 감시 재개 */
+}
+
+/**
+ * @brief  하드웨어 차단 레벨을 DAC3 기준 전압(12bit)으로 변환하여 반영합니다.
+ * @details A상과 B상 비교기는 DAC3_CH1을 공유하므로 두 상의 전류 오프셋 평균을 기준으로 합니다.
+ * 오프셋 보정 전에는 공칭 오프셋(HW_ADC_OFFSET_NOM)을 사용하며, 보정 완료 시 다시 호출됩니다.
+ * @param  fCurrLev 과전류 차단 레벨 [A]
+ * @param  fVdcLev 과전압 차단 레벨 [V]
+ * @retval 없음
+ */
+void vSetHwTripLevel(float fCurrLev, float fVdcLev){
+	float fOffset, fCode;
+
+	fHwCurrTripLev = fCurrLev;
+	fHwVdcTripLev = fVdcLev;
+
+	fOffset = 0.5f * (INV.ADC1Meas.fIaADC1Offset + INV.ADC1Meas.fIbADC1Offset);
+	if(fOffset < 1.0f) fOffset = HW_ADC_OFFSET_NOM;
+
+	fCode = fOffset + fCurrLev * (1.0f / SCALE_ADC_CURR);
+	DAC3->DHR12R1 = (uint32_t)LIMIT(fCode, 0.0f, 4095.0f);
+
+	fCode = fVdcLev * (1.0f / (GAIN_TUNING_ADC_VDC * SCALE_ADC_VDC));
+	DAC3->DHR12R2 = (uint32_t)LIMIT(fCode, 0.0f, 4095.0f);
+}
+
+/**
+ * @brief  COMP1~3과 DAC3을 설정하고 비교기 출력을 TIM1 Break 입력에 연결합니다.
+ * @details
+ * 1. DAC3 두 채널을 내부 연결 전용(외부 핀 없음, 버퍼 비활성) 모드로 설정합니다.
+ * 2. 비교기 (+) 입력은 ADC와 공유하는 측정 핀, (-) 입력은 DAC3 출력으로 설정합니다.
+ * 3. 비교기 기동 시간 경과 후 TIM1 AF1의 BKCMPxE를 설정하여 Break 입력에 OR 연결합니다.
+ * @note   MX_TIM1_Init(BKE, BKP=High) 및 MX_ADC1_Init(PA0/PA1/PA3 아날로그) 이후 호출해야 합니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vInitHwTrip(void){
+	/* 1. DAC3 (내부 전용, 170MHz AHB → HFSEL = 160MHz 초과) */
+	RCC->AHB2ENR |= RCC_AHB2ENR_DAC3EN;
+	(void)RCC->AHB2ENR;
+
+	DAC3->CR = 0u;
+	DAC3->MCR = DAC_MCR_HFSEL_1 | (3UL << DAC_MCR_MODE1_Pos) | (3UL << DAC_MCR_MODE2_Pos);
+	vSetHwTripLevel(fHwCurrTripLev, fHwVdcTripLev);
+	DAC3->CR = DAC_CR_EN1 | DAC_CR_EN2;
+
+	/* 2. 비교기 (SYSCFG 클럭 공유), INMSEL = 100b: DAC3_CH1(COMP1, COMP3) / DAC3_CH2(COMP2) */
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+	(void)RCC->APB2ENR;
+
+	COMP3->CSR = COMP_CSR_INMSEL_2 | COMP_CSR_HYST_1 | COMP_CSR_EN;                      /* PA0 vs DAC3_CH1 */
+	COMP1->CSR = COMP_CSR_INMSEL_2 | COMP_CSR_HYST_1 | COMP_CSR_EN;                      /* PA1 vs DAC3_CH1 */
+	COMP2->CSR = COMP_CSR_INMSEL_2 | COMP_CSR_INPSEL | COMP_CSR_HYST_1 | COMP_CSR_EN;     /* PA3 vs DAC3_CH2 */
+
+	/* 3. DAC 웨이크업 및 비교기 기동 대기 후 Break 입력 연결 (BKCMPxP = 0: BKP 극성을 그대로 사용) */
+	HAL_Delay(1u);
+	TIM1->SR = ~TIM_SR_BIF;
+	TIM1->AF1 |= TIM1_AF1_BKCMP1E | TIM1_AF1_BKCMP2E | TIM1_AF1_BKCMP3E;
+	__HAL_TIM_ENABLE_IT(&htim1, TIM_IT_BREAK);
 }
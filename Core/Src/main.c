@@ -26,11 +26,33 @@
  * | CurrentControl.c | FOC 핵심 알고리즘 – Clarke/Park 변환, PI 제어, SVPWM |
  * | Adc.c | ADC1 초기화 및 3상 전류(Ia, Ib, Ic) / DC링크 전압(Vdc) 측정 |
  * | SpeedObserver.c | Hall Sensor 각도 센싱 및 PLL 속도 추정기 |
- * | Fault.c | 하드웨어/소프트웨어 고장 감지 및 PWM 즉시 차단 |
+ * | Fault.c | 하드웨어(COMP+DAC3 → TIM1 Break)/소프트웨어 고장 감지 및 PWM 즉시 차단 |
  * | SpeedControl.c | PI 속도 제어 |
  * | GlobalVar.c | 모듈 간 공유 전역 변수 |
  * | stm32g4xx_it.c | TIM1(PWM 20kHz), TIM2(제어 20kHz), TIM15 초기화 |
  * | IntDac.c | STM32G474RET6 지원 DAC |
+ * | SyncPwm.c | 고속 영역 동기 PWM (캐리어 주기를 전기 주파수의 정수배로 가변) |
+ * | BlackBox.c | Fault 직전 제어 주기 이력을 기록하는 RAM 링 버퍼 (Break 시 동결) |
+ * | FlashLog.c | Bank 2 플래시 고장/이벤트 로그 (Read-While-Write, 메인 루프에서 비차단 기록) |
+ * | Scope.c | 트리거/Pre-trigger 지원 8채널 소프트웨어 스코프 (더블 버퍼 RAM 캡처) |
+ * | VarTable.c | 모니터링 변수 레지스트리 (이름 해시/주소/타입/단위/스케일, ID로 O(1) 조회) |
+ * | Uart.c | USART1 레지스터 드라이버 (PB6/PB7, DMA 송신, 순환 DMA 수신, CRC-16) |
+ * | Telemetry.c | 제어 주기 단위 바이너리 텔레메트리 스트림 (더블 버퍼, 4Mbps, 선택적 차분 압축) |
+ * | Mailbox.c | 잠금 없는 SPSC 링 버퍼 및 2슬롯 최신값 우편함 (명시적 메모리 배리어) |
+ * | Command.c | 시작/정지/리셋 이벤트 및 설정값 스냅숏을 제어 ISR로 전달 |
+ * | Proto.c | USART1 요청/응답 프로토콜 (변수 읽기/쓰기, 시작/정지/리셋, 설정값/파라미터, 스코프 무장/판독) |
+ * | CanMsg.c | CAN 상태/명령 프레임 데이터 필드 변환 (하드웨어 비의존, 호스트 검증 가능) |
+ * | Can.c | FDCAN1 레지스터 드라이버 (CAN FD 1/5Mbps, 하드웨어 필터, 상태 송신, 명령 수신 및 끊김 감시) |
+ * | Param.c | 제어 이득/제한값/필터 계수 더블 버퍼 세트 (메인 루프 계산, 제어 주기 시작 시 포인터 교체) |
+ * | Throttle.c | RC PWM/DShot/직렬 수신기 스로틀 입력 (TIM5 DMA 캡처, 중앙값/IIR 필터, 불감대/Expo 곡선, Failsafe, 토크/속도 지령) |
+ * | ThrottleMode.c | 스로틀 운전 모드 (전진/제동, 전진/제동/후진 지연, 3D 양방향, 드래그 브레이크, 하드웨어 비의존) |
+ * | DShot.c | DShot150/300/600 프레임 복호, 양방향 eRPM 응답 GCR 부호화, KISS 텔레메트리 프레임 (하드웨어 비의존, 호스트 검증 가능) |
+ * | RcFrame.c | SBUS/CRSF 프레임 파서 및 CRSF 텔레메트리 프레임 생성 (하드웨어 비의존, 호스트 검증 가능) |
+ * | PowerLimit.c | 배터리 전류/전력 추정 및 동적 q축 전류 제한 (전류/전력 제한, 직류단 전압 하한 유지, 회생 과전압 제한) |
+ * | EscTelem.c | ESC 텔레메트리 (직류 전류/소모 용량/온도/eRPM, KISS 프레임 USART2 DMA 송신, 저속 제어에서 갱신) |
+ * | Traction.c | 속도 미분 기반 구동력 제어 (미끄럼 판정 시 q축 전류 즉시 차단, 유지 후 기울기 복귀) 및 출발 토크 프로파일 (하드웨어 비의존) |
+ * | Thermal.c | 권선 I²t/MOSFET 손실 열 모델 (피크 전류 허용 후 연속 정격으로 디레이팅, 저속 제어에서 갱신) |
+ * | RcRx.c | USART3 직렬 수신기 입력 (순환 DMA, 유휴 구간 프레임 경계, 링크 Failsafe, CRSF 텔레메트리 송신) |
  */
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
@@ -41,6 +63,22 @@
 #include "GlobalVar.h"
 #include "Adc.h"
 #include "IntDac.h"
+#include "MotorControl.h"
+#include "SyncPwm.h"
+#include "BlackBox.h"
+#include "FlashLog.h"
+#include "Scope.h"
+#include "Uart.h"
+#include "Telemetry.h"
+#include "Command.h"
+#include "Param.h"
+#include "Proto.h"
+#include "Can.h"
+#include "Throttle.h"
+#include "Traction.h"
+#include "Thermal.h"
+#include "RcRx.h"
+#include "EscTelem.h"
 
 /* USER CODE END Includes */
 
@@ -136,12 +174,30 @@ int main(void)
   MX_DAC2_Init();
   MX_TIM5_Init();
   /* USER CODE BEGIN 2 */
+	vInitParam();
+	vInitThermal();
+	vInitSyncPwm(&htim1);	/* 제어 ISR의 vSyncPwmUpdate/Reset이 사용하므로 TIM1 인터럽트 시작 전에 초기화 */
 	HAL_TIM_Base_Start_IT(&htim1);
 	HAL_LPTIM_TimeOut_Start_IT(&hlptim1, 0x0000, 500);
 	vEnableCycleCounter();
 	vInitAdc();
 	vInitIntDac();
+	vInintMotorParameter(&INV);
 	vInitController();
+	vInitCommand();
+	vInitHwTrip();
+	vInitBlackBox();
+	vInitFlashLog();
+	vAdcLoadCalib();
+	vInitScope();
+	vInitUart(UART_BAUD);
+	vInitTelemetry();
+	vInitProto();
+	vInitCan();
+	vInitThrottle();
+	vTractionInit(&Traction);
+	vInitRcRx();
+	vInitEscTelem();
 
 
 
@@ -155,26 +211,26 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
-		/**
-		 * @brief 외부 입력 PWM 신호 상태 모니터링
-		 * @details 10ms 이상 신호 업데이트가 없으면 주파수를 0Hz로 강제 처리하고,
-		 * 핀의 High/Low 상태에 따라 듀티 사이클을 100% 또는 0%로 설정합니다.
-		 */
-		if ((HAL_GetTick() - uLast_Capture_Time) > 10)
-		{
-			uFrequency = 0; // 주파수는 0Hz로 처리
-
-			// TIM3_CH1 핀의 상태를 직접 읽어서 100%인지 0%인지 판단!
-			// (주의: GPIOA, GPIO_PIN_6 부분은 실제 CubeMX에서 설정된 핀에 맞게 변경하세요)
-			if (HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_2) == GPIO_PIN_SET)
-			{
-				fDuty_Cycle = 100.0f; // 계속 High 상태면 100%
-			}
-			else
-			{
-				fDuty_Cycle = 0.0f;   // 계속 Low 상태면 0%
-			}
-		}
+		/** @brief 플래시 로그 기록 (Bank 2 소거/프로그램을 한 단계씩 진행, 대기 없음) */
+		vFlashLogTask();
+
+		/** @brief 디버거/통신 명령 요청을 제어 ISR 이벤트 큐 및 설정값 우편함으로 전달 */
+		vCmdTask();
+
+		/** @brief 파라미터 변경 요청 시 비활성 세트에 재계산 후 게시 (ISR이 다음 주기 시작에 교체) */
+		vParamTask();
+
+		/** @brief 텔레메트리 차분 압축 및 송신 (압축 모드에서만 동작, 호출당 블록 수 제한) */
+		vTelemTask();
+
+		/** @brief 통신 요청 조립 및 처리 (호출당 요청 1개, 응답은 송신 DMA가 비었을 때 시작) */
+		vProtoTask();
+
+		/** @brief CAN 명령 프레임 처리, 명령 끊김 및 Bus-off 감시 */
+		vCanTask();
+
+		/** @brief 직렬 수신기 소모 용량 적분 및 CRSF 텔레메트리 송신 (송신 DMA가 비었을 때만) */
+		vRcRxTask();
 
 	}
   /* USER CODE END 3 */
@@ -672,8 +728,7 @@ static void MX_TIM5_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN TIM5_Init 2 */
-    HAL_TIM_IC_Start_IT(&htim5, TIM_CHANNEL_1);
-    HAL_TIM_IC_Start_IT(&htim5, TIM_CHANNEL_2);
+    /* 캡처 시작은 vInitThrottle에서 수행 (CCR2 → DMA, 캡처 인터럽트 미사용) */
   /* USER CODE END TIM5_Init 2 */
 
 }
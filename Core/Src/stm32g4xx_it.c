@@ -25,6 +25,8 @@
 
 #include "GlobalVar.h"
 #include "MotorControl.h"
+#include "Throttle.h"
+#include "RcRx.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -289,7 +291,7 @@ void LPTIM1_IRQHandler(void)
 void TIM5_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM5_IRQn 0 */
-
+	vThrottleTurnIrq();
   /* USER CODE END TIM5_IRQn 0 */
   HAL_TIM_IRQHandler(&htim5);
   /* USER CODE BEGIN TIM5_IRQn 1 */
@@ -299,4 +301,27 @@ void TIM5_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles DMA1 channel7 global interrupt (양방향 DShot eRPM 응답 송신 완료).
+  */
+void DMA1_Channel7_IRQHandler(void)
+{
+	vThrottleTxDoneIrq();
+}
+
+/**
+  * @brief This function handles USART3 global interrupt (직렬 수신기 유휴 구간).
+  */
+void USART3_IRQHandler(void)
+{
+	vRcRxIrq();
+}
+
+/**
+  * @brief This function handles DMA2 channel1 global interrupt (직렬 수신기 수신 버퍼 절반/완료).
+  */
+void DMA2_Channel1_IRQHandler(void)
+{
+	vRcRxIrq();
+}
 /* USER CODE END 1 */
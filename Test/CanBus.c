@@ -0,0 +1,277 @@
+/**
+ * @file    CanBus.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 시험용 소프트웨어 CAN 버스 및 FDCAN1 대역 구현 소스 파일
+ * @details 레지스터 쓰기는 값만 남고 부수 효과가 없으므로, FDCAN1 접근마다 호출되는 pCanBusRegs()가 직전에 쓴 TXBAR/RXF0A를
+ * 처리하고 RXF0S/TXFQS를 내부 상태로 다시 만듭니다. Can.c가 한 번의 vCanTask 안에서 RXF0A를 쓰고 RXF0S를 다시 읽어도
+ * 두 번째 읽기 앞에서 해제가 반영되므로 하드웨어와 같은 순서가 관찰됩니다.
+ *
+ * [메시지 RAM] (STM32G4 고정 배치, 워드 오프셋)
+ * | 영역 | 오프셋 | 요소 크기 |
+ * | :--- | :--- | :--- |
+ * | 표준 ID 필터 | 0 | 1 |
+ * | RX FIFO 0 | 44 | 18 |
+ * | TX FIFO | 158 | 18 |
+ */
+
+#include <string.h>
+#include "stm32g4xx_hal.h"
+#include "CanBus.h"
+
+/** @name FDCAN 메시지 RAM (STM32G4 고정 배치)
+ * @{ */
+#define BUS_RAM_WORDS       212u
+#define BUS_RAM_STDF        0u
+#define BUS_RAM_RXF0        44u
+#define BUS_RAM_TXFQ        158u
+#define BUS_ELEM_WORDS      18u
+#define BUS_FIFO_DEPTH      3u
+#define BUS_STDF_MAX        28u
+/** @} */
+
+/** @brief RXF0A 미기록 표시 (유효 인덱스는 0~2) */
+#define BUS_ACK_NONE        0xFFFFFFFFul
+
+sCanBus CanBus;
+FDCAN_Config_TypeDef CanBusConfig;
+uint32_t ulCanBusRam[BUS_RAM_WORDS];
+
+/** @brief FDCAN1 레지스터 */
+static FDCAN_GlobalTypeDef Regs;
+
+/** @brief CAN FD DLC → 데이터 길이 [byte] */
+static const uint8_t uBusDlcLen[16] = {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 12u, 16u, 20u, 24u, 32u, 48u, 64u};
+
+static uint16_t uRxGet, uRxFill;            /**< RX FIFO 0 읽기 인덱스, 저장 수 */
+static uint16_t uTxGet, uTxPut;             /**< TX FIFO 송신 순서 인덱스, 다음 추가 인덱스 */
+static uint16_t uRxLost;                    /**< RF0L */
+
+static sCanFrame Log[CAN_BUS_LOG_MAX];      /**< 장치 송신 프레임 로그 */
+static uint16_t uLogHead, uLogCnt;
+
+/**
+ * @brief  데이터 길이를 담을 수 있는 가장 작은 DLC
+ */
+static uint32_t ulBusLenToDlc(uint16_t uLen){
+	uint32_t ulDlc = 0u;
+
+	while((ulDlc < 15u) && (uBusDlcLen[ulDlc] < uLen)) ulDlc++;
+	return ulDlc;
+}
+
+/**
+ * @brief  TX FIFO 요소를 버스 로그로 옮깁니다.
+ */
+static void vBusTxElem(uint16_t uIdx){
+	const uint32_t* pElem = &ulCanBusRam[BUS_RAM_TXFQ + uIdx * BUS_ELEM_WORDS];
+	sCanFrame* pFrame;
+	uint16_t i;
+
+	if(uLogCnt >= CAN_BUS_LOG_MAX) {
+		CanBus.ulLogDropCnt++;
+		return;
+	}
+	pFrame = &Log[(uLogHead + uLogCnt) % CAN_BUS_LOG_MAX];
+	uLogCnt++;
+
+	memset(pFrame, 0, sizeof(*pFrame));
+	if(pElem[0] & (1ul << 30)) {
+		pFrame->uFlags |= CAN_BUS_XTD;
+		pFrame->ulId = pElem[0] & 0x1FFFFFFFu;
+	}
+	else pFrame->ulId = (pElem[0] >> 18) & 0x7FFu;
+	if(pElem[0] & (1ul << 29)) pFrame->uFlags |= CAN_BUS_RTR;
+	if(pElem[1] & (1ul << 21)) pFrame->uFlags |= CAN_BUS_FD;
+	if(pElem[1] & (1ul << 20)) pFrame->uFlags |= CAN_BUS_BRS;
+	pFrame->uLen = uBusDlcLen[(pElem[1] >> 16) & 0x0Fu];
+	for(i = 0u; i < pFrame->uLen; i++) pFrame->uData[i] = (uint8_t)(pElem[2u + (i >> 2)] >> (8u * (i & 3u)));
+	CanBus.ulTxCnt++;
+}
+
+/**
+ * @brief  밀린 레지스터 쓰기를 처리하고 상태 레지스터를 갱신합니다.
+ */
+static void vBusSync(void){
+	uint32_t ulAck;
+
+	/* RXF0A: 지정 인덱스까지 해제 */
+	if(Regs.RXF0A != BUS_ACK_NONE) {
+		ulAck = Regs.RXF0A;
+		Regs.RXF0A = BUS_ACK_NONE;
+		while(uRxFill > 0u) {
+			uint16_t uIdx = uRxGet;
+
+			uRxGet = (uint16_t)((uRxGet + 1u) % BUS_FIFO_DEPTH);
+			uRxFill--;
+			if(uIdx == ulAck) break;
+		}
+	}
+
+	/* TXBAR: 송신 요청 대기 등록 */
+	if(Regs.TXBAR) {
+		Regs.TXBRP |= Regs.TXBAR & ((1ul << BUS_FIFO_DEPTH) - 1u);
+		while(Regs.TXBAR & (1ul << uTxPut)) {
+			Regs.TXBAR &= ~(1ul << uTxPut);
+			uTxPut = (uint16_t)((uTxPut + 1u) % BUS_FIFO_DEPTH);
+		}
+		Regs.TXBAR = 0u;
+	}
+
+	/* 버스 참여 중이고 ACK가 있으면 FIFO 순서대로 송신 */
+	if(CanBus.uAck && !(Regs.CCCR & FDCAN_CCCR_INIT)) {
+		while(Regs.TXBRP & (1ul << uTxGet)) {
+			vBusTxElem(uTxGet);
+			Regs.TXBRP &= ~(1ul << uTxGet);
+			uTxGet = (uint16_t)((uTxGet + 1u) % BUS_FIFO_DEPTH);
+		}
+	}
+
+	Regs.RXF0S = ((uint32_t)uRxFill << FDCAN_RXF0S_F0FL_Pos) | ((uint32_t)uRxGet << FDCAN_RXF0S_F0GI_Pos)
+			| ((uint32_t)((uRxGet + uRxFill) % BUS_FIFO_DEPTH) << FDCAN_RXF0S_F0PI_Pos)
+			| ((uRxFill >= BUS_FIFO_DEPTH) ? FDCAN_RXF0S_F0F : 0u) | (uRxLost ? FDCAN_RXF0S_RF0L : 0u);
+	Regs.TXFQS = ((uint32_t)(BUS_FIFO_DEPTH - __builtin_popcount(Regs.TXBRP)) << FDCAN_TXFQS_TFFL_Pos)
+			| ((uint32_t)uTxGet << FDCAN_TXFQS_TFGI_Pos) | ((uint32_t)uTxPut << FDCAN_TXFQS_TFQPI_Pos)
+			| ((Regs.TXBRP == ((1ul << BUS_FIFO_DEPTH) - 1u)) ? FDCAN_TXFQS_TFQF : 0u);
+}
+
+/**
+ * @brief  소프트웨어 버스의 FDCAN1 레지스터 (hal/stm32g4xx_hal.h의 FDCAN1)
+ * @retval 레지스터
+ */
+FDCAN_GlobalTypeDef* pCanBusRegs(void){
+	vBusSync();
+	return &Regs;
+}
+
+/**
+ * @brief  FDCAN1을 리셋 상태(CCCR.INIT = 1)로, 버스를 빈 상태로 되돌립니다. (vInitCan 이전 호출)
+ * @param  없음
+ * @retval 없음
+ */
+void vCanBusInit(void){
+	memset(&Regs, 0, sizeof(Regs));
+	memset(ulCanBusRam, 0, sizeof(ulCanBusRam));
+	memset(&CanBus, 0, sizeof(CanBus));
+	Regs.CCCR = FDCAN_CCCR_INIT;
+	Regs.RXF0A = BUS_ACK_NONE;
+	CanBusConfig.CKDIV = 0u;
+	uRxGet = uRxFill = uRxLost = 0u;
+	uTxGet = uTxPut = 0u;
+	uLogHead = uLogCnt = 0u;
+	CanBus.uAck = 1u;
+	vBusSync();
+}
+
+/**
+ * @brief  표준 ID 필터 목록을 적용합니다.
+ * @param  ulId 식별자
+ * @retval SFEC (0: 일치 없음)
+ */
+static uint32_t ulBusStdFilter(uint32_t ulId){
+	uint32_t ulLss = (Regs.RXGFC >> FDCAN_RXGFC_LSS_Pos) & 0x1Fu;
+	uint32_t i, ulF, ulSft, ulSfec, ulId1, ulId2, ulHit;
+
+	if(ulLss > BUS_STDF_MAX) ulLss = BUS_STDF_MAX;
+	for(i = 0u; i < ulLss; i++) {
+		ulF = ulCanBusRam[BUS_RAM_STDF + i];
+		ulSft = ulF >> 30;
+		ulSfec = (ulF >> 27) & 0x7u;
+		ulId1 = (ulF >> 16) & 0x7FFu;
+		ulId2 = ulF & 0x7FFu;
+		if(ulSfec == 0u) continue;
+
+		switch(ulSft){
+		case 0u:	ulHit = (ulId >= ulId1) && (ulId <= ulId2);	break;
+		case 1u:	ulHit = (ulId == ulId1) || (ulId == ulId2);	break;
+		case 2u:	ulHit = ((ulId ^ ulId1) & ulId2) == 0u;		break;
+		default:	ulHit = 0u;									break;
+		}
+		if(ulHit) return ulSfec;
+	}
+	return 0u;
+}
+
+/**
+ * @brief  다른 노드가 프레임을 보냅니다. 장치의 필터를 거쳐 RX FIFO 0에 저장됩니다.
+ * @param  pFrame 프레임
+ * @retval CAN_BUS_RX_*
+ */
+uint16_t uCanBusSend(const sCanFrame* pFrame){
+	uint32_t ulDest, ulDlc, ulWord, i;
+	uint32_t* pElem;
+	uint16_t uXtd = (pFrame->uFlags & CAN_BUS_XTD) ? 1u : 0u;
+	uint16_t uRtr = (pFrame->uFlags & CAN_BUS_RTR) ? 1u : 0u;
+
+	if((pFrame->uLen > CAN_BUS_DATA_MAX) || (!(pFrame->uFlags & CAN_BUS_FD) && (pFrame->uLen > 8u))) return CAN_BUS_RX_INVALID;
+
+	vBusSync();
+	if(Regs.CCCR & FDCAN_CCCR_INIT) return CAN_BUS_RX_OFF;
+
+	/* 전역 필터: 원격 프레임 거부, 필터 목록, 불일치 처리 (0: FIFO 0, 1: FIFO 1, 2/3: 거부) */
+	if(uRtr && (Regs.RXGFC & (uXtd ? FDCAN_RXGFC_RRFE : FDCAN_RXGFC_RRFS))) ulDest = 3u;
+	else {
+		ulDest = uXtd ? 0u : ulBusStdFilter(pFrame->ulId & 0x7FFu);
+		if(ulDest == 0u) ulDest = 1u + ((Regs.RXGFC >> (uXtd ? FDCAN_RXGFC_ANFE_Pos : FDCAN_RXGFC_ANFS_Pos)) & 0x3u);
+	}
+	if(ulDest != 1u) {
+		CanBus.ulRejectCnt++;
+		return CAN_BUS_RX_REJECT;
+	}
+
+	if(uRxFill >= BUS_FIFO_DEPTH) {
+		uRxLost = 1u;
+		CanBus.ulLostCnt++;
+		vBusSync();
+		return CAN_BUS_RX_LOST;
+	}
+
+	ulDlc = ulBusLenToDlc(pFrame->uLen);
+	pElem = &ulCanBusRam[BUS_RAM_RXF0 + ((uRxGet + uRxFill) % BUS_FIFO_DEPTH) * BUS_ELEM_WORDS];
+	memset(pElem, 0, BUS_ELEM_WORDS * 4u);
+	pElem[0] = (uXtd ? ((1ul << 30) | (pFrame->ulId & 0x1FFFFFFFu)) : ((pFrame->ulId & 0x7FFu) << 18)) | ((uint32_t)uRtr << 29);
+	pElem[1] = (ulDlc << 16) | ((pFrame->uFlags & CAN_BUS_FD) ? (1ul << 21) : 0u) | ((pFrame->uFlags & CAN_BUS_BRS) ? (1ul << 20) : 0u);
+	for(i = 0u; i < pFrame->uLen; i++) {
+		ulWord = pElem[2u + (i >> 2)];
+		pElem[2u + (i >> 2)] = ulWord | ((uint32_t)pFrame->uData[i] << (8u * (i & 3u)));
+	}
+	uRxFill++;
+	CanBus.ulRxCnt++;
+	vBusSync();
+	return CAN_BUS_RX_FIFO0;
+}
+
+/**
+ * @brief  장치가 버스에 보낸 프레임을 오래된 순서로 하나 꺼냅니다.
+ * @param  pFrame 출력
+ * @retval 1: 꺼냄, 0: 없음
+ */
+uint16_t uCanBusRecv(sCanFrame* pFrame){
+	vBusSync();
+	if(uLogCnt == 0u) return 0u;
+
+	*pFrame = Log[uLogHead];
+	uLogHead = (uint16_t)((uLogHead + 1u) % CAN_BUS_LOG_MAX);
+	uLogCnt--;
+	return 1u;
+}
+
+/**
+ * @brief  다른 노드의 ACK 여부를 설정합니다. ACK가 돌아오면 대기 중인 송신을 바로 처리합니다.
+ * @param  uAck 1: ACK, 0: ACK 없음 (버스에 다른 노드 없음)
+ * @retval 없음
+ */
+void vCanBusSetAck(uint16_t uAck){
+	CanBus.uAck = uAck;
+	vBusSync();
+}
+
+/**
+ * @brief  장치를 Bus-off로 만듭니다. (하드웨어와 같이 CCCR.INIT = 1)
+ * @param  없음
+ * @retval 없음
+ */
+void vCanBusOff(void){
+	Regs.CCCR |= FDCAN_CCCR_INIT;
+	vBusSync();
+}
@@ -0,0 +1,106 @@
+/**
+ * @file    CanBus.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 시험용 소프트웨어 CAN 버스 및 FDCAN1 대역 헤더 파일
+ * @details 실제 Can.c가 레지스터/메시지 RAM으로 하는 일을 하드웨어처럼 받아 주는 FDCAN1 모형과, 그 노드가 붙은 버스를 함께 둡니다.
+ * Can.c는 hal/stm32g4xx_hal.h의 FDCAN1, SRAMCAN_BASE를 통해 이 모듈의 레지스터와 메시지 RAM에 접근하며,
+ * 시험 프로그램은 버스의 다른 노드로서 프레임을 보내고(uCanBusSend) 장치가 보낸 프레임을 받습니다(uCanBusRecv).
+ *
+ * | 모사 항목 | 동작 |
+ * | :--- | :--- |
+ * | **TX FIFO** (3단) | TXBAR 쓰기 → 대기, 다른 노드의 ACK가 있고 INIT = 0이면 순서대로 버스 로그에 송신 |
+ * | **RX FIFO 0** (3단) | 필터 통과 프레임 저장, 가득 차면 새 프레임 손실 (RF0L), RXF0A 쓰기로 해제 |
+ * | **표준 ID 필터** | RXGFC.LSS개, SFT 범위/이중/Classic, SFEC 사용 안 함/FIFO 0/거부 |
+ * | **전역 필터** | 불일치 ANFS/ANFE, 원격 프레임 RRFS/RRFE (확장 ID 필터는 LSE = 0만 모사) |
+ * | **Bus-off** | vCanBusOff: CCCR.INIT = 1 (송수신 중단, 소프트웨어가 INIT을 풀면 재참여) |
+ *
+ * FIFO 1, 수신 버퍼, 타임스탬프, 인터럽트는 Can.c가 쓰지 않으므로 모사하지 않습니다 (FIFO 1로 가는 프레임은 거부로 셉니다).
+ */
+
+#ifndef TEST_CANBUS_H_
+#define TEST_CANBUS_H_
+
+#include <stdint.h>
+
+/** @name 프레임 플래그
+ * @{ */
+#define CAN_BUS_FD          0x01u               /**< CAN FD 형식 */
+#define CAN_BUS_BRS         0x02u               /**< 데이터 구간 비트 레이트 전환 */
+#define CAN_BUS_XTD         0x04u               /**< 29비트 확장 ID */
+#define CAN_BUS_RTR         0x08u               /**< 원격 프레임 */
+/** @} */
+
+/** @name uCanBusSend 결과
+ * @{ */
+#define CAN_BUS_RX_FIFO0    0u                  /**< 장치 RX FIFO 0에 저장 */
+#define CAN_BUS_RX_REJECT   1u                  /**< 장치 필터가 거부 */
+#define CAN_BUS_RX_LOST     2u                  /**< 필터 통과, RX FIFO 0 가득 차 손실 */
+#define CAN_BUS_RX_OFF      3u                  /**< 장치가 버스에 참여하지 않음 (CCCR.INIT = 1) */
+#define CAN_BUS_RX_INVALID  4u                  /**< 잘못된 프레임 (Classic 8byte 초과, 64byte 초과) */
+/** @} */
+
+/** @name 크기
+ * @{ */
+#define CAN_BUS_DATA_MAX    64u                 /**< 최대 데이터 길이 [byte] */
+#define CAN_BUS_LOG_MAX     64u                 /**< 장치 송신 프레임 로그 깊이 */
+/** @} */
+
+/**
+ * @struct sCanFrame
+ * @brief  버스 위의 프레임
+ */
+typedef struct {
+	uint32_t ulId;              /**< 식별자 (11비트 또는 CAN_BUS_XTD이면 29비트) */
+	uint16_t uLen;              /**< 데이터 길이 [byte] (송신 시 DLC 길이로 올림, 나머지 0) */
+	uint16_t uFlags;            /**< CAN_BUS_* */
+	uint8_t uData[CAN_BUS_DATA_MAX];
+} sCanFrame;
+
+/**
+ * @struct sCanBus
+ * @brief  버스 설정 및 통계
+ */
+typedef struct {
+	uint16_t uAck;              /**< 1: 다른 노드가 ACK (0이면 장치 송신이 TX FIFO에 머뭄) */
+	uint16_t uReserved;
+	uint32_t ulTxCnt;           /**< 장치가 버스에 송신한 프레임 수 */
+	uint32_t ulRxCnt;           /**< RX FIFO 0에 저장한 프레임 수 */
+	uint32_t ulRejectCnt;       /**< 필터가 거부한 프레임 수 */
+	uint32_t ulLostCnt;         /**< RX FIFO 0 가득 참으로 손실한 프레임 수 */
+	uint32_t ulLogDropCnt;      /**< 로그가 가득 차 버린 장치 송신 프레임 수 */
+} sCanBus;
+
+/** @brief 버스 객체 외부 참조 */
+extern sCanBus CanBus;
+
+/**
+ * @brief  FDCAN1을 리셋 상태(CCCR.INIT = 1)로, 버스를 빈 상태로 되돌립니다. (vInitCan 이전 호출)
+ * @retval 없음
+ */
+extern void vCanBusInit(void);
+/**
+ * @brief  다른 노드가 프레임을 보냅니다. 장치의 필터를 거쳐 RX FIFO 0에 저장됩니다.
+ * @param  pFrame 프레임
+ * @retval CAN_BUS_RX_*
+ */
+extern uint16_t uCanBusSend(const sCanFrame* pFrame);
+/**
+ * @brief  장치가 버스에 보낸 프레임을 오래된 순서로 하나 꺼냅니다.
+ * @param  pFrame 출력
+ * @retval 1: 꺼냄, 0: 없음
+ */
+extern uint16_t uCanBusRecv(sCanFrame* pFrame);
+/**
+ * @brief  다른 노드의 ACK 여부를 설정합니다. ACK가 돌아오면 대기 중인 송신을 바로 처리합니다.
+ * @param  uAck 1: ACK, 0: ACK 없음 (버스에 다른 노드 없음)
+ * @retval 없음
+ */
+extern void vCanBusSetAck(uint16_t uAck);
+/**
+ * @brief  장치를 Bus-off로 만듭니다. (하드웨어와 같이 CCCR.INIT = 1)
+ * @retval 없음
+ */
+extern void vCanBusOff(void);
+
+#endif /* TEST_CANBUS_H_ */
@@ -0,0 +1,181 @@
+/**
+ * @file    ProtoDevice.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜(Proto.h) 장치 대역 구현 소스 파일
+ * @details 변수 레지스트리(VarTable.h)가 주소를 참조하는 전역 변수는 펌웨어와 같은 타입으로 정의하고 0으로 둡니다.
+ * 플랜트가 움직이는 변수는 속도(SO.fWrpmSC/fWrpmEst, SC.fWrpmRef), 전류(CC.fIqsr/fIqsrRef), 직류단 전압(fVdc)뿐입니다.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "SyncPwm.h"
+#include "Throttle.h"
+#include "RcRx.h"
+#include "EscTelem.h"
+#include "PowerLimit.h"
+#include "Traction.h"
+#include "Thermal.h"
+#include "Adc.h"
+#include "Filter.h"
+#include "Command.h"
+#include "Param.h"
+#include "Scope.h"
+#include "Telemetry.h"
+#include "Proto.h"
+#include "UartStub.h"
+#include "ProtoDevice.h"
+
+/** @name 플랜트 상수
+ * @{ */
+#define DEV_TAU_CUR         0.001f              /**< 전류 응답 시정수 [s] */
+#define DEV_TAU_SPD         0.05f               /**< 속도 제어 응답 시정수 [s] */
+#define DEV_KT_RPM          2000.0f             /**< 전류 모드 가속도 [RPM/s/A] */
+#define DEV_DAMP            0.5f                /**< 전류 모드 점성 감쇠 [1/s] */
+#define DEV_KI_ACC          0.002f              /**< 속도 모드 가속 전류 [A/(RPM/s)] */
+#define DEV_R_BAT           0.05f               /**< 배터리 내부 저항 [Ohm] */
+/** @} */
+
+/** @name 펌웨어 전역 변수 (GlobalVar.c, main.c 등의 대역)
+ * @{ */
+float fSysClkFreq = 170.0e6f, fTimIntFreq = 0.0f;
+float fTsamp = 0.0f, fTSc = 0.0f;
+float fVdc = 0.0f;
+uint16_t uControlMode = SPDCONTL_MODE;
+float fVdqsrRefSet = 0.0f;
+uint16_t uCurrState = IDLE_STATE;
+uint16_t SW_Fault = 0u, TZ_Fault = 0u;
+uint32_t ulControlCycles = 0ul;
+float fElapsedTimeUs = 0.0f;
+uint32_t ulOverrunCnt = 0ul;
+uint16_t uAdcCalibSrc = 0u;
+sMotorCtrl INV;
+FLAG_REG Flag;
+IIR2 IIR2WrpmSCLPF, IIR2WrmSCLPF;
+sSyncPwm SyncPwm;
+sThrottle Throttle;
+sRcRx RcRx;
+sEscTelem EscTelem;
+sPowerLimit PwrLim;
+sTraction Traction;
+sThermal Thermal;
+/** @} */
+
+uint32_t ulDevCycles = 0ul;
+
+/**
+ * @brief  모의 시각 [ms]
+ * @retval 시각
+ */
+uint32_t HAL_GetTick(void){
+	return ulDevCycles / DEV_CYCLES_PER_MS;
+}
+
+/**
+ * @brief  펌웨어 초기화 순서(main.c)대로 모듈을 초기화합니다. 텔레메트리 송신은 꺼 둡니다.
+ * @details 텔레메트리는 TELEM 명령으로 켤 수 있으며, 켜면 응답과 같은 송신 경로에 섞여 나갑니다.
+ * @param  없음
+ * @retval 없음
+ */
+void vDevInit(void){
+	memset(&INV, 0, sizeof(INV));
+	memset(&Flag, 0, sizeof(Flag));
+	ulDevCycles = 0ul;
+	fTimIntFreq = DEV_CTRL_FREQ;
+	fTsamp = 1.0f / DEV_CTRL_FREQ;
+	fTSc = DEV_SC_TS;
+	fVdc = DEV_VDC_NOM;
+	uControlMode = SPDCONTL_MODE;
+	fVdqsrRefSet = 0.0f;
+	uCurrState = IDLE_STATE;
+	SW_Fault = TZ_Fault = 0u;
+
+	vInitParam();
+	vInitCommand();
+	vInitScope();
+	vInitUart(UART_BAUD);
+	vInitTelemetry();
+	Telem.uEnable = 0u;
+	vInitProto();
+}
+
+/**
+ * @brief  제어 모드별 단순 플랜트를 한 주기 진행합니다.
+ * @param  없음
+ * @retval 없음
+ */
+static void vDevPlant(void){
+	float fAcc, fIqRef = 0.0f;
+
+	if(uCurrState != RUN_STATE) {
+		INV.SC.fWrpmRef = INV.SO.fWrpmSC;
+	}
+	else if(uControlMode == SPDCONTL_MODE) {
+		/* 목표 속도까지 가속 기울기로 램프, 실제 속도는 1차 지연 */
+		fAcc = ParamCfg.fWrpmAcc * fTsamp;
+		if(INV.SC.fWrpmRef < INV.SC.fWrpmRefSet)	INV.SC.fWrpmRef = fminf(INV.SC.fWrpmRef + fAcc, INV.SC.fWrpmRefSet);
+		else										INV.SC.fWrpmRef = fmaxf(INV.SC.fWrpmRef - fAcc, INV.SC.fWrpmRefSet);
+		fIqRef = DEV_KI_ACC * (INV.SC.fWrpmRef - INV.SO.fWrpmSC) / DEV_TAU_SPD;
+	}
+	else if((uControlMode == VECTCONTL_MODE) || (uControlMode == CONST_CUR_MODE)) {
+		fIqRef = INV.CC.fIqsrRefSet;
+	}
+
+	INV.CC.fIqsrRef = fIqRef;
+	INV.CC.fIdsrRef = (uCurrState == RUN_STATE) ? INV.CC.fIdsrRefSet : 0.0f;
+	INV.CC.fIqsr += (INV.CC.fIqsrRef - INV.CC.fIqsr) * fTsamp / DEV_TAU_CUR;
+	INV.CC.fIdsr += (INV.CC.fIdsrRef - INV.CC.fIdsr) * fTsamp / DEV_TAU_CUR;
+
+	if(uControlMode == SPDCONTL_MODE)	INV.SO.fWrpmSC += (INV.SC.fWrpmRef - INV.SO.fWrpmSC) * fTsamp / DEV_TAU_SPD;
+	else								INV.SO.fWrpmSC += (DEV_KT_RPM * INV.CC.fIqsr - DEV_DAMP * INV.SO.fWrpmSC) * fTsamp;
+	INV.SO.fWrpmEst = INV.SO.fWrpmSC;
+	fVdc = DEV_VDC_NOM - DEV_R_BAT * fabsf(INV.CC.fIqsr);
+}
+
+/**
+ * @brief  제어 ISR 1회: 명령/파라미터 적용, 상태 전이, 플랜트, 기록
+ * @param  없음
+ * @retval 없음
+ */
+static void vDevControl(void){
+	vParamFetch();
+	vCmdFetch();
+
+	if(Flag.RESET) {
+		Flag.RESET = 0u;
+		Flag.START = 0u;
+		SW_Fault = TZ_Fault = 0u;
+		uCurrState = IDLE_STATE;
+		INV.SC.fWrpmRefSet = INV.CC.fIdsrRefSet = INV.CC.fIqsrRefSet = 0.0f;	/* vInitController */
+		vCmdApply();
+	}
+	switch(uCurrState){
+	case IDLE_STATE:	if(Flag.START) uCurrState = RUN_STATE;	break;
+	case RUN_STATE:		if(!Flag.START) uCurrState = IDLE_STATE;	break;
+	default:			break;
+	}
+
+	vDevPlant();
+	vScopeRecord();
+	vTelemRecord();
+	ulControlCycles = 2000ul;
+	fElapsedTimeUs = 11.8f;
+}
+
+/**
+ * @brief  메인 루프 1회와 제어 ISR 1회를 실행합니다.
+ * @param  ulCycles 반복 횟수
+ * @retval 없음
+ */
+void vDevStep(uint32_t ulCycles){
+	while(ulCycles--) {
+		vProtoTask();
+		vCmdTask();
+		vParamTask();
+		vTelemTask();
+		vDevControl();
+		ulDevCycles++;
+	}
+}
@@ -0,0 +1,52 @@
+/**
+ * @file    ProtoDevice.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜(Proto.h) 장치 대역 헤더 파일 (보드 없이 호스트 도구를 시험하기 위한 펌웨어 일부 + 단순 플랜트)
+ * @details 실제 Proto.c, Command.c, Param.c, Scope.c, Telemetry.c, VarTable.c를 그대로 실행하고, 나머지 펌웨어가 정의하는
+ * 전역 변수만 이 모듈이 대신 정의합니다. 송수신은 UartStub.h의 콜백으로 연결합니다.
+ *
+ * | 단계 (vDevStep 1회 = 제어 주기 1회) | 호출 |
+ * | :--- | :--- |
+ * | **메인 루프** | vProtoTask, vCmdTask, vParamTask, vTelemTask |
+ * | **제어 ISR** | vParamFetch, vCmdFetch, 상태 전이, 플랜트, vScopeRecord, vTelemRecord |
+ *
+ * | 상태 전이 (단순화) | 조건 |
+ * | :--- | :--- |
+ * | **IDLE → RUN** | Flag.START = 1 |
+ * | **RUN → IDLE** | Flag.START = 0 |
+ * | **FAULT → IDLE** | Flag.RESET = 1 (SW_Fault, TZ_Fault 해제) |
+ *
+ * 플랜트는 제어 모드별로 목표값을 1차 지연으로 따라가는 정도의 모형이며, 제어기 성능을 보려는 것이 아니라
+ * 변수 읽기/쓰기, 시작/정지, 스코프 트리거가 보드와 같은 순서로 관찰되게 하는 용도입니다.
+ */
+
+#ifndef TEST_PROTODEVICE_H_
+#define TEST_PROTODEVICE_H_
+
+#include <stdint.h>
+
+/** @name 모의 시간
+ * @{ */
+#define DEV_CTRL_FREQ       20000.0f            /**< 제어 주기 주파수 [Hz] */
+#define DEV_SC_TS           0.0005f             /**< 속도 제어 주기 [s] (fTSc) */
+#define DEV_CYCLES_PER_MS   20u                 /**< 1ms당 제어 주기 수 (HAL_GetTick 분해능) */
+#define DEV_VDC_NOM         16.0f               /**< 무부하 직류단 전압 [V] */
+/** @} */
+
+/** @brief 누적 제어 주기 수 (HAL_GetTick = ulDevCycles / DEV_CYCLES_PER_MS) */
+extern uint32_t ulDevCycles;
+
+/**
+ * @brief  펌웨어 초기화 순서(main.c)대로 모듈을 초기화합니다. 텔레메트리 송신은 꺼 둡니다.
+ * @retval 없음
+ */
+extern void vDevInit(void);
+/**
+ * @brief  메인 루프 1회와 제어 ISR 1회를 실행합니다.
+ * @param  ulCycles 반복 횟수
+ * @retval 없음
+ */
+extern void vDevStep(uint32_t ulCycles);
+
+#endif /* TEST_PROTODEVICE_H_ */
@@ -0,0 +1,362 @@
+/**
+ * @file    ProtoHost.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜(Proto.h) 호스트 클라이언트 구현 소스 파일
+ * @details 펌웨어 소스에 의존하지 않고 Proto.h의 형식 상수만 사용합니다. CRC는 텔레메트리 복원기(TelemDecode.c)의
+ * 독립 구현을 함께 씁니다. 바이트 순서를 직접 조립하므로 호스트 엔디언과 무관합니다.
+ */
+
+#include <string.h>
+#include "TelemDecode.h"
+#include "ProtoHost.h"
+
+/** @brief 리틀 엔디언 16비트 읽기 */
+static inline uint16_t uGetU16(const uint8_t* p){ return (uint16_t)(p[0] | ((uint16_t)p[1] << 8)); }
+/** @brief 리틀 엔디언 32비트 읽기 */
+static inline uint32_t ulGetU32(const uint8_t* p){ return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+/** @brief 리틀 엔디언 float 읽기 */
+static inline float fGetF32(const uint8_t* p){ uint32_t ul = ulGetU32(p); float f; memcpy(&f, &ul, 4u); return f; }
+/** @brief 리틀 엔디언 16비트 쓰기 */
+static inline void vPutU16(uint8_t* p, uint16_t u){ p[0] = (uint8_t)u; p[1] = (uint8_t)(u >> 8); }
+/** @brief 리틀 엔디언 32비트 쓰기 */
+static inline void vPutU32(uint8_t* p, uint32_t ul){ p[0] = (uint8_t)ul; p[1] = (uint8_t)(ul >> 8); p[2] = (uint8_t)(ul >> 16); p[3] = (uint8_t)(ul >> 24); }
+/** @brief 리틀 엔디언 float 쓰기 */
+static inline void vPutF32(uint8_t* p, float f){ uint32_t ul; memcpy(&ul, &f, 4u); vPutU32(p, ul); }
+
+/**
+ * @brief  클라이언트를 초기화합니다. (제한 시간/재전송 횟수는 기본값)
+ * @param  pHost 클라이언트
+ * @param  pLink 송수신 연결
+ * @retval 없음
+ */
+void vProtoHostInit(sProtoHost* pHost, const sProtoLink* pLink){
+	memset(pHost, 0, sizeof(*pHost));
+	pHost->Link = *pLink;
+	pHost->uTimeoutMs = PROTO_HOST_TIMEOUT_MS;
+	pHost->uRetryMax = PROTO_HOST_RETRY;
+}
+
+/**
+ * @brief  요청 프레임을 만듭니다.
+ * @param  pFrame 출력 (PROTO_FRAME_MAX 이상)
+ * @param  uSeq 순번
+ * @param  uOp 명령 코드
+ * @param  pReq 요청 페이로드
+ * @param  uLen 요청 페이로드 길이 (≤ PROTO_PAYLOAD_MAX)
+ * @retval 프레임 길이
+ */
+uint16_t uProtoHostFrame(uint8_t* pFrame, uint8_t uSeq, uint8_t uOp, const uint8_t* pReq, uint16_t uLen){
+	vPutU16(&pFrame[0], PROTO_SYNC_REQ);
+	pFrame[2] = uSeq;
+	pFrame[3] = uOp;
+	vPutU16(&pFrame[4], uLen);
+	if(uLen != 0u) memcpy(&pFrame[PROTO_HDR_LEN], pReq, uLen);
+	vPutU16(&pFrame[PROTO_HDR_LEN + uLen], uTelemDecCrc(&pFrame[2], uLen + 4u));
+	return (uint16_t)(PROTO_HDR_LEN + uLen + 2u);
+}
+
+/**
+ * @brief  조립 버퍼 앞쪽 바이트를 버립니다.
+ * @param  pHost 클라이언트
+ * @param  uNum 바이트 수
+ * @retval 없음
+ */
+static void vProtoHostDrop(sProtoHost* pHost, uint16_t uNum){
+	memmove(pHost->uRxBuf, &pHost->uRxBuf[uNum], pHost->uRxLen - uNum);
+	pHost->uRxLen -= uNum;
+}
+
+/**
+ * @brief  조립 버퍼 앞쪽에서 응답 프레임을 찾습니다.
+ * @param  pHost 클라이언트
+ * @retval 응답 프레임 길이, 0: 바이트가 더 필요함
+ */
+static uint16_t uProtoHostScan(sProtoHost* pHost){
+	uint16_t uLen;
+
+	while(pHost->uRxLen >= 2u) {
+		if(uGetU16(pHost->uRxBuf) != PROTO_SYNC_RSP) {
+			pHost->ulSkipBytes++;
+			vProtoHostDrop(pHost, 1u);
+			continue;
+		}
+		if(pHost->uRxLen < PROTO_HDR_LEN) return 0u;
+
+		uLen = uGetU16(&pHost->uRxBuf[4]);
+		if((uLen == 0u) || (uLen > PROTO_PAYLOAD_MAX)) {
+			pHost->ulCrcErrCnt++;
+			vProtoHostDrop(pHost, 1u);
+			continue;
+		}
+		if(pHost->uRxLen < (PROTO_HDR_LEN + uLen + 2u)) return 0u;
+		if(uTelemDecCrc(&pHost->uRxBuf[2], uLen + 4u) != uGetU16(&pHost->uRxBuf[PROTO_HDR_LEN + uLen])) {
+			pHost->ulCrcErrCnt++;
+			vProtoHostDrop(pHost, 1u);
+			continue;
+		}
+		return (uint16_t)(PROTO_HDR_LEN + uLen + 2u);
+	}
+	return 0u;
+}
+
+/**
+ * @brief  요청 1개를 보내고 응답을 기다립니다.
+ * @details 제한 시간 안에 순번과 명령 코드가 같은 응답이 없으면 같은 순번으로 재전송합니다.
+ * @param  pHost 클라이언트
+ * @param  uOp 명령 코드
+ * @param  pReq 요청 페이로드
+ * @param  uReqLen 요청 페이로드 길이
+ * @param  pRsp 응답 데이터 (상태 코드 이후, PROTO_PAYLOAD_MAX 이상, NULL 가능)
+ * @param  puRspLen 응답 데이터 길이 (NULL 가능)
+ * @retval 상태 코드 (PROTO_OK / PROTO_ERR_*) 또는 PROTO_HOST_TIMEOUT
+ */
+uint16_t uProtoCall(sProtoHost* pHost, uint8_t uOp, const uint8_t* pReq, uint16_t uReqLen,
+		uint8_t* pRsp, uint16_t* puRspLen){
+	uint8_t uFrame[PROTO_FRAME_MAX];
+	uint8_t uSeq = pHost->uSeq++;
+	uint16_t uFrameLen, uRsp, uLen, uStatus, uTry;
+	uint32_t ulStart, ulWait;
+	int iRd;
+
+	if(uReqLen > PROTO_PAYLOAD_MAX) return PROTO_ERR_LEN;
+	uFrameLen = uProtoHostFrame(uFrame, uSeq, uOp, pReq, uReqLen);
+
+	for(uTry = 0u; uTry <= pHost->uRetryMax; uTry++) {
+		if(uTry != 0u) pHost->ulRetryCnt++;
+		if(pHost->Link.pfWrite(pHost->Link.pCtx, uFrame, uFrameLen) != 0) return PROTO_HOST_TIMEOUT;
+
+		ulStart = pHost->Link.pfTickMs(pHost->Link.pCtx);
+		while((ulWait = pHost->Link.pfTickMs(pHost->Link.pCtx) - ulStart) < pHost->uTimeoutMs) {
+			iRd = pHost->Link.pfRead(pHost->Link.pCtx, &pHost->uRxBuf[pHost->uRxLen],
+					(uint16_t)(sizeof(pHost->uRxBuf) - pHost->uRxLen), (int)(pHost->uTimeoutMs - ulWait));
+			if(iRd < 0) return PROTO_HOST_TIMEOUT;
+			if(iRd == 0) break;
+			pHost->uRxLen += (uint16_t)iRd;
+
+			while((uRsp = uProtoHostScan(pHost)) != 0u) {
+				if((pHost->uRxBuf[2] != uSeq) || (pHost->uRxBuf[3] != uOp)) {
+					pHost->ulStaleCnt++;
+					vProtoHostDrop(pHost, uRsp);
+					continue;
+				}
+				uLen = (uint16_t)(uGetU16(&pHost->uRxBuf[4]) - 1u);
+				uStatus = pHost->uRxBuf[PROTO_HDR_LEN];
+				if(pRsp != NULL) memcpy(pRsp, &pHost->uRxBuf[PROTO_HDR_LEN + 1u], uLen);
+				if(puRspLen != NULL) *puRspLen = uLen;
+				vProtoHostDrop(pHost, uRsp);
+				return uStatus;
+			}
+		}
+	}
+	return PROTO_HOST_TIMEOUT;
+}
+
+/**
+ * @brief  응답 데이터 길이를 확인하는 호출 (길이가 다르면 PROTO_ERR_LEN)
+ */
+static uint16_t uProtoCallLen(sProtoHost* pHost, uint8_t uOp, const uint8_t* pReq, uint16_t uReqLen,
+		uint8_t* pRsp, uint16_t uRspLen){
+	uint16_t uLen = 0u, uStatus = uProtoCall(pHost, uOp, pReq, uReqLen, pRsp, &uLen);
+
+	if((uStatus == PROTO_OK) && (uLen != uRspLen)) uStatus = PROTO_ERR_LEN;
+	return uStatus;
+}
+
+/** @brief PING: 버전, 변수 수, 파라미터 수를 읽습니다. */
+uint16_t uProtoPing(sProtoHost* pHost, uint16_t* puVer, uint16_t* puVarNum, uint16_t* puParamNum){
+	uint8_t uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t uStatus = uProtoCallLen(pHost, PROTO_OP_PING, NULL, 0u, uRsp, 8u);
+
+	if(uStatus != PROTO_OK) return uStatus;
+	*puVer = uGetU16(&uRsp[0]);
+	*puVarNum = uGetU16(&uRsp[2]);
+	*puParamNum = uGetU16(&uRsp[4]);
+	return PROTO_OK;
+}
+
+/** @brief VAR_INFO: 변수 이름, 타입, 단위, 기본 스케일을 읽습니다. */
+uint16_t uProtoVarInfo(sProtoHost* pHost, uint16_t uId, sProtoVarInfo* pInfo){
+	uint8_t uReq[2], uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t uLen = 0u, uStatus;
+
+	vPutU16(uReq, uId);
+	uStatus = uProtoCall(pHost, PROTO_OP_VAR_INFO, uReq, 2u, uRsp, &uLen);
+	if(uStatus != PROTO_OK) return uStatus;
+	if(uLen < 10u) return PROTO_ERR_LEN;
+	pInfo->ulHash = ulGetU32(&uRsp[0]);
+	pInfo->uType = uRsp[4];
+	pInfo->uUnit = uRsp[5];
+	pInfo->fScale = fGetF32(&uRsp[6]);
+	memcpy(pInfo->cName, &uRsp[10], uLen - 10u);
+	pInfo->cName[uLen - 10u] = '\0';
+	return PROTO_OK;
+}
+
+/** @brief VAR_READ: uNum개(≤ PROTO_READ_MAX)를 한 요청으로 읽습니다. */
+uint16_t uProtoVarRead(sProtoHost* pHost, const uint16_t* pId, uint16_t uNum, uint32_t* pRaw){
+	uint8_t uReq[2u * PROTO_READ_MAX], uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t i, uStatus;
+
+	if((uNum == 0u) || (uNum > PROTO_READ_MAX)) return PROTO_ERR_LEN;
+	for(i = 0u; i < uNum; i++) vPutU16(&uReq[2u * i], pId[i]);
+	uStatus = uProtoCallLen(pHost, PROTO_OP_VAR_READ, uReq, (uint16_t)(2u * uNum), uRsp, (uint16_t)(4u * uNum));
+	if(uStatus != PROTO_OK) return uStatus;
+	for(i = 0u; i < uNum; i++) pRaw[i] = ulGetU32(&uRsp[4u * i]);
+	return PROTO_OK;
+}
+
+/** @brief VAR_WRITE: 원시값(float 비트 패턴 또는 정수)을 씁니다. */
+uint16_t uProtoVarWrite(sProtoHost* pHost, uint16_t uId, uint32_t ulRaw){
+	uint8_t uReq[6];
+
+	vPutU16(&uReq[0], uId);
+	vPutU32(&uReq[2], ulRaw);
+	return uProtoCallLen(pHost, PROTO_OP_VAR_WRITE, uReq, 6u, NULL, 0u);
+}
+
+/** @brief CMD: CMD_START / CMD_STOP / CMD_RESET */
+uint16_t uProtoCmd(sProtoHost* pHost, uint8_t uCmd){
+	return uProtoCallLen(pHost, PROTO_OP_CMD, &uCmd, 1u, NULL, 0u);
+}
+
+/** @brief SET_WRITE: 모드(PROTO_SET_MODE)는 정수로, 나머지는 float로 보냅니다. */
+uint16_t uProtoSetWrite(sProtoHost* pHost, uint8_t uField, float fVal){
+	uint8_t uReq[5];
+
+	uReq[0] = uField;
+	if(uField == PROTO_SET_MODE)	vPutU32(&uReq[1], (uint32_t)fVal);
+	else							vPutF32(&uReq[1], fVal);
+	return uProtoCallLen(pHost, PROTO_OP_SET_WRITE, uReq, 5u, NULL, 0u);
+}
+
+/** @brief SET_GET: 설정값 4개(PROTO_SET_WRPM ~ PROTO_SET_VDQSR 순서)와 제어 모드를 읽습니다. */
+uint16_t uProtoSetGet(sProtoHost* pHost, float* pVal, uint16_t* puMode){
+	uint8_t uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t i, uStatus = uProtoCallLen(pHost, PROTO_OP_SET_GET, NULL, 0u, uRsp, 18u);
+
+	if(uStatus != PROTO_OK) return uStatus;
+	for(i = 0u; i < 4u; i++) pVal[i] = fGetF32(&uRsp[4u * i]);
+	*puMode = uGetU16(&uRsp[16]);
+	return PROTO_OK;
+}
+
+/** @brief PARAM_GET: 설계 입력 1개를 읽습니다. */
+uint16_t uProtoParamGet(sProtoHost* pHost, uint8_t uIdx, float* pVal){
+	uint8_t uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t uStatus = uProtoCallLen(pHost, PROTO_OP_PARAM_GET, &uIdx, 1u, uRsp, 4u);
+
+	if(uStatus == PROTO_OK) *pVal = fGetF32(uRsp);
+	return uStatus;
+}
+
+/** @brief PARAM_SET: 설계 입력 1개를 바꿉니다. (적용은 PARAM_COMMIT) */
+uint16_t uProtoParamSet(sProtoHost* pHost, uint8_t uIdx, float fVal){
+	uint8_t uReq[5];
+
+	uReq[0] = uIdx;
+	vPutF32(&uReq[1], fVal);
+	return uProtoCallLen(pHost, PROTO_OP_PARAM_SET, uReq, 5u, NULL, 0u);
+}
+
+/** @brief PARAM_STATUS: 계산 대기, 오류 비트, 게시 횟수, 적용 버전을 읽습니다. */
+uint16_t uProtoParamStatus(sProtoHost* pHost, uint16_t* puPending, uint16_t* puErr, uint32_t* pulCommit, uint32_t* pulVer){
+	uint8_t uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t uStatus = uProtoCallLen(pHost, PROTO_OP_PARAM_STATUS, NULL, 0u, uRsp, 12u);
+
+	if(uStatus != PROTO_OK) return uStatus;
+	*puPending = uGetU16(&uRsp[0]);
+	*puErr = uGetU16(&uRsp[2]);
+	*pulCommit = ulGetU32(&uRsp[4]);
+	*pulVer = ulGetU32(&uRsp[8]);
+	return PROTO_OK;
+}
+
+/** @brief SCOPE_ARM: 채널과 트리거 조건을 보내고 재무장합니다. */
+uint16_t uProtoScopeArm(sProtoHost* pHost, const sProtoScopeCfg* pCfg){
+	uint8_t uReq[12u + 2u * SCOPE_CH_MAX];
+	uint16_t i;
+
+	if(pCfg->uChNum > SCOPE_CH_MAX) return PROTO_ERR_ARG;
+	uReq[0] = pCfg->uMode;
+	uReq[1] = pCfg->uChNum;
+	vPutU16(&uReq[2], pCfg->uDecim);
+	vPutU16(&uReq[4], pCfg->uPreTrig);
+	uReq[6] = pCfg->uTrigCh;
+	uReq[7] = pCfg->uTrigType;
+	vPutF32(&uReq[8], pCfg->fTrigLevel);
+	for(i = 0u; i < pCfg->uChNum; i++) vPutU16(&uReq[12u + 2u * i], pCfg->uId[i]);
+	return uProtoCallLen(pHost, PROTO_OP_SCOPE_ARM, uReq, (uint16_t)(12u + 2u * pCfg->uChNum), NULL, 0u);
+}
+
+/** @brief SCOPE_STATUS */
+uint16_t uProtoScopeStatus(sProtoHost* pHost, sProtoScopeStatus* pSt){
+	uint8_t uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t uStatus = uProtoCallLen(pHost, PROTO_OP_SCOPE_STATUS, NULL, 0u, uRsp, 12u);
+
+	if(uStatus != PROTO_OK) return uStatus;
+	pSt->uState = uRsp[0];
+	pSt->uReady = uRsp[1];
+	pSt->uChNum = uRsp[2];
+	pSt->uPreTrig = uGetU16(&uRsp[4]);
+	pSt->uDepth = uGetU16(&uRsp[6]);
+	pSt->ulCaptureCnt = ulGetU32(&uRsp[8]);
+	return PROTO_OK;
+}
+
+/**
+ * @brief 완료 버퍼 전체(SCOPE_DEPTH 샘플)를 여러 SCOPE_READ로 내려받습니다.
+ * @details 요청당 샘플 수는 응답 페이로드에 들어가는 최대값(255 이하)입니다.
+ * @param  pHost 클라이언트
+ * @param  uChNum 채널 수 (무장 시 채널 수와 같아야 함)
+ * @param  piDst 출력 [SCOPE_DEPTH][uChNum]
+ * @retval 상태 코드
+ */
+uint16_t uProtoScopeDownload(sProtoHost* pHost, uint16_t uChNum, int16_t* piDst){
+	uint8_t uReq[4], uRsp[PROTO_PAYLOAD_MAX];
+	uint16_t uStart, uNum, uChunk, i, uStatus;
+
+	if((uChNum == 0u) || (uChNum > SCOPE_CH_MAX)) return PROTO_ERR_ARG;
+	uChunk = (uint16_t)((PROTO_PAYLOAD_MAX - 1u) / (2u * uChNum));
+	if(uChunk > 255u) uChunk = 255u;
+
+	for(uStart = 0u; uStart < SCOPE_DEPTH; uStart = (uint16_t)(uStart + uNum)) {
+		uNum = (uint16_t)(((SCOPE_DEPTH - uStart) < uChunk) ? (SCOPE_DEPTH - uStart) : uChunk);
+		vPutU16(&uReq[0], uStart);
+		uReq[2] = (uint8_t)uNum;
+		uReq[3] = ((uStart + uNum) < SCOPE_DEPTH) ? 1u : 0u;
+		uStatus = uProtoCallLen(pHost, PROTO_OP_SCOPE_READ, uReq, 4u, uRsp, (uint16_t)(2u * uNum * uChNum));
+		if(uStatus != PROTO_OK) return uStatus;
+		for(i = 0u; i < (uint16_t)(uNum * uChNum); i++) {
+			piDst[(uint32_t)uStart * uChNum + i] = (int16_t)uGetU16(&uRsp[2u * i]);
+		}
+	}
+	return PROTO_OK;
+}
+
+/** @brief TELEM: 텔레메트리 송신 사용과 모드(0xFF: 유지)를 바꿉니다. */
+uint16_t uProtoTelem(sProtoHost* pHost, uint8_t uEnable, uint8_t uMode){
+	uint8_t uReq[2];
+
+	uReq[0] = uEnable;
+	uReq[1] = uMode;
+	return uProtoCallLen(pHost, PROTO_OP_TELEM, uReq, 2u, NULL, 0u);
+}
+
+/**
+ * @brief  상태 코드 문자열
+ * @param  uStatus uProtoCall 반환값
+ * @retval 문자열
+ */
+const char* pProtoStatusStr(uint16_t uStatus){
+	switch(uStatus){
+	case PROTO_OK:				return "ok";
+	case PROTO_ERR_OP:			return "unknown op";
+	case PROTO_ERR_LEN:			return "bad length";
+	case PROTO_ERR_ARG:			return "bad argument";
+	case PROTO_ERR_BUSY:		return "busy";
+	case PROTO_ERR_RO:			return "read-only";
+	case PROTO_HOST_TIMEOUT:	return "timeout";
+	default:					return "unknown status";
+	}
+}
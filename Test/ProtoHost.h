@@ -0,0 +1,177 @@
+/**
+ * @file    ProtoHost.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜(Proto.h) 호스트 클라이언트 헤더 파일
+ * @details 요청 프레임을 만들어 보내고 응답을 기다리는 동기 호출과, 그 위의 명령별 함수를 제공합니다.
+ * 송수신은 sProtoLink 콜백으로 추상화하여 같은 코드를 직렬 포트(proto_cli)와 메모리 연결(test_proto)에서 씁니다.
+ *
+ * | 상황 | 처리 |
+ * | :--- | :--- |
+ * | **응답 동기 워드 아님** | 1바이트 버림 (ulSkipBytes, 같은 포트의 텔레메트리 프레임 포함) |
+ * | **응답 CRC 오류 / 길이 초과** | 1바이트 버린 뒤 재동기 (ulCrcErrCnt) |
+ * | **순번/명령 코드 불일치** | 이전 재전송의 늦은 응답으로 보고 버림 (ulStaleCnt) |
+ * | **응답 제한 시간 초과** | 같은 순번으로 재전송 (uRetryMax회), 모두 실패하면 PROTO_HOST_TIMEOUT |
+ *
+ * 장치는 같은 순번의 재전송도 다시 처리하므로, 재전송되는 요청(VAR_WRITE, SET_WRITE 등)은 모두 멱등입니다.
+ */
+
+#ifndef TEST_PROTOHOST_H_
+#define TEST_PROTOHOST_H_
+
+#include <stdint.h>
+#include "Proto.h"
+#include "Scope.h"
+
+/** @brief 호출 결과: 응답 없음 (상태 코드 PROTO_OK / PROTO_ERR_*와 구분) */
+#define PROTO_HOST_TIMEOUT  0x100u
+/** @brief 기본 응답 제한 시간 [ms] */
+#define PROTO_HOST_TIMEOUT_MS 100u
+/** @brief 기본 재전송 횟수 */
+#define PROTO_HOST_RETRY    3u
+
+/**
+ * @struct sProtoLink
+ * @brief  송수신 연결
+ */
+typedef struct {
+	/** @brief 요청 프레임 전체를 보냅니다. (0: 성공) */
+	int (*pfWrite)(void* pCtx, const uint8_t* pData, uint16_t uLen);
+	/** @brief 최대 iTimeoutMs 동안 기다려 받은 바이트를 채웁니다. (0: 시간 초과, 음수: 오류) */
+	int (*pfRead)(void* pCtx, uint8_t* pDst, uint16_t uMax, int iTimeoutMs);
+	/** @brief 단조 시각 [ms] (응답 제한 시간 기준, 메모리 연결은 모의 시각) */
+	uint32_t (*pfTickMs)(void* pCtx);
+	void* pCtx;                 /**< 콜백 인자 */
+} sProtoLink;
+
+/**
+ * @struct sProtoHost
+ * @brief  클라이언트 상태
+ */
+typedef struct {
+	sProtoLink Link;            /**< 송수신 연결 */
+	uint16_t uTimeoutMs;        /**< 응답 제한 시간 [ms] */
+	uint16_t uRetryMax;         /**< 재전송 횟수 */
+	uint8_t uSeq;               /**< 다음 요청 순번 */
+	uint8_t uRxBuf[PROTO_FRAME_MAX]; /**< 응답 조립 버퍼 */
+	uint16_t uRxLen;            /**< uRxBuf에 쌓인 바이트 수 */
+	uint32_t ulRetryCnt;        /**< 재전송 횟수 */
+	uint32_t ulCrcErrCnt;       /**< CRC 오류 또는 길이 초과 응답 수 */
+	uint32_t ulStaleCnt;        /**< 순번/명령 코드가 다른 응답 수 */
+	uint32_t ulSkipBytes;       /**< 동기 워드를 찾으며 버린 바이트 수 */
+} sProtoHost;
+
+/**
+ * @struct sProtoVarInfo
+ * @brief  VAR_INFO 응답
+ */
+typedef struct {
+	uint32_t ulHash;            /**< 이름 해시 */
+	uint8_t uType;              /**< 변수 타입 (DCH_TYPE_*) */
+	uint8_t uUnit;              /**< 물리 단위 (VAR_UNIT_*) */
+	float fScale;               /**< 기본 스케일 */
+	char cName[PROTO_PAYLOAD_MAX]; /**< 이름 */
+} sProtoVarInfo;
+
+/**
+ * @struct sProtoScopeCfg
+ * @brief  SCOPE_ARM 요청
+ */
+typedef struct {
+	uint8_t uMode;              /**< SCOPE_MODE_* */
+	uint8_t uChNum;             /**< 채널 수 (1 ~ SCOPE_CH_MAX) */
+	uint16_t uDecim;            /**< 분주 */
+	uint16_t uPreTrig;          /**< Pre-trigger 샘플 수 */
+	uint8_t uTrigCh;            /**< 트리거 채널 */
+	uint8_t uTrigType;          /**< SCOPE_TRIG_* */
+	float fTrigLevel;           /**< 트리거 레벨 (채널 물리값) */
+	uint16_t uId[SCOPE_CH_MAX]; /**< 채널 변수 ID */
+} sProtoScopeCfg;
+
+/**
+ * @struct sProtoScopeStatus
+ * @brief  SCOPE_STATUS 응답
+ */
+typedef struct {
+	uint8_t uState;             /**< SCOPE_STATE_* */
+	uint8_t uReady;             /**< 1: 완료 버퍼 있음 */
+	uint8_t uChNum;             /**< 채널 수 */
+	uint16_t uPreTrig;          /**< Pre-trigger 샘플 수 */
+	uint16_t uDepth;            /**< 캡처당 샘플 수 */
+	uint32_t ulCaptureCnt;      /**< 캡처 수 */
+} sProtoScopeStatus;
+
+/**
+ * @brief  클라이언트를 초기화합니다. (제한 시간/재전송 횟수는 기본값)
+ * @param  pHost 클라이언트
+ * @param  pLink 송수신 연결
+ * @retval 없음
+ */
+extern void vProtoHostInit(sProtoHost* pHost, const sProtoLink* pLink);
+/**
+ * @brief  요청 프레임을 만듭니다.
+ * @param  pFrame 출력 (PROTO_FRAME_MAX 이상)
+ * @param  uSeq 순번
+ * @param  uOp 명령 코드
+ * @param  pReq 요청 페이로드
+ * @param  uLen 요청 페이로드 길이 (≤ PROTO_PAYLOAD_MAX)
+ * @retval 프레임 길이
+ */
+extern uint16_t uProtoHostFrame(uint8_t* pFrame, uint8_t uSeq, uint8_t uOp, const uint8_t* pReq, uint16_t uLen);
+/**
+ * @brief  요청 1개를 보내고 응답을 기다립니다.
+ * @param  pHost 클라이언트
+ * @param  uOp 명령 코드
+ * @param  pReq 요청 페이로드
+ * @param  uReqLen 요청 페이로드 길이
+ * @param  pRsp 응답 데이터 (상태 코드 이후, PROTO_PAYLOAD_MAX 이상, NULL 가능)
+ * @param  puRspLen 응답 데이터 길이 (NULL 가능)
+ * @retval 상태 코드 (PROTO_OK / PROTO_ERR_*) 또는 PROTO_HOST_TIMEOUT
+ */
+extern uint16_t uProtoCall(sProtoHost* pHost, uint8_t uOp, const uint8_t* pReq, uint16_t uReqLen,
+		uint8_t* pRsp, uint16_t* puRspLen);
+
+/** @name 명령별 호출 (반환값은 uProtoCall과 같음)
+ * @{ */
+/** @brief PING: 버전, 변수 수, 파라미터 수 */
+extern uint16_t uProtoPing(sProtoHost* pHost, uint16_t* puVer, uint16_t* puVarNum, uint16_t* puParamNum);
+/** @brief VAR_INFO */
+extern uint16_t uProtoVarInfo(sProtoHost* pHost, uint16_t uId, sProtoVarInfo* pInfo);
+/** @brief VAR_READ: uNum개(≤ PROTO_READ_MAX)를 한 요청으로 읽음 */
+extern uint16_t uProtoVarRead(sProtoHost* pHost, const uint16_t* pId, uint16_t uNum, uint32_t* pRaw);
+/** @brief VAR_WRITE */
+extern uint16_t uProtoVarWrite(sProtoHost* pHost, uint16_t uId, uint32_t ulRaw);
+/** @brief CMD: CMD_START / CMD_STOP / CMD_RESET */
+extern uint16_t uProtoCmd(sProtoHost* pHost, uint8_t uCmd);
+/** @brief SET_WRITE: 모드(PROTO_SET_MODE)는 정수로, 나머지는 float로 보냄 */
+extern uint16_t uProtoSetWrite(sProtoHost* pHost, uint8_t uField, float fVal);
+/** @brief SET_GET: fVal[PROTO_SET_WRPM ~ PROTO_SET_VDQSR], 제어 모드 */
+extern uint16_t uProtoSetGet(sProtoHost* pHost, float* pVal, uint16_t* puMode);
+/** @brief PARAM_GET */
+extern uint16_t uProtoParamGet(sProtoHost* pHost, uint8_t uIdx, float* pVal);
+/** @brief PARAM_SET */
+extern uint16_t uProtoParamSet(sProtoHost* pHost, uint8_t uIdx, float fVal);
+/** @brief PARAM_STATUS: 계산 대기, 오류 비트, 게시 횟수, 적용 버전 */
+extern uint16_t uProtoParamStatus(sProtoHost* pHost, uint16_t* puPending, uint16_t* puErr, uint32_t* pulCommit, uint32_t* pulVer);
+/** @brief SCOPE_ARM */
+extern uint16_t uProtoScopeArm(sProtoHost* pHost, const sProtoScopeCfg* pCfg);
+/** @brief SCOPE_STATUS */
+extern uint16_t uProtoScopeStatus(sProtoHost* pHost, sProtoScopeStatus* pSt);
+/**
+ * @brief 완료 버퍼 전체(SCOPE_DEPTH 샘플)를 여러 SCOPE_READ로 내려받습니다.
+ * @details 마지막 요청 전까지 판독 잠금을 유지하므로 NORMAL 모드에서도 한 캡처의 샘플만 섞임 없이 읽습니다.
+ * @param  piDst 출력 [SCOPE_DEPTH][uChNum] (시간 순서, 0번이 가장 오래된 샘플)
+ */
+extern uint16_t uProtoScopeDownload(sProtoHost* pHost, uint16_t uChNum, int16_t* piDst);
+/** @brief TELEM: 송신 사용, 모드 (0xFF: 유지) */
+extern uint16_t uProtoTelem(sProtoHost* pHost, uint8_t uEnable, uint8_t uMode);
+/** @} */
+
+/**
+ * @brief  상태 코드 문자열
+ * @param  uStatus uProtoCall 반환값
+ * @retval 문자열
+ */
+extern const char* pProtoStatusStr(uint16_t uStatus);
+
+#endif /* TEST_PROTOHOST_H_ */
@@ -0,0 +1,81 @@
+/**
+ * @file    Pty.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 도구용 의사 터미널(pty)과 직렬 포트 열기 구현 소스 파일
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include "Pty.h"
+
+/**
+ * @brief  파일 기술자를 원시 모드로 설정합니다.
+ * @param  iFd 파일 기술자
+ * @param  ulBaud 통신 속도 [bps] (0: 변경 안 함)
+ * @retval 0: 성공, -1: 실패
+ */
+static int iTtyRaw(int iFd, unsigned long ulBaud){
+	struct termios Tio;
+	speed_t Speed = 0;
+
+	if(tcgetattr(iFd, &Tio) != 0) return -1;
+	cfmakeraw(&Tio);
+	Tio.c_cflag |= CLOCAL | CREAD;
+	Tio.c_cc[VMIN] = 1;
+	Tio.c_cc[VTIME] = 0;
+
+	switch(ulBaud) {
+	case 115200ul:	Speed = B115200; break;
+	case 921600ul:	Speed = B921600; break;
+	case 1000000ul:	Speed = B1000000; break;
+	case 2000000ul:	Speed = B2000000; break;
+	case 4000000ul:	Speed = B4000000; break;
+	default:		break;
+	}
+	if(Speed != 0) {
+		cfsetispeed(&Tio, Speed);
+		cfsetospeed(&Tio, Speed);
+	}
+	return tcsetattr(iFd, TCSANOW, &Tio);
+}
+
+/**
+ * @brief  pty 마스터를 원시 모드로 엽니다.
+ * @param  pName 슬레이브 경로 출력 버퍼
+ * @param  ulSize 버퍼 크기
+ * @retval 마스터 파일 기술자, -1: 실패
+ */
+int iPtyOpenMaster(char* pName, size_t ulSize){
+	int iFd = posix_openpt(O_RDWR | O_NOCTTY);
+
+	if(iFd < 0) return -1;
+	if((grantpt(iFd) != 0) || (unlockpt(iFd) != 0) || (ptsname_r(iFd, pName, ulSize) != 0)) {
+		close(iFd);
+		return -1;
+	}
+	(void)iTtyRaw(iFd, 0ul);
+	return iFd;
+}
+
+/**
+ * @brief  직렬 포트(또는 pty 슬레이브)를 원시 모드 8N1로 엽니다.
+ * @param  pPath 장치 경로
+ * @param  ulBaud 통신 속도 [bps]
+ * @retval 파일 기술자, -1: 실패
+ */
+int iSerialOpen(const char* pPath, unsigned long ulBaud){
+	int iFd = open(pPath, O_RDWR | O_NOCTTY);
+
+	if(iFd < 0) return -1;
+	if(iTtyRaw(iFd, ulBaud) != 0) {
+		close(iFd);
+		return -1;
+	}
+	return iFd;
+}
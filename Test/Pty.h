@@ -0,0 +1,30 @@
+/**
+ * @file    Pty.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 도구용 의사 터미널(pty)과 직렬 포트 열기 헤더 파일
+ * @details 장치 대역(telem_sim 등)은 pty 마스터를 열고 슬레이브 경로를 출력하며, 호스트 도구(telem_decode 등)는
+ * 그 경로를 실제 USB-UART 장치(/dev/ttyUSB0 등)와 같은 방법으로 엽니다. 두 쪽 모두 원시 모드(cfmakeraw)로 설정합니다.
+ */
+
+#ifndef TEST_PTY_H_
+#define TEST_PTY_H_
+
+#include <stddef.h>
+
+/**
+ * @brief  pty 마스터를 원시 모드로 엽니다.
+ * @param  pName 슬레이브 경로 출력 버퍼
+ * @param  ulSize 버퍼 크기
+ * @retval 마스터 파일 기술자, -1: 실패
+ */
+extern int iPtyOpenMaster(char* pName, size_t ulSize);
+/**
+ * @brief  직렬 포트(또는 pty 슬레이브)를 원시 모드 8N1로 엽니다.
+ * @param  pPath 장치 경로
+ * @param  ulBaud 통신 속도 [bps] (pty는 무시, 표준 속도가 아니면 설정하지 않음)
+ * @retval 파일 기술자, -1: 실패
+ */
+extern int iSerialOpen(const char* pPath, unsigned long ulBaud);
+
+#endif /* TEST_PTY_H_ */
@@ -0,0 +1,226 @@
+/**
+ * @file    TelemDecode.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 스트림(Telemetry.h 형식) 호스트 복원기 구현 소스 파일
+ * @details 펌웨어 소스에 의존하지 않고 Telemetry.h의 형식 상수만 사용합니다. 바이트 순서를 직접 조립하므로 호스트 엔디언과 무관합니다.
+ */
+
+#include <string.h>
+#include "TelemDecode.h"
+
+/** @brief 고정 형식 프레임 길이 [byte] */
+#define TELEM_DEC_FRAME_LEN ((uint16_t)sizeof(sTelemFrame))
+
+/** @brief 압축 블록 헤더 길이 (동기 워드 ~ 페이로드 길이) [byte] */
+#define TELEM_DEC_HDR_LEN   8u
+
+/**
+ * @struct sBitReader
+ * @brief  LSB 우선 비트 판독 상태 (펌웨어 sBitWriter의 역)
+ */
+typedef struct {
+	const uint8_t* pSrc;        /**< 입력 */
+	uint16_t uLen;              /**< 입력 바이트 수 */
+	uint16_t uPos;              /**< 다음에 읽을 바이트 */
+	uint32_t ulAcc;             /**< 아직 꺼내지 않은 비트 */
+	uint16_t uBits;             /**< ulAcc의 유효 비트 수 */
+	uint16_t uOver;             /**< 1: 입력 끝을 넘어 읽음 */
+} sBitReader;
+
+/**
+ * @brief  리틀 엔디언 16비트 값을 읽습니다.
+ * @param  p 위치
+ * @retval 값
+ */
+static inline uint16_t uGetU16(const uint8_t* p){
+	return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+/**
+ * @brief  하위부터 uNum 비트를 꺼냅니다.
+ * @param  pBr 비트 판독 상태
+ * @param  uNum 비트 수 (0 ~ 24)
+ * @retval 값
+ */
+static uint32_t ulGetBits(sBitReader* pBr, uint16_t uNum){
+	uint32_t ulVal;
+
+	while(pBr->uBits < uNum) {
+		if(pBr->uPos < pBr->uLen)	pBr->ulAcc |= (uint32_t)pBr->pSrc[pBr->uPos++] << pBr->uBits;
+		else						pBr->uOver = 1u;
+		pBr->uBits += 8u;
+	}
+	ulVal = pBr->ulAcc & ((1UL << uNum) - 1UL);
+	pBr->ulAcc >>= uNum;
+	pBr->uBits -= uNum;
+	return ulVal;
+}
+
+/**
+ * @brief  CRC-16/CCITT-FALSE (다항식 0x1021, 초기값 0xFFFF)
+ * @param  pData 데이터
+ * @param  ulLen 바이트 수
+ * @retval CRC
+ */
+uint16_t uTelemDecCrc(const uint8_t* pData, size_t ulLen){
+	uint16_t uCrc = 0xFFFFu, i;
+
+	while(ulLen--) {
+		uCrc ^= (uint16_t)(*pData++ << 8);
+		for(i = 0u; i < 8u; i++) {
+			uCrc = (uCrc & 0x8000u) ? (uint16_t)((uCrc << 1) ^ 0x1021u) : (uint16_t)(uCrc << 1);
+		}
+	}
+	return uCrc;
+}
+
+/**
+ * @brief  압축 블록 1개(동기 워드 ~ CRC)를 복원합니다.
+ * @details 채널마다 [폭 w: 5bit][첫 샘플: 16bit][ZigZag 잔차 × (N-1): w bit]를 읽고, 펌웨어와 같은 예측
+ * (1차: x[k-1], 2차: 2·x[k-1] - x[k-2], k = 1은 항상 1차)에 잔차를 더합니다. 페이로드를 정확히 다 써야 유효합니다.
+ * @param  pBlk 블록 시작
+ * @param  uLen pBlk 이후 사용 가능한 바이트 수
+ * @param  pOut 출력 샘플 (TELEM_BLOCK_LEN개)
+ * @retval 블록 바이트 수, 0: 길이 부족, TELEM_DEC_BAD: 잘못된 헤더 또는 CRC 오류
+ */
+uint16_t uTelemDecBlock(const uint8_t* pBlk, uint16_t uLen, sTelemSample* pOut){
+	sBitReader Br;
+	uint32_t ulZz;
+	int32_t lX, lX1, lX2, lRes;
+	uint16_t uPay, uSeq, uCh, k, uWidth, uOrder2;
+
+	if(uLen < TELEM_DEC_HDR_LEN) return 0u;
+	if((uGetU16(pBlk) != TELEM_SYNC_DELTA) || (pBlk[4] != TELEM_BLOCK_LEN)) return TELEM_DEC_BAD;
+	uPay = uGetU16(&pBlk[6]);
+	if((TELEM_DEC_HDR_LEN + uPay + 2u) > TELEM_DELTA_FRAME_MAX) return TELEM_DEC_BAD;
+	if(uLen < (TELEM_DEC_HDR_LEN + uPay + 2u)) return 0u;
+	if(uTelemDecCrc(&pBlk[2], TELEM_DEC_HDR_LEN - 2u + uPay) != uGetU16(&pBlk[TELEM_DEC_HDR_LEN + uPay])) return TELEM_DEC_BAD;
+
+	uSeq = uGetU16(&pBlk[2]);
+	Br = (sBitReader){&pBlk[TELEM_DEC_HDR_LEN], uPay, 0u, 0ul, 0u, 0u};
+	for(uCh = 0u; uCh < TELEM_CH_NUM; uCh++) {
+		uOrder2 = (pBlk[5] >> uCh) & 1u;
+		uWidth = (uint16_t)ulGetBits(&Br, 5u);
+		if(uWidth > TELEM_RES_BITS_MAX) return TELEM_DEC_BAD;
+
+		lX1 = (int16_t)ulGetBits(&Br, 16u);
+		lX2 = lX1;
+		pOut[0].iCh[uCh] = (int16_t)lX1;
+		for(k = 1u; k < TELEM_BLOCK_LEN; k++) {
+			ulZz = ulGetBits(&Br, uWidth);
+			lRes = (int32_t)(ulZz >> 1) ^ -(int32_t)(ulZz & 1u);
+			lX = ((uOrder2 && (k >= 2u)) ? (2 * lX1 - lX2) : lX1) + lRes;
+			pOut[k].iCh[uCh] = (int16_t)lX;
+			lX2 = lX1;
+			lX1 = lX;
+		}
+	}
+	if(Br.uOver || (Br.uPos != uPay)) return TELEM_DEC_BAD;
+
+	for(k = 0u; k < TELEM_BLOCK_LEN; k++) pOut[k].uSeq = (uint16_t)(uSeq + k);
+	return (uint16_t)(TELEM_DEC_HDR_LEN + uPay + 2u);
+}
+
+/**
+ * @brief  복원 상태를 초기화합니다.
+ * @param  pDec 복원 상태
+ * @param  pfSample 샘플 콜백 (NULL 가능)
+ * @param  pCtx 콜백 인자
+ * @retval 없음
+ */
+void vTelemDecInit(sTelemDecoder* pDec, pfTelemSample pfSample, void* pCtx){
+	memset(pDec, 0, sizeof(*pDec));
+	pDec->pfSample = pfSample;
+	pDec->pCtx = pCtx;
+}
+
+/**
+ * @brief  순번을 검사하고 샘플을 콜백에 전달합니다.
+ * @param  pDec 복원 상태
+ * @param  pSample 샘플
+ * @retval 없음
+ */
+static void vTelemDecEmit(sTelemDecoder* pDec, const sTelemSample* pSample){
+	if(pDec->uSynced && (pSample->uSeq != pDec->uSeqNext)) {
+		pDec->ulLostCnt += (uint16_t)(pSample->uSeq - pDec->uSeqNext);
+	}
+	pDec->uSynced = 1u;
+	pDec->uSeqNext = (uint16_t)(pSample->uSeq + 1u);
+	pDec->ulSampleCnt++;
+	if(pDec->pfSample != NULL) pDec->pfSample(pSample, pDec->pCtx);
+}
+
+/**
+ * @brief  조립 버퍼 앞쪽 바이트를 버립니다.
+ * @param  pDec 복원 상태
+ * @param  uNum 바이트 수
+ * @retval 없음
+ */
+static void vTelemDecDrop(sTelemDecoder* pDec, uint16_t uNum){
+	memmove(pDec->uBuf, &pDec->uBuf[uNum], pDec->uLen - uNum);
+	pDec->uLen -= uNum;
+}
+
+/**
+ * @brief  조립 버퍼 앞쪽에서 프레임 또는 압축 블록을 찾아 처리합니다.
+ * @param  pDec 복원 상태
+ * @retval 1: 버퍼를 소비함 (다시 시도), 0: 바이트가 더 필요함
+ */
+static uint16_t uTelemDecStep(sTelemDecoder* pDec){
+	sTelemSample Sample[TELEM_BLOCK_LEN];
+	uint16_t i, uBlk;
+
+	if(pDec->uLen < 2u) return 0u;
+
+	if(uGetU16(pDec->uBuf) == TELEM_SYNC_DELTA) {
+		uBlk = uTelemDecBlock(pDec->uBuf, pDec->uLen, Sample);
+		if(uBlk == 0u) return 0u;
+		if(uBlk == TELEM_DEC_BAD) {
+			pDec->ulCrcErrCnt++;
+			vTelemDecDrop(pDec, 1u);
+			return 1u;
+		}
+		pDec->ulBlockCnt++;
+		for(i = 0u; i < TELEM_BLOCK_LEN; i++) vTelemDecEmit(pDec, &Sample[i]);
+		vTelemDecDrop(pDec, uBlk);
+		return 1u;
+	}
+	if(uGetU16(pDec->uBuf) != TELEM_SYNC) {
+		pDec->ulSkipBytes++;
+		vTelemDecDrop(pDec, 1u);
+		return 1u;
+	}
+	if(pDec->uLen < TELEM_DEC_FRAME_LEN) return 0u;
+
+	if(uTelemDecCrc(&pDec->uBuf[2], TELEM_DEC_FRAME_LEN - 4u) != uGetU16(&pDec->uBuf[TELEM_DEC_FRAME_LEN - 2u])) {
+		pDec->ulCrcErrCnt++;
+		vTelemDecDrop(pDec, 1u);
+		return 1u;
+	}
+
+	Sample[0].uSeq = uGetU16(&pDec->uBuf[2]);
+	for(i = 0u; i < TELEM_CH_NUM; i++) {
+		Sample[0].iCh[i] = (int16_t)uGetU16(&pDec->uBuf[4u + 2u * i]);
+	}
+	pDec->ulFrameCnt++;
+	vTelemDecEmit(pDec, &Sample[0]);
+	vTelemDecDrop(pDec, TELEM_DEC_FRAME_LEN);
+	return 1u;
+}
+
+/**
+ * @brief  수신 바이트를 넣고, 완성된 프레임/블록의 샘플을 콜백으로 전달합니다.
+ * @param  pDec 복원 상태
+ * @param  pData 수신 바이트
+ * @param  ulLen 바이트 수
+ * @retval 없음
+ */
+void vTelemDecFeed(sTelemDecoder* pDec, const uint8_t* pData, size_t ulLen){
+	pDec->ulRxBytes += (uint32_t)ulLen;
+
+	while(ulLen--) {
+		pDec->uBuf[pDec->uLen++] = *pData++;
+		while(uTelemDecStep(pDec)) {}
+	}
+}
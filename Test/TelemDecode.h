@@ -0,0 +1,90 @@
+/**
+ * @file    TelemDecode.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 스트림(Telemetry.h 형식) 호스트 복원기 헤더 파일
+ * @details 수신 바이트열을 임의 단위로 넣으면 고정 형식 프레임(TELEM_SYNC)과 차분 압축 블록(TELEM_SYNC_DELTA)을 찾아
+ * CRC를 검사하고 샘플 단위로 콜백에 전달합니다. 같은 포트로 섞여 오는 다른 프레임(Proto 응답 등)은 동기 워드가 달라 건너뜁니다.
+ *
+ * | 상황 | 처리 |
+ * | :--- | :--- |
+ * | **동기 워드 아님** | 1바이트 버림 (ulSkipBytes) |
+ * | **CRC 오류 / 잘못된 블록 헤더** | 1바이트 버린 뒤 재동기 (ulCrcErrCnt) |
+ * | **순번 불연속** | 빠진 샘플 수를 ulLostCnt에 더함 (펌웨어의 ulDropCnt와 대응) |
+ */
+
+#ifndef TEST_TELEMDECODE_H_
+#define TEST_TELEMDECODE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Telemetry.h"
+
+/** @brief uTelemDecBlock 반환값: 잘못된 블록 */
+#define TELEM_DEC_BAD       0xFFFFu
+
+/**
+ * @struct sTelemSample
+ * @brief  복원된 샘플 1개
+ */
+typedef struct {
+	uint16_t uSeq;              /**< 순번 */
+	int16_t iCh[TELEM_CH_NUM];  /**< 채널 샘플 (펌웨어 iPackDataChannel 값) */
+} sTelemSample;
+
+/** @brief 샘플 콜백 */
+typedef void (*pfTelemSample)(const sTelemSample* pSample, void* pCtx);
+
+/**
+ * @struct sTelemDecoder
+ * @brief  스트림 복원 상태
+ */
+typedef struct {
+	uint8_t uBuf[TELEM_DELTA_FRAME_MAX]; /**< 프레임 조립 버퍼 */
+	uint16_t uLen;              /**< uBuf에 쌓인 바이트 수 */
+	uint16_t uSeqNext;          /**< 다음에 올 순번 */
+	uint16_t uSynced;           /**< 1: 첫 샘플 수신 후 (순번 비교 가능) */
+	pfTelemSample pfSample;     /**< 샘플 콜백 */
+	void* pCtx;                 /**< 콜백 인자 */
+	uint32_t ulSampleCnt;       /**< 복원한 샘플 수 */
+	uint32_t ulFrameCnt;        /**< 고정 형식 프레임 수 */
+	uint32_t ulBlockCnt;        /**< 압축 블록 수 */
+	uint32_t ulCrcErrCnt;       /**< CRC 오류 또는 잘못된 블록 수 */
+	uint32_t ulLostCnt;         /**< 순번 불연속으로 빠진 샘플 수 */
+	uint32_t ulSkipBytes;       /**< 동기 워드를 찾으며 버린 바이트 수 */
+	uint32_t ulRxBytes;         /**< 입력 바이트 수 */
+} sTelemDecoder;
+
+/**
+ * @brief  복원 상태를 초기화합니다.
+ * @param  pDec 복원 상태
+ * @param  pfSample 샘플 콜백 (NULL 가능)
+ * @param  pCtx 콜백 인자
+ * @retval 없음
+ */
+extern void vTelemDecInit(sTelemDecoder* pDec, pfTelemSample pfSample, void* pCtx);
+/**
+ * @brief  수신 바이트를 넣고, 완성된 프레임/블록의 샘플을 콜백으로 전달합니다.
+ * @param  pDec 복원 상태
+ * @param  pData 수신 바이트
+ * @param  ulLen 바이트 수
+ * @retval 없음
+ */
+extern void vTelemDecFeed(sTelemDecoder* pDec, const uint8_t* pData, size_t ulLen);
+/**
+ * @brief  압축 블록 1개(동기 워드 ~ CRC)를 복원합니다.
+ * @param  pBlk 블록 시작
+ * @param  uLen pBlk 이후 사용 가능한 바이트 수
+ * @param  pOut 출력 샘플 (TELEM_BLOCK_LEN개)
+ * @retval 블록 바이트 수, 0: 길이 부족, TELEM_DEC_BAD: 잘못된 헤더 또는 CRC 오류
+ */
+extern uint16_t uTelemDecBlock(const uint8_t* pBlk, uint16_t uLen, sTelemSample* pOut);
+/**
+ * @brief  CRC-16/CCITT-FALSE (펌웨어 uCrc16과 독립 구현)
+ * @param  pData 데이터
+ * @param  ulLen 바이트 수
+ * @retval CRC
+ */
+extern uint16_t uTelemDecCrc(const uint8_t* pData, size_t ulLen);
+
+#endif /* TEST_TELEMDECODE_H_ */
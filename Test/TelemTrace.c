@@ -0,0 +1,94 @@
+/**
+ * @file    TelemTrace.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 호스트 시험용 합성 전류/속도 파형 구현 소스 파일
+ */
+
+#include <math.h>
+#include "VarTable.h"
+#include "TelemTrace.h"
+
+/** @name 파형 조건
+ * @{ */
+#define TRACE_PP            2.0f                /**< 극쌍수 (MOT_PP) */
+#define TRACE_TAU_IQ        0.5e-3f             /**< 전류 추종 시정수 [s] (대역폭 약 300Hz) */
+#define TRACE_RIPPLE_A      0.3f                /**< 6고조파 전류 리플 진폭 [A] */
+#define TRACE_NOISE_A       0.03f               /**< 전류 측정 잡음 [A] (균등 분포 반폭) */
+#define TRACE_NOISE_RPM     3.0f                /**< 관측기 속도 잡음 [RPM] */
+#define TRACE_NOISE_V       0.005f              /**< 전압 측정 잡음 [V] */
+#define TRACE_KT_ACC        800.0f              /**< 전류당 가속도 [RPM/s/A] */
+#define TRACE_VOC           16.0f               /**< 배터리 개방 전압 [V] */
+#define TRACE_RB            0.03f               /**< 배터리 내부 저항 [Ohm] */
+/** @} */
+
+sTelemTrace Trace;
+
+/**
+ * @brief  [-1, 1) 균등 난수 (선형 합동 생성기)
+ * @retval 난수
+ */
+static float fTraceRand(void){
+	Trace.ulRand = Trace.ulRand * 1664525ul + 1013904223ul;
+	return (float)(int32_t)Trace.ulRand * (1.0f / 2147483648.0f);
+}
+
+/**
+ * @brief  파형을 초기 상태로 되돌립니다.
+ * @param  fNoise 측정 잡음 배율
+ * @retval 없음
+ */
+void vTraceInit(float fNoise){
+	Trace.fT = 0.0f;
+	Trace.fTheta = 0.0f;
+	Trace.fIqsr = 0.0f;
+	Trace.fIqsrRef = 0.0f;
+	Trace.fWrpm = 0.0f;
+	Trace.fWrpmTrue = 0.0f;
+	Trace.fVdc = TRACE_VOC;
+	Trace.fNoise = fNoise;
+	Trace.ulRand = 12345ul;
+}
+
+/**
+ * @brief  한 제어 주기만큼 파형을 진행합니다.
+ * @retval 없음
+ */
+void vTraceStep(void){
+	float fPhase = fmodf(Trace.fT, TRACE_PERIOD_S), fIqAvg;
+
+	if(fPhase < 0.5f)		Trace.fIqsrRef = 10.0f;
+	else if(fPhase < 1.0f)	Trace.fIqsrRef = 3.0f;
+	else					Trace.fIqsrRef = -6.0f;
+
+	/* 전류는 지령의 1차 추종, 속도는 전류에 비례한 가속 (순항 전류는 부하와 평형) */
+	fIqAvg = Trace.fIqsr - TRACE_RIPPLE_A * sinf(6.0f * Trace.fTheta);
+	fIqAvg += (TRACE_TS / TRACE_TAU_IQ) * (Trace.fIqsrRef - fIqAvg);
+	Trace.fWrpmTrue += TRACE_KT_ACC * (fIqAvg - 3.0f) * TRACE_TS;
+	if(Trace.fWrpmTrue < 0.0f) Trace.fWrpmTrue = 0.0f;
+	Trace.fTheta = fmodf(Trace.fTheta + Trace.fWrpmTrue * (TRACE_PP * 6.2831853f / 60.0f) * TRACE_TS, 6.2831853f);
+
+	Trace.fIqsr = fIqAvg + TRACE_RIPPLE_A * sinf(6.0f * Trace.fTheta) + Trace.fNoise * TRACE_NOISE_A * fTraceRand();
+	Trace.fWrpm = Trace.fWrpmTrue + Trace.fNoise * TRACE_NOISE_RPM * fTraceRand();
+	Trace.fVdc = TRACE_VOC - TRACE_RB * fIqAvg + Trace.fNoise * TRACE_NOISE_V * fTraceRand();
+	Trace.fT += TRACE_TS;
+}
+
+/**
+ * @brief  변수 레지스트리 조회 대체: 기본 채널 ID만 파형 변수로 연결합니다. (스케일은 VarTable.h 기본값)
+ * @param  uId 변수 ID
+ * @param  pCh 채널 디스크립터
+ * @retval 1: 성공, 0: 지원하지 않는 ID
+ */
+uint16_t uVarChannel(uint16_t uId, sDataChannel* pCh){
+	pCh->uType = DCH_TYPE_FLOAT;
+	pCh->fOffset = 0.0f;
+
+	switch(uId) {
+	case VAR_ID_CC_IQSR:		pCh->pAddr = &Trace.fIqsr;		pCh->fScale = 1000.0f;	return 1u;
+	case VAR_ID_CC_IQSR_REF:	pCh->pAddr = &Trace.fIqsrRef;	pCh->fScale = 1000.0f;	return 1u;
+	case VAR_ID_SO_WRPM_SC:		pCh->pAddr = &Trace.fWrpm;		pCh->fScale = 1.0f;		return 1u;
+	case VAR_ID_VDC:			pCh->pAddr = &Trace.fVdc;		pCh->fScale = 1000.0f;	return 1u;
+	default:					pCh->pAddr = 0;					pCh->fScale = 0.0f;		return 0u;
+	}
+}
@@ -0,0 +1,56 @@
+/**
+ * @file    TelemTrace.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 호스트 시험용 합성 전류/속도 파형 헤더 파일
+ * @details Telemetry.c의 기본 채널(vInitTelemetry)이 읽는 변수를 이 모듈이 정의하고, 변수 레지스트리 조회(uVarChannel)도
+ * 같은 ID → 변수 대응과 기본 스케일(VarTable.h)로 대신합니다. 난수는 고정 시드의 선형 합동 생성기이므로 결과가 재현됩니다.
+ *
+ * | 채널 | 변수 | 파형 |
+ * | :--- | :--- | :--- |
+ * | **0** | fIqsr [A] | 지령 1차 추종 + 6고조파 리플 + 측정 잡음 |
+ * | **1** | fIqsrRef [A] | 가속 10A → 순항 3A → 감속 −6A 계단 |
+ * | **2** | fWrpmSC [RPM] | 가속 기울기 → 순항 → 감속 (관측기 잡음 포함) |
+ * | **3** | fVdc [V] | 16V − 배터리 저항 전압 강하 + 잡음 |
+ */
+
+#ifndef TEST_TELEMTRACE_H_
+#define TEST_TELEMTRACE_H_
+
+#include <stdint.h>
+
+#define TRACE_TS            50.0e-6f            /**< 제어 주기 [s] (20kHz) */
+#define TRACE_PERIOD_S      1.5f                /**< 가속/순항/감속 한 주기 [s] */
+
+/**
+ * @struct sTelemTrace
+ * @brief  합성 파형 상태
+ */
+typedef struct {
+	float fT;                   /**< 경과 시간 [s] */
+	float fTheta;               /**< 전기각 [rad] */
+	float fIqsr;                /**< q축 측정 전류 [A] */
+	float fIqsrRef;             /**< q축 전류 지령 [A] */
+	float fWrpm;                /**< 관측기 속도 [RPM] */
+	float fVdc;                 /**< 직류단 전압 [V] */
+	float fNoise;               /**< 측정 잡음 배율 (1: 기본) */
+	float fWrpmTrue;            /**< 잡음 없는 속도 [RPM] */
+	uint32_t ulRand;            /**< 난수 상태 */
+} sTelemTrace;
+
+/** @brief 텔레메트리 채널이 읽는 파형 (uVarChannel 대체가 이 객체의 필드를 가리킴) */
+extern sTelemTrace Trace;
+
+/**
+ * @brief  파형을 초기 상태로 되돌립니다.
+ * @param  fNoise 측정 잡음 배율 (0: 잡음 없음)
+ * @retval 없음
+ */
+extern void vTraceInit(float fNoise);
+/**
+ * @brief  한 제어 주기만큼 파형을 진행합니다.
+ * @retval 없음
+ */
+extern void vTraceStep(void);
+
+#endif /* TEST_TELEMTRACE_H_ */
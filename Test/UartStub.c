@@ -0,0 +1,85 @@
+/**
+ * @file    UartStub.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 시험용 Uart.h 구현 소스 파일 (USART1/DMA 대신 콜백으로 송수신)
+ * @details uCrc16은 펌웨어(Uart.c)의 테이블 방식과 같은 CRC-16/CCITT-FALSE를 비트 단위로 계산합니다.
+ */
+
+#include <stddef.h>
+#include "UartStub.h"
+
+pfUartStubTx pUartStubTx = NULL;
+pfUartStubRx pUartStubRx = NULL;
+uint32_t ulUartStubTxBytes = 0ul;
+uint32_t ulUartStubTxCnt = 0ul;
+
+/**
+ * @brief  초기화할 하드웨어가 없으므로 아무것도 하지 않습니다.
+ * @param  ulBaud 통신 속도 [bps] (사용 안 함)
+ * @retval 없음
+ */
+void vInitUart(uint32_t ulBaud){
+	(void)ulBaud;
+}
+
+/**
+ * @brief  송신은 즉시 완료되므로 항상 유휴입니다.
+ * @retval 0
+ */
+uint16_t uUartTxBusy(void){
+	return 0u;
+}
+
+/**
+ * @brief  버퍼를 송신 콜백에 전달합니다.
+ * @param  pData 송신 버퍼
+ * @param  uLen 송신 바이트 수
+ * @retval 1: 전송 완료
+ */
+uint16_t uUartTxStart(const void* pData, uint16_t uLen){
+	if(pUartStubTx != NULL) pUartStubTx((const uint8_t*)pData, uLen);
+	ulUartStubTxBytes += uLen;
+	ulUartStubTxCnt++;
+	return 1u;
+}
+
+/**
+ * @brief  송신은 즉시 완료되므로 항상 재사용 가능입니다.
+ * @param  pData 송신 버퍼 (사용 안 함)
+ * @retval 0
+ */
+uint16_t uUartTxBusyWith(const void* pData){
+	(void)pData;
+	return 0u;
+}
+
+/**
+ * @brief  수신 콜백에서 바이트를 꺼냅니다.
+ * @param  pDst 복사 대상
+ * @param  uMax 최대 바이트 수
+ * @retval 꺼낸 바이트 수
+ */
+uint16_t uUartRxRead(uint8_t* pDst, uint16_t uMax){
+	return (pUartStubRx != NULL) ? pUartStubRx(pDst, uMax) : 0u;
+}
+
+/**
+ * @brief  CRC-16/CCITT-FALSE를 누적 계산합니다. (다항식 0x1021, 비트 단위)
+ * @param  uCrc 초기값 (CRC16_INIT) 또는 이전 누적값
+ * @param  pData 데이터
+ * @param  uLen 바이트 수
+ * @retval 누적 CRC
+ */
+uint16_t uCrc16(uint16_t uCrc, const void* pData, uint16_t uLen){
+	const uint8_t* pByte = (const uint8_t*)pData;
+	uint16_t i;
+
+	while(uLen--) {
+		uCrc ^= (uint16_t)(*pByte++ << 8);
+		for(i = 0u; i < 8u; i++) {
+			uCrc = (uCrc & 0x8000u) ? (uint16_t)((uCrc << 1) ^ 0x1021u) : (uint16_t)(uCrc << 1);
+		}
+	}
+	return uCrc;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file    UartStub.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 시험용 Uart.h 구현(UartStub.c)의 송수신 연결 헤더 파일
+ * @details 펌웨어 모듈(Telemetry.c, Proto.c)은 Core/Inc/Uart.h를 그대로 포함하고, 호스트 프로그램은 이 헤더의 콜백으로
+ * 송신 바이트를 받고 수신 바이트를 공급합니다. 송신 DMA는 즉시 완료된 것으로 봅니다 (uUartTxBusy = 0).
+ *
+ * | 연결 | 호출 시점 | 미지정 시 |
+ * | :--- | :--- | :--- |
+ * | **pUartStubTx** | uUartTxStart (버퍼 전체를 한 번에 전달) | 송신 바이트 버림 |
+ * | **pUartStubRx** | uUartRxRead | 수신 없음 (0 반환) |
+ */
+
+#ifndef TEST_UARTSTUB_H_
+#define TEST_UARTSTUB_H_
+
+#include <stdint.h>
+#include "Uart.h"
+
+/** @brief 송신 콜백 (pData: 송신 버퍼, uLen: 바이트 수) */
+typedef void (*pfUartStubTx)(const uint8_t* pData, uint16_t uLen);
+/** @brief 수신 콜백 (pDst에 최대 uMax 바이트를 채우고 채운 수를 반환) */
+typedef uint16_t (*pfUartStubRx)(uint8_t* pDst, uint16_t uMax);
+
+extern pfUartStubTx pUartStubTx;        /**< 송신 콜백 */
+extern pfUartStubRx pUartStubRx;        /**< 수신 콜백 */
+extern uint32_t ulUartStubTxBytes;      /**< 누적 송신 바이트 수 */
+extern uint32_t ulUartStubTxCnt;        /**< uUartTxStart 성공 횟수 */
+
+#endif /* TEST_UARTSTUB_H_ */
@@ -0,0 +1,47 @@
+/**
+ * @file    UnitTest.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 단위 시험용 검사 매크로 헤더 파일
+ * @details 하드웨어에 의존하지 않는 모듈(Core/Src)을 호스트 gcc로 같은 소스 그대로 빌드하여 검증합니다.
+ * 검사가 실패해도 계속 진행하여 실패 항목을 모두 출력하고, UT_RESULT()가 종료 코드(0: 통과)를 돌려줍니다.
+ *
+ * | 매크로 | 내용 |
+ * | :--- | :--- |
+ * | **UT_CHECK(c)** | 조건 검사 |
+ * | **UT_CHECK_EQ(a, b)** | 정수 같음 검사 (실패 시 두 값 16진수 출력) |
+ * | **UT_CHECK_NEAR(a, b, tol)** | 실수 \|a − b\| ≤ tol 검사 |
+ * | **UT_RUN(fn)** | 시험 함수 실행 |
+ * | **UT_RESULT()** | 결과 출력, 실패 수가 0이면 0 |
+ */
+
+#ifndef TEST_UNITTEST_H_
+#define TEST_UNITTEST_H_
+
+#include <stdio.h>
+#include <math.h>
+
+static int iUtCheckCnt = 0, iUtFailCnt = 0;
+
+#define UT_CHECK(c) do { \
+		iUtCheckCnt++; \
+		if(!(c)) { iUtFailCnt++; printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #c); } \
+	} while(0)
+
+#define UT_CHECK_EQ(a, b) do { \
+		long long llA = (long long)(a), llB = (long long)(b); \
+		iUtCheckCnt++; \
+		if(llA != llB) { iUtFailCnt++; printf("  FAIL %s:%d: %s == %s (0x%llX != 0x%llX)\n", __FILE__, __LINE__, #a, #b, llA, llB); } \
+	} while(0)
+
+#define UT_CHECK_NEAR(a, b, tol) do { \
+		double dA = (double)(a), dB = (double)(b); \
+		iUtCheckCnt++; \
+		if(!(fabs(dA - dB) <= (double)(tol))) { iUtFailCnt++; printf("  FAIL %s:%d: %s ~ %s (%g != %g)\n", __FILE__, __LINE__, #a, #b, dA, dB); } \
+	} while(0)
+
+#define UT_RUN(fn) do { printf("[%s]\n", #fn); fn(); } while(0)
+
+#define UT_RESULT() (printf("%s: %d checks, %d failed\n", __FILE__, iUtCheckCnt, iUtFailCnt), (iUtFailCnt != 0) ? 1 : 0)
+
+#endif /* TEST_UNITTEST_H_ */
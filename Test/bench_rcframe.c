@@ -0,0 +1,239 @@
+/**
+ * @file    bench_rcframe.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   SBUS/CRSF 파서(RcFrame.c) 처리량 벤치마크
+ * @details 수신 경로(RcRx.c)와 같이 메모리의 바이트열을 한 바이트씩 파서에 넣고 프레임마다 유휴 구간을 알려,
+ * 바이트당/프레임당 처리 시간과 선로 최대 속도 대비 부하를 입력 종류별로 출력합니다. 시간은 호스트 기준이므로
+ * 절대값보다 입력 종류 간 비율과 선로 속도 대비 여유를 보는 용도입니다. 복원한 프레임 수가 다르면 종료 코드 1입니다.
+ *
+ * | 입력 | 내용 |
+ * | :--- | :--- |
+ * | **sbus** | 25byte 프레임 (100000bps 8E2 = 8333 byte/s) |
+ * | **crsf rc** | 26byte RC 채널 프레임 (420000bps 8N1 = 42000 byte/s) |
+ * | **crsf mix** | RC 채널 9 : 링크 통계 1 |
+ * | **noise** | 난수 바이트 (동기 탐색 경로), 25byte마다 유휴 구간 |
+ * | **crc** | 24byte CRC-8: 테이블(uCrsfCrc8) 대 비트 단위 계산 |
+ *
+ * 사용법: bench_rcframe [-n 프레임 수] (기본 200000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "RcFrame.h"
+
+#define BENCH_SBUS_BPS      (100000.0 / 12.0)   /**< SBUS 선로 최대 [byte/s] (8E2) */
+#define BENCH_CRSF_BPS      (420000.0 / 10.0)   /**< CRSF 선로 최대 [byte/s] (8N1) */
+#define BENCH_REPEAT        3u                  /**< 반복 측정 (최소값 사용) */
+
+/** @brief 입력 바이트열과 프레임 경계 */
+static uint8_t* pStream;
+static uint32_t* pEnd;
+static uint32_t ulStreamLen, ulFrameNum;
+
+/** @brief 고정 시드 난수 (xorshift32) */
+static uint32_t ulRand = 0x6A09E667u;
+
+/**
+ * @brief  다음 난수
+ */
+static uint32_t ulBenchRand(void){
+	ulRand ^= ulRand << 13;
+	ulRand ^= ulRand >> 17;
+	ulRand ^= ulRand << 5;
+	return ulRand;
+}
+
+/**
+ * @brief  단조 시계 [s]
+ */
+static double dBenchNow(void){
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + (double)Ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief  프레임 하나를 바이트열 끝에 붙입니다.
+ */
+static void vBenchAppend(const uint8_t* pData, uint16_t uLen){
+	memcpy(&pStream[ulStreamLen], pData, uLen);
+	ulStreamLen += uLen;
+	pEnd[ulFrameNum++] = ulStreamLen;
+}
+
+/**
+ * @brief  입력 종류별 바이트열을 만듭니다.
+ * @param  iKind 0: sbus, 1: crsf rc, 2: crsf mix, 3: noise
+ */
+static void vBenchBuild(int iKind, uint32_t ulNum){
+	static const uint8_t uLink[10] = {100u, 98u, 87u, 10u, 0u, 4u, 3u, 60u, 95u, 8u};
+	uint8_t uF[CRSF_FRAME_MAX], uPl[22];
+	uint16_t uCh[RC_CH_NUM], i, uLen;
+	uint32_t k;
+
+	ulStreamLen = ulFrameNum = 0u;
+	for(k = 0u; k < ulNum; k++) {
+		for(i = 0u; i < RC_CH_NUM; i++) uCh[i] = (uint16_t)(172u + ulBenchRand() % 1640u);
+		switch(iKind){
+		case 0:
+			uF[0] = SBUS_START;
+			vRcPackCh(uCh, &uF[1]);
+			uF[23] = 0u;
+			uF[24] = SBUS_END;
+			vBenchAppend(uF, SBUS_FRAME_LEN);
+			break;
+		case 1:
+		case 2:
+			if((iKind == 2) && ((k % 10u) == 9u)) uLen = uCrsfBuild(CRSF_TYPE_LINK, uLink, sizeof(uLink), uF);
+			else {
+				vRcPackCh(uCh, uPl);
+				uLen = uCrsfBuild(CRSF_TYPE_RC, uPl, 22u, uF);
+			}
+			vBenchAppend(uF, uLen);
+			break;
+		default:
+			for(i = 0u; i < SBUS_FRAME_LEN; i++) uF[i] = (uint8_t)ulBenchRand();
+			vBenchAppend(uF, SBUS_FRAME_LEN);
+			break;
+		}
+	}
+}
+
+/**
+ * @brief  바이트열을 파서에 넣습니다. (프레임마다 유휴 구간)
+ * @param  uCrsf 0: SBUS, 1: CRSF
+ * @param  pOk 복원한 프레임 수
+ * @retval 경과 시간 [s] (BENCH_REPEAT회 중 최소)
+ */
+static double dBenchParse(uint16_t uCrsf, uint32_t* pOk){
+	static sSbusParser Sbus;
+	static sCrsfParser Crsf;
+	double dBest = 1e9, dT;
+	uint32_t k, n, ulPos;
+	uint16_t r;
+
+	for(r = 0u; r < BENCH_REPEAT; r++) {
+		memset(&Sbus, 0, sizeof(Sbus));
+		memset(&Crsf, 0, sizeof(Crsf));
+		n = 0u;
+		ulPos = 0u;
+		dT = dBenchNow();
+		for(k = 0u; k < ulFrameNum; k++) {
+			if(uCrsf) {
+				for(; ulPos < pEnd[k]; ulPos++) n += (uCrsfPush(&Crsf, pStream[ulPos]) != 0u);
+				vCrsfIdle(&Crsf);
+			}
+			else {
+				for(; ulPos < pEnd[k]; ulPos++) n += uSbusPush(&Sbus, pStream[ulPos]);
+				vSbusIdle(&Sbus);
+			}
+		}
+		dT = dBenchNow() - dT;
+		if(dT < dBest) dBest = dT;
+		*pOk = n;
+	}
+	return dBest;
+}
+
+/**
+ * @brief  결과 한 줄을 출력합니다.
+ * @retval 0: 복원 수 일치, 1: 불일치
+ */
+static int iBenchReport(const char* pName, double dT, uint32_t ulOk, uint32_t ulExp, double dLineBps){
+	double dNsByte = dT * 1e9 / (double)ulStreamLen;
+
+	printf("%-10s %9lu %9lu %8.2f %9.1f %9.1f %9.4f%%  %s\n", pName, (unsigned long)ulStreamLen, (unsigned long)ulOk,
+			dNsByte, dT * 1e9 / (double)ulFrameNum, (double)ulStreamLen / dT / 1e6,
+			dNsByte * 1e-9 * dLineBps * 100.0, (ulOk == ulExp) ? "ok" : "MISMATCH");
+	return (ulOk == ulExp) ? 0 : 1;
+}
+
+/**
+ * @brief  CRC-8 비트 단위 계산 (테이블 비교용)
+ */
+static uint8_t uBenchCrcBitwise(const uint8_t* pData, uint16_t uLen){
+	uint8_t uCrc = 0u;
+	uint16_t j;
+
+	while(uLen--) {
+		uCrc ^= *pData++;
+		for(j = 0u; j < 8u; j++) uCrc = (uint8_t)((uCrc & 0x80u) ? ((uCrc << 1) ^ 0xD5u) : (uCrc << 1));
+	}
+	return uCrc;
+}
+
+/**
+ * @brief  24byte CRC-8 테이블/비트 단위 시간을 비교합니다.
+ * @retval 0: 결과 일치, 1: 불일치
+ */
+static int iBenchCrc(uint32_t ulNum){
+	volatile uint8_t uSink = 0u;
+	uint8_t uA = 0u, uB = 0u;
+	double dTab, dBit;
+	uint32_t k;
+
+	dTab = dBenchNow();
+	for(k = 0u; k < ulNum; k++) uA ^= uCrsfCrc8(&pStream[(k * 24u) % (ulStreamLen - 24u)], 24u);
+	dTab = dBenchNow() - dTab;
+	dBit = dBenchNow();
+	for(k = 0u; k < ulNum; k++) uB ^= uBenchCrcBitwise(&pStream[(k * 24u) % (ulStreamLen - 24u)], 24u);
+	dBit = dBenchNow() - dBit;
+	uSink = uA;
+	(void)uSink;
+
+	printf("crc 24byte: table %.1f ns, bitwise %.1f ns (x%.1f)  %s\n", dTab * 1e9 / ulNum, dBit * 1e9 / ulNum,
+			dBit / dTab, (uA == uB) ? "ok" : "MISMATCH");
+	return (uA == uB) ? 0 : 1;
+}
+
+int main(int argc, char** argv){
+	uint32_t ulNum = 200000u, ulOk;
+	double dT;
+	int iOpt, iFail = 0;
+
+	while((iOpt = getopt(argc, argv, "n:")) != -1) {
+		switch(iOpt) {
+		case 'n':	ulNum = (uint32_t)atol(optarg); break;
+		default:
+			fprintf(stderr, "usage: %s [-n frames]\n", argv[0]);
+			return 2;
+		}
+	}
+	if(ulNum < 10u) ulNum = 10u;
+	pStream = malloc((size_t)ulNum * CRSF_FRAME_MAX);
+	pEnd = malloc((size_t)ulNum * sizeof(uint32_t));
+	if((pStream == NULL) || (pEnd == NULL)) return 1;
+
+	printf("%u frames per input, best of %u; load = host time per byte x line rate\n", (unsigned)ulNum, BENCH_REPEAT);
+	printf("%-10s %9s %9s %8s %9s %9s %10s\n", "input", "bytes", "frames", "ns/byte", "ns/frame", "MB/s", "line load");
+
+	vBenchBuild(0, ulNum);
+	dT = dBenchParse(0u, &ulOk);
+	iFail |= iBenchReport("sbus", dT, ulOk, ulNum, BENCH_SBUS_BPS);
+
+	vBenchBuild(1, ulNum);
+	dT = dBenchParse(1u, &ulOk);
+	iFail |= iBenchReport("crsf rc", dT, ulOk, ulNum, BENCH_CRSF_BPS);
+
+	vBenchBuild(2, ulNum);
+	dT = dBenchParse(1u, &ulOk);
+	iFail |= iBenchReport("crsf mix", dT, ulOk, ulNum, BENCH_CRSF_BPS);
+
+	/* 잡음: 우연히 맞는 프레임이 있을 수 있으므로 복원 수는 확인하지 않음 */
+	vBenchBuild(3, ulNum);
+	dT = dBenchParse(0u, &ulOk);
+	iBenchReport("noise sbus", dT, ulOk, ulOk, BENCH_SBUS_BPS);
+	dT = dBenchParse(1u, &ulOk);
+	iBenchReport("noise crsf", dT, ulOk, ulOk, BENCH_CRSF_BPS);
+
+	iFail |= iBenchCrc(ulNum);
+
+	free(pStream);
+	free(pEnd);
+	return iFail;
+}
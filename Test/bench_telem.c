@@ -0,0 +1,175 @@
+/**
+ * @file    bench_telem.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 차분 압축(TELEM_MODE_DELTA) 압축률 벤치마크
+ * @details 실제 Telemetry.c를 압축 모드로 실행하여 Telem.ulRawBytes / Telem.ulCompBytes(고정 형식 대비 압축률)와
+ * 20kHz 연속 송신 시 링크 사용률(4Mbps 8N1 = 400kB/s 기준)을 예측 차수 조합별로 출력합니다.
+ *
+ * | 입력 | 내용 |
+ * | :--- | :--- |
+ * | **기본** | 합성 파형(TelemTrace.c)을 잡음 배율 0, 1, 3으로 각각 2초 |
+ * | **-c 파일** | 기록 파형: telem_decode 출력 CSV (seq, 채널 물리값 ×4, 고정 형식 모드로 기록) |
+ * | **-s 스케일** | CSV 채널 스케일 (telem_decode -s와 같은 값, 기본: 기본 채널 스케일) |
+ *
+ * 모든 경우에 복원기(TelemDecode.c)로 되돌려 샘플이 같은지도 확인합니다 (불일치 시 종료 코드 1).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "UartStub.h"
+#include "Telemetry.h"
+#include "TelemDecode.h"
+#include "TelemTrace.h"
+
+#define BENCH_LINK_BPS      ((double)UART_BAUD / 10.0)  /**< 링크 용량 [byte/s] (8N1) */
+#define BENCH_RATE_HZ       20000.0                     /**< 샘플 속도 [Hz] */
+#define BENCH_SYNTH_NUM     40000ul                     /**< 합성 파형 샘플 수 (2초) */
+#define BENCH_CSV_MAX       2000000ul                   /**< CSV 최대 샘플 수 */
+
+/** @brief 기록 파형 [샘플][채널] (물리값 × 스케일로 되돌린 16비트 코드) */
+static float (*fCsv)[TELEM_CH_NUM];
+static uint32_t ulCsvNum;
+/** @brief CSV 재생 채널 변수 */
+static float fCsvCh[TELEM_CH_NUM];
+static float fCsvScale[TELEM_CH_NUM] = {1000.0f, 1000.0f, 1.0f, 1000.0f};
+
+/** @brief 복원 비교용 링 (기록 샘플) */
+static sTelemSample BenchExp[TELEM_RAW_DEPTH];
+static uint32_t ulBenchExpNum, ulBenchDecNum, ulBenchBad;
+static sTelemDecoder BenchDec;
+
+/**
+ * @brief  송신 콜백: 바로 복원기에 넣습니다.
+ */
+static void vBenchTx(const uint8_t* pData, uint16_t uLen){
+	vTelemDecFeed(&BenchDec, pData, uLen);
+}
+
+/**
+ * @brief  복원 콜백: 기록 샘플과 비교합니다.
+ */
+static void vBenchSample(const sTelemSample* pSample, void* pCtx){
+	(void)pCtx;
+	if(memcmp(pSample, &BenchExp[ulBenchDecNum % TELEM_RAW_DEPTH], sizeof(sTelemSample)) != 0) ulBenchBad++;
+	ulBenchDecNum++;
+}
+
+/**
+ * @brief  telem_decode 출력 CSV를 읽습니다.
+ * @param  pPath 파일 경로
+ * @retval 읽은 샘플 수
+ */
+static uint32_t ulBenchLoadCsv(const char* pPath){
+	FILE* pFile = fopen(pPath, "r");
+	char cLine[256];
+	unsigned uSeq;
+	uint32_t k;
+	uint16_t i;
+
+	if(pFile == NULL) return 0ul;
+	fCsv = malloc(sizeof(*fCsv) * BENCH_CSV_MAX);
+	while((ulCsvNum < BENCH_CSV_MAX) && (fgets(cLine, sizeof(cLine), pFile) != NULL)) {
+		if(sscanf(cLine, "%u,%f,%f,%f,%f", &uSeq, &fCsv[ulCsvNum][0], &fCsv[ulCsvNum][1],
+				&fCsv[ulCsvNum][2], &fCsv[ulCsvNum][3]) == 1 + (int)TELEM_CH_NUM) ulCsvNum++;
+	}
+	fclose(pFile);
+
+	/* %.6g 출력의 반올림 오차를 없애도록 코드로 되돌려 스케일 1로 재생 */
+	for(k = 0ul; k < ulCsvNum; k++) {
+		for(i = 0u; i < TELEM_CH_NUM; i++) fCsv[k][i] = roundf(fCsv[k][i] * fCsvScale[i]);
+	}
+	return ulCsvNum;
+}
+
+/**
+ * @brief  압축 모드로 한 번 실행하고 결과 한 줄을 출력합니다.
+ * @param  pName 입력 이름
+ * @param  uMask 예측 차수 마스크
+ * @param  fNoise 합성 파형 잡음 배율 (CSV 입력이면 무시)
+ * @retval 0: 복원 일치, 1: 불일치
+ */
+static int iBenchRun(const char* pName, uint16_t uMask, float fNoise){
+	uint32_t k, ulNum = (fCsv != NULL) ? ulCsvNum : BENCH_SYNTH_NUM;
+	double dRatio, dLoad;
+	int iBad;
+	uint16_t i;
+
+	vTraceInit(fNoise);
+	vInitTelemetry();
+	if(fCsv != NULL) {
+		for(i = 0u; i < TELEM_CH_NUM; i++) {
+			TelemCh[i].pAddr = &fCsvCh[i];
+			TelemCh[i].uType = DCH_TYPE_FLOAT;
+			TelemCh[i].fScale = 1.0f;
+			TelemCh[i].fOffset = 0.0f;
+		}
+	}
+	Telem.uOrderMask = uMask;
+	(void)uTelemSetMode(TELEM_MODE_DELTA);
+	ulBenchExpNum = ulBenchDecNum = ulBenchBad = 0ul;
+	vTelemDecInit(&BenchDec, vBenchSample, NULL);
+	pUartStubTx = vBenchTx;
+
+	for(k = 0ul; k < ulNum; k++) {
+		if(fCsv != NULL) memcpy(fCsvCh, fCsv[k], sizeof(fCsvCh));
+		else vTraceStep();
+		BenchExp[ulBenchExpNum % TELEM_RAW_DEPTH].uSeq = Telem.uSeq;
+		for(i = 0u; i < TELEM_CH_NUM; i++) BenchExp[ulBenchExpNum % TELEM_RAW_DEPTH].iCh[i] = iPackDataChannel(&TelemCh[i]);
+		ulBenchExpNum++;
+		vTelemRecord();
+		vTelemTask();
+	}
+
+	iBad = ((ulBenchBad != 0ul) || (ulBenchDecNum != (ulNum / TELEM_BLOCK_LEN) * TELEM_BLOCK_LEN)) ? 1 : 0;
+	dRatio = (Telem.ulCompBytes != 0ul) ? (double)Telem.ulRawBytes / (double)Telem.ulCompBytes : 0.0;
+	dLoad = (double)Telem.ulCompBytes / (double)(ulBenchDecNum ? ulBenchDecNum : 1ul) * BENCH_RATE_HZ / BENCH_LINK_BPS;
+	printf("%-14s 0x%02X %6.2f  %7.2f  %6.1f%%  %s\n", pName, uMask, dRatio,
+			(double)Telem.ulCompBytes * 8.0 / (double)(ulBenchDecNum ? ulBenchDecNum : 1ul) / TELEM_CH_NUM,
+			dLoad * 100.0, iBad ? "MISMATCH" : "ok");
+	return iBad;
+}
+
+int main(int argc, char** argv){
+	static const uint16_t uMask[4] = {0x00u, 0x03u, 0x07u, 0x0Fu};
+	static const float fNoise[3] = {0.0f, 1.0f, 3.0f};
+	const char* pCsvPath = NULL;
+	char cName[32], * pTok;
+	int iOpt, iFail = 0;
+	uint16_t m, n, i;
+
+	while((iOpt = getopt(argc, argv, "c:s:")) != -1) {
+		switch(iOpt) {
+		case 'c':	pCsvPath = optarg; break;
+		case 's':
+			for(i = 0u, pTok = strtok(optarg, ","); (i < TELEM_CH_NUM) && (pTok != NULL); i++, pTok = strtok(NULL, ",")) {
+				fCsvScale[i] = (float)atof(pTok);
+			}
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-c trace.csv] [-s s0,s1,...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if((pCsvPath != NULL) && (ulBenchLoadCsv(pCsvPath) < TELEM_BLOCK_LEN)) {
+		fprintf(stderr, "%s: no samples\n", pCsvPath);
+		return 1;
+	}
+
+	printf("TELEM_MODE_DELTA: block %u samples, %u ch, raw frame %u byte, link %.0f kB/s at %.0f kHz\n",
+			TELEM_BLOCK_LEN, TELEM_CH_NUM, (unsigned)sizeof(sTelemFrame), BENCH_LINK_BPS / 1000.0, BENCH_RATE_HZ / 1000.0);
+	printf("%-14s %4s %6s  %7s  %7s\n", "input", "mask", "ratio", "bit/ch", "link");
+	printf("%-14s %4s %6.2f  %7.2f  %6.1f%%\n", "raw frame", "-", 1.0, (double)sizeof(sTelemFrame) * 8.0 / TELEM_CH_NUM,
+			sizeof(sTelemFrame) * BENCH_RATE_HZ / BENCH_LINK_BPS * 100.0);
+
+	for(n = 0u; n < ((pCsvPath != NULL) ? 1u : 3u); n++) {
+		if(pCsvPath != NULL) snprintf(cName, sizeof(cName), "csv");
+		else snprintf(cName, sizeof(cName), "synth x%.0f", (double)fNoise[n]);
+		for(m = 0u; m < 4u; m++) iFail |= iBenchRun(cName, uMask[m], fNoise[n]);
+	}
+	free(fCsv);
+	return iFail;
+}
@@ -0,0 +1,2 @@
+/* 대소문자 구분 파일 시스템용: 펌웨어는 "Fault.h"로 포함하고 파일은 Core/Inc/fault.h */
+#include "fault.h"
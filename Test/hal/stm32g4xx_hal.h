@@ -0,0 +1,130 @@
+/**
+ * @file    stm32g4xx_hal.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 빌드용 HAL/CMSIS 대체 헤더 (실제 Core/Inc 헤더를 그대로 포함하는 모듈용)
+ * @details stub/의 대체 헤더는 GlobalVar.h, MotorControl.h 자체를 최소 선언으로 바꾸지만, 변수 레지스트리(VarTable.c)처럼
+ * 전체 구조체가 필요한 모듈은 실제 헤더를 쓰고 그 아래의 HAL 헤더만 이 파일로 바꿉니다. 핸들 타입은 포인터 선언에만 쓰이므로
+ * 내용 없는 구조체로 두고, 메인 루프/ISR 경계에 쓰이는 CMSIS 내장 함수만 호스트 동등 동작으로 정의합니다.
+ *
+ * FDCAN1은 레지스터 배치를 CMSIS 그대로 두되, 인스턴스 접근(FDCAN1->...)마다 소프트웨어 버스(CanBus.c)의 pCanBusRegs()를
+ * 거치게 하여 직전 접근에서 쓴 TXBAR/RXF0A를 하드웨어처럼 처리한 뒤 상태 레지스터를 갱신합니다. 메시지 RAM(SRAMCAN_BASE)도
+ * CanBus.c의 배열을 가리키므로 Can.c를 수정 없이 호스트에서 실행할 수 있습니다.
+ */
+
+#ifndef TEST_HAL_STM32G4XX_HAL_H_
+#define TEST_HAL_STM32G4XX_HAL_H_
+
+#include <stdint.h>
+
+/** @name 주변장치 타입 (선언 전용)
+ * @{ */
+typedef struct { uint32_t ulDummy; } TIM_TypeDef;
+typedef struct { TIM_TypeDef* Instance; } TIM_HandleTypeDef;
+typedef struct { uint32_t ulDummy; } GPIO_TypeDef;
+typedef struct { uint32_t Pin, Mode, Pull, Speed, Alternate; } GPIO_InitTypeDef;
+/** @} */
+
+/** @name GPIO/RCC (설정 값만 받고 동작 없음)
+ * @{ */
+#define GPIOB                       ((GPIO_TypeDef*)0)
+#define GPIO_PIN_8                  0x0100u
+#define GPIO_PIN_9                  0x0200u
+#define GPIO_MODE_AF_PP             0x02u
+#define GPIO_NOPULL                 0x00u
+#define GPIO_SPEED_FREQ_HIGH        0x02u
+#define GPIO_AF9_FDCAN1             0x09u
+#define RCC_FDCANCLKSOURCE_PCLK1    0x02u
+#define HAL_GPIO_Init(port, init)   ((void)(port), (void)(init))
+#define __HAL_RCC_FDCAN_CONFIG(src) ((void)(src))
+#define __HAL_RCC_FDCAN_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()    ((void)0)
+/** @} */
+
+/**
+ * @struct FDCAN_GlobalTypeDef
+ * @brief  FDCAN 레지스터 (stm32g474xx.h와 같은 배치)
+ */
+typedef struct {
+	volatile uint32_t CREL, ENDN, RESERVED1, DBTP, TEST, RWD, CCCR, NBTP, TSCC, TSCV, TOCC, TOCV;
+	uint32_t RESERVED2[4];
+	volatile uint32_t ECR, PSR, TDCR;
+	uint32_t RESERVED3;
+	volatile uint32_t IR, IE, ILS, ILE;
+	uint32_t RESERVED4[8];
+	volatile uint32_t RXGFC, XIDAM, HPMS;
+	uint32_t RESERVED5;
+	volatile uint32_t RXF0S, RXF0A, RXF1S, RXF1A;
+	uint32_t RESERVED6[8];
+	volatile uint32_t TXBC, TXFQS, TXBRP, TXBAR, TXBCR, TXBTO, TXBCF, TXBTIE, TXBCIE, TXEFS, TXEFA;
+} FDCAN_GlobalTypeDef;
+
+/**
+ * @struct FDCAN_Config_TypeDef
+ * @brief  FDCAN 공통 설정 레지스터
+ */
+typedef struct {
+	volatile uint32_t CKDIV;
+} FDCAN_Config_TypeDef;
+
+/** @brief 소프트웨어 버스의 FDCAN1 레지스터 (밀린 쓰기 처리 후 반환, CanBus.c) */
+extern FDCAN_GlobalTypeDef* pCanBusRegs(void);
+/** @brief 소프트웨어 버스의 FDCAN 공통 설정 레지스터 (CanBus.c) */
+extern FDCAN_Config_TypeDef CanBusConfig;
+/** @brief 소프트웨어 버스의 메시지 RAM (CanBus.c) */
+extern uint32_t ulCanBusRam[];
+
+/** @name FDCAN 인스턴스 및 비트 정의 (stm32g474xx.h 값)
+ * @{ */
+#define FDCAN1                  (pCanBusRegs())
+#define FDCAN_CONFIG            (&CanBusConfig)
+#define SRAMCAN_BASE            ((uintptr_t)ulCanBusRam)
+
+#define FDCAN_CCCR_INIT         (0x1UL << 0)
+#define FDCAN_CCCR_CCE          (0x1UL << 1)
+#define FDCAN_CCCR_FDOE         (0x1UL << 8)
+#define FDCAN_CCCR_BRSE         (0x1UL << 9)
+#define FDCAN_CCCR_TXP          (0x1UL << 14)
+#define FDCAN_NBTP_NTSEG2_Pos   (0U)
+#define FDCAN_NBTP_NTSEG1_Pos   (8U)
+#define FDCAN_NBTP_NBRP_Pos     (16U)
+#define FDCAN_NBTP_NSJW_Pos     (25U)
+#define FDCAN_DBTP_DSJW_Pos     (0U)
+#define FDCAN_DBTP_DTSEG2_Pos   (4U)
+#define FDCAN_DBTP_DTSEG1_Pos   (8U)
+#define FDCAN_DBTP_DBRP_Pos     (16U)
+#define FDCAN_DBTP_TDC          (0x1UL << 23)
+#define FDCAN_TDCR_TDCO_Pos     (8U)
+#define FDCAN_RXGFC_RRFE        (0x1UL << 0)
+#define FDCAN_RXGFC_RRFS        (0x1UL << 1)
+#define FDCAN_RXGFC_ANFE_Pos    (2U)
+#define FDCAN_RXGFC_ANFS_Pos    (4U)
+#define FDCAN_RXGFC_LSS_Pos     (16U)
+#define FDCAN_RXGFC_LSE_Pos     (24U)
+#define FDCAN_RXF0S_F0FL_Pos    (0U)
+#define FDCAN_RXF0S_F0FL_Msk    (0xFUL << FDCAN_RXF0S_F0FL_Pos)
+#define FDCAN_RXF0S_F0GI_Pos    (8U)
+#define FDCAN_RXF0S_F0GI_Msk    (0x3UL << FDCAN_RXF0S_F0GI_Pos)
+#define FDCAN_RXF0S_F0PI_Pos    (16U)
+#define FDCAN_RXF0S_F0F         (0x1UL << 24)
+#define FDCAN_RXF0S_RF0L        (0x1UL << 25)
+#define FDCAN_TXFQS_TFFL_Pos    (0U)
+#define FDCAN_TXFQS_TFGI_Pos    (8U)
+#define FDCAN_TXFQS_TFQPI_Pos   (16U)
+#define FDCAN_TXFQS_TFQPI_Msk   (0x3UL << FDCAN_TXFQS_TFQPI_Pos)
+#define FDCAN_TXFQS_TFQF        (0x1UL << 21)
+/** @} */
+
+/** @name CMSIS 내장 함수
+ * @{ */
+#define __DMB()             __sync_synchronize()
+#define __CLZ(x)            ((uint8_t)(((x) == 0u) ? 32u : (uint32_t)__builtin_clz(x)))
+/** @} */
+
+/**
+ * @brief  시스템 시각 [ms] (호스트 프로그램이 정의)
+ * @retval 시각
+ */
+extern uint32_t HAL_GetTick(void);
+
+#endif /* TEST_HAL_STM32G4XX_HAL_H_ */
@@ -0,0 +1,417 @@
+/**
+ * @file    proto_cli.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜(Proto.h) Linux 명령줄 도구
+ * @details 직렬 장치(USB-UART 또는 proto_sim이 출력한 pty 슬레이브)를 원시 모드로 열고 명령 1개를 실행합니다.
+ * 변수는 레지스트리 ID 또는 이름(VAR_INFO로 조회)으로 지정하고, 값은 변수 타입(VAR_INFO)에 맞게 변환합니다.
+ * 응답이 없으면 같은 순번으로 재전송하며(ProtoHost.c), 같은 포트의 텔레메트리 바이트는 건너뜁니다.
+ *
+ * 사용법: proto_cli [-b 속도] [-t 제한 시간 ms] 장치 명령 [인자...]
+ * | 명령 | 내용 |
+ * | :--- | :--- |
+ * | **ping** | 프로토콜 버전, 변수 수, 파라미터 수 |
+ * | **list** | 변수 목록 (ID, 이름, 타입, 단위, 스케일) |
+ * | **read 변수...** | 여러 변수를 한 요청으로 읽음 (최대 PROTO_READ_MAX개) |
+ * | **write 변수 값** | 변수 쓰기 (제어 ISR에서 적용) |
+ * | **start / stop / reset** | 구동 시작/정지, 고장 해제 |
+ * | **get** | 설정값 (속도, Id, Iq, 전압, 제어 모드) |
+ * | **set 필드 값** | 설정값 쓰기 (wrpm, idsr, iqsr, vdqsr, mode) |
+ * | **param [이름 [값]]** | 파라미터 설계 입력 목록/읽기/변경 (적용은 commit) |
+ * | **commit** | 파라미터 세트 계산 및 게시, 결과 출력 |
+ * | **scope arm 변수,... [키=값...]** | 무장 (mode=single/normal, decim, pre, ch, trig=rising/falling/above/below/change, level) |
+ * | **scope status** | 스코프 상태 |
+ * | **scope read [변수,...]** | 완료 버퍼 전체를 CSV로 출력 (변수를 주면 이름 머리글과 물리값, 없으면 원시 샘플) |
+ * | **telem 사용 [raw/delta]** | 텔레메트리 송신 사용/모드 |
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include "Uart.h"
+#include "DataChannel.h"
+#include "Param.h"
+#include "Command.h"
+#include "Telemetry.h"
+#include "ProtoHost.h"
+#include "Pty.h"
+
+/** @brief 파라미터 설계 입력 필드 (sCtrlParamCfg 순서 = PARAM_GET/SET 인덱스) */
+#define CLI_PARAM_LIST(X) \
+	X(fRs) X(fLd) X(fLq) X(fLamf) X(fPP) X(fJm) \
+	X(fWcCc) X(fWcSc) X(fWcPll) X(fZetaPll) X(fWcWrpmLpf) \
+	X(fIsMax) X(fWrpmMax) X(fWrpmAcc) X(fWrpmDec) \
+	X(fCurrFaultLev) X(fVdcFaultLev) X(fSpdFaultLev) X(fVdcUvFaultLev) \
+	X(fIbatMax) X(fPbatMax) X(fVdcSagMin) X(fVdcRegenMax) X(fIdBrakeMax) \
+	X(fIsPeak) X(fTauWind)
+#define CLI_PARAM_ENTRY(f)  { #f, (uint8_t)(offsetof(sCtrlParamCfg, f) / sizeof(float)) },
+
+/** @brief 파라미터 이름 표 */
+static const struct { const char* pName; uint8_t uIdx; } CliParam[] = { CLI_PARAM_LIST(CLI_PARAM_ENTRY) };
+#define CLI_PARAM_NUM       (sizeof(CliParam) / sizeof(CliParam[0]))
+_Static_assert(CLI_PARAM_NUM == sizeof(sCtrlParamCfg) / sizeof(float), "CLI_PARAM_LIST out of date");
+
+/** @brief 변수 타입/단위 이름 */
+static const char* const pCliType[] = { "float", "int16", "uint16", "int32", "uint32" };
+static const char* const pCliUnit[] = { "", "A", "V", "rpm", "rad", "rad/s", "Nm", "s", "us", "cnt", "rpm/s", "mAh", "degC", "W" };
+/** @brief 설정값 필드 이름 (PROTO_SET_* 순서) */
+static const char* const pCliSet[] = { "wrpm", "idsr", "iqsr", "vdqsr", "mode" };
+/** @brief 스코프 트리거 종류 이름 (SCOPE_TRIG_* 순서) */
+static const char* const pCliTrig[] = { "rising", "falling", "above", "below", "change" };
+
+/** @brief 변수 목록 (VAR_INFO, 처음 필요할 때 전체 조회) */
+static sProtoVarInfo* pCliVar;
+static uint16_t uCliVarNum;
+
+static sProtoHost Host;
+
+/**
+ * @brief  직렬 쓰기
+ */
+static int iCliWrite(void* pCtx, const uint8_t* pData, uint16_t uLen){
+	int iFd = *(int*)pCtx;
+	ssize_t lWr;
+
+	while(uLen > 0u) {
+		lWr = write(iFd, pData, uLen);
+		if(lWr <= 0) return -1;
+		pData += lWr;
+		uLen -= (uint16_t)lWr;
+	}
+	return 0;
+}
+
+/**
+ * @brief  직렬 읽기 (poll로 제한 시간 대기)
+ */
+static int iCliRead(void* pCtx, uint8_t* pDst, uint16_t uMax, int iTimeoutMs){
+	struct pollfd Pfd = { *(int*)pCtx, POLLIN, 0 };
+	ssize_t lRd;
+
+	if(poll(&Pfd, 1, iTimeoutMs) <= 0) return 0;
+	lRd = read(Pfd.fd, pDst, uMax);
+	return (lRd > 0) ? (int)lRd : -1;
+}
+
+/**
+ * @brief  단조 시계 [ms]
+ */
+static uint32_t ulCliTick(void* pCtx){
+	struct timespec Ts;
+
+	(void)pCtx;
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (uint32_t)(Ts.tv_sec * 1000 + Ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief  호출 결과를 확인하고 실패면 종료합니다.
+ */
+static void vCliCheck(uint16_t uStatus, const char* pWhat){
+	if(uStatus == PROTO_OK) return;
+	fprintf(stderr, "%s: %s\n", pWhat, pProtoStatusStr(uStatus));
+	exit(1);
+}
+
+/**
+ * @brief  변수 목록을 장치에서 읽습니다. (한 번만)
+ */
+static void vCliLoadVars(void){
+	uint16_t uVer, uParamNum, i;
+
+	if(pCliVar != NULL) return;
+	vCliCheck(uProtoPing(&Host, &uVer, &uCliVarNum, &uParamNum), "ping");
+	pCliVar = calloc(uCliVarNum, sizeof(sProtoVarInfo));
+	for(i = 0u; i < uCliVarNum; i++) vCliCheck(uProtoVarInfo(&Host, i, &pCliVar[i]), "info");
+}
+
+/**
+ * @brief  변수 ID 또는 이름을 ID로 바꿉니다.
+ */
+static uint16_t uCliVarId(const char* pArg){
+	char* pEnd;
+	unsigned long ulId = strtoul(pArg, &pEnd, 0);
+	uint16_t i;
+
+	vCliLoadVars();
+	if((*pEnd == '\0') && (ulId < uCliVarNum)) return (uint16_t)ulId;
+	for(i = 0u; i < uCliVarNum; i++) {
+		if(strcmp(pCliVar[i].cName, pArg) == 0) return i;
+	}
+	fprintf(stderr, "unknown variable: %s\n", pArg);
+	exit(2);
+}
+
+/**
+ * @brief  원시값을 변수 타입에 맞게 출력합니다.
+ */
+static void vCliPrintVal(uint16_t uId, uint32_t ulRaw){
+	float f;
+
+	switch(pCliVar[uId].uType){
+	case DCH_TYPE_FLOAT:	memcpy(&f, &ulRaw, 4u); printf("%.7g", (double)f);	break;
+	case DCH_TYPE_INT16:
+	case DCH_TYPE_INT32:	printf("%ld", (long)(int32_t)ulRaw);	break;
+	default:				printf("%lu", (unsigned long)ulRaw);	break;
+	}
+}
+
+/**
+ * @brief  문자열을 변수 타입의 원시값으로 바꿉니다.
+ */
+static uint32_t ulCliParseVal(uint16_t uId, const char* pArg){
+	float f;
+	uint32_t ul;
+
+	if(pCliVar[uId].uType != DCH_TYPE_FLOAT) return (uint32_t)strtol(pArg, NULL, 0);
+	f = strtof(pArg, NULL);
+	memcpy(&ul, &f, 4u);
+	return ul;
+}
+
+/**
+ * @brief  이름 목록에서 찾습니다.
+ * @retval 인덱스, -1: 없음
+ */
+static int iCliFind(const char* const* pList, int iNum, const char* pArg){
+	int i;
+
+	for(i = 0; i < iNum; i++) {
+		if(strcmp(pList[i], pArg) == 0) return i;
+	}
+	return -1;
+}
+
+/**
+ * @brief  쉼표로 구분한 변수 목록을 ID로 바꿉니다.
+ * @retval 변수 수
+ */
+static uint16_t uCliVarList(char* pArg, uint16_t* pId, uint16_t uMax){
+	uint16_t uNum = 0u;
+	char* pTok;
+
+	for(pTok = strtok(pArg, ","); (pTok != NULL) && (uNum < uMax); pTok = strtok(NULL, ",")) pId[uNum++] = uCliVarId(pTok);
+	return uNum;
+}
+
+/** @brief list */
+static int iCliList(void){
+	uint16_t i;
+
+	vCliLoadVars();
+	for(i = 0u; i < uCliVarNum; i++) {
+		printf("%3u %-24s %-6s %-5s %g\n", i, pCliVar[i].cName,
+				(pCliVar[i].uType < 5u) ? pCliType[pCliVar[i].uType] : "?",
+				(pCliVar[i].uUnit < sizeof(pCliUnit) / sizeof(pCliUnit[0])) ? pCliUnit[pCliVar[i].uUnit] : "?", (double)pCliVar[i].fScale);
+	}
+	return 0;
+}
+
+/** @brief read 변수... */
+static int iCliReadVars(int iArgc, char** pArgv){
+	uint16_t uId[PROTO_READ_MAX], uNum = 0u, i;
+	uint32_t ulRaw[PROTO_READ_MAX];
+
+	if((iArgc < 1) || (iArgc > (int)PROTO_READ_MAX)) {
+		fprintf(stderr, "read: 1 to %u variables\n", PROTO_READ_MAX);
+		return 2;
+	}
+	while(uNum < (uint16_t)iArgc) {
+		uId[uNum] = uCliVarId(pArgv[uNum]);
+		uNum++;
+	}
+	vCliCheck(uProtoVarRead(&Host, uId, uNum, ulRaw), "read");
+	for(i = 0u; i < uNum; i++) {
+		printf("%s = ", pCliVar[uId[i]].cName);
+		vCliPrintVal(uId[i], ulRaw[i]);
+		printf("\n");
+	}
+	return 0;
+}
+
+/** @brief param [이름 [값]] */
+static int iCliParam(int iArgc, char** pArgv){
+	char* pEnd;
+	float fVal;
+	unsigned long ulIdx;
+	uint16_t i;
+
+	if(iArgc == 0) {
+		for(i = 0u; i < CLI_PARAM_NUM; i++) {
+			vCliCheck(uProtoParamGet(&Host, CliParam[i].uIdx, &fVal), "param");
+			printf("%2u %-16s %g\n", CliParam[i].uIdx, CliParam[i].pName, (double)fVal);
+		}
+		return 0;
+	}
+	ulIdx = strtoul(pArgv[0], &pEnd, 0);
+	if(*pEnd != '\0') {
+		for(i = 0u; (i < CLI_PARAM_NUM) && (strcmp(CliParam[i].pName, pArgv[0]) != 0); i++) {}
+		if(i == CLI_PARAM_NUM) {
+			fprintf(stderr, "unknown parameter: %s\n", pArgv[0]);
+			return 2;
+		}
+		ulIdx = CliParam[i].uIdx;
+	}
+	if(iArgc >= 2) vCliCheck(uProtoParamSet(&Host, (uint8_t)ulIdx, strtof(pArgv[1], NULL)), "param set");
+	vCliCheck(uProtoParamGet(&Host, (uint8_t)ulIdx, &fVal), "param");
+	printf("%g\n", (double)fVal);
+	return 0;
+}
+
+/** @brief commit: 계산이 끝날 때까지 상태를 읽어 결과를 출력 */
+static int iCliCommit(void){
+	uint16_t uPending = 1u, uErr = 0u, uTry;
+	uint32_t ulCnt = 0ul, ulVer = 0ul;
+
+	vCliCheck(uProtoCall(&Host, PROTO_OP_PARAM_COMMIT, NULL, 0u, NULL, NULL), "commit");
+	for(uTry = 0u; uPending && (uTry < 100u); uTry++) {
+		vCliCheck(uProtoParamStatus(&Host, &uPending, &uErr, &ulCnt, &ulVer), "param status");
+		if(uPending) usleep(10000);
+	}
+	printf("pending %u, error 0x%04X, commits %lu, version %lu\n", uPending, uErr, (unsigned long)ulCnt, (unsigned long)ulVer);
+	return (uPending || uErr) ? 1 : 0;
+}
+
+/** @brief scope arm/status/read */
+static int iCliScope(int iArgc, char** pArgv){
+	static int16_t iBuf[SCOPE_DEPTH * SCOPE_CH_MAX];
+	sProtoScopeCfg Cfg = { SCOPE_MODE_SINGLE, 0u, 1u, SCOPE_DEPTH / 4u, 0u, SCOPE_TRIG_RISING, 0.0f, { 0u } };
+	sProtoScopeStatus St;
+	uint16_t uId[SCOPE_CH_MAX], uNum = 0u, i, k;
+	char* pVal;
+	int iArg, iSel;
+
+	if((iArgc >= 2) && (strcmp(pArgv[0], "arm") == 0)) {
+		Cfg.uChNum = (uint8_t)uCliVarList(pArgv[1], Cfg.uId, SCOPE_CH_MAX);
+		for(iArg = 2; iArg < iArgc; iArg++) {
+			pVal = strchr(pArgv[iArg], '=');
+			if(pVal == NULL) break;
+			*pVal++ = '\0';
+			if(strcmp(pArgv[iArg], "mode") == 0)		Cfg.uMode = (strcmp(pVal, "normal") == 0) ? SCOPE_MODE_NORMAL : SCOPE_MODE_SINGLE;
+			else if(strcmp(pArgv[iArg], "decim") == 0)	Cfg.uDecim = (uint16_t)atoi(pVal);
+			else if(strcmp(pArgv[iArg], "pre") == 0)	Cfg.uPreTrig = (uint16_t)atoi(pVal);
+			else if(strcmp(pArgv[iArg], "ch") == 0)		Cfg.uTrigCh = (uint8_t)atoi(pVal);
+			else if(strcmp(pArgv[iArg], "level") == 0)	Cfg.fTrigLevel = strtof(pVal, NULL);
+			else if((strcmp(pArgv[iArg], "trig") == 0) && ((iSel = iCliFind(pCliTrig, 5, pVal)) >= 0)) Cfg.uTrigType = (uint8_t)iSel;
+			else break;
+		}
+		if(iArg != iArgc) {
+			fprintf(stderr, "scope arm: bad option %s\n", pArgv[iArg]);
+			return 2;
+		}
+		vCliCheck(uProtoScopeArm(&Host, &Cfg), "scope arm");
+		return 0;
+	}
+
+	vCliCheck(uProtoScopeStatus(&Host, &St), "scope status");
+	if((iArgc >= 1) && (strcmp(pArgv[0], "status") == 0)) {
+		printf("state %u, ready %u, channels %u, pretrig %u, depth %u, captures %lu\n",
+				St.uState, St.uReady, St.uChNum, St.uPreTrig, St.uDepth, (unsigned long)St.ulCaptureCnt);
+		return 0;
+	}
+	if((iArgc < 1) || (strcmp(pArgv[0], "read") != 0)) {
+		fprintf(stderr, "scope: arm | status | read\n");
+		return 2;
+	}
+
+	if(iArgc >= 2) {
+		uNum = uCliVarList(pArgv[1], uId, SCOPE_CH_MAX);
+		if(uNum != St.uChNum) {
+			fprintf(stderr, "scope read: %u variables given, %u channels armed\n", uNum, St.uChNum);
+			return 2;
+		}
+	}
+	vCliCheck(uProtoScopeDownload(&Host, St.uChNum, iBuf), "scope read");
+
+	printf("sample");
+	for(i = 0u; i < St.uChNum; i++) {
+		if(uNum != 0u)	printf(",%s", pCliVar[uId[i]].cName);
+		else			printf(",ch%u", i);
+	}
+	printf("\n");
+	for(k = 0u; k < SCOPE_DEPTH; k++) {
+		printf("%d", (int)k - (int)St.uPreTrig);
+		for(i = 0u; i < St.uChNum; i++) {
+			if(uNum != 0u)	printf(",%.6g", (double)iBuf[k * St.uChNum + i] / (double)pCliVar[uId[i]].fScale);
+			else			printf(",%d", iBuf[k * St.uChNum + i]);
+		}
+		printf("\n");
+	}
+	return 0;
+}
+
+int main(int argc, char** argv){
+	const sProtoLink Link = { iCliWrite, iCliRead, ulCliTick, NULL };
+	unsigned long ulBaud = UART_BAUD;
+	uint16_t uVer, uVarNum, uParamNum, uMode, i, uId;
+	float fSet[4];
+	int iOpt, iFd, iTimeout = PROTO_HOST_TIMEOUT_MS, iSel, iNarg;
+	char** pArg;
+	const char* pCmd;
+
+	while((iOpt = getopt(argc, argv, "b:t:")) != -1) {
+		switch(iOpt) {
+		case 'b':	ulBaud = strtoul(optarg, NULL, 10); break;
+		case 't':	iTimeout = atoi(optarg); break;
+		default:	optind = argc; break;
+		}
+	}
+	if((argc - optind) < 2) {
+		fprintf(stderr, "usage: %s [-b baud] [-t timeout_ms] device command [args...]\n"
+				"  ping | list | read var... | write var value | start | stop | reset | get | set field value\n"
+				"  param [name [value]] | commit | scope arm var,... [key=value...] | scope status | scope read [var,...]\n"
+				"  telem 0|1 [raw|delta]\n", argv[0]);
+		return 2;
+	}
+
+	iFd = iSerialOpen(argv[optind], ulBaud);
+	if(iFd < 0) {
+		perror(argv[optind]);
+		return 1;
+	}
+	vProtoHostInit(&Host, &Link);
+	Host.Link.pCtx = &iFd;
+	Host.uTimeoutMs = (uint16_t)iTimeout;
+
+	pCmd = argv[optind + 1];
+	pArg = &argv[optind + 2];
+	iNarg = argc - optind - 2;
+
+	if(strcmp(pCmd, "ping") == 0) {
+		vCliCheck(uProtoPing(&Host, &uVer, &uVarNum, &uParamNum), "ping");
+		printf("version %u, variables %u, parameters %u\n", uVer, uVarNum, uParamNum);
+	}
+	else if(strcmp(pCmd, "list") == 0)		return iCliList();
+	else if(strcmp(pCmd, "read") == 0)		return iCliReadVars(iNarg, pArg);
+	else if((strcmp(pCmd, "write") == 0) && (iNarg == 2)) {
+		uId = uCliVarId(pArg[0]);
+		vCliCheck(uProtoVarWrite(&Host, uId, ulCliParseVal(uId, pArg[1])), "write");
+	}
+	else if(strcmp(pCmd, "start") == 0)		vCliCheck(uProtoCmd(&Host, CMD_START), "start");
+	else if(strcmp(pCmd, "stop") == 0)		vCliCheck(uProtoCmd(&Host, CMD_STOP), "stop");
+	else if(strcmp(pCmd, "reset") == 0)		vCliCheck(uProtoCmd(&Host, CMD_RESET), "reset");
+	else if(strcmp(pCmd, "get") == 0) {
+		vCliCheck(uProtoSetGet(&Host, fSet, &uMode), "get");
+		for(i = 0u; i < 4u; i++) printf("%s = %g\n", pCliSet[i], (double)fSet[i]);
+		printf("mode = %u\n", uMode);
+	}
+	else if((strcmp(pCmd, "set") == 0) && (iNarg == 2) && ((iSel = iCliFind(pCliSet, 5, pArg[0])) >= 0)) {
+		vCliCheck(uProtoSetWrite(&Host, (uint8_t)iSel, strtof(pArg[1], NULL)), "set");
+	}
+	else if(strcmp(pCmd, "param") == 0)		return iCliParam(iNarg, pArg);
+	else if(strcmp(pCmd, "commit") == 0)	return iCliCommit();
+	else if(strcmp(pCmd, "scope") == 0)		return iCliScope(iNarg, pArg);
+	else if((strcmp(pCmd, "telem") == 0) && (iNarg >= 1)) {
+		uMode = (iNarg < 2) ? 0xFFu : (strcmp(pArg[1], "delta") == 0) ? TELEM_MODE_DELTA : TELEM_MODE_RAW;
+		vCliCheck(uProtoTelem(&Host, (uint8_t)atoi(pArg[0]), (uint8_t)uMode), "telem");
+	}
+	else {
+		fprintf(stderr, "bad command: %s\n", pCmd);
+		return 2;
+	}
+	return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file    proto_sim.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜 장치 대역 (보드 없이 proto_cli를 시험하기 위한 pty 장치)
+ * @details pty 마스터를 열어 슬레이브 경로를 출력한 뒤, 장치 대역(ProtoDevice.c)을 실시간 속도로 실행합니다.
+ * 수신 바이트는 마스터에서 비차단으로 읽어 Proto.c에 넣고, 응답(과 켜진 경우 텔레메트리)은 마스터에 씁니다.
+ * 슬레이브는 /dev/ttyUSB0 등 실제 장치와 같은 방법으로 열 수 있습니다.
+ *
+ * 사용법: proto_sim [-t 초]
+ * | 옵션 | 내용 |
+ * | :--- | :--- |
+ * | **-t** | 실행 시간 [s] (기본 0: 종료할 때까지) |
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include "UartStub.h"
+#include "Proto.h"
+#include "ProtoDevice.h"
+#include "Pty.h"
+
+/** @brief 실시간 동기 간격 [제어 주기] (1ms) */
+#define SIM_PACE_CYCLES     DEV_CYCLES_PER_MS
+
+/** @brief pty 마스터 */
+static int iMasterFd = -1;
+
+/**
+ * @brief  송신 콜백: 송신 버퍼를 pty 마스터에 씁니다.
+ * @details 판독측이 없어 pty 버퍼가 가득 차면 남은 바이트를 버립니다 (실제 UART와 같이 장치는 막히지 않음).
+ */
+static void vSimTx(const uint8_t* pData, uint16_t uLen){
+	ssize_t lWr;
+
+	while(uLen > 0u) {
+		lWr = write(iMasterFd, pData, uLen);
+		if(lWr <= 0) return;
+		pData += lWr;
+		uLen -= (uint16_t)lWr;
+	}
+}
+
+/**
+ * @brief  수신 콜백: pty 마스터에서 비차단으로 읽습니다.
+ */
+static uint16_t uSimRx(uint8_t* pDst, uint16_t uMax){
+	ssize_t lRd = read(iMasterFd, pDst, uMax);
+
+	return (lRd > 0) ? (uint16_t)lRd : 0u;
+}
+
+/**
+ * @brief  단조 시계 [s]
+ */
+static double dSimNow(void){
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + (double)Ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv){
+	char cName[64];
+	double dTimeS = 0.0, dStart, dAhead;
+	int iOpt;
+
+	while((iOpt = getopt(argc, argv, "t:")) != -1) {
+		switch(iOpt) {
+		case 't':	dTimeS = atof(optarg); break;
+		default:
+			fprintf(stderr, "usage: %s [-t sec]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	iMasterFd = iPtyOpenMaster(cName, sizeof(cName));
+	if(iMasterFd < 0) {
+		perror("posix_openpt");
+		return 1;
+	}
+	fcntl(iMasterFd, F_SETFL, fcntl(iMasterFd, F_GETFL) | O_NONBLOCK);
+	printf("%s\n", cName);
+	fflush(stdout);
+
+	pUartStubTx = vSimTx;
+	pUartStubRx = uSimRx;
+	vDevInit();
+
+	dStart = dSimNow();
+	while((dTimeS <= 0.0) || ((double)ulDevCycles / DEV_CTRL_FREQ < dTimeS)) {
+		vDevStep(SIM_PACE_CYCLES);
+		dAhead = (double)ulDevCycles / DEV_CTRL_FREQ - (dSimNow() - dStart);
+		if(dAhead > 0.0) usleep((useconds_t)(dAhead * 1e6));
+	}
+
+	fprintf(stderr, "proto_sim: %lu requests, crc error %lu, timeout %lu\n",
+			(unsigned long)Proto.ulReqCnt, (unsigned long)Proto.ulCrcErrCnt, (unsigned long)Proto.ulTimeoutCnt);
+	close(iMasterFd);
+	return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file    sim_regen.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   회생 제동 직류단 전압 제한(PowerLimit.c) 호스트 시뮬레이션
+ * @details 실제 PowerLimit.c를 대체 헤더(stub/GlobalVar.h, stub/MotorControl.h)와 함께 빌드하고, 파라미터 세트(pCtrlParam)와
+ * 열 모델 허용 전류(Thermal.fIsAllow)는 이 파일에서 uParamBuild와 같은 식으로 채웁니다.
+ *
+ * | 모델 | 내용 |
+ * | :--- | :--- |
+ * | **전동기** | SPM (GlobalVar.h 기본값 Rs, Ld = Lq, λf, 극쌍수 2), 속도 고정 (차량 관성 ≫ 제동 시간) |
+ * | **전류 제어** | 1차 추종 (대역폭 WC_CC = 2π·300), q축 지령은 스로틀 토크 기울기(2000A/s)로 증가 |
+ * | **배터리** | 개방 전압 Voc + 내부 저항 Rb: Vdc = Voc − Rb·Pbat/Vdc (Pbat < 0: 충전), 2차 방정식 해 |
+ * | **지령** | Iq* = LIMIT(−Ibrake, fIqMin, fIqMax), Id* = fIdBrake (Throttle.c 토크 출력과 같은 적용) |
+ *
+ * 기본 조건(Voc 15.6V, Rb 0.5Ω, 10000RPM, 정격 10A 제동)에서 제한이 없으면 직류단이 과전압 Fault(17V)를 넘고,
+ * 제한기(fVdcRegenMax = 16V)는 16.0V로 붙잡아야 합니다. 인자: [-v] [Voc] [Rb]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "UnitTest.h"
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "Param.h"
+#include "PowerLimit.h"
+#include "Thermal.h"
+
+/** @name 시뮬레이션 조건
+ * @{ */
+#define SIM_TS          50.0e-6f            /**< 제어 주기 [s] (20kHz) */
+#define SIM_TIME_S      0.3f                /**< 모의 시간 [s] */
+#define SIM_RS          19e-3f              /**< 상저항 [Ohm] (MOT_RS) */
+#define SIM_LS          3.2e-6f             /**< 인덕턴스 [H] (MOT_LD = MOT_LQ) */
+#define SIM_LAMF        2e-3f               /**< 자속 [Wb] (MOT_LAMF) */
+#define SIM_PP          2.0f                /**< 극쌍수 (MOT_PP) */
+#define SIM_IS_RATED    10.0f               /**< 정격 전류 [A] (MOT_IS_RATED) */
+#define SIM_WC_CC       (300.0f * 6.2831853f) /**< 전류 제어 대역폭 [rad/s] (WC_CC) */
+#define SIM_IQ_SLOPE    2000.0f             /**< 토크 지령 기울기 [A/s] (THR_IQ_SLOPE) */
+#define SIM_WRPM        10000.0f            /**< 기계 속도 [RPM] (MOT_WRPM_RATED) */
+#define SIM_VOC         15.6f               /**< 배터리 개방 전압 [V] (4S, 셀당 3.9V) */
+#define SIM_RB          0.5f                /**< 배터리 + 배선 내부 저항 [Ohm] (소용량 팩, 저온) */
+/** @} */
+
+/* 시험 대상이 참조하는 전역 변수 */
+float fTsamp = SIM_TS, fVdc, fInvVdc;
+uint16_t uCurrState = RUN_STATE;
+sMotorCtrl INV;
+sThermal Thermal;
+static sCtrlParam SimParam;
+const sCtrlParam* pCtrlParam = &SimParam;
+
+/**
+ * @struct sSimResult
+ * @brief  시뮬레이션 결과
+ */
+typedef struct {
+	float fVdcPeak, fVdcEnd, fIqEnd, fIdEnd;
+} sSimResult;
+
+static int iVerbose = 0;
+static float fVoc = SIM_VOC, fRb = SIM_RB;
+
+/**
+ * @brief  uParamBuild와 같은 식으로 전원 제한 관련 파생값을 채웁니다.
+ * @param  fVdcRegenMax 회생 전압 상한 [V] (0: 사용 안 함)
+ * @param  fIdBrakeMax d축 손실 제동 최대 전류 [A]
+ */
+static void vSimParam(float fVdcRegenMax, float fIdBrakeMax){
+	float fKT = 1.5f * SIM_PP * SIM_LAMF;
+
+	memset(&SimParam, 0, sizeof(SimParam));
+	SimParam.fKT = fKT;
+	SimParam.fInvKT = 1.0f / fKT;
+	SimParam.fTeRefMax = fKT * SIM_IS_RATED;
+	SimParam.fTeRefMin = -SimParam.fTeRefMax;
+	SimParam.fIbatMax = PWR_LIM_NONE;
+	SimParam.fPbatMax = PWR_LIM_NONE;
+	SimParam.fVdcSagMin = 0.0f;
+	SimParam.fVdcRegenMax = fVdcRegenMax;
+	SimParam.fIdBrakeMax = fIdBrakeMax;
+	SimParam.fKiPwrLim = PWR_LIM_WC_RATIO * SIM_WC_CC * SIM_TS;
+	Thermal.fIsAllow = SIM_IS_RATED;
+}
+
+/**
+ * @brief  정격 전류 제동을 모의합니다.
+ * @param  pszName 조건 이름
+ * @param  fVdcRegenMax 회생 전압 상한 [V] (0: 사용 안 함)
+ * @param  fIdBrakeMax d축 손실 제동 최대 전류 [A]
+ * @retval 결과
+ */
+static sSimResult SimBrake(const char* pszName, float fVdcRegenMax, float fIdBrakeMax){
+	const float fWe = SIM_WRPM * SIM_PP * (6.2831853f / 60.0f);
+	const uint32_t ulSteps = (uint32_t)(SIM_TIME_S / SIM_TS);
+	float fIqCmd = 0.0f, fIqRef, fIdRef, fId = 0.0f, fIq = 0.0f, fVd = 0.0f, fVq = fWe * SIM_LAMF, fP;
+	sSimResult R = { 0.0f, 0.0f, 0.0f, 0.0f };
+	uint32_t k;
+
+	vSimParam(fVdcRegenMax, fIdBrakeMax);
+	vInitPowerLimit();
+	fVdc = fVoc;
+
+	if(iVerbose) printf("# %s\n#  t[ms]   Vdc[V]   Iq[A]   Id[A]  IqMin[A]  RegenRed[A]\n", pszName);
+	for(k = 0u; k < ulSteps; k++){
+		/* 1. 측정값 (같은 주기 전류, 직전 주기 출력 전압) */
+		INV.CC.fIdsr = fId;
+		INV.CC.fIqsr = fIq;
+		INV.CC.fVdsrOut = fVd;
+		INV.CC.fVqsrOut = fVq;
+		fInvVdc = 1.0f / fVdc;
+
+		/* 2. 시험 대상 */
+		vPowerLimit();
+
+		/* 3. 지령: 기울기 제한 후 전원 제한 범위 적용 */
+		fIqCmd = fmaxf(fIqCmd - SIM_IQ_SLOPE * SIM_TS, -SIM_IS_RATED);
+		fIqRef = fminf(fmaxf(fIqCmd, PwrLim.fIqMin), PwrLim.fIqMax);
+		fIdRef = PwrLim.fIdBrake;
+
+		/* 4. 전류 제어 (1차 추종) 및 dq 전압 (정상 상태) */
+		fId += (fIdRef - fId) * SIM_WC_CC * SIM_TS;
+		fIq += (fIqRef - fIq) * SIM_WC_CC * SIM_TS;
+		fVd = SIM_RS * fId - fWe * SIM_LS * fIq;
+		fVq = SIM_RS * fIq + fWe * (SIM_LS * fId + SIM_LAMF);
+
+		/* 5. 배터리: Vdc² − Voc·Vdc + Rb·P = 0 */
+		fP = 1.5f * (fVd * fId + fVq * fIq);
+		fVdc = 0.5f * (fVoc + sqrtf(fVoc * fVoc - 4.0f * fRb * fP));
+
+		if(fVdc > R.fVdcPeak) R.fVdcPeak = fVdc;
+		if(iVerbose && (k % 200u) == 0u){
+			printf("%7.1f %8.3f %7.2f %7.2f %9.2f %12.2f\n", 1000.0f * (float)k * SIM_TS, fVdc, fIq, fId, PwrLim.fIqMin, PwrLim.fIqRegenRed);
+		}
+	}
+
+	R.fVdcEnd = fVdc;
+	R.fIqEnd = fIq;
+	R.fIdEnd = fId;
+	printf("%-28s Vdc peak %6.3f V, end %6.3f V, Iq %6.2f A, Id %6.2f A\n", pszName, R.fVdcPeak, R.fVdcEnd, R.fIqEnd, R.fIdEnd);
+	return R;
+}
+
+int main(int argc, char** argv){
+	sSimResult Off, On, OnId;
+	int i, iArg = 0;
+
+	for(i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-v") == 0) iVerbose = 1;
+		else if(iArg++ == 0) fVoc = strtof(argv[i], NULL);
+		else fRb = strtof(argv[i], NULL);
+	}
+	printf("Voc %.2f V, Rb %.3f Ohm, %.0f RPM, brake %.1f A\n", fVoc, fRb, SIM_WRPM, SIM_IS_RATED);
+
+	Off = SimBrake("limit off", 0.0f, 0.0f);
+	On = SimBrake("limit 16V", 16.0f, 0.0f);
+	OnId = SimBrake("limit 16V, Id brake 5A", 16.0f, 5.0f);
+
+	/* 기본 조건에서만 판정 (인자로 바꾼 조건은 출력만) */
+	if(iArg == 0){
+		UT_CHECK(Off.fVdcEnd >= VDC_FAULT_LEV);
+		UT_CHECK(On.fVdcPeak < VDC_FAULT_LEV);
+		UT_CHECK_NEAR(On.fVdcEnd, 16.0f, 0.05f);
+		UT_CHECK(On.fIqEnd < -1.0f);
+		UT_CHECK_NEAR(OnId.fVdcEnd, 16.0f, 0.05f);
+		UT_CHECK(OnId.fIqEnd <= On.fIqEnd + 0.01f);
+		UT_CHECK(OnId.fIdEnd < -0.1f);
+		return UT_RESULT();
+	}
+	return 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file    GlobalVar.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 시험용 GlobalVar.h 대체 헤더 (HAL 없이 제어 모듈이 쓰는 전역 변수만 선언)
+ * @details 시험 프로그램이 변수를 정의하고 값을 직접 씁니다. 상수 값은 Core/Inc/GlobalVar.h와 같게 유지합니다.
+ */
+
+#ifndef INC_GLOBALVAR_H_
+#define INC_GLOBALVAR_H_
+
+#include <stdint.h>
+
+/** @name 시스템 주 상태 (Core/Inc/GlobalVar.h와 동일)
+ * @{ */
+#define IDLE_STATE			0u
+#define ALIGN_STATE			1u
+#define RUN_STATE			2u
+#define FAULT_STATE			3u
+#define FLYSTART_STATE		4u
+/** @} */
+
+#define VDC_FAULT_LEV       17.0f       /**< 직류단 과전압 차단 레벨 [V] */
+
+/** @brief CMSIS __CLZ 대체 (선행 0 비트 수, 입력 0이면 32) */
+#define __CLZ(x)            ((uint8_t)(((x) == 0u) ? 32u : (uint32_t)__builtin_clz(x)))
+
+extern float fTsamp;                    /**< 제어 주기 [s] */
+extern float fVdc;                      /**< 직류단 전압 [V] */
+extern float fInvVdc;                   /**< 직류단 전압 역수 */
+extern uint16_t uCurrState;             /**< 현재 주 상태 */
+
+#endif /* INC_GLOBALVAR_H_ */
@@ -0,0 +1,33 @@
+/**
+ * @file    MotorControl.h
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   호스트 시험용 MotorControl.h 대체 헤더 (INV 중 시험 대상이 읽는 dq 전류/전압만 선언)
+ * @details 필드 이름은 Core/Inc/CurrentControl.h의 sCurrentCtrl과 같습니다.
+ */
+
+#ifndef INC_MOTORCONTROL_H_
+#define INC_MOTORCONTROL_H_
+
+#include <stdint.h>
+
+/**
+ * @struct sCurrentCtrl
+ * @brief  전류 제어기 중 시험에 필요한 필드
+ */
+typedef struct {
+	float fIdsr, fIqsr;         /**< dq축 측정 전류 [A] */
+	float fVdsrOut, fVqsrOut;   /**< 직전 주기 dq축 출력 전압 [V] */
+} sCurrentCtrl;
+
+/**
+ * @struct sMotorCtrl
+ * @brief  전동기 제어 객체 중 시험에 필요한 필드
+ */
+typedef struct {
+	sCurrentCtrl CC;
+} sMotorCtrl;
+
+extern sMotorCtrl INV;
+
+#endif /* INC_MOTORCONTROL_H_ */
@@ -0,0 +1,100 @@
+/**
+ * @file    telem_decode.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 스트림 Linux 복원 도구
+ * @details 직렬 장치(USB-UART 또는 telem_sim이 출력한 pty 슬레이브)를 원시 모드로 열어 텔레메트리 스트림(고정 형식/차분 압축 자동 구분)을 복원하고
+ * 샘플마다 CSV 한 줄(순번, 채널 물리값)을 표준 출력에 씁니다. 종료 시 통계(프레임, CRC 오류, 누락 샘플)를 표준 오류에 씁니다.
+ *
+ * 사용법: telem_decode [-b 속도] [-n 샘플 수] [-s 스케일0,스케일1,...] 장치
+ * | 옵션 | 내용 |
+ * | :--- | :--- |
+ * | **-b** | 통신 속도 [bps] (기본 UART_BAUD, pty는 무시) |
+ * | **-n** | 이 수만큼 복원하면 종료 (기본 0: 장치가 닫힐 때까지) |
+ * | **-s** | 채널별 변수 레지스트리 스케일 (물리값 = 샘플 / 스케일, 기본: vInitTelemetry 기본 채널 값) |
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "Uart.h"
+#include "TelemDecode.h"
+#include "Pty.h"
+
+/** @brief 출력 설정 */
+typedef struct {
+	float fScale[TELEM_CH_NUM];     /**< 채널 스케일 */
+	uint32_t ulLimit;               /**< 종료 샘플 수 (0: 제한 없음) */
+	uint32_t ulPrinted;             /**< 출력한 샘플 수 */
+} sDecodeOut;
+
+/**
+ * @brief  샘플 콜백: CSV 한 줄 출력
+ */
+static void vDecodePrint(const sTelemSample* pSample, void* pCtx){
+	sDecodeOut* pOut = (sDecodeOut*)pCtx;
+	uint16_t i;
+
+	if((pOut->ulLimit != 0ul) && (pOut->ulPrinted >= pOut->ulLimit)) return;
+	pOut->ulPrinted++;
+	printf("%u", pSample->uSeq);
+	for(i = 0u; i < TELEM_CH_NUM; i++) {
+		printf(",%.6g", (double)((float)pSample->iCh[i] / pOut->fScale[i]));
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv){
+	sDecodeOut Out = {{1000.0f, 1000.0f, 1.0f, 1000.0f}, 0ul, 0ul};
+	sTelemDecoder Dec;
+	unsigned long ulBaud = UART_BAUD;
+	uint8_t uRx[1024];
+	ssize_t lRd;
+	char* pTok;
+	int iFd, iOpt;
+	uint16_t i;
+
+	while((iOpt = getopt(argc, argv, "b:n:s:")) != -1) {
+		switch(iOpt) {
+		case 'b':	ulBaud = strtoul(optarg, NULL, 0); break;
+		case 'n':	Out.ulLimit = (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 's':
+			for(i = 0u, pTok = strtok(optarg, ","); (i < TELEM_CH_NUM) && (pTok != NULL); i++, pTok = strtok(NULL, ",")) {
+				Out.fScale[i] = (float)atof(pTok);
+				if(Out.fScale[i] == 0.0f) Out.fScale[i] = 1.0f;
+			}
+			break;
+		default:
+			optind = argc + 1;
+			break;
+		}
+	}
+	if(optind != argc - 1) {
+		fprintf(stderr, "usage: %s [-b baud] [-n samples] [-s s0,s1,...] device\n", argv[0]);
+		return 2;
+	}
+
+	iFd = iSerialOpen(argv[optind], ulBaud);
+	if(iFd < 0) {
+		perror(argv[optind]);
+		return 1;
+	}
+
+	vTelemDecInit(&Dec, vDecodePrint, &Out);
+	printf("seq");
+	for(i = 0u; i < TELEM_CH_NUM; i++) printf(",ch%u", i);
+	printf("\n");
+
+	while((Out.ulLimit == 0ul) || (Out.ulPrinted < Out.ulLimit)) {
+		lRd = read(iFd, uRx, sizeof(uRx));
+		if(lRd <= 0) break;                 /* 장치 종료 (pty 마스터가 닫히면 EIO) */
+		vTelemDecFeed(&Dec, uRx, (size_t)lRd);
+	}
+	close(iFd);
+
+	fprintf(stderr, "telem_decode: %lu bytes, %lu samples (%lu frames, %lu blocks), crc err %lu, lost %lu, skipped %lu bytes\n",
+			(unsigned long)Dec.ulRxBytes, (unsigned long)Dec.ulSampleCnt, (unsigned long)Dec.ulFrameCnt, (unsigned long)Dec.ulBlockCnt,
+			(unsigned long)Dec.ulCrcErrCnt, (unsigned long)Dec.ulLostCnt, (unsigned long)Dec.ulSkipBytes);
+	return 0;
+}
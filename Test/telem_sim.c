@@ -0,0 +1,110 @@
+/**
+ * @file    telem_sim.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 장치 대역 (보드 없이 telem_decode를 시험하기 위한 pty 송신기)
+ * @details pty 마스터를 열어 슬레이브 경로를 출력한 뒤, 실제 Telemetry.c를 합성 파형(TelemTrace.c)으로 20kHz 주기마다
+ * 실행하고 송신 버퍼를 마스터에 씁니다. 슬레이브는 /dev/ttyUSB0 등 실제 장치와 같은 방법으로 열 수 있습니다.
+ *
+ * 사용법: telem_sim [-t 초] [-r] [-d]
+ * | 옵션 | 내용 |
+ * | :--- | :--- |
+ * | **-d** | 차분 압축 모드(TELEM_MODE_DELTA)로 송신 (기본: 고정 형식) |
+ * | **-t** | 모의 시간 [s] (기본 0: 종료할 때까지) |
+ * | **-r** | 실시간 속도로 송신 (기본: 판독측이 읽는 만큼 최대 속도) |
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "UartStub.h"
+#include "Telemetry.h"
+#include "TelemTrace.h"
+#include "Pty.h"
+
+/** @brief 실시간 동기 간격 [제어 주기] (20ms) */
+#define SIM_PACE_CYCLES     400u
+
+/** @brief pty 마스터 */
+static int iMasterFd = -1;
+
+/**
+ * @brief  송신 콜백: 송신 버퍼를 pty 마스터에 씁니다.
+ */
+static void vSimTx(const uint8_t* pData, uint16_t uLen){
+	ssize_t lWr;
+
+	while(uLen > 0u) {
+		lWr = write(iMasterFd, pData, uLen);
+		if(lWr <= 0) {
+			perror("write");
+			exit(1);
+		}
+		pData += lWr;
+		uLen -= (uint16_t)lWr;
+	}
+}
+
+/**
+ * @brief  단조 시계 [s]
+ */
+static double dSimNow(void){
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + (double)Ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv){
+	char cName[64];
+	double dTimeS = 0.0, dStart, dAhead;
+	int iRealTime = 0, iDelta = 0, iOpt;
+	uint32_t k;
+
+	while((iOpt = getopt(argc, argv, "t:rd")) != -1) {
+		switch(iOpt) {
+		case 't':	dTimeS = atof(optarg); break;
+		case 'r':	iRealTime = 1; break;
+		case 'd':	iDelta = 1; break;
+		default:
+			fprintf(stderr, "usage: %s [-t sec] [-r] [-d]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	iMasterFd = iPtyOpenMaster(cName, sizeof(cName));
+	if(iMasterFd < 0) {
+		perror("posix_openpt");
+		return 1;
+	}
+	printf("%s\n", cName);
+	fflush(stdout);
+
+	pUartStubTx = vSimTx;
+	vTraceInit(1.0f);
+	vInitTelemetry();
+	if(iDelta) (void)uTelemSetMode(TELEM_MODE_DELTA);
+
+	dStart = dSimNow();
+	for(k = 0ul; (dTimeS <= 0.0) || ((double)k * TRACE_TS < dTimeS); k++) {
+		vTraceStep();
+		vTelemRecord();
+		vTelemTask();
+
+		if(iRealTime && ((k % SIM_PACE_CYCLES) == 0u)) {
+			dAhead = (double)k * TRACE_TS - (dSimNow() - dStart);
+			if(dAhead > 0.0) usleep((useconds_t)(dAhead * 1e6));
+		}
+	}
+
+	fprintf(stderr, "telem_sim: %lu samples, %lu bytes, drop %lu",
+			(unsigned long)Telem.uSeq, (unsigned long)ulUartStubTxBytes, (unsigned long)Telem.ulDropCnt);
+	if(iDelta) fprintf(stderr, ", ratio %.2f", (double)Telem.ulRawBytes / (double)(Telem.ulCompBytes ? Telem.ulCompBytes : 1ul));
+	fprintf(stderr, "\n");
+	/* 판독측이 남은 바이트를 읽을 시간을 준 뒤 종료 (마스터를 닫으면 슬레이브는 EIO) */
+	sleep(1);
+	close(iMasterFd);
+	return 0;
+}
@@ -0,0 +1,422 @@
+/**
+ * @file    test_can.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   CAN 상태/명령 프레임(CanMsg.c) 및 FDCAN 드라이버(Can.c) 호스트 시험
+ * @details 패킹/언패킹은 CanMsg.h 표의 바이트 배치와 왕복을 직접 검사하고, 드라이버는 소프트웨어 버스(CanBus.c)의 FDCAN1 대역 위에서
+ * 실제 Can.c를 장치 대역(ProtoDevice.c)과 함께 실행하여 버스의 다른 노드 입장에서 검사합니다.
+ *
+ * | 시험 | 내용 |
+ * | :--- | :--- |
+ * | **vTestStatusPack** | 상태 프레임 바이트 배치, 왕복, 순번/명령 상태 니블 |
+ * | **vTestCmdPack** | 명령 프레임 바이트 배치, 왕복, 길이/종류/비유한 값 거부 |
+ * | **vTestInit** | 필터 메시지 RAM, RXGFC, 비트 타이밍 레지스터, 버스 참여 |
+ * | **vTestStatusFrame** | 상태 프레임 ID/FD/BRS/길이, 장치 상태 반영, 순번 증가 |
+ * | **vTestFilter** | 다른 노드/확장 ID/원격 프레임 거부, 명령/전체 정지 ID만 수신 |
+ * | **vTestCommand** | 속도/토크 명령 → 시작, 제어 모드/목표값 반영, 정지 에지, 거부 |
+ * | **vTestTimeout** | 명령 끊김 정지, 전체 정지 |
+ * | **vTestFifo** | RX FIFO 넘침 손실, TX FIFO 가득 참, Bus-off 복구 |
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "UnitTest.h"
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "Command.h"
+#include "Param.h"
+#include "Can.h"
+#include "CanBus.h"
+#include "ProtoDevice.h"
+
+/** @brief 저속 제어 주기당 제어 주기 수 (20kHz / 2kHz) */
+#define SC_CYCLES           10u
+
+/**
+ * @brief  메인 루프(vCanTask 포함)와 제어 ISR을 ulMs 동안 실행합니다.
+ * @details uPeriodMs가 0이 아니면 그 간격으로 pCmd를 명령 ID로 다시 보냅니다 (감시 갱신).
+ */
+static void vRun(uint32_t ulMs, const sCanCmd* pCmd, uint32_t ulPeriodMs);
+
+/**
+ * @brief  명령 프레임을 장치 명령 ID로 보냅니다.
+ */
+static uint16_t uSendCmd(uint8_t uType, uint8_t uFlags, float fValue, uint16_t uFd){
+	sCanFrame Frame;
+	sCanCmd Cmd = {uType, uFlags, fValue};
+
+	memset(&Frame, 0, sizeof(Frame));
+	Frame.ulId = CAN_ID_CMD + CAN_NODE_ID;
+	Frame.uLen = CAN_CMD_LEN;
+	Frame.uFlags = uFd ? (CAN_BUS_FD | CAN_BUS_BRS) : 0u;
+	vCanPackCmd(&Cmd, Frame.uData);
+	return uCanBusSend(&Frame);
+}
+
+static void vRun(uint32_t ulMs, const sCanCmd* pCmd, uint32_t ulPeriodMs){
+	uint32_t ulCycles;
+
+	for(ulCycles = 0u; ulCycles < ulMs * DEV_CYCLES_PER_MS; ulCycles++) {
+		if((pCmd != NULL) && (ulPeriodMs != 0u) && ((ulCycles % (ulPeriodMs * DEV_CYCLES_PER_MS)) == 0u)) {
+			uSendCmd(pCmd->uType, pCmd->uFlags, pCmd->fValue, 1u);
+		}
+		vCanTask();
+		vDevStep(1u);
+	}
+}
+
+/**
+ * @brief  장치 대역, 버스, 드라이버를 초기화합니다. (main.c 순서: 명령/파라미터 → CAN)
+ */
+static void vReset(void){
+	vCanBusInit();
+	vDevInit();
+	vInitCan();
+}
+
+/** @brief 상태 프레임 바이트 배치, 왕복, 순번/명령 상태 니블 */
+static void vTestStatusPack(void){
+	static const uint8_t uExp[CAN_STATUS_LEN] = {
+		0x00u, 0x80u, 0xBBu, 0x44u,         /* 1500.0f */
+		0x00u, 0x00u, 0x20u, 0xC0u,         /* -2.5f */
+		0x00u, 0x00u, 0x40u, 0x42u,         /* 48.0f */
+		RUN_STATE, SPDCONTL_MODE, 0x81u, 0x2Au
+	};
+	sCanStatus In = {1500.0f, -2.5f, 48.0f, RUN_STATE, SPDCONTL_MODE, 0x81u, 0x0Au, CAN_CMD_STAT_TIMEOUT};
+	sCanStatus Out;
+	uint8_t uData[CAN_STATUS_LEN];
+	uint16_t i;
+
+	vCanPackStatus(&In, uData);
+	UT_CHECK(memcmp(uData, uExp, CAN_STATUS_LEN) == 0);
+
+	vCanUnpackStatus(uData, &Out);
+	UT_CHECK(Out.fWrpm == In.fWrpm);
+	UT_CHECK(Out.fIqsr == In.fIqsr);
+	UT_CHECK(Out.fVdc == In.fVdc);
+	UT_CHECK_EQ(Out.uState, In.uState);
+	UT_CHECK_EQ(Out.uCtrlMode, In.uCtrlMode);
+	UT_CHECK_EQ(Out.uFault, In.uFault);
+	UT_CHECK_EQ(Out.uSeq, In.uSeq);
+	UT_CHECK_EQ(Out.uCmdStat, In.uCmdStat);
+
+	/* 순번은 하위 4비트만 실리고 명령 상태를 침범하지 않음 */
+	for(i = 0u; i < 32u; i++) {
+		In.uSeq = (uint8_t)i;
+		In.uCmdStat = CAN_CMD_STAT_REJECTED;
+		vCanPackStatus(&In, uData);
+		vCanUnpackStatus(uData, &Out);
+		UT_CHECK_EQ(Out.uSeq, i & 0x0Fu);
+		UT_CHECK_EQ(Out.uCmdStat, CAN_CMD_STAT_REJECTED);
+	}
+
+	/* 비트 단위 보존 (음수 0, 비정규 수, 최대값) */
+	In.fWrpm = -0.0f;
+	In.fIqsr = 1.0e-40f;
+	In.fVdc = 3.4028235e38f;
+	vCanPackStatus(&In, uData);
+	vCanUnpackStatus(uData, &Out);
+	UT_CHECK(memcmp(&Out.fWrpm, &In.fWrpm, 4u) == 0);
+	UT_CHECK(memcmp(&Out.fIqsr, &In.fIqsr, 4u) == 0);
+	UT_CHECK(memcmp(&Out.fVdc, &In.fVdc, 4u) == 0);
+}
+
+/** @brief 명령 프레임 바이트 배치, 왕복, 길이/종류/비유한 값 거부 */
+static void vTestCmdPack(void){
+	static const uint8_t uExp[CAN_CMD_LEN] = {CAN_CMD_SPEED, CAN_CMD_FLAG_ENABLE | CAN_CMD_FLAG_RESET, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Au, 0xC4u};
+	sCanCmd In = {CAN_CMD_SPEED, CAN_CMD_FLAG_ENABLE | CAN_CMD_FLAG_RESET, -1000.0f};
+	sCanCmd Out;
+	uint8_t uData[CAN_BUS_DATA_MAX];
+
+	memset(uData, 0xEEu, sizeof(uData));
+	vCanPackCmd(&In, uData);
+	UT_CHECK(memcmp(uData, uExp, CAN_CMD_LEN) == 0);
+	UT_CHECK_EQ(uData[CAN_CMD_LEN], 0xEEu);
+
+	memset(&Out, 0, sizeof(Out));
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_CMD_LEN, &Out), 1u);
+	UT_CHECK_EQ(Out.uType, In.uType);
+	UT_CHECK_EQ(Out.uFlags, In.uFlags);
+	UT_CHECK(Out.fValue == In.fValue);
+
+	/* CAN FD 길이(12, 64byte)의 뒤쪽 채움 바이트는 무시 */
+	UT_CHECK_EQ(uCanUnpackCmd(uData, 12u, &Out), 1u);
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_BUS_DATA_MAX, &Out), 1u);
+
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_CMD_LEN - 1u, &Out), 0u);
+	UT_CHECK_EQ(uCanUnpackCmd(uData, 0u, &Out), 0u);
+
+	In.uType = CAN_CMD_POSITION;
+	vCanPackCmd(&In, uData);
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_CMD_LEN, &Out), 1u);
+	In.uType = CAN_CMD_POSITION + 1u;
+	vCanPackCmd(&In, uData);
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_CMD_LEN, &Out), 0u);
+
+	In.uType = CAN_CMD_TORQUE;
+	In.fValue = NAN;
+	vCanPackCmd(&In, uData);
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_CMD_LEN, &Out), 0u);
+	In.fValue = -INFINITY;
+	vCanPackCmd(&In, uData);
+	UT_CHECK_EQ(uCanUnpackCmd(uData, CAN_CMD_LEN, &Out), 0u);
+}
+
+/** @brief 필터 메시지 RAM, RXGFC, 비트 타이밍 레지스터, 버스 참여 */
+static void vTestInit(void){
+	vReset();
+
+	UT_CHECK_EQ(Can.uReady, 1u);
+	UT_CHECK_EQ(FDCAN1->CCCR & FDCAN_CCCR_INIT, 0u);
+	UT_CHECK((FDCAN1->CCCR & (FDCAN_CCCR_FDOE | FDCAN_CCCR_BRSE)) == (FDCAN_CCCR_FDOE | FDCAN_CCCR_BRSE));
+	UT_CHECK_EQ((FDCAN1->NBTP >> FDCAN_NBTP_NTSEG1_Pos) & 0xFFu, CAN_NTSEG1 - 1u);
+	UT_CHECK_EQ((FDCAN1->DBTP >> FDCAN_DBTP_DTSEG1_Pos) & 0x1Fu, CAN_DTSEG1 - 1u);
+
+	/* 비트 레이트 = 170MHz / (분주 × (1 + TSEG1 + TSEG2)) */
+	UT_CHECK_EQ(170000000u / (CAN_NBRP * (1u + CAN_NTSEG1 + CAN_NTSEG2)), 1000000u);
+	UT_CHECK_EQ(170000000u / (CAN_DBRP * (1u + CAN_DTSEG1 + CAN_DTSEG2)), 5000000u);
+
+	UT_CHECK_EQ((FDCAN1->RXGFC >> FDCAN_RXGFC_LSS_Pos) & 0x1Fu, 2u);
+	UT_CHECK_EQ((FDCAN1->RXGFC >> FDCAN_RXGFC_LSE_Pos) & 0xFu, 0u);
+	UT_CHECK_EQ((ulCanBusRam[0] >> 16) & 0x7FFu, CAN_ID_CMD + CAN_NODE_ID);
+	UT_CHECK_EQ((ulCanBusRam[1] >> 16) & 0x7FFu, CAN_ID_STOP_ALL);
+	UT_CHECK_EQ(FDCAN1->RXF0S & FDCAN_RXF0S_F0FL_Msk, 0u);
+	UT_CHECK_EQ(FDCAN1->TXFQS & FDCAN_TXFQS_TFQF, 0u);
+}
+
+/** @brief 상태 프레임 ID/FD/BRS/길이, 장치 상태 반영, 순번 증가 */
+static void vTestStatusFrame(void){
+	sCanFrame Frame;
+	sCanStatus Status;
+	uint16_t i;
+
+	vReset();
+	INV.SO.fWrpmSC = 1234.5f;
+	INV.CC.fIqsr = -3.25f;
+	fVdc = 15.5f;
+	uCurrState = RUN_STATE;
+	uControlMode = VECTCONTL_MODE;
+	INV.Fault_Info.uFaultLatch = 0x04u;
+
+	for(i = 0u; i < 20u; i++) {
+		vCanSendStatus();
+		UT_CHECK_EQ(uCanBusRecv(&Frame), 1u);
+		UT_CHECK_EQ(Frame.ulId, CAN_ID_STATUS + CAN_NODE_ID);
+		UT_CHECK_EQ(Frame.uFlags, CAN_BUS_FD | CAN_BUS_BRS);
+		UT_CHECK_EQ(Frame.uLen, CAN_STATUS_LEN);
+		vCanUnpackStatus(Frame.uData, &Status);
+		UT_CHECK_EQ(Status.uSeq, i & 0x0Fu);
+	}
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 0u);
+	UT_CHECK_EQ(Can.ulTxCnt, 20u);
+	UT_CHECK_EQ(CanBus.ulTxCnt, 20u);
+
+	UT_CHECK(Status.fWrpm == 1234.5f);
+	UT_CHECK(Status.fIqsr == -3.25f);
+	UT_CHECK(Status.fVdc == 15.5f);
+	UT_CHECK_EQ(Status.uState, RUN_STATE);
+	UT_CHECK_EQ(Status.uCtrlMode, VECTCONTL_MODE);
+	UT_CHECK_EQ(Status.uFault, 0x04u);
+	UT_CHECK_EQ(Status.uCmdStat, CAN_CMD_STAT_IDLE);
+}
+
+/** @brief 다른 노드/확장 ID/원격 프레임 거부, 명령/전체 정지 ID만 수신 */
+static void vTestFilter(void){
+	static const uint32_t ulOther[] = {CAN_ID_CMD + CAN_NODE_ID + 1u, CAN_ID_CMD, CAN_ID_STATUS + CAN_NODE_ID, CAN_ID_STOP_ALL + 1u, 0x7FFu, 0x000u};
+	sCanFrame Frame;
+	uint16_t i;
+
+	vReset();
+	memset(&Frame, 0, sizeof(Frame));
+	Frame.uLen = CAN_CMD_LEN;
+	Frame.uFlags = CAN_BUS_FD;
+
+	for(i = 0u; i < sizeof(ulOther) / sizeof(ulOther[0]); i++) {
+		Frame.ulId = ulOther[i];
+		UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_REJECT);
+	}
+
+	/* 같은 번호의 확장 ID와 원격 프레임도 거부 */
+	Frame.ulId = CAN_ID_CMD + CAN_NODE_ID;
+	Frame.uFlags = CAN_BUS_FD | CAN_BUS_XTD;
+	UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_REJECT);
+	Frame.uFlags = CAN_BUS_RTR;
+	UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_REJECT);
+
+	/* 거부된 트래픽은 드라이버에 보이지 않음 */
+	vCanTask();
+	UT_CHECK_EQ(Can.ulRxCnt + Can.ulRxBadCnt, 0u);
+	UT_CHECK_EQ(CanBus.ulRejectCnt, 8u);
+
+	/* Classic 8byte 명령, 전체 정지(데이터 없음)는 수신 */
+	UT_CHECK_EQ(uSendCmd(CAN_CMD_NONE, 0u, 0.0f, 0u), CAN_BUS_RX_FIFO0);
+	Frame.ulId = CAN_ID_STOP_ALL;
+	Frame.uLen = 0u;
+	Frame.uFlags = 0u;
+	UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_FIFO0);
+	UT_CHECK_EQ(FDCAN1->RXF0S & FDCAN_RXF0S_F0FL_Msk, 2u);
+	vCanTask();
+	UT_CHECK_EQ(FDCAN1->RXF0S & FDCAN_RXF0S_F0FL_Msk, 0u);
+	UT_CHECK_EQ(Can.ulRxCnt, 1u);
+	UT_CHECK_EQ(Can.ulRxBadCnt, 0u);
+
+	/* 잘못된 길이는 버스에 올라가지 않음 */
+	Frame.uLen = 12u;
+	UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_INVALID);
+}
+
+/** @brief 속도/토크 명령 → 시작, 제어 모드/목표값 반영, 정지 에지, 거부 */
+static void vTestCommand(void){
+	sCanCmd Cmd = {CAN_CMD_SPEED, CAN_CMD_FLAG_ENABLE, 300.0f};
+	sCanFrame Frame;
+	sCanStatus Status;
+	float fIqExp;
+
+	vReset();
+	vRun(1000u, &Cmd, 20u);
+	UT_CHECK_EQ(uCurrState, RUN_STATE);
+	UT_CHECK_EQ(uControlMode, SPDCONTL_MODE);
+	UT_CHECK(INV.SC.fWrpmRefSet == 300.0f);
+	UT_CHECK_NEAR(INV.SO.fWrpmSC, 300.0, 1.0);
+	UT_CHECK_EQ(Can.uCmdStat, CAN_CMD_STAT_ACTIVE);
+	UT_CHECK_EQ(Can.ulRxCnt, 50u);
+
+	/* 상태 프레임으로 버스에서 관찰 */
+	vCanSendStatus();
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 1u);
+	vCanUnpackStatus(Frame.uData, &Status);
+	UT_CHECK_EQ(Status.uState, RUN_STATE);
+	UT_CHECK_EQ(Status.uCmdStat, CAN_CMD_STAT_ACTIVE);
+	UT_CHECK_NEAR(Status.fWrpm, 300.0, 1.0);
+
+	/* 토크 명령: 전류 제어 모드, Iq = 토크 / KT */
+	Cmd.uType = CAN_CMD_TORQUE;
+	Cmd.fValue = 0.2f;
+	fIqExp = 0.2f * pCtrlParam->fInvKT;
+	vRun(10u, &Cmd, 5u);
+	UT_CHECK_EQ(uControlMode, VECTCONTL_MODE);
+	UT_CHECK_NEAR(INV.CC.fIqsrRefSet, fIqExp, 1e-6);
+	UT_CHECK_EQ(uCurrState, RUN_STATE);
+
+	/* 위치 명령과 짧은 프레임은 거부, 운전 상태는 유지 */
+	uSendCmd(CAN_CMD_POSITION, CAN_CMD_FLAG_ENABLE, 1.0f, 1u);
+	vRun(1u, NULL, 0u);
+	UT_CHECK_EQ(Can.uCmdStat, CAN_CMD_STAT_REJECTED);
+	UT_CHECK_EQ(Can.ulRxBadCnt, 1u);
+	memset(&Frame, 0, sizeof(Frame));
+	Frame.ulId = CAN_ID_CMD + CAN_NODE_ID;
+	Frame.uLen = 4u;
+	UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_FIFO0);
+	vRun(1u, NULL, 0u);
+	UT_CHECK_EQ(Can.ulRxBadCnt, 2u);
+	UT_CHECK_EQ(uCurrState, RUN_STATE);
+
+	/* 구동 허용 1 → 0 에지: 정지 */
+	uSendCmd(CAN_CMD_NONE, 0u, 0.0f, 1u);
+	vRun(5u, NULL, 0u);
+	UT_CHECK_EQ(uCurrState, IDLE_STATE);
+	UT_CHECK_EQ(Can.uCmdStat, CAN_CMD_STAT_IDLE);
+	UT_CHECK_EQ(Can.ulTimeoutCnt, 0u);
+}
+
+/** @brief 명령 끊김 정지, 전체 정지 */
+static void vTestTimeout(void){
+	sCanCmd Cmd = {CAN_CMD_SPEED, CAN_CMD_FLAG_ENABLE, 200.0f};
+	sCanFrame Frame;
+	sCanStatus Status;
+
+	vReset();
+	vRun(200u, &Cmd, 20u);
+	UT_CHECK_EQ(uCurrState, RUN_STATE);
+
+	/* 갱신 중단: CAN_CMD_TIMEOUT_MS 이내에는 유지, 넘으면 정지 */
+	vRun(CAN_CMD_TIMEOUT_MS - 30u, NULL, 0u);
+	UT_CHECK_EQ(uCurrState, RUN_STATE);
+	vRun(20u, NULL, 0u);
+	UT_CHECK_EQ(uCurrState, IDLE_STATE);
+	UT_CHECK_EQ(Can.uCmdStat, CAN_CMD_STAT_TIMEOUT);
+	UT_CHECK_EQ(Can.ulTimeoutCnt, 1u);
+	UT_CHECK(INV.SC.fWrpmRefSet == 0.0f);
+
+	vCanSendStatus();
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 1u);
+	vCanUnpackStatus(Frame.uData, &Status);
+	UT_CHECK_EQ(Status.uCmdStat, CAN_CMD_STAT_TIMEOUT);
+	UT_CHECK_EQ(Status.uState, IDLE_STATE);
+
+	/* 정지 후에는 다시 시간 초과를 세지 않음 */
+	vRun(500u, NULL, 0u);
+	UT_CHECK_EQ(Can.ulTimeoutCnt, 1u);
+
+	/* 재시작 후 전체 정지 */
+	vRun(100u, &Cmd, 20u);
+	UT_CHECK_EQ(uCurrState, RUN_STATE);
+	memset(&Frame, 0, sizeof(Frame));
+	Frame.ulId = CAN_ID_STOP_ALL;
+	UT_CHECK_EQ(uCanBusSend(&Frame), CAN_BUS_RX_FIFO0);
+	vRun(5u, NULL, 0u);
+	UT_CHECK_EQ(uCurrState, IDLE_STATE);
+	UT_CHECK_EQ(Can.uCmdStat, CAN_CMD_STAT_IDLE);
+	UT_CHECK(INV.SC.fWrpmRefSet == 0.0f);
+	UT_CHECK_EQ(Can.ulTimeoutCnt, 1u);
+}
+
+/** @brief RX FIFO 넘침 손실, TX FIFO 가득 참, Bus-off 복구 */
+static void vTestFifo(void){
+	sCanFrame Frame;
+	sCanStatus Status;
+	uint16_t i;
+
+	vReset();
+
+	/* RX FIFO 0 (3단): 4번째는 손실, vCanTask 1회에 CAN_RX_TASK_MAX개 처리 */
+	for(i = 0u; i < 3u; i++) UT_CHECK_EQ(uSendCmd(CAN_CMD_NONE, 0u, (float)i, 1u), CAN_BUS_RX_FIFO0);
+	UT_CHECK_EQ(uSendCmd(CAN_CMD_NONE, 0u, 3.0f, 1u), CAN_BUS_RX_LOST);
+	UT_CHECK(FDCAN1->RXF0S & FDCAN_RXF0S_F0F);
+	vCanTask();
+	UT_CHECK_EQ(Can.ulRxCnt, 3u);
+	UT_CHECK_EQ(FDCAN1->RXF0S & FDCAN_RXF0S_F0FL_Msk, 0u);
+	UT_CHECK_EQ(uSendCmd(CAN_CMD_NONE, 0u, 4.0f, 1u), CAN_BUS_RX_FIFO0);
+	vCanTask();
+	UT_CHECK_EQ(Can.ulRxCnt, 4u);
+
+	/* ACK 없음: TX FIFO 3단이 차면 버림, ACK가 돌아오면 순서대로 송신 */
+	vCanBusSetAck(0u);
+	for(i = 0u; i < 5u; i++) vCanSendStatus();
+	UT_CHECK_EQ(Can.ulTxCnt, 3u);
+	UT_CHECK_EQ(Can.ulTxFullCnt, 2u);
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 0u);
+	vCanBusSetAck(1u);
+	for(i = 0u; i < 3u; i++) {
+		UT_CHECK_EQ(uCanBusRecv(&Frame), 1u);
+		vCanUnpackStatus(Frame.uData, &Status);
+		UT_CHECK_EQ(Status.uSeq, i);
+	}
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 0u);
+
+	/* Bus-off: 수신 불가, 대기 송신 유지 → vCanTask가 INIT 해제 후 송신 재개 */
+	vCanBusOff();
+	vCanSendStatus();
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 0u);
+	UT_CHECK_EQ(uSendCmd(CAN_CMD_NONE, 0u, 0.0f, 1u), CAN_BUS_RX_OFF);
+	vCanTask();
+	UT_CHECK_EQ(Can.ulBusOffCnt, 1u);
+	UT_CHECK_EQ(FDCAN1->CCCR & FDCAN_CCCR_INIT, 0u);
+	UT_CHECK_EQ(uCanBusRecv(&Frame), 1u);
+	vCanUnpackStatus(Frame.uData, &Status);
+	UT_CHECK_EQ(Status.uSeq, 3u);
+	UT_CHECK_EQ(uSendCmd(CAN_CMD_NONE, 0u, 0.0f, 1u), CAN_BUS_RX_FIFO0);
+}
+
+int main(void){
+	UT_RUN(vTestStatusPack);
+	UT_RUN(vTestCmdPack);
+	UT_RUN(vTestInit);
+	UT_RUN(vTestStatusFrame);
+	UT_RUN(vTestFilter);
+	UT_RUN(vTestCommand);
+	UT_RUN(vTestTimeout);
+	UT_RUN(vTestFifo);
+	return UT_RESULT();
+}
@@ -0,0 +1,437 @@
+/**
+ * @file    test_dshot.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   DShot 프레임 복호기(uDshotDecBit) 합성 에지 및 양방향 DShot eRPM/GCR 호스트 시험
+ * @details 프레임을 송신측 시각(실수 [tick])의 상승/하강 에지로 만든 뒤, TIM5 버스트 캡처와 같이 정수 틱으로 잘라
+ * (직전 상승 에지 이후 주기, High 시간) 쌍으로 복호기에 넣습니다. 송신측 클럭 편차와 에지 지터는 고정 시드 난수로 넣습니다.
+ *
+ * | 시험 | 내용 |
+ * | :--- | :--- |
+ * | **vTestPack** | 프레임 배치, 알려진 값 (1046 → 0x82C6), 반전 CRC |
+ * | **vTestAllValues** | DShot150/300/600 × 일반/반전 CRC, 값 0 ~ 2047 × 텔레메트리 비트 전부 |
+ * | **vTestTolerance** | 클럭 편차 ±5%, 에지 지터, 0/1 듀티 경계 부근 |
+ * | **vTestCrcError** | 단일 비트 오류 전부 검출, CRC 극성 불일치 |
+ * | **vTestFraming** | 잘린 프레임, 글리치, 공백 없이 이어지는 비트, 연속 프레임 |
+ * | **vTestDecLast** | 링 버퍼 마지막 프레임만 복호 (eRPM 응답 조건): 정상, CRC 오류, 잘린 프레임, 링 끝 넘김, 기준 복호기 불변 |
+ * | **vTestErpm** | 알려진 값 (1000µs → 0x3F47), 9bit 이하 정확, 양자화 오차 < 1/256, 단조성, 정지 값, 반전 CRC |
+ * | **vTestGcr** | 알려진 선 레벨 (0x3F47 → 0x0ED525), 16bit 워드 전부 왕복, 같은 레벨 최대 3bit, 선 극성 무관 |
+ * | **vTestGcrError** | 단일 레벨 오류 검출 (니블 경계 제외), 잘못된 GCR 코드 |
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "UnitTest.h"
+#include "DShot.h"
+
+/** @brief 캡처 타이머 클럭 [Hz] (Throttle.h THR_TIM_CLK) */
+#define TIM_CLK             170000000.0
+/** @brief 프레임 앞 공백 [비트] (프레임 주기 ≥ 16 + 공백 비트) */
+#define GAP_BITS            8.0
+/** @brief 공칭 듀티 */
+#define DUTY_ONE            0.75
+#define DUTY_ZERO           0.375
+
+/**
+ * @struct sEdgeGen
+ * @brief  합성 에지 송신측 모형
+ */
+typedef struct {
+	double dBit;                /**< 송신측 비트 주기 [tick] (클럭 편차 포함) */
+	double dJitter;             /**< 에지 지터 최대값 [tick] (균일 분포 ±) */
+	double dDutyOne;            /**< 1 듀티 */
+	double dDutyZero;           /**< 0 듀티 */
+	double dTime;               /**< 현재 시각 [tick] */
+	uint32_t ulLastRise;        /**< 직전 상승 에지 캡처값 [tick] */
+} sEdgeGen;
+
+/** @brief 고정 시드 난수 (xorshift32) */
+static uint32_t ulRand = 0x2545F491u;
+
+/**
+ * @brief  균일 난수 [-1, 1)
+ */
+static double dRand(void){
+	ulRand ^= ulRand << 13;
+	ulRand ^= ulRand >> 17;
+	ulRand ^= ulRand << 5;
+	return (double)ulRand / 2147483648.0 - 1.0;
+}
+
+/**
+ * @brief  송신측 모형을 초기화합니다.
+ * @param  ulBps 공칭 비트율 [bps]
+ * @param  dClkErr 송신측 클럭 편차 (0.05: 5% 느림)
+ */
+static void vGenInit(sEdgeGen* pGen, uint32_t ulBps, double dClkErr, double dJitter){
+	pGen->dBit = TIM_CLK / (double)ulBps * (1.0 + dClkErr);
+	pGen->dJitter = dJitter;
+	pGen->dDutyOne = DUTY_ONE;
+	pGen->dDutyZero = DUTY_ZERO;
+	pGen->dTime = 1000.0;
+	pGen->ulLastRise = (uint32_t)pGen->dTime;
+}
+
+/**
+ * @brief  비트 하나를 송신하고 복호기에 넣습니다.
+ * @param  dPeriodBits 직전 비트 시작부터 이번 비트 시작까지 [비트] (1: 연속, > 1: 공백)
+ * @retval uDshotDecBit 반환값
+ */
+static uint16_t uGenBit(sEdgeGen* pGen, sDshotDec* pDec, uint16_t uBit, double dPeriodBits, uint16_t* pFrame){
+	double dRise, dFall;
+	uint32_t ulRise, ulFall, ulPeriod;
+
+	pGen->dTime += dPeriodBits * pGen->dBit;
+	dRise = pGen->dTime + pGen->dJitter * dRand();
+	dFall = pGen->dTime + pGen->dBit * (uBit ? pGen->dDutyOne : pGen->dDutyZero) + pGen->dJitter * dRand();
+
+	ulRise = (uint32_t)dRise;
+	ulFall = (uint32_t)dFall;
+	ulPeriod = ulRise - pGen->ulLastRise;
+	pGen->ulLastRise = ulRise;
+	return uDshotDecBit(pDec, ulPeriod, ulFall - ulRise, pFrame);
+}
+
+/**
+ * @brief  공백 뒤에 프레임의 앞 uBits개 비트를 송신합니다.
+ * @retval 마지막 비트의 uDshotDecBit 반환값
+ */
+static uint16_t uGenFrame(sEdgeGen* pGen, sDshotDec* pDec, uint16_t uFrame, uint16_t uBits, uint16_t* pOut){
+	uint16_t i, uRet = 0u;
+
+	for(i = 0u; i < uBits; i++) {
+		uRet = uGenBit(pGen, pDec, (uint16_t)((uFrame >> (DSHOT_FRAME_BITS - 1u - i)) & 1u), (i == 0u) ? (1.0 + GAP_BITS) : 1.0, pOut);
+	}
+	return uRet;
+}
+
+/** @brief 프레임 배치, 알려진 값 (1046 → 0x82C6), 반전 CRC */
+static void vTestPack(void){
+	uint16_t uF;
+
+	UT_CHECK_EQ(uDshotPack(1046u, 0u, 0u), 0x82C6u);
+	UT_CHECK_EQ(uDshotPack(1046u, 0u, 1u), 0x82C9u);
+	UT_CHECK_EQ(uDshotPack(0u, 0u, 0u), 0x0000u);
+	UT_CHECK_EQ(uDshotPack(0u, 0u, 1u), 0x000Fu);
+
+	uF = uDshotPack(DSHOT_THR_MAX, 1u, 0u);
+	UT_CHECK_EQ(DSHOT_VALUE(uF), DSHOT_THR_MAX);
+	UT_CHECK_EQ(DSHOT_TELEM(uF), 1u);
+	uF = uDshotPack(DSHOT_CMD_MAX, 0u, 1u);
+	UT_CHECK_EQ(DSHOT_VALUE(uF), DSHOT_CMD_MAX);
+	UT_CHECK_EQ(DSHOT_TELEM(uF), 0u);
+
+	/* 11bit 초과 값은 잘림 */
+	UT_CHECK_EQ(DSHOT_VALUE(uDshotPack(2048u + 5u, 0u, 0u)), 5u);
+}
+
+/** @brief DShot150/300/600 × 일반/반전 CRC, 값 0 ~ 2047 × 텔레메트리 비트 전부 */
+static void vTestAllValues(void){
+	static const uint32_t ulBps[3] = {150000u, 300000u, 600000u};
+	sEdgeGen Gen;
+	sDshotDec Dec;
+	uint16_t uRate, uInv, uV, uT, uF, uOut, uOk;
+	uint32_t ulBad;
+
+	for(uRate = 0u; uRate < 3u; uRate++) {
+		for(uInv = 0u; uInv < 2u; uInv++) {
+			vDshotDecInit(&Dec, (uint32_t)(TIM_CLK / ulBps[uRate]), uInv);
+			vGenInit(&Gen, ulBps[uRate], 0.0, 0.0);
+			ulBad = 0u;
+			for(uV = 0u; uV <= DSHOT_THR_MAX; uV++) {
+				for(uT = 0u; uT < 2u; uT++) {
+					uF = uDshotPack(uV, uT, uInv);
+					uOut = 0xFFFFu;
+					uOk = uGenFrame(&Gen, &Dec, uF, DSHOT_FRAME_BITS, &uOut);
+					if(!uOk || (uOut != uF)) ulBad++;
+				}
+			}
+			UT_CHECK_EQ(ulBad, 0u);
+			UT_CHECK_EQ(Dec.ulFrameCnt, 2u * (DSHOT_THR_MAX + 1u));
+			UT_CHECK_EQ(Dec.ulCrcErrCnt + Dec.ulFrameErrCnt, 0u);
+		}
+	}
+}
+
+/** @brief 클럭 편차 ±5%, 에지 지터, 0/1 듀티 경계 부근 */
+static void vTestTolerance(void){
+	static const double dClkErr[4] = {-0.05, -0.02, 0.02, 0.05};
+	sEdgeGen Gen;
+	sDshotDec Dec;
+	uint16_t i, n, uF, uOut;
+	uint32_t ulBad;
+
+	/* DShot600 (283 tick/bit), 지터 ±5% 비트 */
+	for(i = 0u; i < 4u; i++) {
+		vDshotDecInit(&Dec, (uint32_t)(TIM_CLK / 600000.0), 1u);
+		vGenInit(&Gen, 600000u, dClkErr[i], 0.05 * TIM_CLK / 600000.0);
+		ulBad = 0u;
+		for(n = 0u; n < 2000u; n++) {
+			uF = uDshotPack((uint16_t)(dRand() * 1024.0 + 1024.0), n & 1u, 1u);
+			if(!uGenFrame(&Gen, &Dec, uF, DSHOT_FRAME_BITS, &uOut) || (uOut != uF)) ulBad++;
+		}
+		UT_CHECK_EQ(ulBad, 0u);
+		UT_CHECK_EQ(Dec.ulCrcErrCnt + Dec.ulFrameErrCnt, 0u);
+	}
+
+	/* 판정 경계 (9/16 비트) 양쪽 1% 안쪽 듀티도 올바르게 판정 */
+	vDshotDecInit(&Dec, (uint32_t)(TIM_CLK / 300000.0), 0u);
+	vGenInit(&Gen, 300000u, 0.0, 0.0);
+	Gen.dDutyOne = 9.0 / 16.0 + 0.01;
+	Gen.dDutyZero = 9.0 / 16.0 - 0.01;
+	for(i = 0u; i < 2u; i++) {
+		uF = uDshotPack((i == 0u) ? 0x555u : 0x2AAu, i, 0u);
+		UT_CHECK_EQ(uGenFrame(&Gen, &Dec, uF, DSHOT_FRAME_BITS, &uOut), 1u);
+		UT_CHECK_EQ(uOut, uF);
+	}
+}
+
+/** @brief 단일 비트 오류 전부 검출, CRC 극성 불일치 */
+static void vTestCrcError(void){
+	sEdgeGen Gen;
+	sDshotDec Dec;
+	uint16_t uV, uB, uF, uOut;
+	uint32_t ulPass = 0u, ulSent = 0u;
+
+	vDshotDecInit(&Dec, (uint32_t)(TIM_CLK / 300000.0), 0u);
+	vGenInit(&Gen, 300000u, 0.0, 0.0);
+	for(uV = 0u; uV <= DSHOT_THR_MAX; uV += 7u) {
+		uF = uDshotPack(uV, uV & 1u, 0u);
+		for(uB = 0u; uB < DSHOT_FRAME_BITS; uB++) {
+			ulPass += uGenFrame(&Gen, &Dec, (uint16_t)(uF ^ (1u << uB)), DSHOT_FRAME_BITS, &uOut);
+			ulSent++;
+		}
+	}
+	UT_CHECK_EQ(ulPass, 0u);
+	UT_CHECK_EQ(Dec.ulCrcErrCnt, ulSent);
+	UT_CHECK_EQ(Dec.ulFrameErrCnt, 0u);
+
+	/* 양방향(반전 CRC) 프레임은 일반 복호기에서 모두 CRC 오류 */
+	ulPass = 0u;
+	for(uV = 0u; uV <= DSHOT_THR_MAX; uV++) ulPass += uGenFrame(&Gen, &Dec, uDshotPack(uV, 0u, 1u), DSHOT_FRAME_BITS, &uOut);
+	UT_CHECK_EQ(ulPass, 0u);
+}
+
+/** @brief 잘린 프레임, 글리치, 공백 없이 이어지는 비트, 연속 프레임 */
+static void vTestFraming(void){
+	sEdgeGen Gen;
+	sDshotDec Dec;
+	uint16_t uF = uDshotPack(1500u, 1u, 0u), uOut = 0u, i, b;
+
+	vDshotDecInit(&Dec, (uint32_t)(TIM_CLK / 600000.0), 0u);
+	vGenInit(&Gen, 600000u, 0.0, 0.0);
+
+	/* 초기 상태에서 공백 없이 들어온 비트는 무시 (프레임 오류로 세지 않음) */
+	for(i = 0u; i < 5u; i++) UT_CHECK_EQ(uGenBit(&Gen, &Dec, 1u, 1.0, &uOut), 0u);
+	UT_CHECK_EQ(Dec.ulFrameErrCnt, 0u);
+
+	/* 10bit에서 끊긴 프레임: 다음 공백에서 오류 1, 뒤 프레임은 정상 */
+	UT_CHECK_EQ(uGenFrame(&Gen, &Dec, uF, 10u, &uOut), 0u);
+	UT_CHECK_EQ(uGenFrame(&Gen, &Dec, uF, DSHOT_FRAME_BITS, &uOut), 1u);
+	UT_CHECK_EQ(uOut, uF);
+	UT_CHECK_EQ(Dec.ulFrameErrCnt, 1u);
+
+	/* 프레임 중간 글리치 (0.3 비트 주기): 폐기, 남은 비트 무시 */
+	uGenFrame(&Gen, &Dec, uF, 6u, &uOut);
+	UT_CHECK_EQ(uGenBit(&Gen, &Dec, 1u, 0.3, &uOut), 0u);
+	for(i = 0u; i < 10u; i++) UT_CHECK_EQ(uGenBit(&Gen, &Dec, 0u, 1.0, &uOut), 0u);
+	UT_CHECK_EQ(Dec.ulFrameErrCnt, 2u);
+	UT_CHECK_EQ(uGenFrame(&Gen, &Dec, uF, DSHOT_FRAME_BITS, &uOut), 1u);
+
+	/* 완성 프레임 뒤 공백 없이 이어지는 비트: 오류 1번만 세고 다음 공백까지 무시 */
+	for(i = 0u; i < 20u; i++) UT_CHECK_EQ(uGenBit(&Gen, &Dec, i & 1u, 1.0, &uOut), 0u);
+	UT_CHECK_EQ(Dec.ulFrameErrCnt, 3u);
+	UT_CHECK_EQ(Dec.ulCrcErrCnt, 0u);
+
+	/* 최소 공백 (1.5 비트 초과) 연속 프레임 */
+	for(i = 0u; i < 100u; i++) {
+		uF = uDshotPack((uint16_t)(DSHOT_THR_MIN + 19u * i), 0u, 0u);
+		UT_CHECK_EQ(uGenBit(&Gen, &Dec, (uint16_t)(uF >> 15), 1.6, &uOut), 0u);
+		for(b = 1u; b < DSHOT_FRAME_BITS; b++) uGenBit(&Gen, &Dec, (uint16_t)((uF >> (15u - b)) & 1u), 1.0, &uOut);
+		UT_CHECK_EQ(uOut, uF);
+	}
+	UT_CHECK_EQ(Dec.ulFrameCnt, 102u);
+	UT_CHECK_EQ(Dec.ulFrameErrCnt, 3u);
+}
+
+/** @brief 링 버퍼 크기 [word] (Throttle.h THR_DSHOT_RING_SIZE) */
+#define RING_SIZE           128u
+
+/**
+ * @brief  비트 하나를 송신하고 TIM5 버스트 캡처처럼 (주기, High) 쌍을 링 버퍼에 기록합니다.
+ */
+static void vGenRing(sEdgeGen* pGen, uint32_t* pRing, uint16_t* pWr, uint16_t uBit, double dPeriodBits){
+	uint32_t ulRise, ulFall;
+
+	pGen->dTime += dPeriodBits * pGen->dBit;
+	ulRise = (uint32_t)pGen->dTime;
+	ulFall = (uint32_t)(pGen->dTime + pGen->dBit * (uBit ? pGen->dDutyOne : pGen->dDutyZero));
+	pRing[*pWr] = ulRise - pGen->ulLastRise;
+	pRing[*pWr + 1u] = ulFall - ulRise;
+	pGen->ulLastRise = ulRise;
+	*pWr = (uint16_t)((*pWr + 2u) & (RING_SIZE - 1u));
+}
+
+/**
+ * @brief  공백 뒤에 프레임의 앞 uBits개 비트를 링 버퍼에 기록합니다.
+ */
+static void vGenRingFrame(sEdgeGen* pGen, uint32_t* pRing, uint16_t* pWr, uint16_t uFrame, uint16_t uBits){
+	uint16_t i;
+
+	for(i = 0u; i < uBits; i++) {
+		vGenRing(pGen, pRing, pWr, (uint16_t)((uFrame >> (DSHOT_FRAME_BITS - 1u - i)) & 1u), (i == 0u) ? (1.0 + GAP_BITS) : 1.0);
+	}
+}
+
+/** @brief 링 버퍼 마지막 프레임만 복호: 정상, CRC 오류, 잘린 프레임, 링 끝 넘김, 기준 복호기 불변 */
+static void vTestDecLast(void){
+	static uint32_t ulRing[RING_SIZE];
+	sEdgeGen Gen;
+	sDshotDec Dec;
+	uint16_t uWr = 0u, uOut = 0u, uA = uDshotPack(300u, 0u, 1u), uB = uDshotPack(1200u, 1u, 1u), i;
+
+	vDshotDecInit(&Dec, (uint32_t)(TIM_CLK / 300000.0), 1u);
+	vGenInit(&Gen, 300000u, 0.0, 0.0);
+
+	vGenRingFrame(&Gen, ulRing, &uWr, uA, DSHOT_FRAME_BITS);
+	vGenRingFrame(&Gen, ulRing, &uWr, uB, DSHOT_FRAME_BITS);
+	UT_CHECK_EQ(uDshotDecLast(&Dec, ulRing, RING_SIZE - 1u, uWr, &uOut), 1u);
+	UT_CHECK_EQ(uOut, uB);
+
+	/* 마지막 프레임 CRC 오류: 앞 프레임이 정상이어도 응답 안 함 */
+	vGenRingFrame(&Gen, ulRing, &uWr, (uint16_t)(uB ^ 0x0100u), DSHOT_FRAME_BITS);
+	UT_CHECK_EQ(uDshotDecLast(&Dec, ulRing, RING_SIZE - 1u, uWr, &uOut), 0u);
+
+	/* 15bit에서 끊긴 프레임: 마지막 16쌍의 첫 쌍이 공백이 아니므로 거절 */
+	vGenRingFrame(&Gen, ulRing, &uWr, uA, DSHOT_FRAME_BITS - 1u);
+	UT_CHECK_EQ(uDshotDecLast(&Dec, ulRing, RING_SIZE - 1u, uWr, &uOut), 0u);
+
+	/* 링 끝을 넘는 위치: 모든 시작 위치에서 정상 */
+	for(i = 0u; i < RING_SIZE / 2u; i++) {
+		vGenRingFrame(&Gen, ulRing, &uWr, uB, DSHOT_FRAME_BITS);
+		UT_CHECK_EQ(uDshotDecLast(&Dec, ulRing, RING_SIZE - 1u, uWr, &uOut), 1u);
+		vGenRing(&Gen, ulRing, &uWr, 0u, 1.0 + GAP_BITS);
+	}
+
+	/* 기준 복호기 상태/통계는 그대로 */
+	UT_CHECK_EQ(Dec.ulFrameCnt, 0u);
+	UT_CHECK_EQ(Dec.ulCrcErrCnt, 0u);
+	UT_CHECK_EQ(Dec.uBitCnt, DSHOT_FRAME_BITS + 1u);
+}
+
+/**
+ * @brief  워드의 반전 CRC가 맞는지 (DShot.h 표 2단계를 그대로 계산)
+ */
+static uint16_t uErpmCrcOk(uint16_t uWord){
+	uint16_t uV = (uint16_t)(uWord >> 4);
+
+	return (uint16_t)(((~(uV ^ (uV >> 4) ^ (uV >> 8))) & 0x0Fu) == (uWord & 0x0Fu));
+}
+
+/** @brief 알려진 값, 9bit 이하 정확, 양자화 오차 < 1/256, 단조성, 정지 값, 반전 CRC */
+static void vTestErpm(void){
+	uint32_t ulP, ulD, ulPrev = 0u, ulBad = 0u;
+	uint16_t uW;
+
+	/* 1000µs = 500 << 1 → v12 = 0x3F4, CRC ~0x8 = 0x7 */
+	UT_CHECK_EQ(uDshotErpmEncode(1000u), 0x3F47u);
+	UT_CHECK_EQ(ulDshotErpmDecode(0x3F47u), 1000u);
+
+	for(ulP = 0u; ulP <= 0x1FFu << 7; ulP++) {
+		uW = uDshotErpmEncode(ulP);
+		ulD = ulDshotErpmDecode(uW);
+		if(!uErpmCrcOk(uW)) ulBad++;
+		if(ulP <= 0x1FFu) { if(ulD != ulP) ulBad++; }
+		else if((ulD > ulP) || ((ulP - ulD) * 256u >= ulP)) ulBad++;
+		if(ulD < ulPrev) ulBad++;
+		ulPrev = ulD;
+	}
+	UT_CHECK_EQ(ulBad, 0u);
+
+	/* 범위 초과(정지)는 값 0xFFF, 복원 주기는 최대값 */
+	UT_CHECK_EQ(uDshotErpmEncode((0x1FFu << 7) + 1u) >> 4, DSHOT_ERPM_STOP);
+	UT_CHECK_EQ(uDshotErpmEncode(0xFFFFFFFFu) >> 4, DSHOT_ERPM_STOP);
+	UT_CHECK_EQ(ulDshotErpmDecode(uDshotErpmEncode(0xFFFFFFFFu)), 0x1FFu << 7);
+	UT_CHECK(uErpmCrcOk(uDshotErpmEncode(0xFFFFFFFFu)));
+
+	/* Throttle.c와 같은 환산: 30000 eRPM → 2000µs → 복원 eRPM 오차 0.4% 이내 */
+	ulD = ulDshotErpmDecode(uDshotErpmEncode((uint32_t)(60.0e6 / 30000.0)));
+	UT_CHECK_NEAR(60.0e6 / (double)ulD, 30000.0, 30000.0 * 0.004);
+}
+
+/** @brief 알려진 선 레벨, 16bit 워드 전부 왕복, 같은 레벨 최대 3bit, 선 극성 무관 */
+static void vTestGcr(void){
+	uint32_t ulW, ulL, ulValid = 0u, ulBad = 0u, ulRun, ulMaxRun = 0u;
+	uint64_t ullLine;
+	uint16_t uOut;
+	int16_t i;
+
+	/* 니블 3, F, 4, 7 → GCR 13, 0F, 1D, 17 → 시작 0, 1마다 반전 */
+	UT_CHECK_EQ(ulDshotGcrEncode(0x3F47u), 0x0ED525u);
+
+	for(ulW = 0u; ulW <= 0xFFFFu; ulW++) {
+		ulL = ulDshotGcrEncode((uint16_t)ulW);
+		if(ulL >> (DSHOT_GCR_BITS - 1u)) ulBad++;           /* 시작 비트 Low, 21bit 이내 */
+
+		uOut = 0u;
+		if(uDshotGcrDecode(ulL, &uOut) != uErpmCrcOk((uint16_t)ulW)) ulBad++;
+		if(!uErpmCrcOk((uint16_t)ulW)) continue;
+		ulValid++;
+		if(uOut != ulW) ulBad++;
+
+		/* 선 극성이 뒤집혀도 같은 워드 (수신측은 레벨 변화만 봄) */
+		uOut = 0u;
+		if(!uDshotGcrDecode(ulL ^ ((1ul << DSHOT_GCR_BITS) - 1u), &uOut) || (uOut != ulW)) ulBad++;
+
+		/* 앞뒤 Idle High를 포함한 같은 레벨 연속 길이 (클럭 복원 조건) */
+		ullLine = (1ull << (DSHOT_GCR_BITS + 1u)) | ((uint64_t)ulL << 1) | 1u;
+		ulRun = 1u;
+		for(i = DSHOT_GCR_BITS; i >= 0; i--) {
+			ulRun = (((ullLine >> i) ^ (ullLine >> (i + 1))) & 1u) ? 1u : ulRun + 1u;
+			if((i > 0) && (i < DSHOT_GCR_BITS) && (ulRun > ulMaxRun)) ulMaxRun = ulRun;
+		}
+	}
+	UT_CHECK_EQ(ulBad, 0u);
+	UT_CHECK_EQ(ulValid, 4096u);
+	UT_CHECK_EQ(ulMaxRun, 3u);
+}
+
+/** @brief 단일 레벨 오류 검출 (니블 경계 제외), 잘못된 GCR 코드 */
+static void vTestGcrError(void){
+	uint32_t ulP, ulL, ulMiss = 0u, ulBoundary = 0u, ulFlips = 0u;
+	uint16_t uW, uOut, uBit;
+
+	for(ulP = 1u; ulP <= 0x1FFu << 7; ulP += 13u) {
+		uW = uDshotErpmEncode(ulP);
+		ulL = ulDshotGcrEncode(uW);
+		for(uBit = 0u; uBit < DSHOT_GCR_BITS; uBit++) {
+			if(!uDshotGcrDecode(ulL ^ (1ul << uBit), &uOut)) continue;
+			if((uBit % 5u) == 0u && uBit != 0u && uBit != 20u) ulBoundary++;
+			else ulMiss++;
+		}
+		ulFlips += DSHOT_GCR_BITS;
+	}
+	/* 레벨 1bit는 GCR 2bit를 바꾸므로 니블 안에서는 항상 코드 오류, 경계에서도 대부분 CRC 오류 */
+	UT_CHECK_EQ(ulMiss, 0u);
+	UT_CHECK(ulBoundary * 100u < ulFlips);
+
+	/* 마지막 GCR 코드를 00000 (레벨 변화 없음)으로 만들면 거부 */
+	ulL = ulDshotGcrEncode(0x3F47u);
+	ulL = (ulL & (1ul << 5)) ? (ulL | 0x1Fu) : (ulL & ~0x1Fu);
+	UT_CHECK_EQ(uDshotGcrDecode(ulL, &uOut), 0u);
+	UT_CHECK_EQ(uDshotGcrDecode(0u, &uOut), 0u);
+	UT_CHECK_EQ(uDshotGcrDecode((1ul << DSHOT_GCR_BITS) - 1u, &uOut), 0u);
+}
+
+int main(void){
+	UT_RUN(vTestPack);
+	UT_RUN(vTestAllValues);
+	UT_RUN(vTestTolerance);
+	UT_RUN(vTestCrcError);
+	UT_RUN(vTestFraming);
+	UT_RUN(vTestDecLast);
+	UT_RUN(vTestErpm);
+	UT_RUN(vTestGcr);
+	UT_RUN(vTestGcrError);
+	return UT_RESULT();
+}
@@ -0,0 +1,81 @@
+/**
+ * @file    test_kiss.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   KISS ESC 텔레메트리 프레임(uKissBuild/uKissParse)과 CRC-8 호스트 시험
+ * @details CRC-8(다항식 0x07, 초기값 0, 반사 없음)의 표준 검사값은 "123456789" → 0xF4입니다.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "UnitTest.h"
+#include "DShot.h"
+
+/** @brief CRC 검사값과 빈 입력 */
+static void vTestCrc8(void){
+	const uint8_t uCheck[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	const uint8_t uOne[1] = { 0x01u };
+
+	UT_CHECK_EQ(uKissCrc8(uCheck, 9u), 0xF4u);
+	UT_CHECK_EQ(uKissCrc8(uCheck, 0u), 0x00u);
+	UT_CHECK_EQ(uKissCrc8(uOne, 1u), 0x07u);
+}
+
+/** @brief 필드 배치 (빅 엔디언)와 CRC 위치 */
+static void vTestBuildLayout(void){
+	const sKissTelem T = { 45u, 1260u, 1530u, 321u, 0x1234u };
+	const uint8_t uExp[9] = { 45u, 0x04u, 0xECu, 0x05u, 0xFAu, 0x01u, 0x41u, 0x12u, 0x34u };
+	uint8_t uBuf[KISS_FRAME_LEN];
+
+	UT_CHECK_EQ(uKissBuild(&T, uBuf), KISS_FRAME_LEN);
+	UT_CHECK(memcmp(uBuf, uExp, sizeof(uExp)) == 0);
+	UT_CHECK_EQ(uBuf[9], uKissCrc8(uExp, 9u));
+}
+
+/** @brief 생성 → 해석 왕복 (경계값 포함) */
+static void vTestRoundTrip(void){
+	const sKissTelem Cases[3] = {
+		{ 0u, 0u, 0u, 0u, 0u },
+		{ 255u, 0xFFFFu, 0xFFFFu, 0xFFFFu, 0xFFFFu },
+		{ 70u, 1680u, 4210u, 1500u, 987u },
+	};
+	uint8_t uBuf[KISS_FRAME_LEN];
+	sKissTelem R;
+	uint16_t i;
+
+	for(i = 0u; i < 3u; i++){
+		uKissBuild(&Cases[i], uBuf);
+		memset(&R, 0, sizeof(R));
+		UT_CHECK_EQ(uKissParse(uBuf, &R), 1u);
+		UT_CHECK_EQ(R.uTemp, Cases[i].uTemp);
+		UT_CHECK_EQ(R.uVolt, Cases[i].uVolt);
+		UT_CHECK_EQ(R.uCurr, Cases[i].uCurr);
+		UT_CHECK_EQ(R.uMah, Cases[i].uMah);
+		UT_CHECK_EQ(R.uErpm, Cases[i].uErpm);
+	}
+}
+
+/** @brief 단일 비트 오류는 모두 검출 */
+static void vTestBitError(void){
+	const sKissTelem T = { 38u, 1110u, 250u, 42u, 310u };
+	uint8_t uBuf[KISS_FRAME_LEN];
+	sKissTelem R;
+	uint16_t uByte, uBit, uMiss = 0u;
+
+	for(uByte = 0u; uByte < KISS_FRAME_LEN; uByte++){
+		for(uBit = 0u; uBit < 8u; uBit++){
+			uKissBuild(&T, uBuf);
+			uBuf[uByte] ^= (uint8_t)(1u << uBit);
+			if(uKissParse(uBuf, &R) != 0u) uMiss++;
+		}
+	}
+	UT_CHECK_EQ(uMiss, 0u);
+}
+
+int main(void){
+	UT_RUN(vTestCrc8);
+	UT_RUN(vTestBuildLayout);
+	UT_RUN(vTestRoundTrip);
+	UT_RUN(vTestBitError);
+	return UT_RESULT();
+}
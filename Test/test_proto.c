@@ -0,0 +1,480 @@
+/**
+ * @file    test_proto.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   프로토콜(Proto.c) 호스트 시험: 클라이언트(ProtoHost.c) ↔ 장치 대역(ProtoDevice.c) 메모리 연결
+ * @details 호스트 쓰기는 장치 수신 큐로, 장치 송신(UartStub)은 호스트 수신 버퍼로 연결합니다. 호스트가 응답을 기다리는 동안
+ * 장치를 1ms(20 제어 주기)씩 진행하므로 제한 시간과 재전송은 모의 시각으로 결정적으로 동작합니다.
+ *
+ * | 연결 고장 주입 | 내용 |
+ * | :--- | :--- |
+ * | **uLinkCorrupt** | 다음 n개 요청의 CRC 바이트를 뒤집음 (장치는 응답하지 않음) |
+ * | **uLinkDropRsp** | 다음 n개 응답을 버림 |
+ * | **uLinkJunk** | 요청 앞에 동기 워드 일부를 포함한 잡음 바이트를 붙임 |
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "UnitTest.h"
+#include "GlobalVar.h"
+#include "MotorControl.h"
+#include "VarTable.h"
+#include "Command.h"
+#include "Param.h"
+#include "Scope.h"
+#include "Telemetry.h"
+#include "Throttle.h"
+#include "Proto.h"
+#include "UartStub.h"
+#include "ProtoDevice.h"
+#include "ProtoHost.h"
+
+/** @brief 연결 버퍼 크기 [byte] */
+#define LINK_BUF_SIZE       65536u
+
+/** @brief 호스트 → 장치 */
+static uint8_t uDevRx[LINK_BUF_SIZE];
+static uint32_t ulDevRxHead, ulDevRxTail;
+/** @brief 장치 → 호스트 */
+static uint8_t uHostRx[LINK_BUF_SIZE];
+static uint32_t ulHostRxLen;
+/** @brief 고장 주입 */
+static uint16_t uLinkCorrupt, uLinkDropRsp, uLinkJunk;
+
+static sProtoHost Host;
+
+/**
+ * @brief  장치 수신 콜백: 호스트가 쓴 바이트를 꺼냅니다.
+ */
+static uint16_t uLinkDevRx(uint8_t* pDst, uint16_t uMax){
+	uint16_t uNum = 0u;
+
+	while((uNum < uMax) && (ulDevRxTail != ulDevRxHead)) pDst[uNum++] = uDevRx[ulDevRxTail++ % LINK_BUF_SIZE];
+	return uNum;
+}
+
+/**
+ * @brief  장치 송신 콜백: 응답과 텔레메트리를 호스트 수신 버퍼에 쌓습니다.
+ */
+static void vLinkDevTx(const uint8_t* pData, uint16_t uLen){
+	if((uLinkDropRsp != 0u) && (pData[0] == (uint8_t)PROTO_SYNC_RSP) && (pData[1] == (uint8_t)(PROTO_SYNC_RSP >> 8))) {
+		uLinkDropRsp--;
+		return;
+	}
+	if((ulHostRxLen + uLen) > LINK_BUF_SIZE) return;
+	memcpy(&uHostRx[ulHostRxLen], pData, uLen);
+	ulHostRxLen += uLen;
+}
+
+/**
+ * @brief  호스트 쓰기: 고장 주입 후 장치 수신 큐에 넣습니다.
+ */
+static int iLinkWrite(void* pCtx, const uint8_t* pData, uint16_t uLen){
+	static const uint8_t uJunk[5] = { 0x5Cu, 0x00u, 0xA5u, 0x5Cu, 0x13u };
+	uint16_t i;
+
+	(void)pCtx;
+	if(uLinkJunk != 0u) {
+		uLinkJunk--;
+		for(i = 0u; i < sizeof(uJunk); i++) uDevRx[ulDevRxHead++ % LINK_BUF_SIZE] = uJunk[i];
+	}
+	for(i = 0u; i < uLen; i++) uDevRx[ulDevRxHead++ % LINK_BUF_SIZE] = pData[i];
+	if(uLinkCorrupt != 0u) {
+		uLinkCorrupt--;
+		uDevRx[(ulDevRxHead - 1u) % LINK_BUF_SIZE] ^= 0xFFu;
+	}
+	return 0;
+}
+
+/**
+ * @brief  호스트 읽기: 받은 바이트가 없으면 장치를 1ms씩 진행하며 기다립니다.
+ */
+static int iLinkRead(void* pCtx, uint8_t* pDst, uint16_t uMax, int iTimeoutMs){
+	uint16_t uNum;
+
+	(void)pCtx;
+	while((ulHostRxLen == 0u) && (iTimeoutMs-- > 0)) vDevStep(DEV_CYCLES_PER_MS);
+	uNum = (uint16_t)((ulHostRxLen < uMax) ? ulHostRxLen : uMax);
+	memcpy(pDst, uHostRx, uNum);
+	memmove(uHostRx, &uHostRx[uNum], ulHostRxLen - uNum);
+	ulHostRxLen -= uNum;
+	return uNum;
+}
+
+/**
+ * @brief  모의 시각 [ms]
+ */
+static uint32_t ulLinkTick(void* pCtx){
+	(void)pCtx;
+	return HAL_GetTick();
+}
+
+/**
+ * @brief  장치와 연결을 초기 상태로 되돌립니다.
+ */
+static void vTestReset(void){
+	const sProtoLink Link = { iLinkWrite, iLinkRead, ulLinkTick, NULL };
+
+	ulDevRxHead = ulDevRxTail = ulHostRxLen = 0ul;
+	uLinkCorrupt = uLinkDropRsp = uLinkJunk = 0u;
+	pUartStubRx = uLinkDevRx;
+	pUartStubTx = vLinkDevTx;
+	vDevInit();
+	vProtoHostInit(&Host, &Link);
+}
+
+/** @brief float 원시값 */
+static float fRaw(uint32_t ulRaw){
+	float f;
+
+	memcpy(&f, &ulRaw, 4u);
+	return f;
+}
+
+/** @brief float → 원시값 */
+static uint32_t ulRaw(float f){
+	uint32_t ul;
+
+	memcpy(&ul, &f, 4u);
+	return ul;
+}
+
+/** @brief 변수 1개 읽기 (float) */
+static float fReadVar(uint16_t uId){
+	uint32_t ul = 0ul;
+
+	UT_CHECK_EQ(uProtoVarRead(&Host, &uId, 1u, &ul), PROTO_OK);
+	return fRaw(ul);
+}
+
+/** @brief 변수 1개 읽기 (정수) */
+static uint32_t ulReadVar(uint16_t uId){
+	uint32_t ul = 0ul;
+
+	UT_CHECK_EQ(uProtoVarRead(&Host, &uId, 1u, &ul), PROTO_OK);
+	return ul;
+}
+
+/** @brief PING과 VAR_INFO: 레지스트리 내용이 그대로 보임 */
+static void vTestInfo(void){
+	sProtoVarInfo Info;
+	uint16_t uVer = 0u, uVarNum = 0u, uParamNum = 0u, i;
+
+	vTestReset();
+	UT_CHECK_EQ(uProtoPing(&Host, &uVer, &uVarNum, &uParamNum), PROTO_OK);
+	UT_CHECK_EQ(uVer, PROTO_VERSION);
+	UT_CHECK_EQ(uVarNum, VAR_ID_NUM);
+	UT_CHECK_EQ(uParamNum, sizeof(sCtrlParamCfg) / sizeof(float));
+
+	UT_CHECK_EQ(uProtoVarInfo(&Host, VAR_ID_SO_WRPM_SC, &Info), PROTO_OK);
+	UT_CHECK(strcmp(Info.cName, "SO.fWrpmSC") == 0);
+	UT_CHECK_EQ(Info.uType, DCH_TYPE_FLOAT);
+	UT_CHECK_EQ(Info.uUnit, VAR_UNIT_RPM);
+	UT_CHECK_EQ(Info.ulHash, VarTable[VAR_ID_SO_WRPM_SC].ulHash);
+	UT_CHECK_EQ(uProtoVarInfo(&Host, VAR_ID_ESC_TEMP, &Info), PROTO_OK);
+	UT_CHECK_EQ(Info.uUnit, VAR_UNIT_DEGC);
+
+	/* 전체 목록: 이름과 타입, 단위가 레지스트리와 같음 */
+	for(i = 0u; i < VAR_ID_NUM; i++) {
+		if((uProtoVarInfo(&Host, i, &Info) != PROTO_OK) || (strcmp(Info.cName, VarTable[i].pName) != 0)
+				|| (Info.uType != VarTable[i].uType) || (Info.uUnit != VarTable[i].uUnit)) break;
+	}
+	UT_CHECK_EQ(i, VAR_ID_NUM);
+	UT_CHECK_EQ(uProtoVarInfo(&Host, VAR_ID_NUM, &Info), PROTO_ERR_ARG);
+}
+
+/** @brief 일괄 읽기와 쓰기 */
+static void vTestVarReadWrite(void){
+	uint16_t uId[PROTO_READ_MAX + 1u], i;
+	uint32_t ulVal[PROTO_READ_MAX + 1u];
+
+	vTestReset();
+	uId[0] = VAR_ID_VDC;
+	uId[1] = VAR_ID_STATE;
+	uId[2] = VAR_ID_CTRL_CYCLES;
+	UT_CHECK_EQ(uProtoVarRead(&Host, uId, 3u, ulVal), PROTO_OK);
+	UT_CHECK_NEAR(fRaw(ulVal[0]), DEV_VDC_NOM, 1e-3f);
+	UT_CHECK_EQ(ulVal[1], IDLE_STATE);
+	UT_CHECK_EQ(ulVal[2], ulControlCycles);
+
+	/* 최대 개수는 한 요청, 초과는 장치가 길이 오류로 거절 */
+	for(i = 0u; i <= PROTO_READ_MAX; i++) uId[i] = (uint16_t)(i % VAR_ID_NUM);
+	UT_CHECK_EQ(uProtoVarRead(&Host, uId, PROTO_READ_MAX, ulVal), PROTO_OK);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_VAR_READ, (const uint8_t*)uId, 2u * (PROTO_READ_MAX + 1u), NULL, NULL), PROTO_ERR_LEN);
+	uId[1] = VAR_ID_NUM;
+	UT_CHECK_EQ(uProtoVarRead(&Host, uId, 2u, ulVal), PROTO_ERR_ARG);
+
+	/* 쓰기 가능 항목은 제어 ISR에서 적용된 뒤 읽힘 */
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_THR_OUT_MODE, THR_OUT_SPEED), PROTO_OK);
+	vDevStep(1u);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_THR_OUT_MODE), THR_OUT_SPEED);
+	Throttle.uOutMode = THR_OUT_OFF;
+
+	/* 설정값 항목은 CmdReq.Set으로 전달되어 SET_GET과 제어 변수에 함께 보임 */
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_SC_WRPM_REFSET, ulRaw(750.0f)), PROTO_OK);
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_CTRL_MODE, VECTCONTL_MODE), PROTO_OK);
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_CTRL_MODE, ALIGN_MODE + 1u), PROTO_ERR_ARG);
+	vDevStep(2u);
+	UT_CHECK_NEAR(fReadVar(VAR_ID_SC_WRPM_REFSET), 750.0f, 1e-6f);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_CTRL_MODE), VECTCONTL_MODE);
+	UT_CHECK_NEAR(CmdReq.Set.fWrpmRefSet, 750.0f, 1e-6f);
+	UT_CHECK_EQ(CmdReq.Set.uControlMode, VECTCONTL_MODE);
+
+	/* 측정값, 상태, 카운터는 읽기 전용 */
+	ulVal[0] = ulOverrunCnt;
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_ESC_TEMP, ulRaw(25.5f)), PROTO_ERR_RO);
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_OVERRUN_CNT, 7ul), PROTO_ERR_RO);
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_STATE, RUN_STATE), PROTO_ERR_RO);
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_TSAMP, ulRaw(1.0e-3f)), PROTO_ERR_RO);
+	vDevStep(1u);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_OVERRUN_CNT), ulVal[0]);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_STATE), IDLE_STATE);
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_NUM, 0ul), PROTO_ERR_ARG);
+}
+
+/** @brief 시작/정지/리셋과 설정값 */
+static void vTestCmdSet(void){
+	float fSet[4];
+	uint16_t uMode = 0u;
+
+	vTestReset();
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_MODE, (float)SPDCONTL_MODE), PROTO_OK);
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_WRPM, 1000.0f), PROTO_OK);
+	UT_CHECK_EQ(uProtoSetGet(&Host, fSet, &uMode), PROTO_OK);
+	UT_CHECK_NEAR(fSet[PROTO_SET_WRPM], 1000.0f, 1e-3f);
+	UT_CHECK_EQ(uMode, SPDCONTL_MODE);
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_MODE, (float)(ALIGN_MODE + 1u)), PROTO_ERR_ARG);
+	UT_CHECK_EQ(uProtoSetWrite(&Host, 9u, 0.0f), PROTO_ERR_ARG);
+
+	UT_CHECK_EQ(uProtoCmd(&Host, CMD_START), PROTO_OK);
+	vDevStep(2u);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_STATE), RUN_STATE);
+	vDevStep((uint32_t)(1.5f * DEV_CTRL_FREQ));
+	UT_CHECK_NEAR(fReadVar(VAR_ID_SO_WRPM_SC), 1000.0f, 20.0f);
+	UT_CHECK_NEAR(fReadVar(VAR_ID_SC_WRPM_REFSET), 1000.0f, 1e-3f);
+
+	/* 변수 쓰기는 다음 설정값 게시 전까지 유지 (매 주기 스냅숏으로 되돌리지 않음) */
+	UT_CHECK_EQ(uProtoVarWrite(&Host, VAR_ID_SC_WRPM_REFSET, ulRaw(1200.0f)), PROTO_OK);
+	vDevStep(10u);
+	UT_CHECK_NEAR(fReadVar(VAR_ID_SC_WRPM_REFSET), 1200.0f, 1e-3f);
+
+	UT_CHECK_EQ(uProtoCmd(&Host, CMD_STOP), PROTO_OK);
+	vDevStep(2u);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_STATE), IDLE_STATE);
+
+	/* 리셋은 설정값도 0으로 */
+	UT_CHECK_EQ(uProtoCmd(&Host, CMD_START), PROTO_OK);
+	UT_CHECK_EQ(uProtoCmd(&Host, CMD_RESET), PROTO_OK);
+	vDevStep(2u);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_STATE), IDLE_STATE);
+	UT_CHECK_EQ(uProtoSetGet(&Host, fSet, &uMode), PROTO_OK);
+	UT_CHECK_EQ(fSet[PROTO_SET_WRPM], 0.0f);
+	UT_CHECK_EQ(fReadVar(VAR_ID_SC_WRPM_REFSET), 0.0f);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_CTRL_MODE), SPDCONTL_MODE);
+	UT_CHECK_EQ(uProtoCmd(&Host, 9u), PROTO_ERR_ARG);
+}
+
+/** @brief 설정값 출처 우선순위: 스로틀 게시 중에는 CmdReq보다 우선, 해제하면 CmdReq 최신값 */
+static void vTestCmdSrc(void){
+	sCmdSetpoint ThrSet = { 0.0f, 0.0f, 3.0f, 0.0f, THR_IQ_SLOPE, VECTCONTL_MODE, 0u };
+
+	vTestReset();
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_MODE, (float)SPDCONTL_MODE), PROTO_OK);
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_WRPM, 800.0f), PROTO_OK);
+	UT_CHECK_EQ(ulReadVar(VAR_ID_CTRL_MODE), SPDCONTL_MODE);
+
+	vCmdThrottlePost(&ThrSet);
+	vDevStep(1u);
+	UT_CHECK_EQ(uControlMode, VECTCONTL_MODE);
+	UT_CHECK_NEAR(INV.CC.fIqsrRefSet, 3.0f, 1e-6f);
+	UT_CHECK_NEAR(INV.CC.fIqsrSlopeSet, THR_IQ_SLOPE, 1e-6f);
+	UT_CHECK_EQ(INV.SC.fWrpmRefSet, 0.0f);
+
+	/* 스로틀 사용 중 CmdReq 설정값은 적용하지 않고 보관 */
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_WRPM, 600.0f), PROTO_OK);
+	UT_CHECK_EQ(uControlMode, VECTCONTL_MODE);
+	UT_CHECK_NEAR(INV.CC.fIqsrRefSet, 3.0f, 1e-6f);
+
+	/* 해제하면 다음 주기에 CmdReq 최신값으로 복귀 */
+	vCmdThrottleRelease();
+	vDevStep(1u);
+	UT_CHECK_EQ(uControlMode, SPDCONTL_MODE);
+	UT_CHECK_NEAR(INV.SC.fWrpmRefSet, 600.0f, 1e-6f);
+	UT_CHECK_NEAR(INV.CC.fIqsrSlopeSet, CC_IQ_SLOPE, 1e-6f);
+}
+
+/** @brief 파라미터 읽기/변경/게시 */
+static void vTestParam(void){
+	const uint8_t uAcc = (uint8_t)(offsetof(sCtrlParamCfg, fWrpmAcc) / sizeof(float));
+	const uint8_t uRs = (uint8_t)(offsetof(sCtrlParamCfg, fRs) / sizeof(float));
+	const uint8_t uWcSc = (uint8_t)(offsetof(sCtrlParamCfg, fWcSc) / sizeof(float));
+	uint16_t uPending = 1u, uErr = 1u;
+	uint32_t ulCommit = 0ul, ulCommit0 = 0ul, ulVer = 0ul, ulVer0 = 0ul;
+	float fVal = 0.0f;
+
+	vTestReset();
+	UT_CHECK_EQ(uProtoParamGet(&Host, uAcc, &fVal), PROTO_OK);
+	UT_CHECK_EQ(fVal, PARAM_WRPM_ACC);
+	UT_CHECK_EQ(uProtoParamStatus(&Host, &uPending, &uErr, &ulCommit0, &ulVer0), PROTO_OK);
+
+	UT_CHECK_EQ(uProtoParamSet(&Host, uAcc, 2000.0f), PROTO_OK);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_PARAM_COMMIT, NULL, 0u, NULL, NULL), PROTO_OK);
+	vDevStep(4u);
+	UT_CHECK_EQ(uProtoParamStatus(&Host, &uPending, &uErr, &ulCommit, &ulVer), PROTO_OK);
+	UT_CHECK_EQ(uPending, 0u);
+	UT_CHECK_EQ(uErr, PARAM_ERR_NONE);
+	UT_CHECK_EQ(ulCommit, ulCommit0 + 1ul);
+	UT_CHECK(ulVer != ulVer0);
+	UT_CHECK_EQ(uProtoParamGet(&Host, uAcc, &fVal), PROTO_OK);
+	UT_CHECK_EQ(fVal, 2000.0f);
+	/* 가감속 증분은 vSpeedControl 호출 주기(SC_DIV 제어 주기) 기준 */
+	UT_CHECK_NEAR(pCtrlParam->fDelWrpmAcc, 2000.0f * (float)SC_DIV / DEV_CTRL_FREQ, 1e-4f);
+
+	/* 속도 제어 대역폭도 SC_DIV 제어 주기로 검증 (LPTIM 주기 기준으로는 통과하는 값) */
+	UT_CHECK_EQ(uProtoParamSet(&Host, uWcSc, 0.8f * PARAM_WC_TS_MAX / DEV_SC_TS), PROTO_OK);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_PARAM_COMMIT, NULL, 0u, NULL, NULL), PROTO_OK);
+	vDevStep(4u);
+	UT_CHECK_EQ(uProtoParamStatus(&Host, &uPending, &uErr, &ulCommit0, &ulVer0), PROTO_OK);
+	UT_CHECK(uErr & PARAM_ERR_BW);
+	UT_CHECK_EQ(ulCommit0, ulCommit);
+	UT_CHECK_EQ(uProtoParamSet(&Host, uWcSc, WC_SC), PROTO_OK);
+
+	/* 잘못된 값은 게시되지 않고 오류 비트만 남음 */
+	UT_CHECK_EQ(uProtoParamSet(&Host, uRs, -1.0f), PROTO_OK);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_PARAM_COMMIT, NULL, 0u, NULL, NULL), PROTO_OK);
+	vDevStep(4u);
+	UT_CHECK_EQ(uProtoParamStatus(&Host, &uPending, &uErr, &ulCommit0, &ulVer0), PROTO_OK);
+	UT_CHECK(uErr & PARAM_ERR_MOTOR);
+	UT_CHECK_EQ(ulCommit0, ulCommit);
+	UT_CHECK_EQ(ulVer0, ulVer);
+
+	UT_CHECK_EQ(uProtoParamGet(&Host, (uint8_t)(sizeof(sCtrlParamCfg) / sizeof(float)), &fVal), PROTO_ERR_ARG);
+}
+
+/** @brief 스코프 무장 → 트리거 → 전체 내려받기 */
+static void vTestScope(void){
+	static int16_t iBuf[SCOPE_DEPTH][2];
+	sProtoScopeCfg Cfg = { SCOPE_MODE_SINGLE, 2u, 1u, 64u, 0u, SCOPE_TRIG_RISING, 500.0f,
+			{ VAR_ID_SO_WRPM_SC, VAR_ID_CC_IQSR } };
+	sProtoScopeStatus St;
+	const float fScale = VarTable[VAR_ID_SO_WRPM_SC].fScale;
+	uint16_t k;
+
+	vTestReset();
+	UT_CHECK_EQ(uProtoScopeArm(&Host, &Cfg), PROTO_OK);
+	vDevStep(Cfg.uPreTrig + 2u);
+	UT_CHECK_EQ(uProtoScopeStatus(&Host, &St), PROTO_OK);
+	UT_CHECK_EQ(St.uState, SCOPE_STATE_ARMED);
+	UT_CHECK_EQ(St.uReady, 0u);
+	UT_CHECK_EQ(St.uDepth, SCOPE_DEPTH);
+	UT_CHECK_EQ(uProtoScopeDownload(&Host, 2u, &iBuf[0][0]), PROTO_ERR_BUSY);
+
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_WRPM, 1000.0f), PROTO_OK);
+	UT_CHECK_EQ(uProtoCmd(&Host, CMD_START), PROTO_OK);
+	vDevStep((uint32_t)DEV_CTRL_FREQ);
+	UT_CHECK_EQ(uProtoScopeStatus(&Host, &St), PROTO_OK);
+	UT_CHECK_EQ(St.uReady, 1u);
+	UT_CHECK_EQ(St.ulCaptureCnt, 1ul);
+
+	UT_CHECK_EQ(uProtoScopeDownload(&Host, 2u, &iBuf[0][0]), PROTO_OK);
+	UT_CHECK(iBuf[Cfg.uPreTrig - 1u][0] < (int16_t)(500.0f * fScale));
+	UT_CHECK(iBuf[Cfg.uPreTrig][0] >= (int16_t)(500.0f * fScale));
+	for(k = 1u; k < SCOPE_DEPTH; k++) {
+		if(iBuf[k][0] < iBuf[k - 1u][0]) break;
+	}
+	UT_CHECK_EQ(k, SCOPE_DEPTH);
+
+	/* 판독 중 다른 배치로 재무장해도 완료 버퍼는 완료 시점의 채널 수/Pre-trigger로 읽힘 */
+	Cfg.uChNum = 1u;
+	Cfg.uPreTrig = 16u;
+	UT_CHECK_EQ(uProtoScopeArm(&Host, &Cfg), PROTO_OK);
+	UT_CHECK_EQ(uProtoScopeStatus(&Host, &St), PROTO_OK);
+	UT_CHECK_EQ(St.uReady, 1u);
+	UT_CHECK_EQ(St.uChNum, 2u);
+	UT_CHECK_EQ(St.uPreTrig, 64u);
+	UT_CHECK_EQ(uProtoScopeDownload(&Host, 2u, &iBuf[0][0]), PROTO_OK);
+	UT_CHECK(iBuf[63][0] < (int16_t)(500.0f * fScale));
+	UT_CHECK(iBuf[64][0] >= (int16_t)(500.0f * fScale));
+	Cfg.uChNum = 2u;
+	Cfg.uPreTrig = 64u;
+
+	/* 트리거 레벨에는 채널 오프셋까지 같은 변환을 적용 */
+	ScopeCh[0].fOffset = 1000.0f;
+	Scope.uTrigCh = 0u;
+	Scope.fTrigLevel = 500.0f;
+	vScopeArm();
+	UT_CHECK_EQ(Scope.iTrigLevel, (int16_t)(500.0f * fScale + 1000.0f));
+	ScopeCh[0].fOffset = 0.0f;
+
+	/* 잘못된 설정은 거절 */
+	Cfg.uChNum = SCOPE_CH_MAX + 1u;
+	UT_CHECK_EQ(uProtoScopeArm(&Host, &Cfg), PROTO_ERR_ARG);
+	Cfg.uChNum = 2u;
+	Cfg.uTrigCh = 2u;
+	UT_CHECK_EQ(uProtoScopeArm(&Host, &Cfg), PROTO_ERR_ARG);
+	Cfg.uTrigCh = 0u;
+	Cfg.uId[1] = VAR_ID_NUM;
+	UT_CHECK_EQ(uProtoScopeArm(&Host, &Cfg), PROTO_ERR_ARG);
+}
+
+/** @brief 형식 오류 요청 */
+static void vTestErrors(void){
+	const uint8_t uTwo[2] = { CMD_START, 0u };
+
+	vTestReset();
+	UT_CHECK_EQ(uProtoCall(&Host, 0x7Fu, NULL, 0u, NULL, NULL), PROTO_ERR_OP);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_CMD, uTwo, 2u, NULL, NULL), PROTO_ERR_LEN);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_VAR_READ, uTwo, 1u, NULL, NULL), PROTO_ERR_LEN);
+	UT_CHECK_EQ(uProtoCall(&Host, PROTO_OP_TELEM, uTwo, 1u, NULL, NULL), PROTO_ERR_LEN);
+	UT_CHECK_EQ(Proto.ulReqCnt, 4ul);
+}
+
+/** @brief 연결 고장: CRC 오류 재전송, 응답 유실, 잡음, 텔레메트리 혼합 */
+static void vTestLink(void){
+	uint16_t uVer, uVarNum, uParamNum, i;
+
+	vTestReset();
+	uLinkCorrupt = 1u;
+	UT_CHECK_EQ(uProtoPing(&Host, &uVer, &uVarNum, &uParamNum), PROTO_OK);
+	UT_CHECK_EQ(Host.ulRetryCnt, 1ul);
+	UT_CHECK_EQ(Proto.ulCrcErrCnt, 1ul);
+
+	/* 응답 유실: 같은 순번 재전송, 장치는 다시 처리 (멱등) */
+	uLinkDropRsp = 2u;
+	UT_CHECK_EQ(uProtoSetWrite(&Host, PROTO_SET_IQSR, 2.5f), PROTO_OK);
+	UT_CHECK_EQ(Host.ulRetryCnt, 3ul);
+	UT_CHECK_NEAR(CmdReq.Set.fIqsrRefSet, 2.5f, 1e-6f);
+
+	/* 재전송 횟수를 넘으면 시간 초과 */
+	uLinkDropRsp = Host.uRetryMax + 1u;
+	UT_CHECK_EQ(uProtoCmd(&Host, CMD_STOP), PROTO_HOST_TIMEOUT);
+
+	/* 요청 사이 잡음 */
+	uLinkJunk = 3u;
+	for(i = 0u; i < 3u; i++) UT_CHECK_EQ(uProtoPing(&Host, &uVer, &uVarNum, &uParamNum), PROTO_OK);
+
+	/* 텔레메트리와 응답이 같은 경로로 섞여도 응답만 골라냄 */
+	UT_CHECK_EQ(uProtoTelem(&Host, 1u, TELEM_MODE_RAW), PROTO_OK);
+	vDevStep(100u);
+	for(i = 0u; i < 20u; i++) {
+		if(uProtoPing(&Host, &uVer, &uVarNum, &uParamNum) != PROTO_OK) break;
+		vDevStep(37u);
+	}
+	UT_CHECK_EQ(i, 20u);
+	UT_CHECK(Host.ulSkipBytes > 100ul);
+	UT_CHECK_EQ(uProtoTelem(&Host, 1u, 9u), PROTO_ERR_ARG);
+	UT_CHECK_EQ(uProtoTelem(&Host, 0u, 0xFFu), PROTO_OK);
+}
+
+int main(void){
+	UT_RUN(vTestInfo);
+	UT_RUN(vTestVarReadWrite);
+	UT_RUN(vTestCmdSet);
+	UT_RUN(vTestCmdSrc);
+	UT_RUN(vTestParam);
+	UT_RUN(vTestScope);
+	UT_RUN(vTestErrors);
+	UT_RUN(vTestLink);
+	return UT_RESULT();
+}
@@ -0,0 +1,327 @@
+/**
+ * @file    test_rcframe.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   SBUS/CRSF 파서 및 CRSF 텔레메트리 프레임(RcFrame.c) 호스트 시험
+ * @details CRSF CRC-8(다항식 0xD5, 초기값 0, 반사 없음)의 표준 검사값은 "123456789" → 0xBC입니다.
+ * 수신 경로(RcRx.c)와 같이 바이트를 하나씩 넣고 프레임 사이 유휴 구간을 vSbusIdle/vCrsfIdle로 알립니다.
+ *
+ * | 시험 | 내용 |
+ * | :--- | :--- |
+ * | **vTestChPack** | 11bit 패킹 비트 위치, 왕복, 펄스폭 환산 |
+ * | **vTestCrc** | 검사값, 테이블 = 비트 단위 계산 |
+ * | **vTestSbus** | 채널/플래그, 끝 바이트 오류, 잘린 프레임, 유휴 구간 없는 초과 바이트 |
+ * | **vTestCrsf** | RC 채널/링크 통계, 연속 프레임, CRC/길이/주소 오류, 잘린 프레임 |
+ * | **vTestTelemFrame** | 배터리/RPM 프레임 배치, 길이 초과 |
+ * | **vTestResync** | 잡음 사이에 섞인 프레임을 유휴 구간 뒤 모두 복원 |
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "UnitTest.h"
+#include "RcFrame.h"
+
+/** @brief 고정 시드 난수 (xorshift32) */
+static uint32_t ulRand = 0x9E3779B9u;
+
+/**
+ * @brief  다음 난수
+ */
+static uint32_t ulRandNext(void){
+	ulRand ^= ulRand << 13;
+	ulRand ^= ulRand >> 17;
+	ulRand ^= ulRand << 5;
+	return ulRand;
+}
+
+/**
+ * @brief  SBUS 프레임을 만듭니다.
+ */
+static void vSbusMake(const uint16_t* pCh, uint8_t uFlags, uint8_t* pOut){
+	pOut[0] = SBUS_START;
+	vRcPackCh(pCh, &pOut[1]);
+	pOut[23] = uFlags;
+	pOut[24] = SBUS_END;
+}
+
+/**
+ * @brief  CRSF RC 채널 프레임을 만듭니다.
+ * @retval 프레임 길이 [byte]
+ */
+static uint16_t uCrsfMakeRc(const uint16_t* pCh, uint8_t* pOut){
+	uint8_t uPl[22];
+
+	vRcPackCh(pCh, uPl);
+	return uCrsfBuild(CRSF_TYPE_RC, uPl, 22u, pOut);
+}
+
+/**
+ * @brief  SBUS 바이트열을 넣고 마지막 반환값을 돌려줍니다.
+ */
+static uint16_t uSbusFeed(sSbusParser* pP, const uint8_t* pData, uint16_t uLen){
+	uint16_t i, uRet = 0u;
+
+	for(i = 0u; i < uLen; i++) uRet = uSbusPush(pP, pData[i]);
+	return uRet;
+}
+
+/**
+ * @brief  CRSF 바이트열을 넣고 마지막 반환값을 돌려줍니다.
+ */
+static uint8_t uCrsfFeed(sCrsfParser* pP, const uint8_t* pData, uint16_t uLen){
+	uint16_t i;
+	uint8_t uRet = 0u;
+
+	for(i = 0u; i < uLen; i++) uRet = uCrsfPush(pP, pData[i]);
+	return uRet;
+}
+
+/** @brief 11bit 패킹 비트 위치, 왕복, 펄스폭 환산 */
+static void vTestChPack(void){
+	uint16_t uCh[RC_CH_NUM], uOut[RC_CH_NUM];
+	uint8_t uData[22];
+	uint16_t i, j, uBad = 0u;
+
+	/* 채널 i만 0x7FF: 패킹 비트열의 11i ~ 11i + 10번 비트만 1 (LSB 먼저) */
+	for(i = 0u; i < RC_CH_NUM; i++) {
+		memset(uCh, 0, sizeof(uCh));
+		uCh[i] = 0x7FFu;
+		vRcPackCh(uCh, uData);
+		for(j = 0u; j < 176u; j++) {
+			if((uint16_t)((uData[j >> 3] >> (j & 7u)) & 1u) != (uint16_t)((j >= 11u * i) && (j < 11u * i + 11u))) uBad++;
+		}
+	}
+	UT_CHECK_EQ(uBad, 0u);
+
+	/* 알려진 값: CH1 = 0x7FF, CH2 = 1 → FF 0F 00 */
+	memset(uCh, 0, sizeof(uCh));
+	uCh[0] = 0x7FFu;
+	uCh[1] = 1u;
+	vRcPackCh(uCh, uData);
+	UT_CHECK_EQ(uData[0], 0xFFu);
+	UT_CHECK_EQ(uData[1], 0x0Fu);
+	UT_CHECK_EQ(uData[2], 0x00u);
+
+	/* 왕복 (11bit 초과 비트는 버림) */
+	for(j = 0u; j < 200u; j++) {
+		for(i = 0u; i < RC_CH_NUM; i++) uCh[i] = (uint16_t)ulRandNext();
+		vRcPackCh(uCh, uData);
+		vRcUnpackCh(uData, uOut);
+		for(i = 0u; i < RC_CH_NUM; i++) if(uOut[i] != (uCh[i] & 0x7FFu)) uBad++;
+	}
+	UT_CHECK_EQ(uBad, 0u);
+
+	UT_CHECK_EQ(RC_CH_TO_US(172), 988u);
+	UT_CHECK_EQ(RC_CH_TO_US(992), 1500u);
+	UT_CHECK_EQ(RC_CH_TO_US(1811), 2012u);
+	UT_CHECK_EQ(RC_CH_TO_US(993), 1501u);
+}
+
+/** @brief 검사값, 테이블 = 비트 단위 계산 */
+static void vTestCrc(void){
+	const uint8_t uCheck[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	uint8_t uByte, uRef;
+	uint16_t i, j, uBad = 0u;
+
+	UT_CHECK_EQ(uCrsfCrc8(uCheck, 9u), 0xBCu);
+	UT_CHECK_EQ(uCrsfCrc8(uCheck, 0u), 0x00u);
+
+	for(i = 0u; i < 256u; i++) {
+		uByte = (uint8_t)i;
+		uRef = uByte;
+		for(j = 0u; j < 8u; j++) uRef = (uint8_t)((uRef & 0x80u) ? ((uRef << 1) ^ 0xD5u) : (uRef << 1));
+		if(uCrsfCrc8(&uByte, 1u) != uRef) uBad++;
+	}
+	UT_CHECK_EQ(uBad, 0u);
+}
+
+/** @brief 채널/플래그, 끝 바이트 오류, 잘린 프레임, 유휴 구간 없는 초과 바이트 */
+static void vTestSbus(void){
+	sSbusParser P;
+	uint16_t uCh[RC_CH_NUM], i;
+	uint8_t uF[SBUS_FRAME_LEN];
+
+	memset(&P, 0, sizeof(P));
+	for(i = 0u; i < RC_CH_NUM; i++) uCh[i] = (uint16_t)(172u + 100u * i);
+	vSbusMake(uCh, SBUS_FLAG_FAILSAFE | 0x01u, uF);
+
+	UT_CHECK_EQ(uSbusFeed(&P, uF, SBUS_FRAME_LEN), 1u);
+	UT_CHECK(memcmp(P.uCh, uCh, sizeof(uCh)) == 0);
+	UT_CHECK_EQ(P.uFlags, SBUS_FLAG_FAILSAFE | 0x01u);
+	UT_CHECK_EQ(P.ulFrameCnt, 1u);
+
+	/* 유휴 구간 없이 이어진 바이트는 무시 (두 번째 프레임은 복원되지 않음) */
+	UT_CHECK_EQ(uSbusFeed(&P, uF, SBUS_FRAME_LEN), 0u);
+	UT_CHECK_EQ(P.ulFrameCnt, 1u);
+	UT_CHECK_EQ(P.ulErrCnt, 0u);
+	vSbusIdle(&P);
+
+	/* 유휴 구간 뒤 시작 바이트 전 잡음은 건너뜀 */
+	UT_CHECK_EQ(uSbusPush(&P, 0xAAu), 0u);
+	UT_CHECK_EQ(uSbusPush(&P, SBUS_END), 0u);
+	UT_CHECK_EQ(uSbusFeed(&P, uF, SBUS_FRAME_LEN), 1u);
+	UT_CHECK_EQ(P.ulErrCnt, 0u);
+	vSbusIdle(&P);
+
+	/* 끝 바이트 오류: 채널 갱신 없음 */
+	uF[24] = 0x04u;
+	uCh[0] = 0u;
+	UT_CHECK_EQ(uSbusFeed(&P, uF, SBUS_FRAME_LEN), 0u);
+	UT_CHECK_EQ(P.ulErrCnt, 1u);
+	UT_CHECK_EQ(P.uCh[0], 172u);
+	vSbusIdle(&P);
+	UT_CHECK_EQ(P.ulErrCnt, 1u);
+
+	/* 잘린 프레임: 유휴 구간에서 오류, 다음 프레임 정상 */
+	vSbusMake(uCh, 0u, uF);
+	UT_CHECK_EQ(uSbusFeed(&P, uF, 12u), 0u);
+	vSbusIdle(&P);
+	UT_CHECK_EQ(P.ulErrCnt, 2u);
+	UT_CHECK_EQ(uSbusFeed(&P, uF, SBUS_FRAME_LEN), 1u);
+	UT_CHECK_EQ(P.uCh[0], 0u);
+	UT_CHECK_EQ(P.uFlags, 0u);
+	UT_CHECK_EQ(P.ulFrameCnt, 3u);
+}
+
+/** @brief RC 채널/링크 통계, 연속 프레임, CRC/길이/주소 오류, 잘린 프레임 */
+static void vTestCrsf(void){
+	static const uint8_t uLink[10] = {100u, 98u, 87u, 10u, 0u, 4u, 3u, 60u, 95u, 8u};
+	sCrsfParser P;
+	uint16_t uCh[RC_CH_NUM], i, uLen, uLenL;
+	uint8_t uF[CRSF_FRAME_MAX], uL[CRSF_FRAME_MAX], uBad[4];
+
+	memset(&P, 0, sizeof(P));
+	for(i = 0u; i < RC_CH_NUM; i++) uCh[i] = (uint16_t)(1811u - 50u * i);
+	uLen = uCrsfMakeRc(uCh, uF);
+	uLenL = uCrsfBuild(CRSF_TYPE_LINK, uLink, sizeof(uLink), uL);
+	UT_CHECK_EQ(uLen, 26u);
+	UT_CHECK_EQ(uF[1], 24u);
+
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	UT_CHECK(memcmp(P.uCh, uCh, sizeof(uCh)) == 0);
+
+	/* 프레임이 공백 없이 이어져도 각각 복원 */
+	UT_CHECK_EQ(uCrsfFeed(&P, uL, uLenL), CRSF_TYPE_LINK);
+	UT_CHECK_EQ(P.uLinkLq, uLink[CRSF_LINK_LQ_OFS]);
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	UT_CHECK_EQ(P.ulFrameCnt, 3u);
+
+	/* 수신기/송신기 주소도 수용 */
+	uF[0] = CRSF_ADDR_RX;
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	uF[0] = CRSF_ADDR_TX;
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	uF[0] = CRSF_ADDR_FC;
+
+	/* 데이터 1bit 오류: CRC 오류, 채널 유지 */
+	uF[5] ^= 0x10u;
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), 0u);
+	UT_CHECK_EQ(P.ulCrcErrCnt, 1u);
+	UT_CHECK(memcmp(P.uCh, uCh, sizeof(uCh)) == 0);
+	uF[5] ^= 0x10u;
+
+	/* 길이 오류 (1, 63): 즉시 폐기 후 다음 주소 바이트부터 동기 */
+	uBad[0] = CRSF_ADDR_FC; uBad[1] = 1u;
+	UT_CHECK_EQ(uCrsfFeed(&P, uBad, 2u), 0u);
+	uBad[1] = CRSF_FRAME_MAX - 1u;
+	UT_CHECK_EQ(uCrsfFeed(&P, uBad, 2u), 0u);
+	UT_CHECK_EQ(P.ulErrCnt, 2u);
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+
+	/* 주소가 아닌 바이트는 건너뜀 */
+	uBad[0] = 0x00u; uBad[1] = 0x16u; uBad[2] = 0xFFu;
+	UT_CHECK_EQ(uCrsfFeed(&P, uBad, 3u), 0u);
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	UT_CHECK_EQ(P.ulErrCnt, 2u);
+
+	/* 잘린 프레임: 유휴 구간에서 오류, 다음 프레임 정상 */
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, 10u), 0u);
+	vCrsfIdle(&P);
+	UT_CHECK_EQ(P.ulErrCnt, 3u);
+	vCrsfIdle(&P);
+	UT_CHECK_EQ(P.ulErrCnt, 3u);
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	UT_CHECK_EQ(P.ulFrameCnt, 8u);
+
+	/* 너무 짧은 RC 채널 프레임은 CRC가 맞아도 채널 갱신 없음 */
+	memset(uBad, 0, sizeof(uBad));
+	uLen = uCrsfBuild(CRSF_TYPE_RC, uBad, 4u, uF);
+	UT_CHECK_EQ(uCrsfFeed(&P, uF, uLen), CRSF_TYPE_RC);
+	UT_CHECK(memcmp(P.uCh, uCh, sizeof(uCh)) == 0);
+}
+
+/** @brief 배터리/RPM 프레임 배치, 길이 초과 */
+static void vTestTelemFrame(void){
+	static const uint8_t uBatExp[12] = {CRSF_ADDR_FC, 10u, CRSF_TYPE_BATTERY, 0x00u, 0xA8u, 0x00u, 0x7Bu, 0x00u, 0x05u, 0xDCu, 75u, 0x00u};
+	static const uint8_t uRpmExp[7] = {CRSF_ADDR_FC, 6u, CRSF_TYPE_RPM, 3u, 0xFFu, 0xFBu, 0x2Eu};
+	sCrsfParser P;
+	uint8_t uOut[CRSF_FRAME_MAX], uPl[CRSF_FRAME_MAX];
+
+	/* 16.8V, 12.3A, 1500mAh, 75% */
+	UT_CHECK_EQ(uCrsfBuildBattery(16.8f, 12.3f, 1500u, 75u, uOut), 12u);
+	UT_CHECK(memcmp(uOut, uBatExp, 11u) == 0);
+	UT_CHECK_EQ(uOut[11], uCrsfCrc8(&uOut[2], 9u));
+
+	/* 음수 전류/전압은 0 */
+	uCrsfBuildBattery(-1.0f, -5.0f, 0u, 0u, uOut);
+	UT_CHECK_EQ(uOut[3] | uOut[4] | uOut[5] | uOut[6], 0u);
+
+	/* RPM -1234 → int24 0xFFFB2E */
+	UT_CHECK_EQ(uCrsfBuildRpm(3u, -1234, uOut), 8u);
+	UT_CHECK(memcmp(uOut, uRpmExp, 7u) == 0);
+
+	/* 생성한 프레임은 파서가 그대로 수용 */
+	memset(&P, 0, sizeof(P));
+	UT_CHECK_EQ(uCrsfFeed(&P, uOut, 8u), CRSF_TYPE_RPM);
+
+	/* 최대 데이터 길이 60byte, 초과 시 0 */
+	memset(uPl, 0x5Au, sizeof(uPl));
+	UT_CHECK_EQ(uCrsfBuild(0x7Fu, uPl, CRSF_FRAME_MAX - 4u, uOut), CRSF_FRAME_MAX);
+	UT_CHECK_EQ(uCrsfFeed(&P, uOut, CRSF_FRAME_MAX), 0x7Fu);
+	UT_CHECK_EQ(uCrsfBuild(0x7Fu, uPl, CRSF_FRAME_MAX - 3u, uOut), 0u);
+}
+
+/** @brief 잡음 사이에 섞인 프레임을 유휴 구간 뒤 모두 복원 */
+static void vTestResync(void){
+	sSbusParser S;
+	sCrsfParser C;
+	uint16_t uCh[RC_CH_NUM], i, n, uNoise, uLen;
+	uint8_t uF[CRSF_FRAME_MAX], uByte;
+	uint32_t ulSbusOk = 0u, ulCrsfOk = 0u;
+
+	memset(&S, 0, sizeof(S));
+	memset(&C, 0, sizeof(C));
+	for(n = 0u; n < 1000u; n++) {
+		for(i = 0u; i < RC_CH_NUM; i++) uCh[i] = (uint16_t)(172u + ulRandNext() % 1640u);
+
+		/* 잡음 버스트 (길이 0 ~ 40) → 유휴 구간 → 프레임 → 유휴 구간 */
+		uNoise = (uint16_t)(ulRandNext() % 41u);
+		for(i = 0u; i < uNoise; i++) {
+			uByte = (uint8_t)ulRandNext();
+			uSbusPush(&S, uByte);
+			uCrsfPush(&C, uByte);
+		}
+		vSbusIdle(&S);
+		vCrsfIdle(&C);
+
+		vSbusMake(uCh, 0u, uF);
+		if(uSbusFeed(&S, uF, SBUS_FRAME_LEN) && (memcmp(S.uCh, uCh, sizeof(uCh)) == 0)) ulSbusOk++;
+		uLen = uCrsfMakeRc(uCh, uF);
+		if((uCrsfFeed(&C, uF, uLen) == CRSF_TYPE_RC) && (memcmp(C.uCh, uCh, sizeof(uCh)) == 0)) ulCrsfOk++;
+		vSbusIdle(&S);
+		vCrsfIdle(&C);
+	}
+	UT_CHECK_EQ(ulSbusOk, 1000u);
+	UT_CHECK_EQ(ulCrsfOk, 1000u);
+	UT_CHECK(S.ulFrameCnt >= 1000u);
+}
+
+int main(void){
+	UT_RUN(vTestChPack);
+	UT_RUN(vTestCrc);
+	UT_RUN(vTestSbus);
+	UT_RUN(vTestCrsf);
+	UT_RUN(vTestTelemFrame);
+	UT_RUN(vTestResync);
+	return UT_RESULT();
+}
@@ -0,0 +1,365 @@
+/**
+ * @file    test_telem.c
+ * @author  lsj50
+ * @date    2026. 10. 17.
+ * @brief   텔레메트리 스트림(Telemetry.c) 호스트 복원 시험
+ * @details 실제 Telemetry.c를 대체 UART(UartStub.c)와 합성 파형(TelemTrace.c)으로 실행하고, 송신 바이트열을
+ * 호스트 복원기(TelemDecode.c)로 되돌려 채널 샘플이 비트 단위로 같은지 확인합니다 (고정 형식 프레임, 1차/2차 차분 압축 블록).
+ * 압축률 상세 비교는 bench_telem이 출력합니다. 마지막 시험은 같은 바이트열을
+ * pty 마스터에 쓰고 슬레이브에서 읽어, 실제 USB-UART 장치를 여는 것과 같은 경로로 복원합니다.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include <unistd.h>
+#include "UnitTest.h"
+#include "UartStub.h"
+#include "Telemetry.h"
+#include "TelemDecode.h"
+#include "TelemTrace.h"
+#include "Pty.h"
+
+#define TEST_SAMPLE_NUM     (TELEM_FRAME_NUM * 64u)    /**< 시험 샘플 수 */
+#define TEST_STREAM_MAX     (TEST_SAMPLE_NUM * 16u)    /**< 송신 바이트 저장 크기 */
+
+/** @brief 펌웨어가 기록한 샘플 (송신 순서) */
+static sTelemSample ExpSample[TEST_SAMPLE_NUM];
+/** @brief 송신 바이트열 */
+static uint8_t uStream[TEST_STREAM_MAX];
+static uint32_t ulStreamLen;
+/** @brief 복원된 샘플 */
+static sTelemSample DecSample[TEST_SAMPLE_NUM];
+static uint32_t ulDecNum;
+/** @brief pty 마스터 (음수: 사용 안 함) */
+static int iPtyFd = -1;
+/** @brief pty 슬레이브와 그 복원 상태 */
+static int iPtySlave = -1;
+static sTelemDecoder PtyDec;
+
+/**
+ * @brief  송신 콜백: 바이트열 저장, pty 시험 중이면 마스터에도 씁니다.
+ */
+static void vTestTx(const uint8_t* pData, uint16_t uLen){
+	if(ulStreamLen + uLen <= TEST_STREAM_MAX) {
+		memcpy(&uStream[ulStreamLen], pData, uLen);
+		ulStreamLen += uLen;
+	}
+	if(iPtyFd >= 0) UT_CHECK(write(iPtyFd, pData, uLen) == (ssize_t)uLen);
+}
+
+/**
+ * @brief  복원 콜백: 샘플 저장
+ */
+static void vTestSample(const sTelemSample* pSample, void* pCtx){
+	(void)pCtx;
+	if(ulDecNum < TEST_SAMPLE_NUM) DecSample[ulDecNum] = *pSample;
+	ulDecNum++;
+}
+
+/**
+ * @brief  합성 파형 한 주기 진행 (기본 신호원)
+ * @param  ulK 샘플 번호
+ */
+static void vTestTraceSource(uint32_t ulK){
+	(void)ulK;
+	vTraceStep();
+}
+
+/**
+ * @brief  신호원을 진행하며 텔레메트리를 ulNum 샘플 기록합니다. (vInitTelemetry 이후 호출, 예측 차수 설정 유지)
+ * @param  uMode 송신 모드
+ * @param  ulNum 샘플 수
+ * @param  pfSource 샘플마다 채널 변수를 갱신할 함수 (첫 호출에서 TelemCh를 바꿔도 됨)
+ * @param  pfStep 샘플마다 기록 후 호출할 함수 (NULL 가능)
+ * @retval 없음
+ */
+static void vTestRun(uint16_t uMode, uint32_t ulNum, void (*pfSource)(uint32_t ulK), void (*pfStep)(int iWaitMs)){
+	uint32_t k;
+	uint16_t i;
+
+	pUartStubTx = vTestTx;
+	ulStreamLen = 0ul;
+	(void)uTelemSetMode(uMode);
+
+	for(k = 0ul; k < ulNum; k++) {
+		pfSource(k);
+		ExpSample[k].uSeq = Telem.uSeq;
+		for(i = 0u; i < TELEM_CH_NUM; i++) ExpSample[k].iCh[i] = iPackDataChannel(&TelemCh[i]);
+		vTelemRecord();
+		vTelemTask();
+		if(pfStep != NULL) pfStep(0);
+	}
+}
+
+/**
+ * @brief  복원 샘플이 기록 샘플과 같은지 검사합니다.
+ * @param  ulFirst 비교 시작 기록 샘플
+ * @param  ulNum 샘플 수
+ * @retval 다른 샘플 수
+ */
+static uint32_t ulTestCompare(uint32_t ulFirst, uint32_t ulNum){
+	uint32_t k, ulBad = 0ul;
+
+	for(k = 0ul; k < ulNum; k++) {
+		if(memcmp(&DecSample[k], &ExpSample[ulFirst + k], sizeof(sTelemSample)) != 0) ulBad++;
+	}
+	return ulBad;
+}
+
+/**
+ * @brief  저장한 송신 바이트열 전체를 임의 크기(1 ~ 40byte) 조각으로 복원합니다.
+ * @param  pDec 복원 상태 (초기화함)
+ * @retval 없음
+ */
+static void vTestDecode(sTelemDecoder* pDec){
+	uint32_t ulPos = 0ul, ulChunk;
+
+	ulDecNum = 0ul;
+	vTelemDecInit(pDec, vTestSample, NULL);
+	srand(1);
+	while(ulPos < ulStreamLen) {
+		ulChunk = 1ul + (uint32_t)rand() % 40ul;
+		if(ulChunk > ulStreamLen - ulPos) ulChunk = ulStreamLen - ulPos;
+		vTelemDecFeed(pDec, &uStream[ulPos], ulChunk);
+		ulPos += ulChunk;
+	}
+}
+
+/**
+ * @brief  복원기 CRC와 대체 UART CRC가 CRC-16/CCITT-FALSE 확인값과 같은지 검사
+ */
+static void vTestCrc(void){
+	static const uint8_t uCheck[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+	UT_CHECK_EQ(uTelemDecCrc(uCheck, sizeof(uCheck)), 0x29B1);
+	UT_CHECK_EQ(uCrc16(CRC16_INIT, uCheck, sizeof(uCheck)), 0x29B1);
+	UT_CHECK_EQ(sizeof(sTelemFrame), 14);
+}
+
+/**
+ * @brief  고정 형식 프레임 왕복 (임의 크기 조각으로 입력)
+ */
+static void vTestRawRoundTrip(void){
+	sTelemDecoder Dec;
+
+	vTraceInit(1.0f);
+	vInitTelemetry();
+	vTestRun(TELEM_MODE_RAW, TEST_SAMPLE_NUM, vTestTraceSource, NULL);
+	UT_CHECK_EQ(ulStreamLen, TEST_SAMPLE_NUM * sizeof(sTelemFrame));
+	UT_CHECK_EQ(Telem.ulDropCnt, 0);
+
+	vTestDecode(&Dec);
+
+	UT_CHECK_EQ(ulDecNum, TEST_SAMPLE_NUM);
+	UT_CHECK_EQ(ulTestCompare(0ul, TEST_SAMPLE_NUM), 0);
+	UT_CHECK_EQ(Dec.ulCrcErrCnt, 0);
+	UT_CHECK_EQ(Dec.ulLostCnt, 0);
+	UT_CHECK_EQ(Dec.ulSkipBytes, 0);
+}
+
+/**
+ * @brief  손상/누락/잡음 바이트: 손상 프레임만 버리고 순번으로 누락 수를 셉니다.
+ */
+static void vTestRawErrors(void){
+	static const uint8_t uJunk[5] = {0x5Au, 0x00u, 0xA5u, 0x5Au, 0x11u};
+	sTelemDecoder Dec;
+	const uint32_t ulFr = sizeof(sTelemFrame);
+
+	vTraceInit(1.0f);
+	vInitTelemetry();
+	vTestRun(TELEM_MODE_RAW, 64ul, vTestTraceSource, NULL);
+	uStream[10u * ulFr + 6u] ^= 0x04u;              /* 프레임 10: 채널 비트 오류 */
+
+	ulDecNum = 0ul;
+	vTelemDecInit(&Dec, vTestSample, NULL);
+	vTelemDecFeed(&Dec, uStream, 20u * ulFr);
+	vTelemDecFeed(&Dec, uJunk, sizeof(uJunk));      /* 프레임 사이 잡음 */
+	vTelemDecFeed(&Dec, &uStream[21u * ulFr], 43u * ulFr); /* 프레임 20 누락 */
+
+	UT_CHECK_EQ(ulDecNum, 62);
+	UT_CHECK_EQ(Dec.ulCrcErrCnt, 1);
+	UT_CHECK_EQ(Dec.ulLostCnt, 2);
+	UT_CHECK_EQ(ulTestCompare(0ul, 10ul), 0);
+	UT_CHECK_EQ(DecSample[10].uSeq, ExpSample[11].uSeq);
+	UT_CHECK_EQ(DecSample[19].uSeq, ExpSample[21].uSeq);
+	UT_CHECK(memcmp(&DecSample[61], &ExpSample[63], sizeof(sTelemSample)) == 0);
+}
+
+/** @brief 경계값 시험 신호 (채널별 원본 변수, 스케일 1) */
+static float fEdge[TELEM_CH_NUM];
+
+/**
+ * @brief  경계값 신호원: 최대 1차/2차 잔차, 포화, 폭 0, 완만한 기울기
+ * @param  ulK 샘플 번호
+ */
+static void vTestEdgeSource(uint32_t ulK){
+	uint16_t i;
+
+	if(ulK == 0ul) {
+		for(i = 0u; i < TELEM_CH_NUM; i++) {
+			TelemCh[i].pAddr = &fEdge[i];
+			TelemCh[i].uType = DCH_TYPE_FLOAT;
+			TelemCh[i].fScale = 1.0f;
+			TelemCh[i].fOffset = 0.0f;
+		}
+	}
+	fEdge[0] = (ulK & 1ul) ? 32767.0f : -32768.0f;              /* 1차 잔차 ±65535 (17bit) */
+	fEdge[1] = (ulK & 1ul) ? 40000.0f : -40000.0f;              /* 포화 후 2차 잔차 ±131070 (18bit) */
+	fEdge[2] = -1234.0f;                                        /* 잔차 0 (폭 0) */
+	fEdge[3] = (float)((int32_t)(ulK * 7ul) % 65536 - 32768);   /* 기울기 7, 랩어라운드 */
+}
+
+/**
+ * @brief  차분 압축 블록 왕복: 1차/2차 예측 조합과 잡음 크기별로 비트 단위 일치
+ */
+static void vTestDeltaRoundTrip(void){
+	static const uint16_t uMask[3] = {0x00u, 0x07u, 0x0Fu};
+	static const float fNoise[3] = {0.0f, 1.0f, 10.0f};
+	sTelemDecoder Dec;
+	uint16_t m, n;
+
+	for(m = 0u; m < 3u; m++) {
+		for(n = 0u; n < 3u; n++) {
+			vTraceInit(fNoise[n]);
+			vInitTelemetry();
+			Telem.uOrderMask = uMask[m];
+			vTestRun(TELEM_MODE_DELTA, TEST_SAMPLE_NUM, vTestTraceSource, NULL);
+			vTestDecode(&Dec);
+
+			UT_CHECK_EQ(Telem.ulDropCnt, 0);
+			UT_CHECK_EQ(Dec.ulBlockCnt, TEST_SAMPLE_NUM / TELEM_BLOCK_LEN);
+			UT_CHECK_EQ(ulDecNum, TEST_SAMPLE_NUM);
+			UT_CHECK_EQ(ulTestCompare(0ul, TEST_SAMPLE_NUM), 0);
+			UT_CHECK_EQ(Dec.ulCrcErrCnt + Dec.ulLostCnt + Dec.ulSkipBytes, 0);
+			UT_CHECK_EQ(Dec.ulRxBytes, Telem.ulCompBytes);
+		}
+	}
+}
+
+/**
+ * @brief  차분 압축 경계값: 최대 폭 잔차와 포화 샘플도 정확히 복원하고 블록 크기가 상한 이내
+ */
+static void vTestDeltaEdge(void){
+	sTelemDecoder Dec;
+	uint16_t m;
+
+	for(m = 0u; m < 2u; m++) {
+		vInitTelemetry();
+		Telem.uOrderMask = (m == 0u) ? 0x00u : 0x0Fu;
+		vTestRun(TELEM_MODE_DELTA, 256ul, vTestEdgeSource, NULL);
+		vTestDecode(&Dec);
+
+		UT_CHECK_EQ(ulDecNum, 256);
+		UT_CHECK_EQ(ulTestCompare(0ul, 256ul), 0);
+		UT_CHECK_EQ(Dec.ulCrcErrCnt, 0);
+		UT_CHECK(ulStreamLen <= (256ul / TELEM_BLOCK_LEN) * TELEM_DELTA_FRAME_MAX);
+	}
+	UT_CHECK_EQ(ExpSample[1].iCh[1], 32767);
+	UT_CHECK_EQ(ExpSample[2].iCh[1], -32768);
+}
+
+/**
+ * @brief  차분 압축 오류: 손상 블록은 통째로 버리고(16 샘플 누락) 다음 블록부터 정상 복원
+ */
+static void vTestDeltaErrors(void){
+	sTelemDecoder Dec;
+	uint32_t ulBlk0Len;
+
+	vTraceInit(1.0f);
+	vInitTelemetry();
+	vTestRun(TELEM_MODE_DELTA, 4ul * TELEM_BLOCK_LEN, vTestTraceSource, NULL);
+	ulBlk0Len = 8ul + (uStream[6] | ((uint32_t)uStream[7] << 8)) + 2ul;
+	uStream[ulBlk0Len + 12u] ^= 0x10u;              /* 블록 1 페이로드 비트 오류 */
+	vTestDecode(&Dec);
+
+	UT_CHECK(Dec.ulCrcErrCnt >= 1ul);
+	UT_CHECK_EQ(Dec.ulBlockCnt, 3);
+	UT_CHECK_EQ(Dec.ulLostCnt, TELEM_BLOCK_LEN);
+	UT_CHECK_EQ(ulTestCompare(0ul, TELEM_BLOCK_LEN), 0);
+	UT_CHECK(memcmp(&DecSample[TELEM_BLOCK_LEN], &ExpSample[2u * TELEM_BLOCK_LEN], 2u * TELEM_BLOCK_LEN * sizeof(sTelemSample)) == 0);
+}
+
+/**
+ * @brief  압축률: 기본 채널(잡음 포함 합성 파형)에서 고정 형식 대비 3배 이상, 20kHz 링크 사용률 25% 미만
+ */
+static void vTestDeltaRatio(void){
+	double dRatio, dLoad;
+
+	vTraceInit(1.0f);
+	vInitTelemetry();
+	vTestRun(TELEM_MODE_DELTA, TEST_SAMPLE_NUM, vTestTraceSource, NULL);
+
+	dRatio = (double)Telem.ulRawBytes / (double)Telem.ulCompBytes;
+	dLoad = (double)Telem.ulCompBytes / TEST_SAMPLE_NUM * 20000.0 / ((double)UART_BAUD / 10.0);
+	printf("  ratio %.2f, link %.1f%% (raw frame %.1f%%)\n", dRatio, dLoad * 100.0,
+			sizeof(sTelemFrame) * 20000.0 / ((double)UART_BAUD / 10.0) * 100.0);
+	UT_CHECK_EQ(Telem.ulRawBytes, TEST_SAMPLE_NUM * sizeof(sTelemFrame));
+	UT_CHECK(dRatio > 3.0);
+	UT_CHECK(dLoad < 0.25);
+}
+
+/**
+ * @brief  pty 슬레이브에 도착한 바이트를 모두 읽어 복원기에 넣습니다.
+ * @param  iWaitMs 첫 바이트 대기 시간 [ms]
+ */
+static void vTestPtyPoll(int iWaitMs){
+	struct pollfd Pfd = {iPtySlave, POLLIN, 0};
+	uint8_t uRx[512];
+	ssize_t lRd;
+
+	while((poll(&Pfd, 1, iWaitMs) > 0) && ((lRd = read(iPtySlave, uRx, sizeof(uRx))) > 0)) {
+		vTelemDecFeed(&PtyDec, uRx, (size_t)lRd);
+	}
+}
+
+/**
+ * @brief  pty 왕복: 마스터에 쓴 스트림을 슬레이브(직렬 포트와 같은 방법으로 연 장치)에서 읽어 복원
+ * @details pty 버퍼가 넘치지 않도록 샘플마다 슬레이브를 비웁니다.
+ */
+static void vTestPty(void){
+	char cName[64];
+
+	iPtyFd = iPtyOpenMaster(cName, sizeof(cName));
+	if(iPtyFd < 0) {
+		printf("  skip: pty 사용 불가\n");
+		return;
+	}
+	iPtySlave = iSerialOpen(cName, UART_BAUD);
+	UT_CHECK(iPtySlave >= 0);
+
+	if(iPtySlave >= 0) {
+		ulDecNum = 0ul;
+		vTelemDecInit(&PtyDec, vTestSample, NULL);
+		vTraceInit(1.0f);
+		vInitTelemetry();
+		vTestRun(TELEM_MODE_RAW, TEST_SAMPLE_NUM, vTestTraceSource, vTestPtyPoll);
+		while(PtyDec.ulRxBytes < ulStreamLen) {
+			uint32_t ulPrev = PtyDec.ulRxBytes;
+			vTestPtyPoll(100);
+			if(PtyDec.ulRxBytes == ulPrev) break;
+		}
+		close(iPtySlave);
+		iPtySlave = -1;
+
+		UT_CHECK_EQ(PtyDec.ulRxBytes, ulStreamLen);
+		UT_CHECK_EQ(ulDecNum, TEST_SAMPLE_NUM);
+		UT_CHECK_EQ(ulTestCompare(0ul, TEST_SAMPLE_NUM), 0);
+		UT_CHECK_EQ(PtyDec.ulCrcErrCnt + PtyDec.ulLostCnt, 0);
+	}
+	close(iPtyFd);
+	iPtyFd = -1;
+}
+
+int main(void){
+	UT_RUN(vTestCrc);
+	UT_RUN(vTestRawRoundTrip);
+	UT_RUN(vTestRawErrors);
+	UT_RUN(vTestDeltaRoundTrip);
+	UT_RUN(vTestDeltaEdge);
+	UT_RUN(vTestDeltaErrors);
+	UT_RUN(vTestDeltaRatio);
+	UT_RUN(vTestPty);
+	return UT_RESULT();
+}